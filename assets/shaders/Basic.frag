@@ -16,6 +16,15 @@ uniform sampler2D u_DirectionalShadowMap;
 uniform mat4 u_LightViewProj;
 uniform int u_HasDirectionalShadow;  // 1 if shadow map is valid, 0 otherwise
 
+// Image based lighting (baked on the CPU by IBLBaker)
+uniform int u_HasSkyLight;           // 1 if IBL data is uploaded, 0 otherwise
+uniform float u_SkyLightIntensity;
+uniform int u_UseDiffuseIBL;
+uniform int u_UseSpecularIBL;
+uniform vec3 u_IrradianceSH[9];      // L2 SH, already cosine-convolved
+uniform samplerCube u_PrefilteredEnv;
+uniform float u_PrefilteredMaxLod;   // roughness 1.0 maps to this mip
+
 // Light data structure (matches C++ LightDataGPU)
 struct LightDataGPU {
     vec4 Position;      // w can be 1.0 for point, 0 for directional
@@ -68,6 +77,46 @@ float ComputeShadow(vec3 worldPos) {
     return shadow;
 }
 
+// Irradiance from L2 spherical harmonics (basis matches IBLBaker)
+vec3 EvaluateSH9(vec3 n) {
+    vec3 result = u_IrradianceSH[0] * 0.282095
+                + u_IrradianceSH[1] * (0.488603 * n.y)
+                + u_IrradianceSH[2] * (0.488603 * n.z)
+                + u_IrradianceSH[3] * (0.488603 * n.x)
+                + u_IrradianceSH[4] * (1.092548 * n.x * n.y)
+                + u_IrradianceSH[5] * (1.092548 * n.y * n.z)
+                + u_IrradianceSH[6] * (0.315392 * (3.0 * n.z * n.z - 1.0))
+                + u_IrradianceSH[7] * (1.092548 * n.x * n.z)
+                + u_IrradianceSH[8] * (0.546274 * (n.x * n.x - n.y * n.y));
+    return max(result, vec3(0.0));
+}
+
+// Ambient term from the sky light, falls back to a flat ambient
+vec3 ComputeAmbient(vec3 worldPos, vec3 normal, vec3 albedo, float roughness, float metallic) {
+    if (u_HasSkyLight == 0) {
+        return vec3(0.03) * albedo;
+    }
+    
+    vec3 N = normalize(normal);
+    vec3 V = normalize(u_ViewPos - worldPos);
+    vec3 ambient = vec3(0.0);
+    
+    if (u_UseDiffuseIBL != 0) {
+        ambient += EvaluateSH9(N) * albedo / 3.14159 * (1.0 - metallic);
+    }
+    
+    if (u_UseSpecularIBL != 0) {
+        vec3 R = reflect(-V, N);
+        vec3 prefiltered = textureLod(u_PrefilteredEnv, R, roughness * u_PrefilteredMaxLod).rgb;
+        vec3 F0 = mix(vec3(0.04), albedo, metallic);
+        float NdotV = max(dot(N, V), 0.0);
+        vec3 fresnel = F0 + (max(vec3(1.0 - roughness), F0) - F0) * pow(1.0 - NdotV, 5.0);
+        ambient += prefiltered * fresnel;
+    }
+    
+    return ambient * u_SkyLightIntensity;
+}
+
 // PBR lighting calculation
 vec3 ApplyLight(LightDataGPU light, vec3 worldPos, vec3 normal, vec3 albedo, float roughness, float metallic) {
     vec3 N = normalize(normal);
@@ -156,7 +205,7 @@ void main()
     }
     
     // Add ambient
-    vec3 ambient = vec3(0.03) * albedo;
+    vec3 ambient = ComputeAmbient(worldPos, normal, albedo, roughness, metallic);
     lighting += ambient;
     
     // Combine lighting with albedo
@@ -6,6 +6,9 @@ out vec4 FragColor;
 uniform sampler2D u_SkyboxTexture;
 uniform int u_UseTexture;
 uniform float u_CloudOffset;
+uniform int u_UseAtmosphere;
+uniform sampler2D u_SkyViewLUT;
+uniform vec3 u_SunDirection;
 
 // Convert 3D direction to equirectangular UV coordinates
 vec2 DirectionToUV(vec3 dir) {
@@ -14,6 +17,20 @@ vec2 DirectionToUV(vec3 dir) {
     return vec2(u, v);
 }
 
+// Sky-view LUT mapping, must match SkyAtmosphere::SampleSkyView:
+// u = azimuth relative to the sun / PI, v packs latitude with sqrt toward the horizon
+vec2 DirectionToSkyViewUV(vec3 dir) {
+    float cosAzimuth = 1.0;
+    if (length(dir.xz) > 1e-5 && length(u_SunDirection.xz) > 1e-5) {
+        cosAzimuth = dot(normalize(dir.xz), normalize(u_SunDirection.xz));
+    }
+    float u = acos(clamp(cosAzimuth, -1.0, 1.0)) / 3.14159265359;
+    float latitude = asin(clamp(dir.y, -1.0, 1.0));
+    float t = sqrt(abs(latitude) / (0.5 * 3.14159265359));
+    float v = latitude >= 0.0 ? 0.5 - 0.5 * t : 0.5 + 0.5 * t;
+    return vec2(u, v);
+}
+
 void main()
 {
     if (u_UseTexture == 1) {
@@ -42,6 +59,9 @@ void main()
         saturated = min(saturated, vec3(1.0));
         
         FragColor = vec4(saturated, 1.0);
+    } else if (u_UseAtmosphere == 1) {
+        // Precomputed atmosphere: scene-referred radiance, tone mapped with the scene
+        FragColor = vec4(texture(u_SkyViewLUT, DirectionToSkyViewUV(normalize(v_TexCoord))).rgb, 1.0);
     } else {
         // Fallback gradient (simple blue sky)
         float t = (v_TexCoord.y + 1.0) * 0.5; // Normalize y from [-1,1] to [0,1]
@@ -0,0 +1,309 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Asset delete benchmark: builds a project of textures and the materials that
+// use them (files, .meta files, registry, dependency graph, reference index
+// and GUID registry), then times deleting every asset the old way, one GUID at
+// a time, against one AssetDeleter batch. Also checks a trash/restore/purge
+// round trip, that a batch with a blocked file move is rolled back whole, and
+// that RecoverJournal undoes a prepared batch and replays a committed one.
+// Usage: LGE_AssetDeleteBenchmark [assets]
+
+#include "LGE/core/assets/AssetDeleter.h"
+#include "LGE/core/assets/AssetReferenceIndex.h"
+#include "LGE/core/assets/AssetRegistry.h"
+#include "LGE/core/assets/DependencyGraph.h"
+#include "LGE/core/filesystem/VirtualFileSystem.h"
+#include "LGE/core/GUIDRegistry.h"
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Half textures, half materials using two textures each; every other asset has a .meta file
+struct Project {
+    VirtualFileSystem vfs;
+    AssetRegistry registry;
+    DependencyGraph graph{ &registry };
+    AssetReferenceIndex index;
+    GUIDRegistry guids;
+    std::vector<GUID> textures;
+    std::vector<GUID> materials;
+    std::vector<GUID> all;
+    
+    Project(const std::filesystem::path& root, int assetCount) {
+        std::filesystem::remove_all(root);
+        vfs.Initialize(root);
+        for (int i = 0; i < assetCount; ++i) {
+            bool isTexture = i % 2 == 0;
+            AssetMetadata metadata;
+            metadata.guid = GUID::Generate();
+            metadata.type = isTexture ? AssetType::Texture : AssetType::Material;
+            metadata.virtualPath = std::string(isTexture ? "/Assets/Textures/Set" : "/Assets/Materials/Set") +
+                std::to_string(i % 20) + "/A" + std::to_string(i) + (isTexture ? ".png" : ".lmat");
+            metadata.name = "A" + std::to_string(i);
+            metadata.tags = { isTexture ? "texture" : "material" };
+            if (!isTexture) {
+                metadata.dependencies = { textures[(i * 7) % textures.size()], textures[(i * 13 + 1) % textures.size()] };
+            }
+            
+            std::filesystem::path file = vfs.ResolveVirtualPath(metadata.virtualPath);
+            std::filesystem::create_directories(file.parent_path());
+            std::ofstream(file, std::ios::binary) << metadata.name;
+            if (i % 4 < 2) {
+                std::ofstream(file.string() + ".meta", std::ios::binary) << metadata.guid.ToString();
+            }
+            
+            registry.RegisterAsset(metadata);
+            guids.RegisterAsset(metadata.guid, metadata.virtualPath);
+            std::vector<AssetPropertyReference> references;
+            for (const auto& dependency : metadata.dependencies) {
+                graph.AddDependency(metadata.guid, dependency);
+                references.push_back({ dependency, "textures.albedo" });
+            }
+            index.SetReferences(metadata.guid, references);
+            (isTexture ? textures : materials).push_back(metadata.guid);
+            all.push_back(metadata.guid);
+        }
+    }
+    
+    std::filesystem::path FileOf(const GUID& asset) {
+        const AssetMetadata* metadata = registry.GetAsset(asset);
+        return metadata ? vfs.ResolveVirtualPath(metadata->virtualPath) : std::filesystem::path();
+    }
+};
+
+size_t CountFiles(const std::filesystem::path& folder) {
+    size_t count = 0;
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(folder, ec); it != std::filesystem::recursive_directory_iterator(); ++it) {
+        count += it->is_regular_file() ? 1 : 0;
+    }
+    return count;
+}
+
+// What AssetDeleter did per GUID before batches: break references, delete
+// the files, then update each index for this one asset
+void DeleteOneByOne(Project& project, const std::vector<GUID>& assets) {
+    for (const auto& asset : assets) {
+        for (const auto& dependent : project.graph.GetDependents(asset)) {
+            project.graph.RemoveDependency(dependent, asset);
+            project.index.RemoveReference(dependent, asset);
+            AssetMetadata* metadata = project.registry.GetAsset(dependent);
+            if (metadata) {
+                metadata->dependencies.erase(std::remove(metadata->dependencies.begin(), metadata->dependencies.end(), asset),
+                                             metadata->dependencies.end());
+                project.registry.UpdateAsset(dependent, *metadata);
+            }
+        }
+        
+        std::filesystem::path file = project.FileOf(asset);
+        if (std::filesystem::exists(file)) {
+            std::filesystem::remove(file);
+            std::filesystem::path metaPath = file.string() + ".meta";
+            if (std::filesystem::exists(metaPath)) {
+                std::filesystem::remove(metaPath);
+            }
+        }
+        
+        project.registry.UnregisterAsset(asset);
+        project.graph.RemoveDependencies(asset);
+        project.index.RemoveAsset(asset);
+        project.guids.RemoveAsset(asset);
+    }
+}
+
+// Journal as AssetDeleter writes it, for a delete batch whose files were
+// already moved to the staging folder when the process died
+void WriteInterruptedJournal(const std::filesystem::path& trash, uint8_t state, const std::vector<std::pair<GUID, std::string>>& staged) {
+    std::filesystem::create_directories(trash / ".staged");
+    std::ofstream out(trash / "deletion_journal.bin", std::ios::binary);
+    auto put = [&](const auto& value) { out.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+    auto putString = [&](const std::string& value) {
+        put(static_cast<uint32_t>(value.size()));
+        out.write(value.data(), static_cast<std::streamsize>(value.size()));
+    };
+    out.write("LGEDJN01", 8);
+    put(state);
+    put(static_cast<uint8_t>(1));   // Delete
+    put(static_cast<uint8_t>(0));
+    put(static_cast<uint32_t>(staged.size()));
+    for (const auto& [asset, source] : staged) {
+        std::string destination = (trash / ".staged" / (asset.ToString() + ".png")).string();
+        std::filesystem::rename(source, destination);
+        put(asset.GetHigh());
+        put(asset.GetLow());
+        put(static_cast<uint8_t>(1));
+        put(static_cast<uint8_t>(0));
+        putString(source);
+        putString(destination);
+        putString(std::string());
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int assetCount = argc > 1 ? std::max(100, std::atoi(argv[1])) : 10000;
+    bool ok = true;
+    Log::SetConsoleOutput(false);
+    JobSystem::Initialize();
+    
+    std::filesystem::path root = std::filesystem::temp_directory_path() / "lge_asset_delete";
+    std::filesystem::path assetsRoot = root / "Project";
+    std::filesystem::path trash = root / "Trash";
+    
+    double oneByOneMs = 0.0;
+    {
+        Project project(assetsRoot, assetCount);
+        size_t files = CountFiles(assetsRoot);
+        Clock::time_point start = Clock::now();
+        DeleteOneByOne(project, project.all);
+        oneByOneMs = MillisecondsSince(start);
+        ok &= Expect(project.registry.GetAssetCount() == 0, "one-by-one delete left assets registered");
+        std::printf("assets=%d files=%zu workers=%u\n", assetCount, files, JobSystem::GetWorkerCount());
+        std::printf("one GUID at a time:        %9.2f ms\n", oneByOneMs);
+    }
+    
+    {
+        Project project(assetsRoot, assetCount);
+        std::filesystem::remove_all(trash);
+        AssetDeleter deleter(&project.registry, &project.graph, &project.vfs, &project.index);
+        deleter.SetTrashPath(trash);
+        deleter.SetGUIDRegistry(&project.guids);
+        
+        Clock::time_point start = Clock::now();
+        AssetDeleter::DeletionResult result = deleter.DeleteAssets(project.all, AssetDeleter::DeletionMode::BreakReferences);
+        double batchMs = MillisecondsSince(start);
+        std::printf("one journaled batch:       %9.2f ms (%.1fx)\n", batchMs, oneByOneMs / batchMs);
+        
+        ok &= Expect(result.success && result.deletedAssets.size() == project.all.size(), "batch delete failed");
+        ok &= Expect(project.registry.GetAssetCount() == 0 && project.guids.GetAssetCount() == 0, "batch delete left assets registered");
+        ok &= Expect(project.graph.GetDependencyCount() == 0 && project.index.GetEdgeCount() == 0, "batch delete left graph edges");
+        ok &= Expect(!project.registry.HasSubdirectories("/Assets"), "batch delete left registry folders");
+        ok &= Expect(CountFiles(assetsRoot) == 0 && CountFiles(trash) == 0, "batch delete left files behind");
+    }
+    
+    {
+        // Trash the materials, bring them back, trash them again and purge
+        Project project(assetsRoot, assetCount);
+        std::filesystem::remove_all(trash);
+        AssetDeleter deleter(&project.registry, &project.graph, &project.vfs, &project.index);
+        deleter.SetTrashPath(trash);
+        deleter.SetGUIDRegistry(&project.guids);
+        std::filesystem::path firstMaterial = project.FileOf(project.materials.front());
+        
+        Clock::time_point start = Clock::now();
+        bool trashed = deleter.MoveToTrash(project.materials);
+        double trashMs = MillisecondsSince(start);
+        ok &= Expect(trashed && project.registry.GetAssetCount() == project.textures.size(), "trash did not unregister the materials");
+        ok &= Expect(!project.index.IsReferenced(project.textures.front()), "trash left references to textures");
+        
+        AssetDeleter reopened(&project.registry, &project.graph, &project.vfs, &project.index);
+        reopened.SetTrashPath(trash);
+        reopened.SetGUIDRegistry(&project.guids);
+        ok &= Expect(reopened.GetTrashedAssets().size() == project.materials.size(), "trash manifest did not persist");
+        
+        start = Clock::now();
+        bool restored = reopened.RestoreFromTrash(project.materials);
+        double restoreMs = MillisecondsSince(start);
+        ok &= Expect(restored && project.registry.GetAssetCount() == project.all.size(), "restore did not register the materials");
+        ok &= Expect(std::filesystem::exists(firstMaterial) && project.guids.GetGUIDFromPath(project.registry.GetAsset(project.materials.front())->virtualPath) == project.materials.front(),
+                     "restore did not bring back the file and its GUID");
+        ok &= Expect(project.graph.GetDependencies(project.materials.back()).size() == 2, "restore did not bring back dependencies");
+        ok &= Expect(reopened.GetTrashedAssets().empty(), "restore left trash entries");
+        
+        ok &= Expect(reopened.MoveToTrash(project.materials) && reopened.PermanentlyDelete(project.materials), "purge failed");
+        ok &= Expect(reopened.GetTrashedAssets().empty() && CountFiles(trash) == 1, "purge left files in the trash");   // The manifest
+        std::printf("trash / restore materials: %9.2f / %.2f ms\n", trashMs, restoreMs);
+    }
+    
+    {
+        // A file that cannot be moved fails the whole batch, and nothing changes
+        Project project(assetsRoot, assetCount);
+        std::filesystem::remove_all(trash);
+        AssetDeleter deleter(&project.registry, &project.graph, &project.vfs, &project.index);
+        deleter.SetTrashPath(trash);
+        size_t files = CountFiles(assetsRoot);
+        GUID blocked = project.textures[project.textures.size() / 2];
+        std::filesystem::create_directories(trash / ".staged" / (blocked.ToString() + ".png") / "occupied");
+        
+        AssetDeleter::DeletionResult result = deleter.DeleteAssets(project.textures, AssetDeleter::DeletionMode::BreakReferences);
+        ok &= Expect(!result.success && result.deletedAssets.empty(), "blocked batch reported success");
+        ok &= Expect(CountFiles(assetsRoot) == files, "blocked batch was not rolled back");
+        ok &= Expect(project.registry.GetAssetCount() == project.all.size() && project.index.GetReferenceCount(project.textures.front()) > 0,
+                     "blocked batch changed the indices");
+        ok &= Expect(!std::filesystem::exists(trash / "deletion_journal.bin"), "blocked batch left its journal");
+    }
+    
+    {
+        // Crash before the commit: the files come back. Crash after: the batch is finished.
+        Project project(assetsRoot, assetCount);
+        std::filesystem::remove_all(trash);
+        AssetDeleter deleter(&project.registry, &project.graph, &project.vfs, &project.index);
+        deleter.SetTrashPath(trash);
+        size_t files = CountFiles(assetsRoot);
+        std::vector<std::pair<GUID, std::string>> staged;
+        for (size_t i = 0; i < 100; ++i) {
+            staged.push_back({ project.textures[i], project.FileOf(project.textures[i]).string() });
+        }
+        
+        WriteInterruptedJournal(trash, 1, staged);
+        ok &= Expect(deleter.RecoverJournal() && CountFiles(assetsRoot) == files, "prepared journal was not rolled back");
+        ok &= Expect(project.registry.GetAssetCount() == project.all.size(), "rollback changed the registry");
+        
+        WriteInterruptedJournal(trash, 2, staged);
+        ok &= Expect(deleter.RecoverJournal() && CountFiles(trash) == 0, "committed journal was not replayed");
+        ok &= Expect(project.registry.GetAssetCount() == project.all.size() - staged.size() && !project.graph.GetDependents(project.textures.front()).size(),
+                     "replay did not update the indices");
+    }
+    
+    std::filesystem::remove_all(root);
+    JobSystem::Shutdown();
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,209 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Asset directory index benchmark: registers a synthetic project spread over
+// nested folders and times listing every folder through the directory index
+// against filtering the whole registry per folder. Then renames and removes
+// assets and checks that folders appear where assets land and are pruned
+// once the last asset leaves them.
+// Usage: LGE_AssetDirectoryIndexBenchmark [assets]
+
+#include "LGE/core/assets/AssetRegistry.h"
+#include "LGE/core/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kAreas = 32;
+constexpr int kSubfolders = 32;
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::string FolderPath(int area, int subfolder) {
+    return "/Assets/Area" + std::to_string(area) + "/Sub" + std::to_string(subfolder);
+}
+
+AssetMetadata MakeAsset(const std::string& folder, size_t index) {
+    AssetMetadata metadata;
+    metadata.guid = GUID::Generate();
+    metadata.type = AssetType::Material;
+    metadata.name = "Material" + std::to_string(index);
+    metadata.virtualPath = folder + "/" + metadata.name + ".lmat";
+    return metadata;
+}
+
+bool Lists(const AssetRegistry& registry, const std::string& folder, const GUID& guid) {
+    auto assets = registry.GetAssetsInDirectory(folder);
+    return std::any_of(assets.begin(), assets.end(), [&](const AssetMetadata* asset) { return asset->guid == guid; });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t assetCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    Log::SetConsoleOutput(false);
+    
+    AssetRegistry registry;
+    std::vector<std::vector<GUID>> folders(kAreas * kSubfolders);
+    for (size_t i = 0; i < assetCount; ++i) {
+        size_t folder = i % folders.size();
+        AssetMetadata metadata = MakeAsset(FolderPath(static_cast<int>(folder / kSubfolders), static_cast<int>(folder % kSubfolders)), i);
+        folders[folder].push_back(metadata.guid);
+        registry.RegisterAsset(metadata);
+    }
+    
+    // List every folder through the index; filtering all assets per folder is
+    // slow enough that one area is sampled for it
+    auto start = Clock::now();
+    size_t indexed = 0;
+    for (int area = 0; area < kAreas; ++area) {
+        for (int subfolder = 0; subfolder < kSubfolders; ++subfolder) {
+            indexed += registry.GetAssetsInDirectory(FolderPath(area, subfolder)).size();
+        }
+    }
+    double indexMs = MillisecondsSince(start);
+    
+    start = Clock::now();
+    size_t filtered = 0;
+    for (int subfolder = 0; subfolder < kSubfolders; ++subfolder) {
+        std::string prefix = FolderPath(0, subfolder) + "/";
+        registry.ForEachAsset([&](const AssetMetadata& metadata) {
+            if (metadata.virtualPath.compare(0, prefix.size(), prefix) == 0 &&
+                metadata.virtualPath.find('/', prefix.size()) == std::string::npos) {
+                ++filtered;
+            }
+        });
+    }
+    double filterMs = MillisecondsSince(start);
+    size_t sampled = 0;
+    for (int subfolder = 0; subfolder < kSubfolders; ++subfolder) {
+        sampled += folders[subfolder].size();
+    }
+    
+    double indexPerFolder = indexMs / folders.size();
+    double filterPerFolder = filterMs / kSubfolders;
+    
+    std::printf("assets=%zu folders=%zu\n", assetCount, folders.size());
+    std::printf("list one folder: index %.4f ms, filter %.4f ms (%.1fx)\n",
+                indexPerFolder, filterPerFolder, indexPerFolder > 0.0 ? filterPerFolder / indexPerFolder : 0.0);
+    
+    bool ok = true;
+    ok &= Expect(indexed == assetCount, "every asset listed exactly once");
+    ok &= Expect(filtered == sampled, "index and filter agree on the sampled area");
+    
+    // FindDirectory after add: every ancestor exists, separators are tolerated
+    ok &= Expect(registry.HasDirectory("/Assets") && registry.HasDirectory("/Assets/Area3"), "ancestors of added assets exist");
+    ok &= Expect(registry.HasDirectory("/Assets/Area3/Sub7/") && registry.HasDirectory("\\Assets\\Area3\\Sub7"), "trailing and back slashes find the folder");
+    ok &= Expect(!registry.HasDirectory("/Assets/Area3/Missing"), "unknown folder is not found");
+    ok &= Expect(registry.GetSubdirectories("/Assets").size() == static_cast<size_t>(kAreas), "top level lists every area");
+    ok &= Expect(registry.GetAssetsInDirectory("/Assets/Area3").empty(), "assets are listed only in their own folder");
+    
+    // FindDirectory after rename: the asset moves to a freshly created folder
+    const std::string oldFolder = FolderPath(1, 2);
+    const std::string newFolder = "/Assets/Renamed/Deep";
+    GUID moved = folders[1 * kSubfolders + 2].front();
+    AssetMetadata renamed = *registry.GetAsset(moved);
+    renamed.virtualPath = newFolder + "/" + renamed.name + ".lmat";
+    registry.UpdateAsset(moved, renamed);
+    ok &= Expect(registry.HasDirectory(newFolder) && Lists(registry, newFolder, moved), "renamed asset is listed in its new folder");
+    ok &= Expect(!Lists(registry, oldFolder, moved), "renamed asset left its old folder");
+    ok &= Expect(registry.GetAssetsInDirectory(oldFolder).size() == folders[1 * kSubfolders + 2].size() - 1, "old folder keeps its other assets");
+    
+    // Renaming back empties the new folder, which is pruned with its empty parent
+    renamed.virtualPath = oldFolder + "/" + renamed.name + ".lmat";
+    registry.UpdateAsset(moved, renamed);
+    ok &= Expect(Lists(registry, oldFolder, moved), "asset renamed back is listed again");
+    ok &= Expect(!registry.HasDirectory(newFolder) && !registry.HasDirectory("/Assets/Renamed"), "renamed-away folders are pruned");
+
+    // In-place move, as the Content Browser and hot reloader do it: the stored
+    // metadata already holds the new path when UpdateAsset sees it
+    const std::string lastFolder = FolderPath(2, 4);
+    const std::string movedPath = lastFolder + "/Moved.lmat";
+    AssetMetadata* inPlace = registry.GetAsset(moved);
+    const std::string oldPath = inPlace->virtualPath;
+    inPlace->virtualPath = movedPath;
+    registry.UpdateAsset(moved, *inPlace);
+    const AssetMetadata* byNewPath = registry.GetAssetByPath(movedPath);
+    ok &= Expect(byNewPath && byNewPath->guid == moved, "in-place move is found by its new path");
+    ok &= Expect(!registry.GetAssetByPath(oldPath), "in-place move is gone from its old path");
+    ok &= Expect(Lists(registry, lastFolder, moved) && !Lists(registry, oldFolder, moved), "in-place move changes folders");
+
+    // Moving the last asset out of a folder in place prunes it
+    const std::string emptiedFolder = "/Assets/Scratch";
+    inPlace->virtualPath = emptiedFolder + "/Moved.lmat";
+    registry.UpdateAsset(moved, *inPlace);
+    ok &= Expect(Lists(registry, emptiedFolder, moved), "in-place move creates the new folder");
+    inPlace->virtualPath = oldPath;
+    registry.UpdateAsset(moved, *inPlace);
+    ok &= Expect(!registry.HasDirectory(emptiedFolder) && Lists(registry, oldFolder, moved), "in-place move out prunes the emptied folder");
+
+    // PruneDirectory after remove: the last asset out takes the folder with it
+    const std::string removedFolder = FolderPath(5, 0);
+    const auto& removedAssets = folders[5 * kSubfolders + 0];
+    for (size_t i = 0; i < removedAssets.size(); ++i) {
+        registry.UnregisterAsset(removedAssets[i]);
+        if (i + 1 < removedAssets.size() && !registry.HasDirectory(removedFolder)) {
+            ok &= Expect(false, "folder kept while it still holds assets");
+            break;
+        }
+    }
+    ok &= Expect(!registry.HasDirectory(removedFolder), "emptied folder is pruned");
+    ok &= Expect(registry.HasDirectory("/Assets/Area5") && registry.GetSubdirectories("/Assets/Area5").size() == kSubfolders - 1u, "non-empty parent keeps its other folders");
+    
+    // Bulk removal of a whole area prunes every folder and the area itself
+    std::vector<GUID> area;
+    for (int subfolder = 0; subfolder < kSubfolders; ++subfolder) {
+        const auto& assets = folders[6 * kSubfolders + subfolder];
+        area.insert(area.end(), assets.begin(), assets.end());
+    }
+    ok &= Expect(registry.UnregisterAssets(area) == area.size(), "bulk removal removes every asset");
+    ok &= Expect(!registry.HasDirectory("/Assets/Area6") && !registry.HasDirectory(FolderPath(6, 1)), "bulk-emptied area is pruned");
+    ok &= Expect(registry.GetSubdirectories("/Assets").size() == kAreas - 1u, "top level drops the pruned area");
+    
+    // Pruned slots are reused when assets land in the folder again
+    AssetMetadata readded = MakeAsset(FolderPath(6, 1), assetCount);
+    registry.RegisterAsset(readded);
+    ok &= Expect(registry.HasDirectory(FolderPath(6, 1)) && Lists(registry, FolderPath(6, 1), readded.guid), "pruned folder is recreated on add");
+    ok &= Expect(registry.GetSubdirectories("/Assets/Area6").size() == 1, "recreated area holds only the new folder");
+    
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
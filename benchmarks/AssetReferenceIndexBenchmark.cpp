@@ -0,0 +1,235 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Reverse-reference index benchmark: builds a registry of textures, shaders,
+// materials and scenes, then asks whether a 500-asset selection can be deleted
+// three ways - the registry's per-asset scan over every dependency list, the
+// validator's per-asset graph lookups, and one batch query on the index. Also
+// checks property paths, that rescans keep the index equal to a fresh build,
+// and a save/load round trip.
+// Usage: LGE_AssetReferenceIndexBenchmark [assets] [selection]
+
+#include "LGE/core/assets/AssetReferenceIndex.h"
+#include "LGE/core/assets/AssetDeletionValidator.h"
+#include "LGE/core/assets/AssetRegistry.h"
+#include "LGE/core/assets/DependencyGraph.h"
+#include "LGE/core/assets/DependencyScanner.h"
+#include "LGE/core/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// (referencer, property) pairs for every target, as strings so two indices compare
+std::vector<std::set<std::pair<GUID, std::string>>> Snapshot(const AssetReferenceIndex& index, const std::vector<GUID>& guids) {
+    std::vector<std::set<std::pair<GUID, std::string>>> snapshot(guids.size());
+    std::vector<AssetReferenceIndex::Reference> references;
+    for (size_t i = 0; i < guids.size(); ++i) {
+        references.clear();
+        index.GetReferences(guids[i], references);
+        for (const auto& reference : references) {
+            snapshot[i].emplace(reference.asset, std::string(PathTable::Get().GetString(reference.property)));
+        }
+    }
+    return snapshot;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int assetCount = argc > 1 ? std::max(1000, std::atoi(argv[1])) : 50000;
+    int selectionCount = argc > 2 ? std::max(1, std::atoi(argv[2])) : 500;
+    bool ok = true;
+    Log::SetConsoleOutput(false);
+    
+    // 60% textures, 2% shaders, 30% materials naming two textures and a shader
+    // in their settings, 8% scenes listing twenty materials or textures
+    AssetRegistry registry;
+    DependencyGraph graph(&registry);
+    std::mt19937 rng(4321);
+    std::vector<GUID> guids(static_cast<size_t>(assetCount));
+    std::vector<GUID> textures, shaders, materials;
+    for (int i = 0; i < assetCount; ++i) {
+        AssetMetadata metadata;
+        metadata.guid = guids[i] = GUID::Generate();
+        metadata.name = "Asset" + std::to_string(i);
+        int bucket = i % 50;
+        if (bucket < 30) {
+            metadata.type = AssetType::Texture;
+            textures.push_back(metadata.guid);
+        } else if (bucket < 31) {
+            metadata.type = AssetType::Shader;
+            shaders.push_back(metadata.guid);
+        } else if (bucket < 46) {
+            metadata.type = AssetType::Material;
+            auto pick = [&](const std::vector<GUID>& from) {
+                return from[std::uniform_int_distribution<size_t>(0, from.size() - 1)(rng)];
+            };
+            metadata.importSettings = "{\"diffuseTexture\": \"" + pick(textures).ToString() +
+                "\", \"normalTexture\": \"" + pick(textures).ToString() +
+                "\", \"shader\": \"" + (shaders.empty() ? GUID() : pick(shaders)).ToString() + "\"}";
+            materials.push_back(metadata.guid);
+        } else {
+            metadata.type = AssetType::Scene;
+            for (int d = 0; d < 20; ++d) {
+                const std::vector<GUID>& from = d % 2 ? textures : materials;
+                metadata.dependencies.push_back(from[std::uniform_int_distribution<size_t>(0, from.size() - 1)(rng)]);
+            }
+        }
+        metadata.virtualPath = "/Assets/Folder" + std::to_string(i % 64) + "/" + metadata.name;
+        registry.RegisterAsset(metadata);
+    }
+    
+    // Graph and metadata the way a full dependency scan leaves them
+    DependencyScanner plainScanner(&registry, &graph);
+    for (const GUID& guid : guids) {
+        std::vector<GUID> dependencies = plainScanner.ScanAsset(guid);
+        for (const GUID& dependency : dependencies) {
+            graph.AddDependency(guid, dependency);
+        }
+        AssetMetadata metadata = *registry.GetAsset(guid);
+        metadata.dependencies = dependencies;
+        registry.UpdateAsset(guid, metadata);
+    }
+    
+    AssetReferenceIndex index;
+    Clock::time_point start = Clock::now();
+    plainScanner.IndexAll(index);
+    double buildMs = MillisecondsSince(start);
+    std::printf("assets=%d edges=%zu selection=%d\n", assetCount, index.GetEdgeCount(), selectionCount);
+    std::printf("index build:                           %9.2f ms\n", buildMs);
+    ok &= Expect(index.GetIndexedCount() == static_cast<size_t>(assetCount), "every asset indexed");
+    
+    // A Content Browser style selection: a run of consecutive assets, so some
+    // referencers sit inside it
+    std::vector<GUID> selection(guids.begin() + assetCount / 3, guids.begin() + assetCount / 3 + std::min(selectionCount, assetCount / 3));
+    std::unordered_set<GUID> selected(selection.begin(), selection.end());
+    
+    start = Clock::now();
+    std::set<GUID> legacyBlockers;
+    for (const GUID& asset : selection) {
+        for (const GUID& dependent : registry.GetDependents(asset)) {
+            if (!selected.count(dependent)) {
+                legacyBlockers.insert(dependent);
+            }
+        }
+    }
+    double legacyMs = MillisecondsSince(start);
+    
+    AssetDeletionValidator graphValidator(&graph, &registry);
+    start = Clock::now();
+    std::vector<AssetDeletionValidator::DeletionInfo> graphInfo = graphValidator.ValidateDeletion(selection);
+    double graphMs = MillisecondsSince(start);
+    
+    AssetDeletionValidator indexValidator(&graph, &registry, &index);
+    std::vector<AssetDeletionValidator::DeletionInfo> indexInfo;
+    double indexMs = 1e30;
+    for (int run = 0; run < 5; ++run) {
+        start = Clock::now();
+        indexInfo = indexValidator.ValidateDeletion(selection);
+        indexMs = std::min(indexMs, MillisecondsSince(start));
+    }
+    
+    std::set<GUID> indexBlockers;
+    bool graphAgrees = true;
+    for (size_t i = 0; i < selection.size(); ++i) {
+        indexBlockers.insert(indexInfo[i].blockingDependents.begin(), indexInfo[i].blockingDependents.end());
+        std::set<GUID> outside;
+        for (const GUID& dependent : graphInfo[i].blockingDependents) {
+            if (!selected.count(dependent)) {
+                outside.insert(dependent);
+            }
+        }
+        graphAgrees &= outside == std::set<GUID>(indexInfo[i].blockingDependents.begin(), indexInfo[i].blockingDependents.end());
+    }
+    std::printf("registry scan per asset:               %9.2f ms (%zu blockers)\n", legacyMs, legacyBlockers.size());
+    std::printf("validator, graph per asset:            %9.3f ms\n", graphMs);
+    std::printf("validator, one batch query:            %9.3f ms (%.0fx vs registry scan)\n", indexMs, legacyMs / indexMs);
+    ok &= Expect(!legacyBlockers.empty(), "selection has outside referencers");
+    ok &= Expect(indexBlockers == legacyBlockers, "batch query finds the same blockers as the registry scan");
+    ok &= Expect(graphAgrees, "per-asset blockers match the graph outside the selection");
+    
+    // Property paths come from the material settings
+    std::vector<AssetReferenceIndex::Reference> references;
+    index.GetReferencesFrom(materials.front(), references);
+    bool hasDiffuse = std::any_of(references.begin(), references.end(), [](const AssetReferenceIndex::Reference& reference) {
+        return PathTable::Get().GetString(reference.property) == "diffuseTexture";
+    });
+    ok &= Expect(hasDiffuse, "material references carry their property");
+    
+    // Rescans through a scanner that owns the index keep it equal to a fresh build
+    DependencyScanner scanner(&registry, &graph, &index);
+    for (int i = 0; i < 200; ++i) {
+        const GUID& material = materials[static_cast<size_t>(i) * 7 % materials.size()];
+        AssetMetadata metadata = *registry.GetAsset(material);
+        metadata.importSettings = "{\"albedoTexture\": \"" + textures[static_cast<size_t>(i)].ToString() + "\"}";
+        metadata.dependencies.clear();
+        registry.UpdateAsset(material, metadata);
+        scanner.RescanAsset(material);
+    }
+    AssetReferenceIndex rebuilt;
+    plainScanner.IndexAll(rebuilt);
+    auto expected = Snapshot(rebuilt, guids);
+    ok &= Expect(Snapshot(index, guids) == expected, "rescanned index matches a fresh build");
+    ok &= Expect(index.GetEdgeCount() == rebuilt.GetEdgeCount(), "edge counts match after rescans");
+    
+    std::filesystem::path file = std::filesystem::temp_directory_path() / "lge_reference_index.bin";
+    start = Clock::now();
+    bool saved = index.SaveToFile(file);
+    double saveMs = MillisecondsSince(start);
+    AssetReferenceIndex loaded;
+    start = Clock::now();
+    bool loadedOk = loaded.LoadFromFile(file);
+    double loadMs = MillisecondsSince(start);
+    std::printf("save / load:                           %9.2f / %.2f ms (%ju bytes)\n", saveMs, loadMs,
+        static_cast<uintmax_t>(std::filesystem::file_size(file)));
+    ok &= Expect(saved && loadedOk, "round trip succeeds");
+    ok &= Expect(loaded.GetIndexedCount() == index.GetIndexedCount() && Snapshot(loaded, guids) == expected, "loaded index matches");
+    std::filesystem::remove(file);
+    
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
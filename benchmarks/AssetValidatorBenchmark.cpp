@@ -0,0 +1,228 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Asset validator benchmark: validates a synthetic registry with duplicate
+// names, missing dependencies and dependency cycles, timing the fused sweep
+// against the old per-type loops with a DFS per asset. Then edits a handful
+// of assets and checks that RevalidateChanged touches only those and agrees
+// with a fresh full validation.
+// Usage: LGE_AssetValidatorBenchmark [assets]
+
+#include "LGE/core/assets/AssetValidator.h"
+#include "LGE/core/assets/AssetRegistry.h"
+#include "LGE/core/assets/DependencyGraph.h"
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Results = std::vector<AssetValidator::ValidationResult>;
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::vector<std::tuple<std::string, std::string, std::string>> Canonical(const Results& results) {
+    std::vector<std::tuple<std::string, std::string, std::string>> keys;
+    keys.reserve(results.size());
+    for (const auto& result : results) {
+        keys.emplace_back(result.asset.ToString(), result.message, result.details);
+    }
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+size_t CountMessage(const Results& results, const std::string& prefix) {
+    return static_cast<size_t>(std::count_if(results.begin(), results.end(), [&](const AssetValidator::ValidationResult& result) {
+        return result.message.compare(0, prefix.size(), prefix) == 0;
+    }));
+}
+
+// The validator before the fused sweep: every check loops over all types, and
+// cycles are found with a DFS started from each asset
+size_t ValidateLegacy(AssetRegistry& registry, DependencyGraph& graph) {
+    const AssetType types[] = {
+        AssetType::Texture, AssetType::Model, AssetType::Material,
+        AssetType::Shader, AssetType::Script, AssetType::Audio,
+        AssetType::Scene, AssetType::Prefab, AssetType::Animation, AssetType::Font
+    };
+    size_t issues = 0;
+    for (AssetType type : types) {
+        for (AssetMetadata* metadata : registry.GetAssetsByType(type)) {
+            for (const GUID& dependency : graph.GetDependencies(metadata->guid)) {
+                issues += registry.GetAsset(dependency) ? 0 : 1;
+            }
+        }
+    }
+    for (AssetType type : types) {
+        for (AssetMetadata* metadata : registry.GetAssetsByType(type)) {
+            for (const GUID& dependency : metadata->dependencies) {
+                issues += registry.GetAsset(dependency) ? 0 : 1;
+            }
+        }
+    }
+    for (AssetType type : types) {
+        for (AssetMetadata* metadata : registry.GetAssetsByType(type)) {
+            issues += graph.HasCircularDependency(metadata->guid) ? 1 : 0;
+        }
+    }
+    std::unordered_map<std::string, size_t> names;
+    for (AssetType type : types) {
+        for (AssetMetadata* metadata : registry.GetAssetsByType(type)) {
+            ++names[metadata->name];
+        }
+    }
+    for (const auto& [name, count] : names) {
+        issues += count > 1 ? count : 0;
+    }
+    return issues;
+}
+
+void Link(AssetRegistry& registry, DependencyGraph& graph, const GUID& asset, const GUID& dependency) {
+    graph.AddDependency(asset, dependency);
+    AssetMetadata metadata = *registry.GetAsset(asset);
+    metadata.dependencies.push_back(dependency);
+    registry.UpdateAsset(asset, metadata);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int assetCount = argc > 1 ? std::max(100, std::atoi(argv[1])) : 20000;
+    bool ok = true;
+    Log::SetConsoleOutput(false);
+    JobSystem::Initialize();
+    
+    // Assets depend on up to three earlier ones (a DAG), with a back edge
+    // closing a cycle every 500 assets, a dangling dependency every 1000 and a
+    // shared name every 97
+    AssetRegistry registry;
+    DependencyGraph graph(&registry);
+    std::mt19937 rng(1234);
+    std::vector<GUID> guids(static_cast<size_t>(assetCount));
+    for (int i = 0; i < assetCount; ++i) {
+        AssetMetadata metadata;
+        metadata.guid = guids[i] = GUID::Generate();
+        metadata.type = static_cast<AssetType>(1 + i % 10);
+        metadata.name = i % 97 == 0 ? "Shared" + std::to_string(i % 3) : "Asset" + std::to_string(i);
+        metadata.virtualPath = "/Assets/Folder" + std::to_string(i % 64) + "/" + metadata.name + std::to_string(i) + ".lmat";
+        for (int d = 0; d < 3 && i > 0; ++d) {
+            GUID dependency = guids[std::uniform_int_distribution<int>(std::max(0, i - 200), i - 1)(rng)];
+            if (std::find(metadata.dependencies.begin(), metadata.dependencies.end(), dependency) == metadata.dependencies.end()) {
+                metadata.dependencies.push_back(dependency);
+                graph.AddDependency(metadata.guid, dependency);
+            }
+        }
+        if (i % 1000 == 999) {
+            metadata.dependencies.push_back(GUID::Generate());
+        }
+        registry.RegisterAsset(metadata);
+    }
+    for (int i = 500; i < assetCount; i += 500) {
+        Link(registry, graph, guids[i - 1], guids[i]);
+        Link(registry, graph, guids[i], guids[i - 1]);
+    }
+    
+    Clock::time_point start = Clock::now();
+    size_t legacyIssues = ValidateLegacy(registry, graph);
+    double legacyMs = MillisecondsSince(start);
+    
+    AssetValidator validator(&registry, &graph);
+    Results full;
+    double fullMs = 1e30;
+    for (int run = 0; run < 3; ++run) {
+        start = Clock::now();
+        full = validator.ValidateProject();
+        fullMs = std::min(fullMs, MillisecondsSince(start));
+    }
+    size_t cycles = CountMessage(full, "Circular dependency");
+    size_t missing = CountMessage(full, "Missing dependency");
+    size_t duplicates = CountMessage(full, "Duplicate asset name");
+    std::printf("assets=%d workers=%u issues=%zu (cycles=%zu missing=%zu duplicates=%zu)\n",
+        assetCount, JobSystem::GetWorkerCount(), full.size(), cycles, missing, duplicates);
+    std::printf("legacy per-type loops + DFS per asset: %9.2f ms (%zu issues)\n", legacyMs, legacyIssues);
+    std::printf("fused sweep + Tarjan:                  %9.2f ms (%.1fx)\n", fullMs, legacyMs / fullMs);
+    ok &= Expect(cycles >= static_cast<size_t>(2 * (assetCount / 500 - 1)), "every planted cycle found");
+    ok &= Expect(missing == static_cast<size_t>(assetCount / 1000), "every dangling dependency reported");
+    ok &= Expect(duplicates > 0, "duplicate names reported");
+    
+    start = Clock::now();
+    Results unchanged = validator.RevalidateChanged();
+    double unchangedMs = MillisecondsSince(start);
+    ok &= Expect(validator.GetLastRevalidatedCount() == 0, "no edits, nothing rechecked");
+    ok &= Expect(Canonical(unchanged) == Canonical(full), "unchanged revalidation matches");
+    
+    // A few edits: rename into a shared name, unregister assets others depend
+    // on, close a new cycle, break a planted one and relink one asset
+    for (int i = 1; i <= 5; ++i) {
+        AssetMetadata metadata = *registry.GetAsset(guids[i * 301]);
+        metadata.name = "Shared0";
+        registry.UpdateAsset(metadata.guid, metadata);
+    }
+    for (int i = 1; i <= 3; ++i) {
+        GUID removed = guids[i * 977];
+        graph.RemoveDependencies(removed);
+        registry.UnregisterAsset(removed);
+    }
+    Link(registry, graph, guids[assetCount / 3 - 150], guids[assetCount / 3]);
+    graph.RemoveDependency(guids[999], guids[1000]);
+    AssetMetadata relinked = *registry.GetAsset(guids[999]);
+    relinked.dependencies.erase(std::remove(relinked.dependencies.begin(), relinked.dependencies.end(), guids[1000]), relinked.dependencies.end());
+    registry.UpdateAsset(relinked.guid, relinked);
+    
+    start = Clock::now();
+    Results incremental = validator.RevalidateChanged();
+    double incrementalMs = MillisecondsSince(start);
+    size_t rechecked = validator.GetLastRevalidatedCount();
+    
+    AssetValidator fresh(&registry, &graph);
+    Results expected = fresh.ValidateProject();
+    std::printf("revalidate, no edits:                  %9.3f ms\n", unchangedMs);
+    std::printf("revalidate after edits:                %9.3f ms (%zu assets rechecked, %zu issues)\n",
+        incrementalMs, rechecked, incremental.size());
+    ok &= Expect(Canonical(incremental) == Canonical(expected), "incremental revalidation matches a full sweep");
+    ok &= Expect(rechecked > 0 && rechecked < static_cast<size_t>(assetCount) / 10, "only touched assets rechecked");
+    ok &= Expect(CountMessage(incremental, "Circular dependency") != cycles, "cycle edits picked up");
+    
+    JobSystem::Shutdown();
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
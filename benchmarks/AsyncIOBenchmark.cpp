@@ -0,0 +1,391 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Async file I/O benchmark: reads a set of asset-sized files with blocking
+// ifstream reads (one thread and a JobSystem ParallelFor) and through
+// AsyncFileIO at increasing queue depths, on tmpfs and on a disk-backed folder
+// with the page cache dropped before each pass. Then packs the set into an
+// .lpak through the async packager and issues random 4 KB direct reads into it.
+// Also checks priority ordering and the thread-pool fallback.
+// Usage: LGE_AsyncIOBenchmark [tmpfsDir] [diskDir]
+
+#include "LGE/core/filesystem/AsyncFileIO.h"
+#include "LGE/core/filesystem/MappedFile.h"
+#include "LGE/core/filesystem/PackageArchive.h"
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/Log.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t kFileCount = 256;
+constexpr size_t kFileSize = 256 * 1024;
+constexpr size_t kRandomReads = 8192;
+constexpr size_t kRandomReadSize = 4096;
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+double Seconds(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+uint64_t SumWords(const uint8_t* data, size_t size) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        sum += word;
+    }
+    return sum;
+}
+
+// Writes the file set and returns the checksum of all of it
+uint64_t WriteDataset(const std::filesystem::path& root, std::vector<std::string>& outPaths) {
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "Textures");
+    std::vector<uint64_t> words(kFileSize / sizeof(uint64_t));
+    uint64_t total = 0;
+    outPaths.clear();
+    for (size_t i = 0; i < kFileCount; ++i) {
+        std::mt19937_64 rng(i + 1);
+        for (uint64_t& word : words) {
+            word = rng();
+            total += word;
+        }
+        std::string path = (root / "Textures" / ("tex_" + std::to_string(i) + ".png")).string();
+        std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(words.data()), kFileSize);
+        outPaths.push_back(path);
+    }
+    return total;
+}
+
+// Evicts the files from the page cache so the next pass hits the device
+void DropCache(const std::vector<std::string>& paths) {
+#ifndef _WIN32
+    for (const std::string& path : paths) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            fdatasync(fd);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            ::close(fd);
+        }
+    }
+#else
+    (void)paths;
+#endif
+}
+
+uint64_t ReadBlocking(const std::vector<std::string>& paths, size_t begin, size_t end) {
+    std::vector<uint8_t> buffer;
+    uint64_t sum = 0;
+    for (size_t i = begin; i < end; ++i) {
+        std::ifstream in(paths[i], std::ios::binary | std::ios::ate);
+        buffer.resize(static_cast<size_t>(in.tellg()));
+        in.seekg(0);
+        in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        sum += SumWords(buffer.data(), buffer.size());
+    }
+    return sum;
+}
+
+uint64_t ReadAsync(AsyncFileIO& io, const std::vector<std::string>& paths, IOCompletionContext context) {
+    std::atomic<uint64_t> sum{ 0 };
+    std::vector<IOReadRequest> requests(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        requests[i].path = paths[i];
+        requests[i].context = context;
+        requests[i].onComplete = [&sum](const IOReadResult& result) {
+            if (result.success) {
+                sum += SumWords(result.data, result.size);
+            }
+        };
+    }
+    io.SubmitBatch(requests);
+    io.WaitIdle();
+    return sum.load();
+}
+
+AsyncIOConfig MakeConfig(uint32_t queueDepth, bool allowIoUring) {
+    AsyncIOConfig config;
+    config.queueDepth = queueDepth;
+    config.bufferCount = std::max(queueDepth, 4u);
+    config.bufferSize = kFileSize;
+    config.fallbackThreads = std::min(queueDepth, 8u);
+    config.allowIoUring = allowIoUring;
+    return config;
+}
+
+void PrintRate(const char* label, double seconds, uint64_t bytes) {
+    std::printf("  %-34s %8.2f ms  %8.1f MB/s\n", label, seconds * 1000.0, bytes / seconds / (1024.0 * 1024.0));
+}
+
+bool RunReadScaling(const char* name, const std::filesystem::path& root, bool cold) {
+    bool ok = true;
+    std::vector<std::string> paths;
+    uint64_t expected = WriteDataset(root, paths);
+    uint64_t bytes = static_cast<uint64_t>(kFileCount) * kFileSize;
+    std::printf("%s (%s, %zu x %zu KB%s)\n", name, root.string().c_str(), kFileCount, kFileSize / 1024,
+                cold ? ", cold cache" : "");
+    
+    if (cold) DropCache(paths);
+    Clock::time_point start = Clock::now();
+    uint64_t sum = ReadBlocking(paths, 0, paths.size());
+    PrintRate("blocking ifstream, 1 thread", Seconds(start), bytes);
+    ok &= Expect(sum == expected, "blocking read checksum");
+    
+    if (cold) DropCache(paths);
+    std::atomic<uint64_t> parallelSum{ 0 };
+    start = Clock::now();
+    JobSystem::ParallelFor(paths.size(), 8, [&](size_t begin, size_t end) {
+        parallelSum += ReadBlocking(paths, begin, end);
+    });
+    PrintRate("blocking ifstream, ParallelFor", Seconds(start), bytes);
+    ok &= Expect(parallelSum.load() == expected, "parallel blocking read checksum");
+    
+    for (uint32_t queueDepth : { 1u, 4u, 16u, 64u }) {
+        AsyncFileIO io;
+        io.Initialize(MakeConfig(queueDepth, true));
+        if (cold) DropCache(paths);
+        start = Clock::now();
+        sum = ReadAsync(io, paths, IOCompletionContext::IOThread);
+        char label[64];
+        std::snprintf(label, sizeof(label), "async %s, QD %u", io.GetBackendName(), queueDepth);
+        PrintRate(label, Seconds(start), bytes);
+        ok &= Expect(sum == expected, "async read checksum");
+        
+        if (queueDepth == 16) {
+            if (cold) DropCache(paths);
+            start = Clock::now();
+            sum = ReadAsync(io, paths, IOCompletionContext::JobSystem);
+            std::snprintf(label, sizeof(label), "async %s, QD %u, JobSystem", io.GetBackendName(), queueDepth);
+            PrintRate(label, Seconds(start), bytes);
+            ok &= Expect(sum == expected, "async JobSystem completion checksum");
+        }
+        io.Shutdown();
+    }
+    
+    // Thread-pool backend, as used where io_uring is unavailable
+    {
+        AsyncFileIO io;
+        io.Initialize(MakeConfig(16, false));
+        if (cold) DropCache(paths);
+        start = Clock::now();
+        sum = ReadAsync(io, paths, IOCompletionContext::IOThread);
+        PrintRate("async thread pool, QD 16", Seconds(start), bytes);
+        ok &= Expect(sum == expected, "fallback read checksum");
+        ok &= Expect(!io.IsUsingIoUring(), "fallback backend selected");
+    }
+    
+    // Pack the set and read random 4 KB ranges out of the package
+    std::filesystem::path package = root / "Textures.lpak";
+    start = Clock::now();
+    ok &= Expect(PackageArchive::Build(root / "Textures", package), "build package");
+    PrintRate("async packager", Seconds(start), bytes);
+    
+    PackageArchive archive;
+    ok &= Expect(archive.Open(package), "open package");
+    ok &= Expect(archive.GetFileCount() == kFileCount, "package entry count");
+    FileView mapped = MappedFile::Open(package, FileAccessHint::Random);
+    ok &= Expect(mapped.IsValid(), "map package");
+    if (!mapped.IsValid()) {
+        return false;
+    }
+    
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> offsets(kRandomReads);
+    uint64_t rangeSum = 0;
+    uint64_t dataEnd = mapped.GetSize() - kRandomReadSize;
+    for (uint64_t& offset : offsets) {
+        offset = rng() % dataEnd;
+        rangeSum += SumWords(mapped.GetData() + offset, kRandomReadSize);
+    }
+    uint64_t rangeBytes = static_cast<uint64_t>(kRandomReads) * kRandomReadSize;
+    std::string packagePath = package.string();
+    
+#ifndef _WIN32
+    {
+        if (cold) DropCache({ packagePath });
+        int fd = ::open(packagePath.c_str(), O_RDONLY);
+        std::vector<uint8_t> buffer(kRandomReadSize);
+        sum = 0;
+        start = Clock::now();
+        for (uint64_t offset : offsets) {
+            if (pread(fd, buffer.data(), buffer.size(), static_cast<off_t>(offset)) == static_cast<ssize_t>(buffer.size())) {
+                sum += SumWords(buffer.data(), buffer.size());
+            }
+        }
+        PrintRate("random 4 KB, blocking pread", Seconds(start), rangeBytes);
+        ::close(fd);
+        ok &= Expect(sum == rangeSum, "blocking range checksum");
+    }
+#endif
+    
+    for (uint32_t queueDepth : { 1u, 16u, 64u }) {
+        AsyncFileIO io;
+        io.Initialize(MakeConfig(queueDepth, true));
+        std::atomic<uint64_t> asyncSum{ 0 };
+        std::vector<IOReadRequest> requests(offsets.size());
+        for (size_t i = 0; i < offsets.size(); ++i) {
+            requests[i].path = packagePath;
+            requests[i].offset = offsets[i];
+            requests[i].size = kRandomReadSize;
+            requests[i].direct = true;
+            requests[i].context = IOCompletionContext::IOThread;
+            requests[i].onComplete = [&asyncSum](const IOReadResult& result) {
+                if (result.success && result.size == kRandomReadSize) {
+                    asyncSum += SumWords(result.data, result.size);
+                }
+            };
+        }
+        if (cold) DropCache({ packagePath });
+        start = Clock::now();
+        io.SubmitBatch(requests);
+        io.WaitIdle();
+        char label[64];
+        std::snprintf(label, sizeof(label), "random 4 KB, async direct, QD %u", queueDepth);
+        PrintRate(label, Seconds(start), rangeBytes);
+        ok &= Expect(asyncSum.load() == rangeSum, "async direct range checksum");
+    }
+    
+    // Whole entries through the archive, compared against the mapping
+    {
+        std::atomic<uint32_t> matches{ 0 };
+        for (size_t i = 0; i < kFileCount; ++i) {
+            std::string entry = "tex_" + std::to_string(i) + ".png";
+            FileView view = archive.GetFileView(entry);
+            IOReadRequest request;
+            request.context = IOCompletionContext::IOThread;
+            request.onComplete = [&matches, view](const IOReadResult& result) {
+                if (result.success && result.size == view.GetSize() &&
+                    std::memcmp(result.data, view.GetData(), view.GetSize()) == 0) {
+                    ++matches;
+                }
+            };
+            archive.SubmitRead(entry, std::move(request));
+        }
+        AsyncFileIO::Get().WaitIdle();
+        ok &= Expect(matches.load() == kFileCount, "package entry reads match");
+    }
+    
+    std::filesystem::remove_all(root);
+    return ok;
+}
+
+bool RunPriorityOrder() {
+    bool ok = true;
+    for (bool allowIoUring : { true, false }) {
+        // One read at a time so completion order is dispatch order
+        AsyncIOConfig config = MakeConfig(1, allowIoUring);
+        config.fallbackThreads = 1;
+        AsyncFileIO io;
+        io.Initialize(config);
+        
+        std::filesystem::path path = std::filesystem::temp_directory_path() / "lge_asyncio_priority.bin";
+        std::ofstream(path, std::ios::binary) << std::string(4096, 'x');
+        
+        std::mutex orderMutex;
+        std::vector<int> order;
+        std::vector<IOReadRequest> requests;
+        const IOPriority priorities[] = { IOPriority::Low, IOPriority::Normal, IOPriority::Critical, IOPriority::High };
+        auto now = Clock::now();
+        for (int i = 0; i < 8; ++i) {
+            IOReadRequest request;
+            request.path = path.string();
+            request.priority = priorities[i % 4];
+            // Within a priority the earlier deadline goes first
+            request.deadline = now + std::chrono::seconds(i < 4 ? 20 : 10);
+            request.context = IOCompletionContext::IOThread;
+            request.onComplete = [&orderMutex, &order, i](const IOReadResult&) {
+                std::lock_guard<std::mutex> lock(orderMutex);
+                order.push_back(i);
+            };
+            requests.push_back(std::move(request));
+        }
+        io.SubmitBatch(requests);
+        io.WaitIdle();
+        
+        std::vector<int> expected = { 6, 2, 7, 3, 5, 1, 4, 0 };
+        ok &= Expect(order == expected, allowIoUring ? "priority order (io_uring)" : "priority order (thread pool)");
+        ok &= Expect(io.GetStats().completed == 8, "priority reads completed");
+        
+        // Missing files complete with an error instead of hanging
+        std::atomic<int> error{ 0 };
+        IOReadRequest missing;
+        missing.path = (std::filesystem::temp_directory_path() / "lge_asyncio_missing.bin").string();
+        missing.context = IOCompletionContext::IOThread;
+        missing.onComplete = [&error](const IOReadResult& result) { error = result.success ? 0 : result.error; };
+        io.Submit(std::move(missing));
+        io.WaitIdle();
+        ok &= Expect(error.load() == ENOENT, "missing file reports ENOENT");
+        
+        io.Shutdown();
+        std::filesystem::remove(path);
+    }
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::filesystem::path tmpfsRoot = argc > 1 ? argv[1] : "/dev/shm/lge_asyncio";
+    std::filesystem::path diskRoot = argc > 2 ? argv[2] : std::filesystem::temp_directory_path() / "lge_asyncio";
+    
+    Log::SetLevel(LogLevel::Warn);
+    JobSystem::Initialize();
+    
+    bool ok = RunPriorityOrder();
+    std::error_code ec;
+    if (std::filesystem::is_directory(tmpfsRoot.parent_path(), ec)) {
+        ok &= RunReadScaling("tmpfs", tmpfsRoot, false);
+    }
+    ok &= RunReadScaling("disk", diskRoot, true);
+    
+    AsyncFileIO::Get().Shutdown();
+    JobSystem::Shutdown();
+    
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
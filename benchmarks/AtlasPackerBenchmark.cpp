@@ -0,0 +1,139 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Atlas packer benchmark: packs a mix of editor-icon-sized images into one
+// page, checks the layout (bounds, padding, no overlap, UVs) and reports
+// occupancy and packing time.
+// Usage: LGE_AtlasPackerBenchmark [images] [padding]
+
+#include "LGE/rendering/AtlasPacker.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool Overlaps(const AtlasRect& a, const AtlasRect& b, int padding) {
+    // Padded areas of two rects must not intersect either
+    return a.x - padding < b.x + b.width + padding && b.x - padding < a.x + a.width + padding &&
+           a.y - padding < b.y + b.height + padding && b.y - padding < a.y + a.height + padding;
+}
+
+bool Validate(const std::vector<AtlasRect>& sizes, const std::vector<AtlasRect>& rects,
+              int width, int height, int padding) {
+    if (rects.size() != sizes.size()) {
+        std::printf("FAIL: %zu rects for %zu sizes\n", rects.size(), sizes.size());
+        return false;
+    }
+    for (size_t i = 0; i < rects.size(); ++i) {
+        const AtlasRect& rect = rects[i];
+        if (rect.width != sizes[i].width || rect.height != sizes[i].height) {
+            std::printf("FAIL: rect %zu has the wrong size\n", i);
+            return false;
+        }
+        if (rect.x - padding < 0 || rect.y - padding < 0 ||
+            rect.x + rect.width + padding > width || rect.y + rect.height + padding > height) {
+            std::printf("FAIL: rect %zu is out of bounds\n", i);
+            return false;
+        }
+        AtlasUV uv = AtlasPacker::ToUV(rect, width, height);
+        if (std::fabs(uv.u0 * width - rect.x) > 1e-3f || std::fabs(uv.v1 * height - (rect.y + rect.height)) > 1e-3f) {
+            std::printf("FAIL: rect %zu has wrong UVs\n", i);
+            return false;
+        }
+        for (size_t j = i + 1; j < rects.size(); ++j) {
+            if (Overlaps(rect, rects[j], padding)) {
+                std::printf("FAIL: rects %zu and %zu overlap\n", i, j);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int imageCount = argc > 1 ? std::max(1, std::atoi(argv[1])) : 500;
+    int padding = argc > 2 ? std::max(0, std::atoi(argv[2])) : 4;
+    const int maxSize = 8192;
+    
+    // Mostly 12-64 px icons with the odd 128/256 thumbnail
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> iconDist(12, 64);
+    std::uniform_int_distribution<int> kindDist(0, 19);
+    std::vector<AtlasRect> sizes;
+    uint64_t imageArea = 0;
+    for (int i = 0; i < imageCount; ++i) {
+        int kind = kindDist(rng);
+        int w = kind == 0 ? 256 : (kind == 1 ? 128 : iconDist(rng));
+        int h = kind <= 1 ? w : (kindDist(rng) < 15 ? w : iconDist(rng));
+        sizes.push_back({ 0, 0, w, h });
+        imageArea += static_cast<uint64_t>(w) * static_cast<uint64_t>(h);
+    }
+    
+    auto start = Clock::now();
+    int width = 0;
+    int height = 0;
+    if (!AtlasPacker::ChooseSize(sizes, padding, maxSize, width, height)) {
+        std::printf("FAIL: %d images do not fit in %dx%d\n", imageCount, maxSize, maxSize);
+        return 1;
+    }
+    float chooseMs = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+    
+    start = Clock::now();
+    AtlasPacker packer(width, height, padding);
+    std::vector<AtlasRect> rects;
+    bool packed = packer.InsertBatch(sizes, rects);
+    float packMs = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+    
+    if (!packed || !Validate(sizes, rects, width, height, padding)) {
+        return 1;
+    }
+    
+    // Incremental inserts into a page with no room left must fail cleanly
+    AtlasRect extra;
+    AtlasPacker tiny(16, 16, 0);
+    bool rejects = tiny.Insert(16, 16, extra) && !tiny.Insert(1, 1, extra) && tiny.GetFreeRects().empty();
+    if (!rejects) {
+        std::printf("FAIL: full page accepted another rect\n");
+        return 1;
+    }
+    
+    std::printf("Images: %d, padding %d px\n\n", imageCount, padding);
+    std::printf("Page size         %dx%d\n", width, height);
+    std::printf("Occupancy         %.1f%% with padding, %.1f%% image texels\n",
+                packer.GetOccupancy() * 100.0f, 100.0 * imageArea / (static_cast<double>(width) * height));
+    std::printf("ChooseSize        %.3f ms\n", chooseMs);
+    std::printf("Final pack        %.3f ms\n", packMs);
+    std::printf("\nLayout checks passed; one texture instead of %d\n", imageCount);
+    return 0;
+}
@@ -0,0 +1,274 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Dependency scan benchmark: writes a project of .lscene, .prefab and .lmat
+// files referencing models, scripts and textures by GUID, then times a DOM
+// parse of every file against DependencyScanner::ScanAll's streaming pass
+// (parallel, or serial when the pool has one worker), a rescan with nothing
+// changed (content hashes match) and one after touching a few files. Checks
+// every planted reference is found with its JSON path, that in-file object
+// GUIDs are not reported, and that the scan cache survives a save/load.
+// Usage: LGE_DependencyScanBenchmark [scenes] [objectsPerScene]
+
+#include "LGE/core/assets/DependencyScanner.h"
+#include "LGE/core/assets/AssetReferenceIndex.h"
+#include "LGE/core/assets/AssetRegistry.h"
+#include "LGE/core/assets/DependencyGraph.h"
+#include "LGE/core/filesystem/VirtualFileSystem.h"
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/Log.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+GUID Register(AssetRegistry& registry, AssetType type, const std::string& virtualPath) {
+    AssetMetadata metadata;
+    metadata.guid = GUID::Generate();
+    metadata.type = type;
+    metadata.name = std::filesystem::path(virtualPath).stem().string();
+    metadata.virtualPath = virtualPath;
+    registry.RegisterAsset(metadata);
+    return metadata.guid;
+}
+
+void Write(const std::filesystem::path& file, const std::string& text) {
+    std::filesystem::create_directories(file.parent_path());
+    std::ofstream(file, std::ios::binary) << text;
+}
+
+// The way a scan had to be done without a streaming pass: build the DOM, then walk it
+size_t CountGuidsInDom(const nlohmann::json& node) {
+    if (node.is_string()) {
+        return GUID::FromString(node.get<std::string>()).IsValid() ? 1 : 0;
+    }
+    size_t count = 0;
+    if (node.is_structured()) {
+        for (const auto& child : node) {
+            count += CountGuidsInDom(child);
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int sceneCount = argc > 1 ? std::max(10, std::atoi(argv[1])) : 1000;
+    int objectsPerScene = argc > 2 ? std::max(2, std::atoi(argv[2])) : 100;
+    bool ok = true;
+    Log::SetConsoleOutput(false);
+    JobSystem::Initialize();
+    
+    std::filesystem::path root = std::filesystem::temp_directory_path() / "lge_dependency_scan";
+    std::filesystem::remove_all(root);
+    VirtualFileSystem vfs;
+    vfs.Initialize(root);
+    
+    AssetRegistry registry;
+    DependencyGraph graph(&registry);
+    AssetReferenceIndex index;
+    std::mt19937 rng(99);
+    auto pick = [&](const std::vector<GUID>& from) {
+        return from[std::uniform_int_distribution<size_t>(0, from.size() - 1)(rng)];
+    };
+    
+    std::vector<GUID> textures, models, scripts, materials, scenes, prefabs;
+    for (int i = 0; i < 500; ++i) {
+        textures.push_back(Register(registry, AssetType::Texture, "/Assets/Textures/T" + std::to_string(i) + ".png"));
+        models.push_back(Register(registry, AssetType::Model, "/Assets/Models/M" + std::to_string(i) + ".fbx"));
+        scripts.push_back(Register(registry, AssetType::Script, "/Assets/Scripts/S" + std::to_string(i) + ".lua"));
+    }
+    for (int i = 0; i < 300; ++i) {
+        std::string virtualPath = "/Assets/Materials/Mat" + std::to_string(i) + ".lmat";
+        GUID guid = Register(registry, AssetType::Material, virtualPath);
+        materials.push_back(guid);
+        Write(vfs.ResolveVirtualPath(virtualPath), "{ \"guid\": \"" + guid.ToString() + "\", \"shader\": \"Standard\", \"textures\": { \"albedo\": \"" +
+            pick(textures).ToString() + "\", \"normal\": \"" + pick(textures).ToString() + "\" }, \"roughness\": 0.5 }");
+    }
+    
+    // Game objects carry their own GUID and point at their parent by GUID;
+    // neither is an asset reference. Each has a mesh, two materials and a script.
+    auto writeObjects = [&](const std::string& virtualPath, const GUID& self, const char* listKey) {
+        std::ostringstream json;
+        json << "{\n  \"guid\": \"" << self.ToString() << "\",\n  \"name\": \"" << virtualPath << "\",\n  \"version\": 1,\n  \"" << listKey << "\": [\n";
+        GUID parent;
+        for (int o = 0; o < objectsPerScene; ++o) {
+            GUID object = GUID::Generate();
+            json << (o ? ",\n" : "") << "    {\n      \"guid\": \"" << object.ToString() << "\",\n      \"name\": \"Object " << o << "\",\n"
+                 << "      \"parent\": \"" << (parent.IsValid() ? parent.ToString() : std::string()) << "\",\n"
+                 << "      \"isActive\": true,\n      \"transform\": { \"position\": [" << o << ", 0.5, -2.25], \"scale\": [1, 1, 1] },\n"
+                 << "      \"components\": [\n"
+                 << "        { \"type\": \"MeshRenderer\", \"castShadows\": true, \"meshGUID\": \"" << pick(models).ToString()
+                 << "\", \"materials\": [\"" << pick(materials).ToString() << "\", \"" << pick(materials).ToString() << "\"] },\n"
+                 << "        { \"type\": \"ScriptComponent\", \"script\": \"" << pick(scripts).ToString() << "\", \"enabled\": true }\n"
+                 << "      ],\n      \"children\": []\n    }";
+            parent = object;
+        }
+        json << "\n  ]\n}\n";
+        Write(vfs.ResolveVirtualPath(virtualPath), json.str());
+    };
+    for (int i = 0; i < sceneCount; ++i) {
+        std::string virtualPath = "/Assets/Scenes/Scene" + std::to_string(i) + ".lscene";
+        scenes.push_back(Register(registry, AssetType::Scene, virtualPath));
+        writeObjects(virtualPath, scenes.back(), "gameObjects");
+    }
+    for (int i = 0; i < sceneCount / 4; ++i) {
+        std::string virtualPath = "/Assets/Prefabs/Prefab" + std::to_string(i) + ".prefab";
+        prefabs.push_back(Register(registry, AssetType::Prefab, virtualPath));
+        writeObjects(virtualPath, prefabs.back(), "objects");
+    }
+    
+    std::vector<std::string> files;
+    uintmax_t totalBytes = 0;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+        if (entry.is_regular_file()) {
+            files.push_back(entry.path().string());
+            totalBytes += entry.file_size();
+        }
+    }
+    
+    // Parser cost alone, on text already in memory
+    std::vector<std::string> texts;
+    for (const std::string& file : files) {
+        std::ifstream in(file, std::ios::binary);
+        std::ostringstream text;
+        text << in.rdbuf();
+        texts.push_back(text.str());
+    }
+    
+    Clock::time_point start = Clock::now();
+    size_t domGuids = 0;
+    for (const std::string& text : texts) {
+        domGuids += CountGuidsInDom(nlohmann::json::parse(text));
+    }
+    double domMs = MillisecondsSince(start);
+    
+    start = Clock::now();
+    size_t saxReferences = 0;
+    std::vector<AssetPropertyReference> extracted;
+    for (const std::string& text : texts) {
+        extracted.clear();
+        DependencyScanner::ExtractReferences(text, GUID(), extracted);
+        saxReferences += extracted.size();
+    }
+    double saxMs = MillisecondsSince(start);
+    texts.clear();
+    
+    DependencyScanner scanner(&registry, &graph, &index);
+    scanner.SetVirtualFileSystem(&vfs);
+    start = Clock::now();
+    scanner.ScanAll();
+    double coldMs = MillisecondsSince(start);
+    size_t coldParsed = scanner.GetFilesParsed();
+    
+    start = Clock::now();
+    scanner.ScanAll();
+    double warmMs = MillisecondsSince(start);
+    size_t warmReused = scanner.GetFilesReused();
+    
+    std::printf("files=%zu (%.1f MB) objects/scene=%d workers=%u\n", files.size(), totalBytes / (1024.0 * 1024.0),
+        objectsPerScene, JobSystem::GetWorkerCount());
+    std::printf("DOM parse + walk, 1 thread:      %9.2f ms (%zu GUID strings)\n", domMs, domGuids);
+    std::printf("streaming extract, 1 thread:     %9.2f ms (%zu references)\n", saxMs, saxReferences);
+    std::printf("%-33s%9.2f ms (%zu files parsed, %zu references)\n", JobSystem::GetWorkerCount() > 1 ?
+        "ScanAll, streaming in parallel:" : "ScanAll, streaming serially:", coldMs, coldParsed, index.GetEdgeCount());
+    std::printf("ScanAll, nothing changed:        %9.2f ms (%zu files reused)\n", warmMs, warmReused);
+    ok &= Expect(coldParsed == files.size(), "every file parsed on the first scan");
+    ok &= Expect(warmReused == files.size() && scanner.GetFilesParsed() == 0, "unchanged files skipped");
+    
+    // Each object contributes four references; the parent and identity GUIDs must not show up
+    size_t perFile = static_cast<size_t>(objectsPerScene) * 4;
+    std::vector<AssetReferenceIndex::Reference> references;
+    index.GetReferencesFrom(scenes.front(), references);
+    ok &= Expect(references.size() == perFile, "every scene reference found, in-file GUIDs skipped");
+    ok &= Expect(domGuids == index.GetEdgeCount() + files.size() + (files.size() - materials.size()) * (2 * objectsPerScene - 1),
+        "SAX and DOM see the same GUID strings");
+    bool hasMeshPath = std::any_of(references.begin(), references.end(), [](const AssetReferenceIndex::Reference& reference) {
+        return PathTable::Get().GetString(reference.property) == "gameObjects[0].components[0].meshGUID";
+    });
+    ok &= Expect(hasMeshPath, "references carry their JSON path");
+    ok &= Expect(graph.GetDependencies(materials.front()).size() >= 1, "material textures found in the .lmat");
+    ok &= Expect(registry.GetAsset(prefabs.front())->dependencies.size() <= perFile && !registry.GetAsset(prefabs.front())->dependencies.empty(),
+        "metadata dependencies updated");
+    
+    // Touch a few scenes: one loses its objects, the others are rewritten
+    for (size_t i = 1; i < 10; ++i) {
+        writeObjects(registry.GetAsset(scenes[i])->virtualPath, scenes[i], "gameObjects");
+    }
+    Write(vfs.ResolveVirtualPath(registry.GetAsset(scenes[0])->virtualPath), "{ \"gameObjects\": [] }");
+    start = Clock::now();
+    scanner.ScanAll();
+    double touchedMs = MillisecondsSince(start);
+    std::printf("ScanAll, 10 files touched:       %9.2f ms (%zu parsed)\n", touchedMs, scanner.GetFilesParsed());
+    ok &= Expect(scanner.GetFilesParsed() == 10, "only touched files parsed");
+    ok &= Expect(graph.GetDependencies(scenes[0]).empty(), "removed references dropped");
+    
+    std::filesystem::path cacheFile = root / "dependency_scans.bin";
+    ok &= Expect(scanner.SaveFileScans(cacheFile), "cache saved");
+    DependencyScanner reopened(&registry, &graph, &index);
+    reopened.SetVirtualFileSystem(&vfs);
+    start = Clock::now();
+    bool loaded = reopened.LoadFileScans(cacheFile);
+    double loadMs = MillisecondsSince(start);
+    size_t edgesBefore = index.GetEdgeCount();
+    start = Clock::now();
+    reopened.ScanAll();
+    double reopenedMs = MillisecondsSince(start);
+    std::printf("cache load / ScanAll after load: %9.2f / %.2f ms (%zu reused)\n", loadMs, reopenedMs, reopened.GetFilesReused());
+    ok &= Expect(loaded && reopened.GetFilesReused() == files.size(), "loaded cache skips every file");
+    ok &= Expect(index.GetEdgeCount() == edgesBefore, "same references from the cache");
+    
+    std::vector<AssetPropertyReference> malformed;
+    ok &= Expect(!DependencyScanner::ExtractReferences("{ \"a\": \"" + textures[0].ToString() + "\", \"b\": [", GUID(), malformed) &&
+        malformed.size() == 1, "malformed JSON keeps what came before the damage");
+    
+    std::filesystem::remove_all(root);
+    JobSystem::Shutdown();
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
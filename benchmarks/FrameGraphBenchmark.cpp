@@ -0,0 +1,237 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Frame graph benchmark: compiles the editor viewport graph with and without a
+// shadow caster, checks culling, ordering, barriers and transient lifetimes
+// against a recording backend, then times compilation of a long post chain.
+// Usage: LGE_FrameGraphBenchmark [frames]
+
+#include "LGE/rendering/FrameGraph.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+RenderTargetDesc MakeDesc(uint32_t width, uint32_t height, RenderTargetFormat format) {
+    RenderTargetDesc desc;
+    desc.width = width;
+    desc.height = height;
+    desc.format = format;
+    return desc;
+}
+
+// Records what the graph asks of the API instead of calling GL
+class RecordingBackend : public FrameGraphBackend {
+public:
+    uint32_t GetTexture(uint32_t target) override { return 1000 + target; }
+    uint32_t GetFramebuffer(uint32_t colorTarget, uint32_t depthTarget) override {
+        return 1 + (colorTarget & 0xFF) * 256 + (depthTarget & 0xFF);
+    }
+    void BeginPass(uint32_t framebuffer, uint32_t width, uint32_t height) override {
+        log.push_back("bind " + std::to_string(framebuffer) + " " + std::to_string(width) + "x" + std::to_string(height));
+    }
+    void Barrier(uint32_t barriers) override { log.push_back("barrier " + std::to_string(barriers)); }
+    void EndPasses() override { log.push_back("end"); }
+    
+    std::vector<std::string> log;
+};
+
+std::string CompiledNames(const FrameGraph& graph) {
+    std::string names;
+    for (uint32_t pass : graph.GetCompiledPasses()) {
+        if (!names.empty()) {
+            names += ",";
+        }
+        names += graph.GetPassName(pass);
+    }
+    return names;
+}
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+// Mirrors the editor viewport: shadows -> scene -> exposure -> tone map
+FrameGraphHandle BuildViewportGraph(FrameGraph& graph, bool hasShadowCaster, std::vector<std::string>& executed) {
+    graph.Reset();
+    FrameGraphHandle shadow = graph.ImportTexture("Shadow", MakeDesc(2048, 2048, RenderTargetFormat::Depth32F), 7, 8);
+    FrameGraphBuilder shadowPass = graph.AddPass("Shadow", [&executed](const FrameGraphResources&) { executed.push_back("Shadow"); });
+    shadow = shadowPass.Write(shadow, FrameGraphAccess::DepthStencil);
+    
+    FrameGraphHandle color = graph.CreateTexture("SceneColor", MakeDesc(1280, 720, RenderTargetFormat::RGBA16F));
+    FrameGraphHandle depth = graph.CreateTexture("SceneDepth", MakeDesc(1280, 720, RenderTargetFormat::Depth24Stencil8));
+    FrameGraphBuilder scene = graph.AddPass("Scene", [&executed](const FrameGraphResources&) { executed.push_back("Scene"); });
+    if (hasShadowCaster) {
+        scene.Read(shadow);
+    }
+    color = scene.Write(color);
+    depth = scene.Write(depth, FrameGraphAccess::DepthStencil);
+    
+    FrameGraphBuilder exposure = graph.AddPass("Exposure", [&executed](const FrameGraphResources&) { executed.push_back("Exposure"); });
+    exposure.Read(color);
+    exposure.SetSideEffect();
+    
+    FrameGraphHandle ldr = graph.ImportTexture("LDR", MakeDesc(1280, 720, RenderTargetFormat::RGBA8), 3, 4);
+    FrameGraphBuilder toneMap = graph.AddPass("ToneMap", [&executed, color](const FrameGraphResources& resources) {
+        executed.push_back("ToneMap:" + std::to_string(resources.GetTexture(color)) + ":" + std::to_string(resources.GetFramebuffer()));
+    });
+    toneMap.Read(color);
+    ldr = toneMap.Write(ldr);
+    graph.MarkOutput(ldr);
+    return color;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::max(10, std::atoi(argv[1])) : 1000;
+    bool ok = true;
+    
+    RenderTargetAllocator allocator;
+    std::vector<uint32_t> destroyed;
+    FrameGraph graph;
+    std::vector<std::string> executed;
+    
+    // 1. Viewport graph: the shadow pass only survives when something samples it
+    BuildViewportGraph(graph, true, executed);
+    ok &= Expect(graph.Compile(&allocator), "viewport graph compiles");
+    ok &= Expect(CompiledNames(graph) == "Shadow,Scene,Exposure,ToneMap", "viewport order with caster");
+    allocator.EndFrame(destroyed);
+    
+    FrameGraphHandle sceneColor = BuildViewportGraph(graph, false, executed);
+    ok &= Expect(graph.Compile(&allocator), "viewport graph without caster compiles");
+    ok &= Expect(CompiledNames(graph) == "Scene,Exposure,ToneMap", "shadow pass culled without caster");
+    ok &= Expect(graph.IsCulled(0), "shadow pass reported culled");
+    
+    RecordingBackend backend;
+    executed.clear();
+    graph.Execute(backend);
+    uint32_t colorTarget = graph.GetTarget(sceneColor);
+    std::string expectedToneMap = "ToneMap:" + std::to_string(1000 + colorTarget) + ":4";
+    ok &= Expect(executed.size() == 3 && executed[0] == "Scene" && executed[2] == expectedToneMap,
+                 "execution follows compiled order with resolved resources");
+    ok &= Expect(backend.log.size() == 3 && backend.log[0].find("1280x720") != std::string::npos &&
+                 backend.log[1] == "bind 4 1280x720" && backend.log[2] == "end",
+                 "backend binds attachments per pass");
+    allocator.EndFrame(destroyed);
+    
+    // 2. Ordering comes from dependencies, not declaration: a pass declared
+    //    later that reads the old contents must run before the overwrite
+    graph.Reset();
+    FrameGraphHandle history = graph.CreateTexture("History", MakeDesc(640, 360, RenderTargetFormat::RGBA16F));
+    FrameGraphBuilder init = graph.AddPass("Init", nullptr);
+    history = init.Write(history);
+    FrameGraphHandle initial = history;
+    FrameGraphBuilder overwrite = graph.AddPass("Overwrite", nullptr);
+    history = overwrite.Write(history, FrameGraphAccess::Storage);
+    FrameGraphHandle copy = graph.CreateTexture("Copy", MakeDesc(640, 360, RenderTargetFormat::RGBA16F));
+    FrameGraphBuilder reader = graph.AddPass("ReadOld", nullptr);
+    reader.Read(initial);
+    copy = reader.Write(copy);
+    FrameGraphBuilder resolve = graph.AddPass("Resolve", nullptr);
+    resolve.Read(history);
+    resolve.Read(copy);
+    resolve.SetSideEffect();
+    FrameGraphHandle unused = graph.CreateTexture("Debug", MakeDesc(640, 360, RenderTargetFormat::RGBA8));
+    FrameGraphBuilder debug = graph.AddPass("Debug", nullptr);
+    debug.Read(history);
+    debug.Write(unused);
+    
+    ok &= Expect(graph.Compile(&allocator), "dependency graph compiles");
+    ok &= Expect(CompiledNames(graph) == "Init,ReadOld,Overwrite,Resolve", "write-after-read ordering and culling");
+    ok &= Expect(graph.GetPassBarriers(resolve.GetPassIndex()) == FrameGraphBarrier::TextureFetch,
+                 "storage write then sampled read needs a texture fetch barrier");
+    ok &= Expect(graph.GetPassBarriers(reader.GetPassIndex()) == FrameGraphBarrier::None, "no barrier after attachment writes");
+    uint32_t first = 0;
+    uint32_t last = 0;
+    ok &= Expect(graph.GetLifetime(initial, first, last) && first == 0 && last == 3, "history lifetime spans its users");
+    ok &= Expect(!graph.GetLifetime(unused, first, last), "culled pass's target has no lifetime");
+    ok &= Expect(graph.GetTarget(unused) == RenderTargetAllocator::InvalidHandle, "culled pass's target is not allocated");
+    allocator.EndFrame(destroyed);
+    
+    // 3. Long post chain: every pass reads the previous result, so same-size
+    //    targets two passes apart can alias
+    const uint32_t chainLength = 48;
+    float worstCompileMs = 0.0f;
+    double totalCompileMs = 0.0;
+    uint32_t steadyCreates = 0;
+    RenderTargetStats chainStats;
+    for (int frame = 0; frame < frames; ++frame) {
+        graph.Reset();
+        FrameGraphHandle previous = graph.CreateTexture("Chain0", MakeDesc(1920, 1080, RenderTargetFormat::RGBA16F));
+        FrameGraphBuilder source = graph.AddPass("Source", nullptr);
+        previous = source.Write(previous);
+        for (uint32_t i = 1; i < chainLength; ++i) {
+            FrameGraphHandle next = graph.CreateTexture("Chain" + std::to_string(i),
+                                                        MakeDesc(1920, 1080, RenderTargetFormat::RGBA16F));
+            FrameGraphBuilder pass = graph.AddPass("Pass" + std::to_string(i), nullptr);
+            pass.Read(previous);
+            previous = pass.Write(next);
+        }
+        FrameGraphHandle output = graph.ImportTexture("Output", MakeDesc(1920, 1080, RenderTargetFormat::RGBA8), 1, 2);
+        FrameGraphBuilder present = graph.AddPass("Present", nullptr);
+        present.Read(previous);
+        graph.MarkOutput(present.Write(output));
+        
+        auto start = Clock::now();
+        if (!graph.Compile(&allocator)) {
+            std::printf("FAIL: chain graph did not compile\n");
+            return 1;
+        }
+        float ms = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+        worstCompileMs = std::max(worstCompileMs, ms);
+        totalCompileMs += ms;
+        
+        chainStats = allocator.GetStats();
+        allocator.EndFrame(destroyed);
+        if (frame > 0) {
+            steadyCreates += allocator.GetStats().createdThisFrame;
+        }
+    }
+    
+    const double toMB = 1.0 / (1024.0 * 1024.0);
+    std::printf("Frames: %d\n\n", frames);
+    std::printf("Post chain (%u passes, %u transients)\n", chainLength + 1, chainStats.transientRequests);
+    std::printf("  Aliased         %u of %u requests\n", chainStats.aliasedRequests, chainStats.transientRequests);
+    std::printf("  Memory          %.1f MB allocated vs %.1f MB without aliasing\n",
+                chainStats.transientBytesAllocated * toMB, chainStats.transientBytesRequested * toMB);
+    std::printf("  Steady state    %u allocations after the first frame\n", steadyCreates);
+    std::printf("  Compile         avg %.3f ms, worst %.3f ms\n", totalCompileMs / frames, worstCompileMs);
+    
+    ok &= Expect(chainStats.transientRequests == chainLength, "every chain target declared");
+    ok &= Expect(chainStats.transientBytesAllocated <= 2 * RenderTargetAllocator::GetBytes(MakeDesc(1920, 1080, RenderTargetFormat::RGBA16F)),
+                 "chain aliases down to two targets");
+    ok &= Expect(steadyCreates == 0, "no allocations in steady state");
+    return ok ? 0 : 1;
+}
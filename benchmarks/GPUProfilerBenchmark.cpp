@@ -0,0 +1,325 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// GPU profiler benchmark: drives the timestamp query pools against a mock backend
+// whose results arrive a configurable number of frames late, and checks that frames
+// are read back without ever waiting, that zones keep their nesting and line up with
+// the CPU timeline, that the pool ring grows to a GPU five frames behind, and that one
+// beyond the ring's limit drops frames and reports it instead of stalling.
+// Usage: LGE_GPUProfilerBenchmark [frames]
+
+#include "LGE/rendering/GPUProfiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Simulated GPU state, owned by the test so it outlives the profiler and its backend
+struct MockGPU {
+    uint32_t latency = 0;   // Frames until a written timestamp can be read
+    uint64_t frame = 0;
+    uint64_t writes = 0;
+    uint64_t polls = 0;
+    uint64_t stalls = 0;
+    int64_t liveQueries = 0;
+};
+
+// GPU clock = steady clock plus an arbitrary epoch offset; results become
+// available 'latency' frames after the timestamp was written
+class MockTimerBackend : public GPUTimerBackend {
+public:
+    static constexpr uint64_t kEpochOffset = 5000000000000ull;
+    
+    explicit MockTimerBackend(MockGPU& gpu) : gpu(gpu) {}
+    
+    bool IsSupported() const override { return true; }
+    
+    void CreateQueries(uint32_t count, uint32_t* outQueries) override {
+        for (uint32_t i = 0; i < count; ++i) {
+            outQueries[i] = nextQuery++;
+            queries[outQueries[i]] = Query();
+        }
+        gpu.liveQueries += count;
+    }
+    
+    void DestroyQueries(uint32_t count, const uint32_t* queries) override {
+        for (uint32_t i = 0; i < count; ++i) {
+            this->queries.erase(queries[i]);
+        }
+        gpu.liveQueries -= count;
+    }
+    
+    void WriteTimestamp(uint32_t query) override {
+        Query& entry = queries[query];
+        entry.value = GetGPUTime();
+        entry.readyFrame = gpu.frame + gpu.latency;
+        entry.written = true;
+        gpu.writes++;
+    }
+    
+    bool IsResultAvailable(uint32_t query) override {
+        gpu.polls++;
+        const Query& entry = queries[query];
+        return entry.written && gpu.frame >= entry.readyFrame;
+    }
+    
+    uint64_t GetResult(uint32_t query) override {
+        const Query& entry = queries[query];
+        if (!entry.written || gpu.frame < entry.readyFrame) {
+            gpu.stalls++; // A real driver would block here
+        }
+        return queries[query].value;
+    }
+    
+    uint64_t GetGPUTime() override {
+        return kEpochOffset + static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now().time_since_epoch()).count());
+    }
+    
+    struct Query {
+        uint64_t value = 0;
+        uint64_t readyFrame = 0;
+        bool written = false;
+    };
+    
+    MockGPU& gpu;
+    std::unordered_map<uint32_t, Query> queries;
+    uint32_t nextQuery = 1;
+};
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+void SpinMicroseconds(int microseconds) {
+    auto until = Clock::now() + std::chrono::microseconds(microseconds);
+    while (Clock::now() < until) {
+    }
+}
+
+// The editor viewport's GPU zones: shadows, then the scene with nested draws, then post
+void RecordFrame(GPUProfiler& profiler, MockGPU& gpu, std::vector<uint64_t>& outShadowCpuTicks) {
+    Profiling::MarkFrame();
+    profiler.BeginFrame();
+    {
+        outShadowCpuTicks.push_back(Profiling::Now());
+        GPUScope shadow("ShadowMap");
+        SpinMicroseconds(50);
+    }
+    {
+        GPUScope scene("Scene");
+        {
+            GPUScope skybox("Skybox");
+            SpinMicroseconds(20);
+        }
+        {
+            GPUScope grid("Grid");
+            SpinMicroseconds(10);
+        }
+    }
+    {
+        GPUScope toneMap("ToneMap");
+        SpinMicroseconds(10);
+    }
+    profiler.EndFrame();
+    gpu.frame++;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::max(10, std::atoi(argv[1])) : 120;
+    bool ok = true;
+    
+    Profiling::SetThreadName("Main");
+    
+    // 1. Steady state: the GPU is two frames behind, inside the three-frame budget
+    MockGPU steadyGPU;
+    steadyGPU.latency = 2;
+    uint64_t runBegin = Profiling::Now();
+    std::vector<uint64_t> shadowCpuTicks;
+    GPUProfilerStats steadyStats;
+    uint32_t track = 0;
+    {
+        GPUProfiler profiler(std::make_unique<MockTimerBackend>(steadyGPU));
+        GPUProfiler::SetActive(&profiler);
+        track = profiler.GetTrack();
+        ok &= Expect(profiler.BeginZone("BeforeFrame") == GPUProfiler::InvalidZone, "zones outside a frame are ignored");
+        
+        for (int frame = 0; frame < frames; ++frame) {
+            RecordFrame(profiler, steadyGPU, shadowCpuTicks);
+        }
+        steadyStats = profiler.GetStats();
+        
+        // Empty frames flush the last two frames still in flight
+        for (uint32_t frame = 0; frame < GPUProfiler::kFramesInFlight; ++frame) {
+            profiler.BeginFrame();
+            profiler.EndFrame();
+            steadyGPU.frame++;
+        }
+        
+        // 2. Too many zones in one frame
+        profiler.BeginFrame();
+        for (uint32_t z = 0; z < GPUProfiler::kMaxZonesPerFrame + 10; ++z) {
+            GPUScope zone("Overflow");
+        }
+        profiler.EndFrame();
+        ok &= Expect(profiler.GetStats().overflowZones == 10, "zones beyond the pool size are counted, not recorded");
+        GPUProfiler::SetActive(nullptr);
+    }
+    int64_t liveAfterDestroy = steadyGPU.liveQueries;
+    uint64_t runEnd = Profiling::Now();
+    
+    // Zones on the GPU lane, in frame order
+    std::vector<ProfileZone> zones;
+    Profiling::CollectZones(runBegin, runEnd, zones);
+    zones.erase(std::remove_if(zones.begin(), zones.end(), [track](const ProfileZone& zone) {
+        return zone.threadIndex != track;
+    }), zones.end());
+    
+    size_t shadowCount = 0;
+    size_t nestedOk = 0;
+    size_t nestedCount = 0;
+    double worstAlignmentUs = 0.0;
+    const double ticksPerMicrosecond = Profiling::GetTicksPerSecond() / 1000000.0;
+    const ProfileZone* currentScene = nullptr;
+    for (const ProfileZone& zone : zones) {
+        std::string name = zone.name;
+        if (name == "ShadowMap") {
+            if (shadowCount < shadowCpuTicks.size()) {
+                double error = std::fabs(static_cast<double>(zone.begin) - static_cast<double>(shadowCpuTicks[shadowCount])) / ticksPerMicrosecond;
+                worstAlignmentUs = std::max(worstAlignmentUs, error);
+            }
+            shadowCount++;
+        } else if (name == "Scene") {
+            currentScene = &zone;
+        } else if (name == "Skybox" || name == "Grid") {
+            nestedCount++;
+            if (currentScene && zone.depth == 1 && zone.begin >= currentScene->begin && zone.end <= currentScene->end) {
+                nestedOk++;
+            }
+        }
+    }
+    
+    // 3. The GPU falls five frames behind: the ring grows instead of dropping frames
+    MockGPU slowGPU;
+    slowGPU.latency = 5;
+    GPUProfilerStats slowStats;
+    {
+        GPUProfiler profiler(std::make_unique<MockTimerBackend>(slowGPU));
+        GPUProfiler::SetActive(&profiler);
+        std::vector<uint64_t> unused;
+        for (int frame = 0; frame < frames; ++frame) {
+            RecordFrame(profiler, slowGPU, unused);
+        }
+        slowStats = profiler.GetStats();
+        GPUProfiler::SetActive(nullptr);
+    }
+    
+    // 4. Further behind than the ring may grow: frames are dropped, never waited on,
+    // and the stats say so
+    MockGPU stuckGPU;
+    stuckGPU.latency = GPUProfiler::kMaxFramesInFlight + 4;
+    GPUProfilerStats stuckStats;
+    {
+        GPUProfiler profiler(std::make_unique<MockTimerBackend>(stuckGPU));
+        GPUProfiler::SetActive(&profiler);
+        std::vector<uint64_t> unused;
+        for (int frame = 0; frame < frames; ++frame) {
+            RecordFrame(profiler, stuckGPU, unused);
+        }
+        stuckStats = profiler.GetStats();
+        GPUProfiler::SetActive(nullptr);
+    }
+    
+    // 5. CPU cost of a zone (mock backend calls included)
+    double nsPerZone = 0.0;
+    {
+        MockGPU timedGPU;
+        timedGPU.latency = 2;
+        GPUProfiler profiler(std::make_unique<MockTimerBackend>(timedGPU));
+        GPUProfiler::SetActive(&profiler);
+        const int timedFrames = 2000;
+        const int timedZones = 50;
+        auto start = Clock::now();
+        for (int frame = 0; frame < timedFrames; ++frame) {
+            profiler.BeginFrame();
+            for (int z = 0; z < timedZones; ++z) {
+                GPUScope zone("Timed");
+            }
+            profiler.EndFrame();
+            timedGPU.frame++;
+        }
+        nsPerZone = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (timedFrames * timedZones);
+        GPUProfiler::SetActive(nullptr);
+    }
+    
+    std::printf("Frames: %d\n\n", frames);
+    std::printf("GPU 2 frames behind\n");
+    std::printf("  Resolved        %u frames (latency %u), %u dropped\n", steadyStats.resolvedFrames,
+                steadyStats.latencyFrames, steadyStats.droppedFrames);
+    std::printf("  GPU frame       %.3f ms\n", steadyStats.frameMs);
+    std::printf("  Alignment       worst %.1f us between CPU and GPU timelines\n", worstAlignmentUs);
+    std::printf("  Nesting         %zu / %zu nested zones inside their parent\n", nestedOk, nestedCount);
+    std::printf("  Readback        %llu polls, %llu stalls\n", static_cast<unsigned long long>(steadyGPU.polls),
+                static_cast<unsigned long long>(steadyGPU.stalls));
+    std::printf("  Zone cost       %.1f ns\n", nsPerZone);
+    std::printf("GPU 5 frames behind\n");
+    std::printf("  Resolved        %u frames (latency %u, %u pools), %u dropped, %llu stalls\n", slowStats.resolvedFrames,
+                slowStats.latencyFrames, slowStats.framesInFlight, slowStats.droppedFrames,
+                static_cast<unsigned long long>(slowGPU.stalls));
+    std::printf("GPU %u frames behind\n", stuckGPU.latency);
+    std::printf("  Resolved        %u frames (%u pools), %u dropped, %u since last readback, %llu stalls\n",
+                stuckStats.resolvedFrames, stuckStats.framesInFlight, stuckStats.droppedFrames,
+                stuckStats.framesSinceResolve, static_cast<unsigned long long>(stuckGPU.stalls));
+    
+    ok &= Expect(steadyGPU.stalls == 0 && slowGPU.stalls == 0 && stuckGPU.stalls == 0, "results are only read once available");
+    ok &= Expect(steadyStats.droppedFrames == 0, "no drops within the frames-in-flight budget");
+    ok &= Expect(steadyStats.latencyFrames == 2, "frames read back as soon as the GPU finished them");
+    ok &= Expect(steadyStats.resolvedFrames >= static_cast<uint32_t>(frames) - 2, "every steady frame resolved");
+    ok &= Expect(shadowCount == static_cast<size_t>(frames), "one shadow zone per frame on the GPU lane");
+    ok &= Expect(nestedCount > 0 && nestedOk == nestedCount, "nested zones stay inside their parent");
+    ok &= Expect(worstAlignmentUs < 100.0, "GPU zones line up with the CPU timeline");
+    ok &= Expect(steadyStats.framesInFlight == GPUProfiler::kFramesInFlight, "the ring stays at its initial size when the GPU keeps up");
+    ok &= Expect(slowStats.droppedFrames == 0 && slowStats.latencyFrames == 5, "the ring grows to a GPU five frames behind");
+    ok &= Expect(slowStats.resolvedFrames >= static_cast<uint32_t>(frames) - 5, "every slow frame resolved");
+    ok &= Expect(slowStats.framesSinceResolve <= slowStats.framesInFlight, "resolving frames are not reported stale");
+    ok &= Expect(stuckStats.framesInFlight == GPUProfiler::kMaxFramesInFlight, "the ring stops growing at its limit");
+    ok &= Expect(stuckStats.droppedFrames > 0 && stuckStats.resolvedFrames == 0, "a GPU too far behind drops frames instead of stalling");
+    ok &= Expect(stuckStats.framesSinceResolve > stuckStats.framesInFlight, "dropping every frame is reported");
+    ok &= Expect(liveAfterDestroy == 0, "query pools released on destruction");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,285 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// GUID registry benchmark: registers a large project's GUIDs and paths, then
+// compares lookups and load time against the old layout (two string-keyed
+// unordered_maps with the unmixed GUID hash, persisted as JSON). Also checks
+// GUIDMap against std::unordered_map under inserts and erases, how the old and
+// new GUID hashes spread structured GUIDs over power-of-two tables, and that
+// the binary file round-trips.
+// Usage: LGE_GUIDRegistryBenchmark [entries]
+
+#include "LGE/core/GUIDMap.h"
+#include "LGE/core/GUIDRegistry.h"
+#include "LGE/core/filesystem/FileSystem.h"
+#include "LGE/core/filesystem/PathTable.h"
+#include "LGE/core/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+double NanosecondsPer(Clock::time_point start, size_t count) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(count);
+}
+
+// std::hash<GUID> before it mixed the halves
+struct LegacyGUIDHash {
+    size_t operator()(const GUID& guid) const {
+        return std::hash<uint64_t>()(guid.GetHigh()) ^ (std::hash<uint64_t>()(guid.GetLow()) << 1);
+    }
+};
+
+std::string LegacyNormalize(const std::string& path) {
+    std::string normalized = path;
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+    if (normalized.empty() || normalized[0] != '/') {
+        normalized = "/" + normalized;
+    }
+    return normalized;
+}
+
+// Distinct slots the hashes land in for a table of 2^bits slots
+template <typename Hasher>
+size_t CountSlots(const std::vector<GUID>& guids, int bits) {
+    std::unordered_set<size_t> slots;
+    for (const GUID& guid : guids) {
+        slots.insert(Hasher()(guid) & ((size_t(1) << bits) - 1));
+    }
+    return slots.size();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::max(1000, std::atoi(argv[1])) : 1000000;
+    bool ok = true;
+    Log::SetConsoleOutput(false);
+    
+    std::filesystem::path root = std::filesystem::temp_directory_path() / "lge_guid_registry";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    
+    std::vector<GUID> guids;
+    std::vector<std::string> paths;
+    guids.reserve(count);
+    paths.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        guids.push_back(GUID::Generate());
+        paths.push_back("/Assets/Folder" + std::to_string(i % 1000) + "/Asset" + std::to_string(i) + ".png");
+    }
+    std::mt19937 rng(7);
+    std::vector<size_t> queries(count);
+    for (size_t& query : queries) {
+        query = std::uniform_int_distribution<size_t>(0, count - 1)(rng);
+    }
+    size_t checksum = 0;
+    
+    // 1. The old layout: every path stored twice, unmixed GUID hash
+    std::unordered_map<GUID, std::string, LegacyGUIDHash> legacyToPath;
+    std::unordered_map<std::string, GUID> legacyToGUID;
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < count; ++i) {
+        legacyToPath[guids[i]] = paths[i];
+        legacyToGUID[paths[i]] = guids[i];
+    }
+    double legacyInsertNs = NanosecondsPer(start, count);
+    // Like the old API: paths are returned by value and normalized before lookup
+    start = Clock::now();
+    for (size_t query : queries) {
+        std::string path = legacyToPath.find(guids[query])->second;
+        checksum += path.size();
+    }
+    double legacyByGuidNs = NanosecondsPer(start, count);
+    start = Clock::now();
+    for (size_t query : queries) {
+        checksum += legacyToGUID.find(LegacyNormalize(paths[query]))->second.GetLow() & 1;
+    }
+    double legacyByPathNs = NanosecondsPer(start, count);
+    
+    // The containers alone
+    GUIDMap<uint32_t> guidMap;
+    std::unordered_map<GUID, uint32_t, LegacyGUIDHash> legacyMap;
+    for (size_t i = 0; i < count; ++i) {
+        guidMap[guids[i]] = static_cast<uint32_t>(i);
+        legacyMap[guids[i]] = static_cast<uint32_t>(i);
+    }
+    start = Clock::now();
+    for (size_t query : queries) {
+        checksum += legacyMap.find(guids[query])->second;
+    }
+    double legacyMapNs = NanosecondsPer(start, count);
+    start = Clock::now();
+    for (size_t query : queries) {
+        checksum += *guidMap.Find(guids[query]);
+    }
+    double guidMapNs = NanosecondsPer(start, count);
+    legacyMap.clear();
+    guidMap.Clear();
+    
+    // The JSON file the old SaveToFile wrote
+    std::filesystem::path jsonFile = root / "guid_registry.json";
+    {
+        std::ostringstream json;
+        json << "{\n  \"assets\": [\n";
+        size_t index = 0;
+        for (const auto& [guid, path] : legacyToPath) {
+            json << "    {\n      \"guid\": \"" << guid.ToString() << "\",\n      \"path\": \"" << path << "\"\n    }";
+            json << (++index < legacyToPath.size() ? ",\n" : "\n");
+        }
+        json << "  ]\n}\n";
+        FileSystem::WriteFile(jsonFile.string(), json.str());
+    }
+    legacyToPath.clear();
+    legacyToGUID.clear();
+    
+    // 2. GUIDRegistry: GUIDMap one way, a PathId-indexed array the other, one interned string
+    GUIDRegistry registry;
+    start = Clock::now();
+    for (size_t i = 0; i < count; ++i) {
+        registry.RegisterAsset(guids[i], paths[i]);
+    }
+    double insertNs = NanosecondsPer(start, count);
+    start = Clock::now();
+    for (size_t query : queries) {
+        checksum += registry.GetPathFromGUID(guids[query]).size();
+    }
+    double byGuidNs = NanosecondsPer(start, count);
+    start = Clock::now();
+    for (size_t query : queries) {
+        checksum += registry.GetGUIDFromPath(paths[query]).GetLow() & 1;
+    }
+    double byPathNs = NanosecondsPer(start, count);
+    
+    bool consistent = registry.GetAssetCount() == count;
+    for (size_t i = 0; i < count; i += 97) {
+        consistent &= registry.GetGUIDFromPath(paths[i]) == guids[i] && registry.GetPathFromGUID(guids[i]) == paths[i];
+    }
+    ok &= Expect(consistent, "registry maps both directions");
+    
+    std::filesystem::path binaryFile = root / "guid_registry.bin";
+    start = Clock::now();
+    ok &= Expect(registry.SaveToFile(binaryFile), "binary save");
+    double saveMs = MillisecondsSince(start);
+    
+    GUIDRegistry fromJson;
+    start = Clock::now();
+    ok &= Expect(fromJson.LoadFromFile(jsonFile), "legacy JSON still loads");
+    double jsonLoadMs = MillisecondsSince(start);
+    
+    GUIDRegistry fromBinary;
+    start = Clock::now();
+    ok &= Expect(fromBinary.LoadFromFile(binaryFile), "binary load");
+    double binaryLoadMs = MillisecondsSince(start);
+    
+    bool roundTrip = fromJson.GetAssetCount() == count && fromBinary.GetAssetCount() == count;
+    for (size_t i = 0; i < count; i += 89) {
+        roundTrip &= fromBinary.GetGUIDFromPath(paths[i]) == guids[i] && fromJson.GetPathFromGUID(guids[i]) == paths[i];
+    }
+    ok &= Expect(roundTrip, "both files round-trip every entry");
+    
+    // Moves and removals keep both directions in step
+    ok &= Expect(registry.UpdatePath(guids[0], "/Assets/Moved.png") && registry.GetGUIDFromPath(paths[0]) == GUID::Invalid() &&
+                 registry.GetGUIDFromPath("Assets\\Moved.png") == guids[0], "UpdatePath moves the entry");
+    ok &= Expect(registry.RemoveAsset(paths[1]) && !registry.RemoveAsset(guids[1]) && registry.GetAssetCount() == count - 2 + 1,
+                 "RemoveAsset by path drops the GUID too");
+    ok &= Expect(!registry.RegisterAsset(GUID::Generate(), paths[2]) && registry.RegisterAsset(guids[2], paths[2]),
+                 "a path keeps its GUID");
+    
+    // 3. GUIDMap against std::unordered_map under churn, including erases in long probe runs
+    GUIDMap<uint32_t> map;
+    std::unordered_map<GUID, uint32_t> reference;
+    std::vector<GUID> keys(guids.begin(), guids.begin() + std::min<size_t>(count, 200000));
+    bool sameContents = true;
+    for (int round = 0; round < 3; ++round) {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if ((i + round) % 3 == 0) {
+                sameContents &= map.Erase(keys[i]) == (reference.erase(keys[i]) != 0);
+            } else {
+                map[keys[i]] = static_cast<uint32_t>(i + round);
+                reference[keys[i]] = static_cast<uint32_t>(i + round);
+            }
+        }
+    }
+    sameContents &= map.Size() == reference.size();
+    for (const GUID& key : keys) {
+        const uint32_t* value = map.Find(key);
+        auto it = reference.find(key);
+        sameContents &= (value != nullptr) == (it != reference.end()) && (!value || *value == it->second);
+    }
+    ok &= Expect(sameContents && !map.Insert(GUID::Invalid(), 1), "GUIDMap matches std::unordered_map");
+    
+    // 4. GUIDs that differ only in their upper bits, as with counters packed into the high half
+    std::vector<GUID> structured;
+    for (size_t i = 0; i < 65536; ++i) {
+        structured.push_back(GUID(i << 40, 0x5EED));
+    }
+    size_t legacySlots = CountSlots<LegacyGUIDHash>(structured, 20);
+    size_t mixedSlots = CountSlots<std::hash<GUID>>(structured, 20);
+    ok &= Expect(mixedSlots > structured.size() * 9 / 10, "mixed hash spreads structured GUIDs");
+    
+    std::printf("entries=%zu\n", count);
+    std::printf("GUIDMap find     %7.1f ns  (unordered_map, unmixed hash %7.1f ns)\n", guidMapNs, legacyMapNs);
+    std::printf("insert           %7.1f ns  (two string maps %7.1f ns)\n", insertNs, legacyInsertNs);
+    std::printf("GUID -> path     %7.1f ns  (two string maps %7.1f ns)\n", byGuidNs, legacyByGuidNs);
+    std::printf("path -> GUID     %7.1f ns  (two string maps %7.1f ns)\n", byPathNs, legacyByPathNs);
+    std::printf("load             %7.1f ms  (JSON %7.1f ms, %.1fx), save %.1f ms\n", binaryLoadMs, jsonLoadMs, jsonLoadMs / binaryLoadMs, saveMs);
+    std::printf("file size        %7.1f MB  (JSON %7.1f MB)\n", std::filesystem::file_size(binaryFile) / (1024.0 * 1024.0),
+                std::filesystem::file_size(jsonFile) / (1024.0 * 1024.0));
+    std::printf("memory           %7.1f MB  registry + %.1f MB shared path strings\n", registry.GetMemoryUsage() / (1024.0 * 1024.0),
+                PathTable::Get().GetMemoryUsage() / (1024.0 * 1024.0));
+    std::printf("structured GUIDs %zu -> %zu of 2^20 slots (unmixed hash), %zu (mixed)\n", structured.size(), legacySlots, mixedSlots);
+    std::printf("checksum         %zu\n", checksum);
+    
+    ok &= Expect(binaryLoadMs < jsonLoadMs, "binary load beats JSON");
+    ok &= Expect(guidMapNs < legacyMapNs, "GUIDMap lookups beat unordered_map");
+    ok &= Expect(byGuidNs < legacyByGuidNs && byPathNs < legacyByPathNs, "registry lookups beat the two string maps");
+    
+    std::filesystem::remove_all(root);
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Decode benchmark for the bundled sky HDRIs.
+// Usage: LGE_HDRDecodeBenchmark [iterations] [files...]
+// Run from the repository root so the default asset paths resolve.
+
+#include "LGE/rendering/HDRDecoder.h"
+#include "LGE/core/JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void BenchmarkFile(const std::string& path, int iterations) {
+    double best = 1e30;
+    double total = 0.0;
+    HDRImage image;
+    
+    for (int i = 0; i < iterations; ++i) {
+        auto start = Clock::now();
+        if (!HDRDecoder::Load(path, image)) {
+            std::printf("%-70s FAILED\n", path.c_str());
+            return;
+        }
+        double ms = ElapsedMs(start);
+        best = std::min(best, ms);
+        total += ms;
+    }
+    
+    double megapixels = image.GetPixelCount() / 1.0e6;
+    std::printf("%-70s %5dx%-5d best %8.2f ms  avg %8.2f ms  %7.1f MPix/s\n",
+                path.c_str(), image.width, image.height, best, total / iterations, megapixels / (best / 1000.0));
+}
+
+// Reference conversion matching the previous Texture::LoadHDR loop
+void RGBEToFloatReference(const uint8_t* rgbe, float* rgb, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t* p = rgbe + i * 4;
+        if (p[3] == 0) {
+            rgb[i * 3] = rgb[i * 3 + 1] = rgb[i * 3 + 2] = 0.0f;
+            continue;
+        }
+        float exp = std::ldexp(1.0f, static_cast<int>(p[3]) - 128);
+        rgb[i * 3] = (p[0] + 0.5f) / 256.0f * exp;
+        rgb[i * 3 + 1] = (p[1] + 0.5f) / 256.0f * exp;
+        rgb[i * 3 + 2] = (p[2] + 0.5f) / 256.0f * exp;
+    }
+}
+
+void BenchmarkKernels() {
+    const size_t pixelCount = 4096 * 2048;
+    std::vector<uint8_t> rgbe(pixelCount * 4);
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> byteDist(0, 255);
+    std::uniform_int_distribution<int> expDist(110, 140);
+    for (size_t i = 0; i < pixelCount; ++i) {
+        rgbe[i * 4] = static_cast<uint8_t>(byteDist(rng));
+        rgbe[i * 4 + 1] = static_cast<uint8_t>(byteDist(rng));
+        rgbe[i * 4 + 2] = static_cast<uint8_t>(byteDist(rng));
+        rgbe[i * 4 + 3] = static_cast<uint8_t>(expDist(rng));
+    }
+    
+    std::vector<float> reference(pixelCount * 3);
+    std::vector<float> simd(pixelCount * 3);
+    std::vector<uint16_t> halves(pixelCount * 3);
+    
+    auto start = Clock::now();
+    RGBEToFloatReference(rgbe.data(), reference.data(), pixelCount);
+    double referenceMs = ElapsedMs(start);
+    
+    start = Clock::now();
+    HDRDecoder::RGBEToFloat(rgbe.data(), simd.data(), pixelCount);
+    double simdMs = ElapsedMs(start);
+    
+    start = Clock::now();
+    HDRDecoder::FloatToHalf(simd.data(), halves.data(), simd.size());
+    double halfMs = ElapsedMs(start);
+    
+    double maxRelError = 0.0;
+    for (size_t i = 0; i < reference.size(); ++i) {
+        double denom = std::max(std::fabs(static_cast<double>(reference[i])), 1e-30);
+        maxRelError = std::max(maxRelError, std::fabs(static_cast<double>(simd[i]) - reference[i]) / denom);
+    }
+    
+    std::printf("\nRGBE->float (%zu px): reference %.2f ms, SIMD %.2f ms (%.1fx), max rel error %.2e\n",
+                pixelCount, referenceMs, simdMs, referenceMs / std::max(simdMs, 1e-6), maxRelError);
+    std::printf("float->half (%zu values): %.2f ms\n", simd.size(), halfMs);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 5;
+    
+    std::vector<std::string> files;
+    for (int i = 2; i < argc; ++i) {
+        files.push_back(argv[i]);
+    }
+    if (files.empty()) {
+        files = {
+            "assets/HDR Sky/citrus_orchard_road_puresky_1k.hdr",
+            "assets/DaySkyHDRI057B_1K/DaySkyHDRI057B_1K_HDR.exr",
+            "assets/EXR Sky/kloofendal_48d_partly_cloudy_puresky_1k.exr",
+            "assets/EXR Sky/kloofendal_48d_partly_cloudy_puresky_4k.exr",
+        };
+    }
+    
+    JobSystem::Initialize();
+    std::printf("Workers: %u, iterations: %d\n\n", JobSystem::GetWorkerCount(), iterations);
+    
+    for (const auto& file : files) {
+        BenchmarkFile(file, iterations);
+    }
+    
+    BenchmarkKernels();
+    
+    JobSystem::Shutdown();
+    return 0;
+}
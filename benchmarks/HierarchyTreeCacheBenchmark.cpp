@@ -0,0 +1,198 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Hierarchy tree cache benchmark: builds a scene of nested GameObjects (30k by
+// default) and times an outliner frame that walks and searches the whole tree,
+// as the old windows did, against a frame served from HierarchyTreeCache.
+// Also times rebuilding, expanding and an incremental search, and checks that
+// expansion follows objects by GUID: it survives a rebuild, is dropped when
+// the object leaves the tree and does not carry over to a new object.
+// Usage: LGE_HierarchyTreeCacheBenchmark [objects]
+
+#include "LGE/ui/HierarchyTreeCache.h"
+#include "LGE/core/scene/GameObject.h"
+#include "LGE/core/Log.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kChildren = 10;
+constexpr int kGrandchildren = 10;
+constexpr size_t kVisibleRows = 40;
+constexpr int kFrames = 20;
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::string ToLower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(),
+        [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+    return text;
+}
+
+// What the outliners did every frame: visit every object and test its name
+size_t WalkAndSearch(const std::shared_ptr<GameObject>& object, const std::string& filter) {
+    size_t touched = ToLower(object->GetName()).find(filter) != std::string::npos ? 1 : 0;
+    for (const auto& child : object->GetChildren()) {
+        touched += WalkAndSearch(child, filter);
+    }
+    return touched;
+}
+
+bool HasRow(const std::vector<HierarchyRow>& rows, const GameObject* object) {
+    return std::any_of(rows.begin(), rows.end(), [&](const HierarchyRow& row) { return row.object == object; });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t objectCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 30000;
+    Log::SetConsoleOutput(false);
+    
+    // Roots with ten children of ten grandchildren each
+    const size_t perRoot = 1 + kChildren + kChildren * kGrandchildren;
+    std::vector<std::shared_ptr<GameObject>> roots;
+    for (size_t r = 0; roots.size() * perRoot < objectCount; ++r) {
+        auto root = std::make_shared<GameObject>("Group" + std::to_string(r));
+        for (int c = 0; c < kChildren; ++c) {
+            auto child = std::make_shared<GameObject>("Prop" + std::to_string(r) + "_" + std::to_string(c));
+            child->SetParent(root);
+            for (int g = 0; g < kGrandchildren; ++g) {
+                auto leaf = std::make_shared<GameObject>("Mesh" + std::to_string(r) + "_" + std::to_string(c) + "_" + std::to_string(g));
+                leaf->SetParent(child);
+            }
+        }
+        roots.push_back(root);
+    }
+    const size_t total = roots.size() * perRoot;
+    
+    HierarchyTreeCache cache;
+    auto start = Clock::now();
+    cache.SetRoots(roots);
+    double rebuildMs = MillisecondsSince(start);
+    
+    // Expand every root and child so every object has a row
+    start = Clock::now();
+    for (const auto& root : roots) {
+        cache.SetExpanded(root.get(), true);
+        for (const auto& child : root->GetChildren()) {
+            cache.SetExpanded(child.get(), true);
+        }
+    }
+    size_t expandedRows = cache.GetRows().size();
+    double expandMs = MillisecondsSince(start);
+    
+    // A frame draws only the rows in view
+    start = Clock::now();
+    size_t drawn = 0;
+    for (int frame = 0; frame < kFrames; ++frame) {
+        const auto& rows = cache.GetRows();
+        size_t first = (static_cast<size_t>(frame) * 997) % rows.size();
+        for (size_t i = first; i < std::min(rows.size(), first + kVisibleRows); ++i) {
+            drawn += rows[i].object->GetName().size() > 0 ? 1 : 0;
+        }
+    }
+    double cachedFrameMs = MillisecondsSince(start) / kFrames;
+    
+    start = Clock::now();
+    size_t walked = 0;
+    for (int frame = 0; frame < kFrames; ++frame) {
+        for (const auto& root : roots) {
+            walked += WalkAndSearch(root, "mesh1_");
+        }
+    }
+    double walkFrameMs = MillisecondsSince(start) / kFrames;
+    
+    // Typing a query one letter at a time narrows the previous matches
+    start = Clock::now();
+    for (const char* query : {"m", "me", "mes", "mesh", "mesh1", "mesh1_"}) {
+        cache.SetFilter(query);
+        cache.GetRows();
+    }
+    double searchMs = MillisecondsSince(start);
+    size_t matches = cache.GetMatchCount();
+    
+    std::printf("objects=%zu roots=%zu\n", total, roots.size());
+    std::printf("rebuild %.2f ms, expand all %.2f ms, type 6 letters %.2f ms\n", rebuildMs, expandMs, searchMs);
+    std::printf("frame: walk and search %.3f ms, cached rows %.4f ms (%.0fx)\n",
+                walkFrameMs, cachedFrameMs, cachedFrameMs > 0.0 ? walkFrameMs / cachedFrameMs : 0.0);
+    
+    bool ok = true;
+    ok &= Expect(cache.GetNodeCount() == total, "every object has a node");
+    ok &= Expect(expandedRows == total, "expanding every parent shows every object");
+    ok &= Expect(drawn == kFrames * kVisibleRows, "each frame draws one screen of rows");
+    ok &= Expect(matches * kFrames == walked, "incremental search matches a full search");
+    ok &= Expect(cachedFrameMs < walkFrameMs, "cached frame is cheaper than walking the tree");
+    
+    // Ancestors of matches stay visible and open while searching
+    const auto& filtered = cache.GetRows();
+    ok &= Expect(HasRow(filtered, roots[1].get()) && !HasRow(filtered, roots[2].get()), "search keeps only ancestors of matches");
+    cache.SetFilter("");
+    ok &= Expect(cache.GetRows().size() == total, "clearing the search restores the expanded rows");
+    
+    // Expansion survives a rebuild
+    cache.SetRoots(roots);
+    ok &= Expect(cache.IsExpanded(roots[0].get()) && cache.GetRows().size() == total, "expansion survives SetRoots");
+    
+    // An object that leaves the tree forgets its expansion
+    std::shared_ptr<GameObject> removed = roots.back();
+    roots.pop_back();
+    cache.SetRoots(roots);
+    roots.push_back(removed);
+    cache.SetRoots(roots);
+    ok &= Expect(!cache.IsExpanded(removed.get()), "expansion is dropped when the object leaves the tree");
+    
+    // A new object, even one at a destroyed object's address, starts collapsed
+    cache.SetExpanded(removed.get(), true);
+    roots.pop_back();
+    removed.reset();
+    cache.SetRoots(roots);
+    auto replacement = std::make_shared<GameObject>("Replacement");
+    std::make_shared<GameObject>("ReplacementChild")->SetParent(replacement);
+    roots.push_back(replacement);
+    cache.SetRoots(roots);
+    ok &= Expect(!cache.IsExpanded(replacement.get()), "a new object starts collapsed");
+    ok &= Expect(cache.GetRows().size() == total - perRoot + 1, "a new object's children stay hidden");
+    
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
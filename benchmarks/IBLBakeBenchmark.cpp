@@ -0,0 +1,138 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// IBL bake benchmark: cold bake vs. cache hit, plus SH accuracy against
+// brute-force cosine integration of the source HDRI.
+// Usage: LGE_IBLBakeBenchmark [hdri] [cacheDirectory]
+// Run from the repository root so the default asset path resolves.
+
+#include "LGE/rendering/IBLBaker.h"
+#include "LGE/rendering/HDRDecoder.h"
+#include "LGE/core/JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Reference irradiance for one normal by integrating every source pixel
+Math::Vector3 BruteForceIrradiance(const HDRImage& image, const Math::Vector3& n) {
+    const double pi = 3.14159265358979;
+    double sum[3] = {};
+    for (int y = 0; y < image.height; ++y) {
+        double theta = (y + 0.5) / image.height * pi;
+        for (int x = 0; x < image.width; ++x) {
+            double phi = ((x + 0.5) / image.width - 0.5) * 2.0 * pi;
+            double dx = std::sin(theta) * std::cos(phi);
+            double dy = std::cos(theta);
+            double dz = std::sin(theta) * std::sin(phi);
+            double cosine = dx * n.x + dy * n.y + dz * n.z;
+            if (cosine <= 0.0) {
+                continue;
+            }
+            double weight = (2.0 * pi / image.width) * (pi / image.height) * std::sin(theta) * cosine;
+            const float* p = image.pixels.data() + (static_cast<size_t>(y) * image.width + x) * 3;
+            sum[0] += p[0] * weight;
+            sum[1] += p[1] * weight;
+            sum[2] += p[2] * weight;
+        }
+    }
+    return Math::Vector3(static_cast<float>(sum[0]), static_cast<float>(sum[1]), static_cast<float>(sum[2]));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string hdri = argc > 1 ? argv[1] : "assets/HDR Sky/citrus_orchard_road_puresky_1k.hdr";
+    std::string cacheDirectory = argc > 2 ? argv[2] : (std::filesystem::temp_directory_path() / "LGE_IBLBakeBenchmark").string();
+    
+    JobSystem::Initialize();
+    std::printf("Workers: %u\nHDRI: %s\n\n", JobSystem::GetWorkerCount(), hdri.c_str());
+    
+    HDRImage image;
+    if (!HDRDecoder::Load(hdri, image)) {
+        std::printf("Failed to load %s\n", hdri.c_str());
+        JobSystem::Shutdown();
+        return 1;
+    }
+    
+    IBLBakeSettings settings;
+    IBLBakeResult result;
+    
+    auto start = Clock::now();
+    IBLBaker::ProjectIrradianceSH(image, result.irradianceSH);
+    double shMs = ElapsedMs(start);
+    
+    start = Clock::now();
+    IBLBaker::PrefilterSpecular(image, settings, result.specularMips);
+    double specularMs = ElapsedMs(start);
+    
+    std::printf("SH9 projection (%dx%d):          %8.2f ms\n", image.width, image.height, shMs);
+    std::printf("GGX prefilter (%upx, %zu mips, %u spp): %8.2f ms\n",
+                settings.specularResolution, result.specularMips.size(), settings.sampleCount, specularMs);
+    
+    // Cold LoadOrBake (decode + bake + write) followed by a cache hit
+    std::filesystem::remove_all(cacheDirectory);
+    IBLBakeResult cached;
+    start = Clock::now();
+    IBLBaker::LoadOrBake(hdri, cacheDirectory, settings, cached);
+    double coldMs = ElapsedMs(start);
+    
+    start = Clock::now();
+    IBLBaker::LoadOrBake(hdri, cacheDirectory, settings, cached);
+    double warmMs = ElapsedMs(start);
+    
+    std::printf("LoadOrBake cold:                  %8.2f ms\n", coldMs);
+    std::printf("LoadOrBake cached:                %8.2f ms (%.1fx)\n", warmMs, coldMs / std::max(warmMs, 1e-6));
+    
+    // L2 SH is a low-pass approximation; report its error on the axis normals
+    const Math::Vector3 normals[6] = {
+        {1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}
+    };
+    double maxRelError = 0.0;
+    for (const auto& n : normals) {
+        Math::Vector3 sh = IBLBaker::EvaluateIrradianceSH(result.irradianceSH, n);
+        Math::Vector3 reference = BruteForceIrradiance(image, n);
+        float channels[3][2] = {{sh.x, reference.x}, {sh.y, reference.y}, {sh.z, reference.z}};
+        for (const auto& c : channels) {
+            maxRelError = std::max(maxRelError, std::fabs(static_cast<double>(c[0]) - c[1]) / std::max(static_cast<double>(c[1]), 1e-6));
+        }
+    }
+    std::printf("\nSH irradiance vs brute force: max rel error %.2f%%\n", maxRelError * 100.0);
+    
+    std::filesystem::remove_all(cacheDirectory);
+    JobSystem::Shutdown();
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Luminance histogram reference check: bins hand-picked luminances, averages
+// hand-built histograms and derives exposure, comparing each against values
+// worked out from the binning and percentile rules by hand. Then times the
+// CPU reference over a full RGBA frame.
+// Usage: LGE_LuminanceHistogramBenchmark [width] [height]
+
+#include "LGE/rendering/LuminanceHistogram.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+bool Near(float value, float expected, float tolerance = 1e-4f) {
+    return std::fabs(value - expected) <= tolerance * std::max(1.0f, std::fabs(expected));
+}
+
+double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t width = argc > 1 ? static_cast<uint32_t>(std::atoi(argv[1])) : 1920;
+    uint32_t height = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 1080;
+    const LuminanceHistogramSettings settings;   // log2 range [-10, 10], percentiles 10%..90%
+    bool ok = true;
+    
+    // Binning: 254 bins over 20 stops, so bin 1 + floor((log2 L + 10) * 12.7)
+    ok &= Expect(LuminanceHistogram::BinForLuminance(0.0f, settings) == 0, "black lands in bin 0");
+    ok &= Expect(LuminanceHistogram::BinForLuminance(std::exp2(-11.0f), settings) == 0, "below the range lands in bin 0");
+    ok &= Expect(LuminanceHistogram::BinForLuminance(std::numeric_limits<float>::quiet_NaN(), settings) == 0, "NaN lands in bin 0");
+    ok &= Expect(LuminanceHistogram::BinForLuminance(std::exp2(-10.0f), settings) == 1, "range minimum is bin 1");
+    ok &= Expect(LuminanceHistogram::BinForLuminance(std::exp2(-5.0f), settings) == 64, "2^-5 is bin 64");
+    ok &= Expect(LuminanceHistogram::BinForLuminance(1.0f, settings) == 128, "1.0 is bin 128");
+    ok &= Expect(LuminanceHistogram::BinForLuminance(std::exp2(5.0f), settings) == 191, "2^5 is bin 191");
+    ok &= Expect(LuminanceHistogram::BinForLuminance(std::exp2(10.0f), settings) == 255, "range maximum is bin 255");
+    ok &= Expect(LuminanceHistogram::BinForLuminance(std::exp2(20.0f), settings) == 255, "above the range clamps to bin 255");
+    
+    // Bin centers: (bin - 0.5) / 254 of the way through the range
+    ok &= Expect(Near(LuminanceHistogram::BinCenterLog2(64, settings), -5.0f), "bin 64 is centered on 2^-5");
+    ok &= Expect(Near(LuminanceHistogram::BinCenterLog2(191, settings), 5.0f), "bin 191 is centered on 2^5");
+    ok &= Expect(Near(LuminanceHistogram::BinCenterLog2(128, settings), 10.0f / 254.0f), "bin 128 is centered just above 1.0");
+    
+    // Accumulate: Rec. 709 weights, RGBA stride, one pixel per case above
+    const float pixels[] = {
+        0.0f, 0.0f, 0.0f, 1.0f,                   // black -> 0
+        1.0f, 0.0f, 0.0f, 1.0f,                   // red, L = 0.2126 -> bin 99
+        0.0f, 1.0f, 0.0f, 1.0f,                   // green, L = 0.7152 -> bin 121
+        0.0f, 0.0f, 1.0f, 1.0f,                   // blue, L = 0.0722 -> bin 79
+        32.0f, 32.0f, 32.0f, 1.0f,                // gray 2^5 -> bin 191
+        std::exp2(-5.0f), std::exp2(-5.0f), std::exp2(-5.0f), 0.0f,   // gray 2^-5 -> bin 64
+    };
+    LuminanceHistogram::Bins bins{};
+    LuminanceHistogram::Accumulate(pixels, 6, 4, settings, bins);
+    uint32_t total = 0;
+    for (uint32_t count : bins) {
+        total += count;
+    }
+    ok &= Expect(total == 6 && bins[0] == 1 && bins[99] == 1 && bins[121] == 1 && bins[79] == 1 &&
+                 bins[191] == 1 && bins[64] == 1, "pixels land in the expected bins");
+    
+    // Averages of hand-built histograms
+    LuminanceHistogram::Bins histogram{};
+    ok &= Expect(Near(LuminanceHistogram::ComputeAverageLuminance(histogram, settings), std::exp2(-10.0f)), "empty histogram averages to the range minimum");
+    histogram[0] = 1000;
+    ok &= Expect(Near(LuminanceHistogram::ComputeAverageLuminance(histogram, settings), std::exp2(-10.0f)), "only-black histogram averages to the range minimum");
+    
+    // Bin 0 is ignored; 10% dark and 10% bright outliers fall outside the percentiles
+    histogram[1] = 10;
+    histogram[128] = 80;
+    histogram[255] = 10;
+    ok &= Expect(Near(LuminanceHistogram::ComputeAverageLuminance(histogram, settings), std::exp2(10.0f / 254.0f)),
+                 "percentiles drop the outliers");
+    
+    // Half at 2^-5, half at 2^5: geometric mean 1.0
+    histogram = {};
+    histogram[64] = 50;
+    histogram[191] = 50;
+    ok &= Expect(Near(LuminanceHistogram::ComputeAverageLuminance(histogram, settings), 1.0f), "symmetric histogram averages to 1.0");
+    
+    // Percentiles cut inside a bin: [25%, 100%] of 200 keeps 50 of bin 64 and all 100 of bin 191,
+    // so log2 average = (50 * -5 + 100 * 5) / 150 = 5/3
+    LuminanceHistogramSettings wide = settings;
+    wide.lowPercentile = 0.25f;
+    wide.highPercentile = 1.0f;
+    histogram[64] = 100;
+    histogram[191] = 100;
+    ok &= Expect(Near(LuminanceHistogram::ComputeAverageLuminance(histogram, wide), std::exp2(5.0f / 3.0f)), "partial bins are weighted by their share");
+    
+    // Exposure: middle gray target over the average, within [0.1, 10]
+    ok &= Expect(Near(LuminanceHistogram::ComputeTargetExposure(1.0f, 0.18f, 0.1f, 10.0f), 0.18f), "1.0 average gives exposure 0.18");
+    ok &= Expect(Near(LuminanceHistogram::ComputeTargetExposure(std::exp2(-5.0f), 0.18f, 0.1f, 10.0f), 5.76f), "2^-5 average gives exposure 5.76");
+    ok &= Expect(Near(LuminanceHistogram::ComputeTargetExposure(std::exp2(-10.0f), 0.18f, 0.1f, 100.0f), 18.0f), "dark average is held at 0.01");
+    ok &= Expect(Near(LuminanceHistogram::ComputeTargetExposure(std::exp2(-10.0f), 0.18f, 0.1f, 10.0f), 10.0f), "exposure clamps to the maximum");
+    ok &= Expect(Near(LuminanceHistogram::ComputeTargetExposure(1000.0f, 0.18f, 0.1f, 10.0f), 0.1f), "bright average clamps to the minimum");
+    
+    // End to end: a frame of 2^-5 and 2^5 gray in equal parts exposes middle gray at 0.18
+    std::vector<float> frame(static_cast<size_t>(width) * height * 4, 1.0f);
+    for (size_t i = 0; i < frame.size(); i += 4) {
+        float value = (i / 4) % 2 ? 32.0f : std::exp2(-5.0f);
+        frame[i] = frame[i + 1] = frame[i + 2] = value;
+    }
+    auto start = Clock::now();
+    LuminanceHistogram::Bins frameBins{};
+    LuminanceHistogram::Accumulate(frame.data(), static_cast<size_t>(width) * height, 4, settings, frameBins);
+    double accumulateMs = MillisecondsSince(start);
+    float average = LuminanceHistogram::ComputeAverageLuminance(frameBins, settings);
+    float exposure = LuminanceHistogram::ComputeTargetExposure(average, 0.18f, 0.1f, 10.0f);
+    ok &= Expect(Near(average, 1.0f) && Near(exposure, 0.18f), "frame averages to 1.0 and exposes at 0.18");
+    
+    std::printf("frame %ux%u: accumulate %.2f ms, average %.4f, exposure %.4f\n", width, height, accumulateMs, average, exposure);
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
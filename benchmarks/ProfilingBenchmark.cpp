@@ -0,0 +1,237 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Profiling benchmark: measures the cost of a CPU zone against the two timestamp
+// reads it needs, then records nested zones
+// from several threads while a reader collects concurrently, and checks that every
+// zone comes back intact, nested correctly and in the Chrome trace export.
+// Usage: LGE_ProfilingBenchmark [zonesPerThread]
+
+#include "LGE/core/Profiling.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const char* const kThreadZones[] = { "Outer0", "Outer1", "Outer2", "Outer3" };
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+// Two levels per iteration: one outer zone wrapping one inner zone
+void RecordNested(int threadIndex, int iterations) {
+    Profiling::SetThreadName("Producer " + std::to_string(threadIndex));
+    for (int i = 0; i < iterations; ++i) {
+        LGE_PROFILE_SCOPE(kThreadZones[threadIndex]);
+        LGE_PROFILE_SCOPE("Inner");
+    }
+}
+
+// Best of several batches, so a preempted batch does not count against the zone
+template <typename Func>
+double BestNsPerIteration(Func&& func) {
+    const int batches = 20;
+    const int iterations = 100000;
+    double best = 1e9;
+    for (int batch = 0; batch < batches; ++batch) {
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            func();
+        }
+        best = std::min(best, std::chrono::duration<double, std::nano>(Clock::now() - start).count() / iterations);
+    }
+    return best;
+}
+
+bool IsKnownName(const char* name) {
+    if (name == nullptr) return false;
+    for (const char* known : kThreadZones) {
+        if (name == known) return true;
+    }
+    return std::string(name) == "Inner";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    // Two zones per iteration; keep every producer's zones inside its ring
+    int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 2000;
+    iterations = std::min<int>(iterations, static_cast<int>(Profiling::kZonesPerThread / 2));
+    const int producerCount = 4;
+    bool ok = true;
+    
+    // 1. Cost per zone on a warm thread (ring wraps many times)
+    Profiling::SetThreadName("Main");
+    {
+        LGE_PROFILE_SCOPE("Warmup");
+    }
+    double nsPerZone = BestNsPerIteration([]() {
+        LGE_PROFILE_SCOPE("Timed");
+    });
+    
+    // The two timestamp reads every zone needs, without recording anything
+    std::atomic<uint64_t> sink{0};
+    double nsClockPair = BestNsPerIteration([&sink]() {
+        uint64_t begin = Profiling::Now();
+        uint64_t end = Profiling::Now();
+        sink.store(end - begin, std::memory_order_relaxed);
+    });
+    
+    Profiling::SetEnabled(false);
+    double nsDisabled = BestNsPerIteration([]() {
+        LGE_PROFILE_SCOPE("Disabled");
+    });
+    Profiling::SetEnabled(true);
+    
+    // Calibration happens once; later calls return the cached rate
+    double ticksPerSecond = Profiling::GetTicksPerSecond();
+    auto start = Clock::now();
+    bool rateStable = true;
+    for (int i = 0; i < 1000; ++i) {
+        rateStable &= Profiling::GetTicksPerSecond() == ticksPerSecond;
+    }
+    double nsRateQuery = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / 1000;
+    
+    // 2. Concurrent producers with a reader sweeping the rings meanwhile
+    Profiling::MarkFrame();
+    uint64_t rangeBegin = Profiling::Now();
+    std::atomic<bool> producing{true};
+    std::atomic<size_t> tornZones{0};
+    std::atomic<int> sweeps{0};
+    std::thread reader([&]() {
+        std::vector<ProfileZone> zones;
+        while (producing.load()) {
+            Profiling::CollectZones(rangeBegin, Profiling::Now(), zones);
+            for (const ProfileZone& zone : zones) {
+                if (zone.end < zone.begin || zone.depth > 1 || !zone.name) {
+                    tornZones.fetch_add(1);
+                }
+            }
+            sweeps.fetch_add(1);
+            std::this_thread::yield();
+        }
+    });
+    
+    std::vector<std::thread> producers;
+    for (int t = 0; t < producerCount; ++t) {
+        producers.emplace_back(RecordNested, t, iterations);
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    producing.store(false);
+    reader.join();
+    uint64_t rangeEnd = Profiling::Now();
+    Profiling::MarkFrame();
+    
+    std::vector<ProfileZone> zones;
+    Profiling::CollectZones(rangeBegin, rangeEnd, zones);
+    
+    std::vector<ProfileThreadInfo> threads = Profiling::GetThreads();
+    std::vector<int> outerPerThread(threads.size(), 0);
+    std::vector<int> innerPerThread(threads.size(), 0);
+    bool namesIntact = true;
+    bool nestingIntact = true;
+    for (size_t i = 0; i < zones.size(); ++i) {
+        const ProfileZone& zone = zones[i];
+        namesIntact &= IsKnownName(zone.name);
+        if (zone.threadIndex >= threads.size()) {
+            namesIntact = false;
+            continue;
+        }
+        if (zone.depth == 0) {
+            ++outerPerThread[zone.threadIndex];
+            // Sorted by begin, so the matching inner zone follows its parent
+            nestingIntact &= i + 1 < zones.size() && zones[i + 1].depth == 1 &&
+                             zones[i + 1].begin >= zone.begin && zones[i + 1].end <= zone.end;
+        } else {
+            ++innerPerThread[zone.threadIndex];
+        }
+    }
+    
+    int producerThreads = 0;
+    bool countsMatch = true;
+    for (size_t t = 0; t < threads.size(); ++t) {
+        if (threads[t].name.rfind("Producer ", 0) == 0) {
+            ++producerThreads;
+            countsMatch &= outerPerThread[t] == iterations && innerPerThread[t] == iterations;
+        }
+    }
+    
+    // 3. Trace export holds every zone still in the rings
+    const std::string tracePath = "LGE_ProfilingBenchmark_trace.json";
+    ok &= Expect(Profiling::ExportChromeTrace(tracePath), "trace export succeeds");
+    std::ifstream traceFile(tracePath);
+    std::stringstream trace;
+    trace << traceFile.rdbuf();
+    traceFile.close();
+    std::remove(tracePath.c_str());
+    std::string traceText = trace.str();
+    size_t completeEvents = 0;
+    for (size_t pos = traceText.find("\"ph\":\"X\""); pos != std::string::npos; pos = traceText.find("\"ph\":\"X\"", pos + 1)) {
+        ++completeEvents;
+    }
+    size_t expectedEvents = static_cast<size_t>(producerCount) * iterations * 2;
+    
+    std::printf("Zone cost          %.1f ns (disabled %.1f ns)\n", nsPerZone, nsDisabled);
+    std::printf("Timestamp pair     %.1f ns, recording overhead %.1f ns\n", nsClockPair, nsPerZone - nsClockPair);
+    std::printf("Tick rate          %.3f GHz (%.1f ns per query)\n", ticksPerSecond / 1e9, nsRateQuery);
+    std::printf("Producers          %d threads x %d nested pairs\n", producerCount, iterations);
+    std::printf("Collected          %zu zones, %d concurrent sweeps, %zu torn\n", zones.size(), sweeps.load(), tornZones.load());
+    std::printf("Trace events       %zu complete events (%zu bytes)\n", completeEvents, traceText.size());
+    
+    // A zone cannot be cheaper than its two timestamp reads, which alone can
+    // approach 50 ns under virtualization; the budget covers what is recorded
+    // on top of them, and the absolute target where the clock allows it
+    ok &= Expect(nsPerZone - nsClockPair < 12.0, "recording costs under 12 ns on top of the timestamps");
+    ok &= Expect(nsClockPair > 40.0 || nsPerZone < 50.0, "zone costs under 50 ns");
+    ok &= Expect(rateStable && nsRateQuery < 100.0, "tick rate calibrated once and cached");
+    ok &= Expect(producerThreads == producerCount, "every producer thread registered");
+    ok &= Expect(countsMatch, "every zone recorded once per thread");
+    ok &= Expect(namesIntact, "zone names and threads intact");
+    ok &= Expect(nestingIntact, "inner zones nest inside their parents");
+    ok &= Expect(tornZones.load() == 0, "concurrent reads never see torn zones");
+    ok &= Expect(completeEvents >= expectedEvents, "trace export contains every producer zone");
+    
+    uint64_t frameBegin = 0;
+    uint64_t frameEnd = 0;
+    ok &= Expect(Profiling::GetFrameRange(0, frameBegin, frameEnd) && frameBegin < rangeBegin && frameEnd > rangeEnd,
+                 "frame markers bracket the producer zones");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,179 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Render target pool benchmark: drives the allocator through a viewport
+// resize drag and a post-processing chain of transient targets, checks that
+// overlapping lifetimes never share a target, and reports reuse and memory
+// against creating every target on demand.
+// Usage: LGE_RenderTargetPoolBenchmark [frames]
+
+#include "LGE/rendering/RenderTargetAllocator.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Request {
+    uint32_t transient;
+    uint32_t firstPass;
+    uint32_t lastPass;
+};
+
+RenderTargetDesc MakeDesc(uint32_t width, uint32_t height, RenderTargetFormat format) {
+    RenderTargetDesc desc;
+    desc.width = width;
+    desc.height = height;
+    desc.format = format;
+    return desc;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::max(10, std::atoi(argv[1])) : 600;
+    const double toMB = 1.0 / (1024.0 * 1024.0);
+    
+    RenderTargetAllocator allocator;
+    std::vector<uint32_t> destroyed;
+    
+    // 1. Viewport drag: size changes every frame for a while, then the panel
+    //    is toggled between two docked sizes
+    uint32_t naiveCreates = 0;
+    uint32_t poolCreates = 0;
+    uint32_t color = RenderTargetAllocator::InvalidHandle;
+    uint32_t depth = RenderTargetAllocator::InvalidHandle;
+    uint32_t lastWidth = 0;
+    uint32_t lastHeight = 0;
+    for (int frame = 0; frame < frames; ++frame) {
+        uint32_t width;
+        uint32_t height;
+        if (frame < frames / 4) {
+            width = 1280 + static_cast<uint32_t>(frame) * 4;
+            height = 720 + static_cast<uint32_t>(frame) * 2;
+        } else {
+            bool maximized = (frame / 20) % 2 == 0;
+            width = maximized ? 1920 : 1280;
+            height = maximized ? 1080 : 720;
+        }
+        
+        if (width != lastWidth || height != lastHeight) {
+            allocator.Release(color);
+            allocator.Release(depth);
+            color = allocator.Acquire(MakeDesc(width, height, RenderTargetFormat::RGBA16F));
+            depth = allocator.Acquire(MakeDesc(width, height, RenderTargetFormat::Depth24Stencil8));
+            naiveCreates += 2;
+            lastWidth = width;
+            lastHeight = height;
+        }
+        allocator.EndFrame(destroyed);
+        poolCreates += allocator.GetStats().createdThisFrame;
+    }
+    const RenderTargetStats resizeStats = allocator.GetStats();
+    
+    // 2. Post chain: a bloom-style downsample/upsample ladder plus a few
+    //    full-resolution ping-pong passes, declared fresh every frame
+    const uint32_t width = 1920;
+    const uint32_t height = 1080;
+    const uint32_t mipLevels = 6;
+    std::vector<Request> requests;
+    std::vector<RenderTargetDesc> descs;
+    float worstCompileMs = 0.0f;
+    uint32_t steadyCreates = 0;
+    for (int frame = 0; frame < frames; ++frame) {
+        requests.clear();
+        descs.clear();
+        uint32_t pass = 0;
+        
+        // Full-res HDR passes, each only read by the next one
+        for (uint32_t i = 0; i < 4; ++i, ++pass) {
+            descs.push_back(MakeDesc(width, height, RenderTargetFormat::RGBA16F));
+            requests.push_back({ allocator.DeclareTransient(descs.back(), pass, pass + 1), pass, pass + 1 });
+        }
+        // Downsample chain, then upsample back with the matching sizes
+        for (uint32_t mip = 1; mip <= mipLevels; ++mip, ++pass) {
+            descs.push_back(MakeDesc(width >> mip, height >> mip, RenderTargetFormat::RGBA16F));
+            requests.push_back({ allocator.DeclareTransient(descs.back(), pass, pass + 1), pass, pass + 1 });
+        }
+        for (uint32_t mip = mipLevels; mip >= 1; --mip, ++pass) {
+            descs.push_back(MakeDesc(width >> mip, height >> mip, RenderTargetFormat::RGBA16F));
+            requests.push_back({ allocator.DeclareTransient(descs.back(), pass, pass + 1), pass, pass + 1 });
+        }
+        
+        auto start = Clock::now();
+        allocator.CompileTransients();
+        worstCompileMs = std::max(worstCompileMs,
+                                  std::chrono::duration<float, std::milli>(Clock::now() - start).count());
+        
+        // Overlapping lifetimes must never share a target, and the target must match
+        for (size_t a = 0; a < requests.size(); ++a) {
+            uint32_t targetA = allocator.GetTransientTarget(requests[a].transient);
+            if (targetA == RenderTargetAllocator::InvalidHandle || allocator.GetDesc(targetA) != descs[a]) {
+                std::printf("FAIL: request %zu got a wrong target\n", a);
+                return 1;
+            }
+            for (size_t b = a + 1; b < requests.size(); ++b) {
+                bool overlap = requests[a].firstPass <= requests[b].lastPass &&
+                               requests[b].firstPass <= requests[a].lastPass;
+                if (overlap && targetA == allocator.GetTransientTarget(requests[b].transient)) {
+                    std::printf("FAIL: requests %zu and %zu overlap but share target %u\n", a, b, targetA);
+                    return 1;
+                }
+            }
+        }
+        
+        allocator.EndFrame(destroyed);
+        if (frame > 0) {
+            steadyCreates += allocator.GetStats().createdThisFrame;
+        }
+    }
+    const RenderTargetStats chainStats = allocator.GetStats();
+    
+    uint64_t naiveChainBytes = 0;
+    for (const RenderTargetDesc& desc : descs) {
+        naiveChainBytes += RenderTargetAllocator::GetBytes(desc);
+    }
+    
+    std::printf("Frames: %d\n\n", frames);
+    std::printf("Viewport resizes\n");
+    std::printf("  Allocations     pool %u vs recreate-on-resize %u\n", poolCreates, naiveCreates);
+    std::printf("  Pool memory     %.1f MB (peak %.1f MB)\n", resizeStats.totalBytes * toMB, resizeStats.peakBytes * toMB);
+    std::printf("\nTransient post chain (%zu targets per frame)\n", requests.size());
+    std::printf("  Aliased         %u of %u requests\n", chainStats.aliasedRequests, chainStats.transientRequests);
+    std::printf("  Memory          %.1f MB allocated vs %.1f MB without aliasing\n",
+                chainStats.transientBytesAllocated * toMB, naiveChainBytes * toMB);
+    std::printf("  Steady state    %u allocations after the first frame\n", steadyCreates);
+    std::printf("  Compile         worst %.3f ms\n", worstCompileMs);
+    
+    if (steadyCreates != 0) {
+        std::printf("FAIL: pool kept allocating in steady state\n");
+        return 1;
+    }
+    return 0;
+}
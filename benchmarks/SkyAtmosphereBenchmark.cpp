@@ -0,0 +1,192 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Sky atmosphere benchmark: LUT bake time for a sun sweep, LUT lookups
+// against the brute-force reference, and the sky-driven IBL bake.
+// Usage: LGE_SkyAtmosphereBenchmark [sunSteps]
+
+#include "LGE/rendering/SkyAtmosphere.h"
+#include "LGE/rendering/IBLBaker.h"
+#include "LGE/core/JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr float kPi = 3.14159265358979f;
+
+double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+float Luminance(const Math::Vector3& c) {
+    return 0.2126f * c.x + 0.7152f * c.y + 0.0722f * c.z;
+}
+
+Math::Vector3 SunFromElevation(float degrees) {
+    float elevation = degrees * kPi / 180.0f;
+    return Math::Vector3(std::cos(elevation), std::sin(elevation), 0.0f);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int sunSteps = argc > 1 ? std::max(2, std::atoi(argv[1])) : 16;
+    bool ok = true;
+    
+    JobSystem::Initialize();
+    std::printf("Workers: %u\n\n", JobSystem::GetWorkerCount());
+    
+    AtmosphereParameters parameters;
+    SkyAtmosphereSettings settings;
+    SkyAtmosphereLUTs luts;
+    
+    // 1. Full bake, then sky-view-only re-bakes for a sun sweep from below the
+    //    horizon to zenith (transmittance and multiple scattering are reused)
+    auto fullStart = Clock::now();
+    if (!SkyAtmosphere::Bake(parameters, settings, luts)) {
+        std::printf("FAIL: bake produced invalid LUTs\n");
+        JobSystem::Shutdown();
+        return 1;
+    }
+    double fullMs = ElapsedMs(fullStart);
+    
+    double totalMs = 0.0;
+    double worstMs = 0.0;
+    for (int i = 0; i < sunSteps; ++i) {
+        parameters.sunDirection = SunFromElevation(-5.0f + 95.0f * i / (sunSteps - 1));
+        auto start = Clock::now();
+        SkyAtmosphere::Bake(parameters, settings, luts);
+        double ms = ElapsedMs(start);
+        totalMs += ms;
+        worstMs = std::max(worstMs, ms);
+    }
+    std::printf("Full LUT bake (%ux%u + %u^2 + %ux%u): %.2f ms\n",
+                settings.transmittanceWidth, settings.transmittanceHeight, settings.multiScatteringSize,
+                settings.skyViewWidth, settings.skyViewHeight, fullMs);
+    std::printf("Sun change re-bake: avg %.2f ms, worst %.2f ms over %d sun positions\n",
+                totalMs / sunSteps, worstMs, sunSteps);
+    
+    // 2. Sky-view LUT vs reference for a morning sun. Per-pixel cost drops from
+    //    a full ray march to one bilinear fetch.
+    parameters.sunDirection = SunFromElevation(20.0f);
+    SkyAtmosphere::Bake(parameters, settings, luts);
+    
+    double sumError = 0.0;
+    double maxError = 0.0;
+    int samples = 0;
+    auto lutStart = Clock::now();
+    double referenceMs = 0.0;
+    for (int e = 0; e < 12; ++e) {
+        float elevation = (2.0f + 86.0f * e / 11.0f) * kPi / 180.0f;
+        for (int a = 0; a < 16; ++a) {
+            float azimuth = (a + 0.25f) / 16.0f * 2.0f * kPi;
+            Math::Vector3 direction(std::cos(elevation) * std::cos(azimuth), std::sin(elevation),
+                                    std::cos(elevation) * std::sin(azimuth));
+            Math::Vector3 fromLUT = SkyAtmosphere::SampleSkyView(luts, direction);
+            auto refStart = Clock::now();
+            Math::Vector3 reference = SkyAtmosphere::ComputeRadianceReference(luts, direction);
+            referenceMs += ElapsedMs(refStart);
+            
+            double error = std::abs(Luminance(fromLUT) - Luminance(reference)) / std::max(Luminance(reference), 1e-6f);
+            sumError += error;
+            maxError = std::max(maxError, error);
+            ++samples;
+        }
+    }
+    double lutMs = ElapsedMs(lutStart) - referenceMs;
+    std::printf("Sky-view LUT vs reference: mean %.2f%%, max %.2f%% luminance error (%d directions)\n",
+                sumError / samples * 100.0, maxError * 100.0, samples);
+    std::printf("  Reference %.3f ms per direction, LUT fetch %.5f ms\n", referenceMs / samples, lutMs / samples);
+    ok &= sumError / samples < 0.05 && maxError < 0.15;
+    
+    // 3. Transmittance LUT vs a fine Beer-Lambert march from the ground to space
+    double maxTransmittanceError = 0.0;
+    for (int i = 0; i <= 10; ++i) {
+        float cosZenith = 0.05f + 0.95f * i / 10.0f;
+        Math::Vector3 t = SkyAtmosphere::SampleTransmittance(luts, 0.0f, cosZenith);
+        
+        // Direct march from the ground
+        const AtmosphereParameters& p = luts.parameters;
+        float r = p.groundRadius;
+        float distance = -r * cosZenith + std::sqrt(r * r * (cosZenith * cosZenith - 1.0f) + p.topRadius * p.topRadius);
+        const int steps = 4000;
+        float dt = distance / steps;
+        double depth[3] = {};
+        for (int s = 0; s < steps; ++s) {
+            float d = (s + 0.5f) * dt;
+            float h = std::sqrt(r * r + d * d + 2.0f * r * cosZenith * d) - p.groundRadius;
+            float rayleigh = std::exp(-h / p.rayleighScaleHeight);
+            float mie = std::exp(-h / p.mieScaleHeight) * p.mieExtinction;
+            float ozone = std::max(0.0f, 1.0f - std::abs(h - p.ozoneCenter) / p.ozoneHalfWidth);
+            depth[0] += (p.rayleighScattering.x * rayleigh + mie + p.ozoneAbsorption.x * ozone) * dt;
+            depth[1] += (p.rayleighScattering.y * rayleigh + mie + p.ozoneAbsorption.y * ozone) * dt;
+            depth[2] += (p.rayleighScattering.z * rayleigh + mie + p.ozoneAbsorption.z * ozone) * dt;
+        }
+        double expected[3] = {std::exp(-depth[0]), std::exp(-depth[1]), std::exp(-depth[2])};
+        double got[3] = {t.x, t.y, t.z};
+        for (int c = 0; c < 3; ++c) {
+            maxTransmittanceError = std::max(maxTransmittanceError, std::abs(got[c] - expected[c]));
+        }
+    }
+    std::printf("Transmittance LUT vs direct march: max %.4f absolute error\n", maxTransmittanceError);
+    ok &= maxTransmittanceError < 0.01;
+    
+    // 4. Physical sanity: blue zenith at noon, redder horizon toward a low sun
+    parameters.sunDirection = SunFromElevation(60.0f);
+    SkyAtmosphere::Bake(parameters, settings, luts);
+    Math::Vector3 zenith = SkyAtmosphere::SampleSkyView(luts, Math::Vector3(0.0f, 1.0f, 0.0f));
+    parameters.sunDirection = SunFromElevation(2.0f);
+    SkyAtmosphere::Bake(parameters, settings, luts);
+    Math::Vector3 sunset = SkyAtmosphere::SampleSkyView(luts, Math::Vector3(0.999f, 0.04f, 0.0f));
+    std::printf("Zenith at 60 deg sun: (%.3f, %.3f, %.3f)\n", zenith.x, zenith.y, zenith.z);
+    std::printf("Horizon toward 2 deg sun: (%.3f, %.3f, %.3f)\n", sunset.x, sunset.y, sunset.z);
+    ok &= zenith.z > zenith.x && sunset.x > sunset.z;
+    
+    // 5. Sky light ambient: resample to equirect and run the regular IBL bake
+    IBLBakeSettings iblSettings;
+    iblSettings.specularResolution = 32;
+    iblSettings.specularMipCount = 5;
+    iblSettings.sampleCount = 32;
+    auto iblStart = Clock::now();
+    HDRImage equirect;
+    SkyAtmosphere::BuildEquirect(luts, 128, 64, equirect);
+    IBLBakeResult ibl;
+    bool iblOk = IBLBaker::Bake(equirect, iblSettings, ibl);
+    std::printf("Sky IBL (128x64 equirect, 32px cube): %.2f ms\n", ElapsedMs(iblStart));
+    ok &= iblOk;
+    
+    JobSystem::Shutdown();
+    if (!ok) {
+        std::printf("FAIL: sky atmosphere validation\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,220 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Residency planner benchmark: simulates a camera fly-through over a set of
+// streamed textures and reports the per-frame planning cost and upload volume
+// against loading every texture at full resolution up front. Also checks the
+// byte accounting for out-of-order, duplicate and evicted upload completions.
+// Usage: LGE_TextureResidencyBenchmark [textures] [frames]
+
+#include "LGE/rendering/TextureResidency.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct SimTexture {
+    uint32_t handle;
+    float position;
+    float size;
+};
+
+float Percentile(std::vector<float> values, float percentile) {
+    if (values.empty()) {
+        return 0.0f;
+    }
+    size_t index = std::min(values.size() - 1, static_cast<size_t>(percentile * (values.size() - 1)));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+uint64_t TailBytes(const TextureResidencyDesc& desc, uint32_t firstMip) {
+    uint64_t bytes = 0;
+    for (uint32_t mip = firstMip; mip < desc.mipCount; ++mip) {
+        bytes += TextureResidency::GetMipBytes(desc, mip);
+    }
+    return bytes;
+}
+
+bool CheckCompletionAccounting() {
+    bool ok = true;
+    TextureResidency residency;
+    
+    TextureResidencyDesc desc;
+    desc.width = desc.height = 256;
+    desc.mipCount = 9;
+    uint32_t handle = residency.Register(desc);
+    
+    std::vector<MipTransfer> uploads;
+    std::vector<MipTransfer> evictions;
+    residency.RequestMip(handle, 0);
+    residency.Update(64, ~0ull, uploads, evictions);
+    ok &= Expect(uploads.size() == desc.mipCount, "full chain requested in one update");
+    ok &= Expect(residency.GetInFlightBytes() == TailBytes(desc, 0), "in-flight bytes cover the requested chain");
+    
+    // Finest levels complete first; the chain only becomes resident once the coarsest lands
+    std::sort(uploads.begin(), uploads.end(), [](const MipTransfer& a, const MipTransfer& b) { return a.mip < b.mip; });
+    for (size_t i = 0; i + 1 < uploads.size(); ++i) {
+        residency.MarkResident(handle, uploads[i].mip);
+    }
+    ok &= Expect(residency.GetResidentMip(handle) == desc.mipCount, "resident mip waits for the coarser levels");
+    ok &= Expect(residency.GetInFlightBytes() == TextureResidency::GetMipBytes(desc, desc.mipCount - 1),
+                 "out-of-order completions release their in-flight bytes");
+    ok &= Expect(residency.GetResidentBytes() == TailBytes(desc, 0) - TextureResidency::GetMipBytes(desc, desc.mipCount - 1),
+                 "out-of-order completions count as resident");
+    
+    // A duplicate completion must not be counted twice
+    residency.MarkResident(handle, 0);
+    ok &= Expect(residency.GetResidentBytes() == TailBytes(desc, 0) - TextureResidency::GetMipBytes(desc, desc.mipCount - 1),
+                 "duplicate completion ignored");
+    
+    residency.MarkResident(handle, desc.mipCount - 1);
+    ok &= Expect(residency.GetResidentMip(handle) == 0, "chain resident once the coarsest level lands");
+    ok &= Expect(residency.GetInFlightBytes() == 0, "no in-flight bytes after every completion");
+    ok &= Expect(residency.GetResidentBytes() == TailBytes(desc, 0), "resident bytes match the full chain");
+    
+    // Trim to the pinned level, then deliver a stale completion for an evicted mip
+    residency.RequestMip(handle, desc.mipCount - 1);
+    uploads.clear();
+    evictions.clear();
+    residency.Update(64, ~0ull, uploads, evictions);
+    uint32_t residentMip = residency.GetResidentMip(handle);
+    ok &= Expect(!evictions.empty() && residentMip > 0, "coarser feedback trims fine mips");
+    residency.MarkResident(handle, 0);
+    ok &= Expect(residency.GetResidentMip(handle) == residentMip, "evicted completion does not change the resident mip");
+    ok &= Expect(residency.GetResidentBytes() == TailBytes(desc, residentMip), "evicted completion not counted as resident");
+    ok &= Expect(residency.GetInFlightBytes() == 0, "evicted completion leaves in-flight bytes at zero");
+    
+    // Unregister with a partially completed chain releases both pools
+    uint32_t second = residency.Register(desc);
+    residency.RequestMip(second, 0);
+    uploads.clear();
+    evictions.clear();
+    residency.Update(64, ~0ull, uploads, evictions);
+    residency.MarkResident(second, 0);
+    residency.MarkResident(second, 1);
+    residency.Unregister(second);
+    residency.Unregister(handle);
+    ok &= Expect(residency.GetInFlightBytes() == 0 && residency.GetResidentBytes() == 0,
+                 "unregister releases resident and in-flight bytes");
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int textureCount = argc > 1 ? std::max(1, std::atoi(argv[1])) : 2000;
+    int frames = argc > 2 ? std::max(1, std::atoi(argv[2])) : 1000;
+    
+    bool ok = CheckCompletionAccounting();
+    
+    const uint64_t budget = 512ull * 1024 * 1024;
+    const uint64_t segmentBytes = 8ull * 1024 * 1024;
+    const float viewportHeight = 1080.0f;
+    
+    TextureResidency residency;
+    residency.SetBudget(budget);
+    
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> positionDist(0.0f, 1000.0f);
+    std::uniform_int_distribution<int> sizeDist(8, 12);   // 256 .. 4096
+    
+    std::vector<SimTexture> textures;
+    uint64_t fullResolutionBytes = 0;
+    for (int i = 0; i < textureCount; ++i) {
+        TextureResidencyDesc desc;
+        desc.width = desc.height = 1u << sizeDist(rng);
+        desc.mipCount = static_cast<uint32_t>(std::log2(desc.width)) + 1;
+        for (uint32_t mip = 0; mip < desc.mipCount; ++mip) {
+            fullResolutionBytes += TextureResidency::GetMipBytes(desc, mip);
+        }
+        textures.push_back({residency.Register(desc), positionDist(rng), 1.0f + (i % 7)});
+    }
+    
+    std::vector<float> planMs;
+    std::vector<float> uploadMB;
+    std::vector<MipTransfer> uploads;
+    std::vector<MipTransfer> evictions;
+    uint64_t totalEvictions = 0;
+    
+    for (int frame = 0; frame < frames; ++frame) {
+        // Camera moves along the line of textures; feedback for everything within 200 units
+        float camera = std::fmod(frame * 1.5f, 1000.0f);
+        auto start = Clock::now();
+        for (const SimTexture& texture : textures) {
+            float distance = std::fabs(texture.position - camera);
+            if (distance < 200.0f) {
+                residency.ReportScreenSize(texture.handle, viewportHeight * texture.size / std::max(distance, 1.0f));
+            }
+        }
+        
+        uploads.clear();
+        evictions.clear();
+        residency.Update(64, segmentBytes, uploads, evictions);
+        
+        uint64_t frameBytes = 0;
+        // Complete the frame's uploads finest first, the worst case for ordering
+        for (auto upload = uploads.rbegin(); upload != uploads.rend(); ++upload) {
+            residency.MarkResident(upload->handle, upload->mip);
+            frameBytes += upload->bytes;
+        }
+        planMs.push_back(std::chrono::duration<float, std::milli>(Clock::now() - start).count());
+        uploadMB.push_back(frameBytes / (1024.0f * 1024.0f));
+        totalEvictions += evictions.size();
+    }
+    
+    float maxPlan = *std::max_element(planMs.begin(), planMs.end());
+    float maxUpload = *std::max_element(uploadMB.begin(), uploadMB.end());
+    
+    std::printf("Textures: %d, frames: %d, budget %.0f MB, per-frame upload allowance %.0f MB\n\n",
+                textureCount, frames, budget / (1024.0 * 1024.0), segmentBytes / (1024.0 * 1024.0));
+    std::printf("Planner cost      p50 %.3f ms  p99 %.3f ms  max %.3f ms\n",
+                Percentile(planMs, 0.5f), Percentile(planMs, 0.99f), maxPlan);
+    std::printf("Upload per frame  p50 %.2f MB  p99 %.2f MB  max %.2f MB\n",
+                Percentile(uploadMB, 0.5f), Percentile(uploadMB, 0.99f), maxUpload);
+    std::printf("Resident at end   %.1f MB (%llu evictions)\n",
+                residency.GetResidentBytes() / (1024.0 * 1024.0), static_cast<unsigned long long>(totalEvictions));
+    std::printf("\nSynchronous full-resolution load: %.1f MB in a single frame\n",
+                fullResolutionBytes / (1024.0 * 1024.0));
+    
+    ok &= Expect(residency.GetInFlightBytes() == 0, "no in-flight bytes after the fly-through");
+    ok &= Expect(residency.GetResidentBytes() <= budget, "resident bytes within budget");
+    std::printf("\n%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,308 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// VFS benchmark: resolves virtual paths through the mount trie against the old
+// linear prefix scan, checks both agree, then measures PathTable interning and
+// lookups over a project-sized set of asset paths. Finally stacks two .lpak
+// layers under the loose /Assets folder and checks overlay reads, copy-up
+// writes and watcher invalidation, and compares buffered against mapped reads.
+// Usage: LGE_VFSBenchmark [resolutions]
+
+#include "LGE/core/filesystem/FileSystem.h"
+#include "LGE/core/filesystem/MappedFile.h"
+#include "LGE/core/filesystem/PackageArchive.h"
+#include "LGE/core/filesystem/PathTable.h"
+#include "LGE/core/filesystem/VirtualFileSystem.h"
+#include "LGE/core/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool Expect(bool condition, const char* what) {
+    if (!condition) {
+        std::printf("FAIL: %s\n", what);
+    }
+    return condition;
+}
+
+void WriteText(const std::filesystem::path& path, const std::string& text) {
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream(path, std::ios::binary) << text;
+}
+
+uint64_t SumWords(const uint8_t* data, size_t size) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        sum += word;
+    }
+    return sum;
+}
+
+std::string ReadText(VirtualFileSystem& vfs, const std::string& virtualPath) {
+    std::vector<uint8_t> data = vfs.ReadFile(virtualPath);
+    return std::string(data.begin(), data.end());
+}
+
+// The resolution VirtualFileSystem used before the trie: normalize, scan mounts
+// in order with find() == 0, build the result with path::operator/
+struct LinearMount {
+    std::string virtualPath;
+    std::filesystem::path physicalPath;
+};
+
+std::filesystem::path ResolveLinear(const std::vector<LinearMount>& mounts, const std::filesystem::path& root,
+                                    const std::string& virtualPath) {
+    std::string normalized = virtualPath;
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+    if (normalized.empty() || normalized[0] != '/') {
+        normalized = "/" + normalized;
+    }
+    if (normalized.length() > 1 && normalized.back() == '/') {
+        normalized.pop_back();
+    }
+    for (const auto& mount : mounts) {
+        if (normalized.find(mount.virtualPath) == 0) {
+            std::string remaining = normalized.substr(mount.virtualPath.length());
+            if (remaining.empty() || remaining[0] == '/') {
+                if (!remaining.empty()) {
+                    remaining = remaining.substr(1);
+                }
+                return mount.physicalPath / remaining;
+            }
+        }
+    }
+    return root / normalized.substr(1);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int resolutions = argc > 1 ? std::max(1, std::atoi(argv[1])) : 1000000;
+    bool ok = true;
+    Log::SetConsoleOutput(false);
+    
+    // Project with the default mounts plus per-plugin content mounts
+    std::filesystem::path root = std::filesystem::temp_directory_path() / "LGE_VFSBenchmark";
+    std::filesystem::remove_all(root);
+    VirtualFileSystem vfs;
+    vfs.Initialize(root);
+    std::vector<LinearMount> linear = {
+        { "/Assets", std::filesystem::absolute(root / "Assets") },
+        { "/Config", std::filesystem::absolute(root / "Config") },
+        { "/Intermediate", std::filesystem::absolute(root / "Config" / "Packages" / "Intermediate") },
+        { "/Saved", std::filesystem::absolute(root / "Config" / "Packages" / "Saved") },
+    };
+    const int pluginCount = 60;
+    for (int p = 0; p < pluginCount; ++p) {
+        std::string virtualPath = "/Plugins/Plugin" + std::to_string(p);
+        std::filesystem::path physical = root / "Plugins" / ("Plugin" + std::to_string(p)) / "Content";
+        vfs.Mount(virtualPath, physical);
+        linear.push_back({ virtualPath, std::filesystem::absolute(physical) });
+    }
+    
+    // Asset paths spread over the mounts, a few unmounted
+    std::vector<std::string> paths;
+    const int uniquePaths = 200000;
+    paths.reserve(uniquePaths);
+    for (int i = 0; i < uniquePaths; ++i) {
+        std::string folder = (i % 10 == 0) ? "/Assets/Textures/Set" + std::to_string(i % 97)
+                           : (i % 10 < 8) ? "/Plugins/Plugin" + std::to_string(i % pluginCount) + "/Meshes/Group" + std::to_string(i % 31)
+                           : (i % 10 == 8) ? "/Config/Packages" : "/Unmounted/Dir";
+        paths.push_back(folder + "/Asset_" + std::to_string(i) + ".lasset");
+    }
+    
+    // 1. Agreement on a sample (separators normalized the same way)
+    bool agree = true;
+    for (int i = 0; i < uniquePaths; i += 997) {
+        agree &= vfs.ResolveVirtualPath(paths[i]).generic_string() == ResolveLinear(linear, root, paths[i]).generic_string();
+    }
+    ok &= Expect(agree, "trie and linear resolution agree");
+    ok &= Expect(vfs.ResolveVirtualPath("/Plugins/Plugin7/a.txt").generic_string() ==
+                 std::filesystem::absolute(root / "Plugins" / "Plugin7" / "Content" / "a.txt").generic_string(),
+                 "nested mount resolves to its own root");
+    
+    // 2. Resolution throughput
+    size_t checksum = 0;
+    auto start = Clock::now();
+    for (int i = 0; i < resolutions; ++i) {
+        checksum += ResolveLinear(linear, root, paths[i % uniquePaths]).native().size();
+    }
+    double linearNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / resolutions;
+    
+    start = Clock::now();
+    for (int i = 0; i < resolutions; ++i) {
+        checksum += vfs.ResolveVirtualPath(paths[i % uniquePaths]).native().size();
+    }
+    double triePathNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / resolutions;
+    
+    std::string physical;
+    start = Clock::now();
+    for (int i = 0; i < resolutions; ++i) {
+        vfs.ResolveVirtualPath(std::string_view(paths[i % uniquePaths]), physical);
+        checksum += physical.size();
+    }
+    double trieStringNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / resolutions;
+    
+    // 3. Interning: duplicate-free storage and hashed lookups
+    PathTable table;
+    start = Clock::now();
+    std::vector<PathId> ids;
+    ids.reserve(uniquePaths);
+    for (const std::string& path : paths) {
+        ids.push_back(table.Intern(path));
+    }
+    double internNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / uniquePaths;
+    
+    bool idsStable = table.GetCount() == static_cast<size_t>(uniquePaths);
+    start = Clock::now();
+    for (int i = 0; i < resolutions; ++i) {
+        idsStable &= table.Find(paths[i % uniquePaths]) == ids[i % uniquePaths];
+    }
+    double findNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / resolutions;
+    for (int i = 0; i < uniquePaths; i += 101) {
+        idsStable &= table.Intern(paths[i]) == ids[i] && table.GetString(ids[i]) == paths[i];
+    }
+    ok &= Expect(idsStable, "ids are stable and round-trip");
+    ok &= Expect(table.Find("/Never/Interned") == kInvalidPathId, "unknown paths are not found");
+    
+    // Two string-keyed maps (path -> guid and back), as GUIDRegistry held them
+    size_t pathBytes = 0;
+    for (const std::string& path : paths) {
+        pathBytes += path.capacity() + 1 + sizeof(std::string);
+    }
+    
+    std::printf("Mounts             %zu (%d plugins)\n", vfs.GetMountPoints().size(), pluginCount);
+    std::printf("Resolve linear     %.1f ns\n", linearNs);
+    std::printf("Resolve trie       %.1f ns (path), %.1f ns (string)\n", triePathNs, trieStringNs);
+    std::printf("Intern             %.1f ns per new path, %.1f ns per lookup\n", internNs, findNs);
+    std::printf("Path memory        %.1f MB interned vs %.1f MB per string-keyed copy\n",
+                table.GetMemoryUsage() / (1024.0 * 1024.0), pathBytes / (1024.0 * 1024.0));
+    std::printf("Checksum           %zu\n", checksum);
+    
+    ok &= Expect(trieStringNs < linearNs, "trie resolution beats the linear scan");
+    
+    // 4. Overlay: base pack < DLC pack < loose project folder
+    std::filesystem::path overlayRoot = root / "Overlay";
+    WriteText(root / "BaseSource" / "a.txt", "base");
+    WriteText(root / "BaseSource" / "shared.txt", "base");
+    WriteText(root / "BaseSource" / "Textures" / "t.png", "png");
+    WriteText(root / "DLCSource" / "shared.txt", "dlc");
+    WriteText(root / "DLCSource" / "dlc.txt", "dlc");
+    ok &= Expect(PackageArchive::Build(root / "BaseSource", root / "Base.lpak"), "base package builds");
+    ok &= Expect(PackageArchive::Build(root / "DLCSource", root / "DLC.lpak"), "DLC package builds");
+    
+    VirtualFileSystem overlay;
+    overlay.Initialize(overlayRoot);
+    ok &= Expect(overlay.MountLayer("/Assets", root / "Base.lpak", -20), "base layer mounts");
+    ok &= Expect(overlay.MountLayer("/Assets", root / "DLC.lpak", -10), "DLC layer mounts");
+    
+    ok &= Expect(ReadText(overlay, "/Assets/a.txt") == "base", "base entries show through");
+    ok &= Expect(ReadText(overlay, "/Assets/shared.txt") == "dlc", "DLC shadows base");
+    ok &= Expect(overlay.FileExists("/Assets/dlc.txt") && overlay.DirectoryExists("/Assets/Textures"), "packaged entries exist");
+    std::vector<std::string> listing = overlay.ListDirectory("/Assets");
+    ok &= Expect(listing == std::vector<std::string>({ "Textures", "a.txt", "dlc.txt", "shared.txt" }), "listing merges layers");
+    
+    ok &= Expect(overlay.WriteFile("/Assets/shared.txt", { 'n', 'e', 'w' }), "write to packaged path succeeds");
+    ok &= Expect(std::filesystem::exists(overlayRoot / "Assets" / "shared.txt"), "write copies up into the loose layer");
+    ok &= Expect(ReadText(overlay, "/Assets/shared.txt") == "new", "written file shadows the packs");
+    
+    // Changed on disk behind the VFS: stale until the watcher reports it
+    WriteText(overlayRoot / "Assets" / "a.txt", "loose");
+    overlay.InvalidatePhysicalPath(overlayRoot / "Assets" / "a.txt");
+    ok &= Expect(ReadText(overlay, "/Assets/a.txt") == "loose", "watcher invalidation picks up new loose file");
+    std::filesystem::remove(overlayRoot / "Assets" / "a.txt");
+    overlay.InvalidatePhysicalPath(overlayRoot / "Assets" / "a.txt");
+    ok &= Expect(ReadText(overlay, "/Assets/a.txt") == "base", "removing the loose file reveals the pack again");
+    
+    const char* overlayPaths[] = { "/Assets/a.txt", "/Assets/shared.txt", "/Assets/dlc.txt", "/Assets/Textures/t.png" };
+    start = Clock::now();
+    for (int i = 0; i < resolutions; ++i) {
+        overlay.ResolveVirtualPath(std::string_view(overlayPaths[i & 3]), physical);
+        checksum += physical.size();
+    }
+    double overlayNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / resolutions;
+    std::printf("Resolve overlay    %.1f ns (cached, 3 layers)\n", overlayNs);
+    ok &= Expect(overlay.MapFile("/Assets/dlc.txt").AsStringView() == "dlc", "packaged files map without a copy");
+    
+    // 5. Whole-file reads: stream into a buffer (the old ReadFile) vs a mapping
+    const size_t bigSize = 32u << 20;
+    std::filesystem::path bigPath = root / "Big.bin";
+    {
+        std::vector<uint8_t> bytes(bigSize);
+        for (size_t i = 0; i < bigSize; ++i) {
+            bytes[i] = static_cast<uint8_t>(i * 2654435761u >> 13);
+        }
+        std::ofstream(bigPath, std::ios::binary).write(reinterpret_cast<const char*>(bytes.data()), bigSize);
+    }
+    const int readPasses = 16;
+    uint64_t bufferedSum = 0;
+    start = Clock::now();
+    for (int pass = 0; pass < readPasses; ++pass) {
+        std::ifstream file(bigPath, std::ios::binary | std::ios::ate);
+        std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+        file.seekg(0, std::ios::beg);
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        bufferedSum += SumWords(data.data(), data.size());
+    }
+    double bufferedSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    
+    uint64_t mappedSum = 0;
+    bool mapped = true;
+    start = Clock::now();
+    for (int pass = 0; pass < readPasses; ++pass) {
+        FileView view = MappedFile::Open(bigPath.string());
+        mapped &= view.IsMapped();
+        mappedSum += SumWords(view.GetData(), view.GetSize());
+    }
+    double mappedSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    ok &= Expect(mapped && mappedSum == bufferedSum, "mapped reads see the same bytes");
+    
+    double megabytes = static_cast<double>(bigSize) * readPasses / (1024.0 * 1024.0);
+    std::printf("Read buffered      %.0f MB/s\n", megabytes / bufferedSeconds);
+    std::printf("Read mapped        %.0f MB/s\n", megabytes / mappedSeconds);
+    
+    // Search-path lookups resolve once, then come from the cache
+    std::string relative = std::filesystem::relative(root / "BaseSource" / "a.txt").string();
+    ok &= Expect(FileSystem::ReadFile(relative) == "base", "FileSystem::ReadFile goes through the search paths");
+    ok &= Expect(FileSystem::ResolveSearchPath(relative) == relative, "resolved search path is cached");
+    FileView small = FileSystem::MapFile(relative);
+    ok &= Expect(small.IsValid() && !small.IsMapped() && small.SubView(1, 100).AsStringView() == "ase", "small files fall back to a buffered read");
+    
+    std::filesystem::remove_all(root);
+    return ok ? 0 : 1;
+}
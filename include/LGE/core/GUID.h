@@ -23,6 +23,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #pragma once
 
+#include "LGE/core/Hash.h"
 #include <cstdint>
 #include <string>
 #include <random>
@@ -71,12 +72,14 @@ public:
 
 } // namespace LGE
 
-// Hash function for unordered_map
+// Hash function for unordered_map and GUIDMap. Both halves are mixed: the
+// standard integer hash is the identity, and tables that mask off the low
+// bits would otherwise see only a few bits of the GUID.
 namespace std {
     template<>
     struct hash<LGE::GUID> {
         size_t operator()(const LGE::GUID& guid) const {
-            return hash<uint64_t>()(guid.GetHigh()) ^ (hash<uint64_t>()(guid.GetLow()) << 1);
+            return static_cast<size_t>(LGE::Hash::Combine(LGE::Hash::Mix64(guid.GetHigh()), guid.GetLow()));
         }
     };
 }
@@ -0,0 +1,190 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/core/GUID.h"
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace LGE {
+
+// Open-addressed GUID -> T map: one flat array of entries, linear probing, a
+// power-of-two capacity kept at most 3/4 full. The invalid (all-zero) GUID
+// marks empty slots and cannot be a key. Erase shifts the rest of the probe
+// run back instead of leaving tombstones. Pointers returned by Find are
+// invalidated by Insert, operator[], Erase and Reserve.
+template <typename T>
+class GUIDMap {
+public:
+    struct Entry {
+        GUID key;
+        T value{};
+    };
+    
+    T* Find(const GUID& key) {
+        size_t slot = FindSlot(key);
+        return slot != kNoSlot ? &m_Entries[slot].value : nullptr;
+    }
+    
+    const T* Find(const GUID& key) const {
+        size_t slot = FindSlot(key);
+        return slot != kNoSlot ? &m_Entries[slot].value : nullptr;
+    }
+    
+    bool Contains(const GUID& key) const { return FindSlot(key) != kNoSlot; }
+    
+    // Adds a default value when the key is missing; key must be valid
+    T& operator[](const GUID& key) {
+        return m_Entries[Emplace(key).first].value;
+    }
+    
+    // False (and nothing changed) when the key is present or invalid
+    bool Insert(const GUID& key, const T& value) {
+        if (IsEmpty(key)) {
+            return false;
+        }
+        auto [slot, inserted] = Emplace(key);
+        if (inserted) {
+            m_Entries[slot].value = value;
+        }
+        return inserted;
+    }
+    
+    bool Erase(const GUID& key) {
+        size_t hole = FindSlot(key);
+        if (hole == kNoSlot) {
+            return false;
+        }
+        
+        // Pull back every later entry of the run that may live in the hole
+        size_t mask = m_Entries.size() - 1;
+        for (size_t next = (hole + 1) & mask; !IsEmpty(m_Entries[next].key); next = (next + 1) & mask) {
+            size_t home = HomeSlot(m_Entries[next].key, mask);
+            if (((next - home) & mask) >= ((next - hole) & mask)) {
+                m_Entries[hole] = std::move(m_Entries[next]);
+                hole = next;
+            }
+        }
+        m_Entries[hole] = Entry();
+        --m_Size;
+        return true;
+    }
+    
+    void Reserve(size_t count) {
+        size_t capacity = kMinCapacity;
+        while (capacity * 3 < count * 4) {
+            capacity *= 2;
+        }
+        if (capacity > m_Entries.size()) {
+            Rehash(capacity);
+        }
+    }
+    
+    void Clear() {
+        m_Entries.clear();
+        m_Size = 0;
+    }
+    
+    size_t Size() const { return m_Size; }
+    bool Empty() const { return m_Size == 0; }
+    size_t GetCapacity() const { return m_Entries.size(); }
+    size_t GetMemoryUsage() const { return m_Entries.capacity() * sizeof(Entry); }
+    
+    // Visits every entry in slot order; the map must not change meanwhile
+    template <typename Func>
+    void ForEach(Func&& func) const {
+        for (const Entry& entry : m_Entries) {
+            if (!IsEmpty(entry.key)) {
+                func(entry.key, entry.value);
+            }
+        }
+    }
+
+private:
+    static constexpr size_t kNoSlot = static_cast<size_t>(-1);
+    static constexpr size_t kMinCapacity = 16;
+    
+    // GUID's own comparisons are out of line; probing compares the halves directly
+    static bool IsEmpty(const GUID& key) { return (key.GetHigh() | key.GetLow()) == 0; }
+    static bool SameKey(const GUID& a, const GUID& b) { return a.GetHigh() == b.GetHigh() && a.GetLow() == b.GetLow(); }
+    static size_t HomeSlot(const GUID& key, size_t mask) { return std::hash<GUID>()(key) & mask; }
+    
+    size_t FindSlot(const GUID& key) const {
+        if (m_Entries.empty() || IsEmpty(key)) {
+            return kNoSlot;
+        }
+        size_t mask = m_Entries.size() - 1;
+        for (size_t slot = HomeSlot(key, mask); ; slot = (slot + 1) & mask) {
+            const GUID& probe = m_Entries[slot].key;
+            if (SameKey(probe, key)) {
+                return slot;
+            }
+            if (IsEmpty(probe)) {
+                return kNoSlot;
+            }
+        }
+    }
+    
+    // Slot of the key, and whether it was added
+    std::pair<size_t, bool> Emplace(const GUID& key) {
+        if ((m_Size + 1) * 4 > m_Entries.size() * 3) {
+            Rehash(m_Entries.empty() ? kMinCapacity : m_Entries.size() * 2);
+        }
+        size_t mask = m_Entries.size() - 1;
+        for (size_t slot = HomeSlot(key, mask); ; slot = (slot + 1) & mask) {
+            Entry& entry = m_Entries[slot];
+            if (SameKey(entry.key, key)) {
+                return { slot, false };
+            }
+            if (IsEmpty(entry.key)) {
+                entry.key = key;
+                ++m_Size;
+                return { slot, true };
+            }
+        }
+    }
+    
+    void Rehash(size_t capacity) {
+        std::vector<Entry> entries(capacity);
+        size_t mask = capacity - 1;
+        for (Entry& entry : m_Entries) {
+            if (IsEmpty(entry.key)) {
+                continue;
+            }
+            size_t slot = HomeSlot(entry.key, mask);
+            while (!IsEmpty(entries[slot].key)) {
+                slot = (slot + 1) & mask;
+            }
+            entries[slot] = std::move(entry);
+        }
+        m_Entries.swap(entries);
+    }
+    
+    std::vector<Entry> m_Entries;
+    size_t m_Size = 0;
+};
+
+} // namespace LGE
@@ -24,16 +24,20 @@ For more information, visit: https://nexelgames.com/luma-engine
 #pragma once
 
 #include "LGE/core/GUID.h"
+#include "LGE/core/GUIDMap.h"
+#include "LGE/core/filesystem/PathTable.h"
 #include <string>
-#include <unordered_map>
+#include <vector>
 #include <filesystem>
 
 namespace LGE {
 
 class GUIDRegistry {
 private:
-    std::unordered_map<GUID, std::string> m_GUIDToPath;
-    std::unordered_map<std::string, GUID> m_PathToGUID;
+    // Paths are interned in PathTable::Get(), shared with the AssetRegistry;
+    // both directions refer to the same interned string
+    GUIDMap<PathId> m_GUIDToPath;
+    std::vector<GUID> m_PathToGUID;   // Indexed by PathId (ids are dense); invalid when unregistered
 
 public:
     GUIDRegistry();
@@ -42,6 +46,10 @@ public:
     // Register an asset and get/create its GUID
     GUID RegisterAsset(const std::string& virtualPath);
     
+    // Register a known GUID (e.g. an asset restored from the trash); false if
+    // the path already belongs to another GUID
+    bool RegisterAsset(const GUID& guid, const std::string& virtualPath);
+    
     // Get or create GUID for an asset
     GUID GetOrCreateGUID(const std::string& virtualPath);
     
@@ -58,21 +66,30 @@ public:
     bool RemoveAsset(const GUID& guid);
     bool RemoveAsset(const std::string& path);
     
-    // Save registry to file
+    // Save registry to file: fixed-size records followed by the path strings,
+    // read back through a memory map
     bool SaveToFile(const std::filesystem::path& path);
     
-    // Load registry from file
+    // Load registry from file; the JSON form written by older versions is still read
     bool LoadFromFile(const std::filesystem::path& path);
     
     // Clear all entries
     void Clear();
     
     // Get count of registered assets
-    size_t GetAssetCount() const { return m_GUIDToPath.size(); }
+    size_t GetAssetCount() const { return m_GUIDToPath.Size(); }
+    size_t GetMemoryUsage() const;   // Both directions, excluding the shared path strings
 
 private:
     // Helper methods
     std::string NormalizePath(const std::string& path) const;
+    static bool IsNormalized(const std::string& path);
+    PathId FindPath(const std::string& path) const;
+    PathId InternPath(const std::string& path) const;
+    GUID FindByPath(PathId pathId) const;
+    void Link(const GUID& guid, PathId pathId);
+    void UnlinkPath(PathId pathId);
+    bool LoadFromJson(const std::string& json, const std::filesystem::path& path);
 };
 
 } // namespace LGE
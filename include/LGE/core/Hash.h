@@ -0,0 +1,63 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace LGE {
+
+// Fast non-cryptographic 64-bit hashing for cache keys and hash tables.
+class Hash {
+public:
+    // Hash a byte range (processes 32 bytes per step)
+    static uint64_t Bytes(const void* data, size_t size, uint64_t seed = 0);
+    
+    // Hash a string's characters
+    static uint64_t String(const std::string& str, uint64_t seed = 0) { return Bytes(str.data(), str.size(), seed); }
+    
+    // Hash the full contents of a file. Returns false if it cannot be read.
+    static bool File(const std::string& filepath, uint64_t& outHash);
+    
+    // Finalizer with full avalanche (every input bit affects every output bit)
+    static uint64_t Mix64(uint64_t value) {
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDull;
+        value ^= value >> 33;
+        value *= 0xC4CEB9FE1A85EC53ull;
+        value ^= value >> 33;
+        return value;
+    }
+    
+    // Order-dependent combination of two hashes
+    static uint64_t Combine(uint64_t seed, uint64_t value) {
+        return Mix64(seed ^ (value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2)));
+    }
+    
+    // Lowercase hex representation (16 characters), used for cache file names
+    static std::string ToHex(uint64_t hash);
+};
+
+} // namespace LGE
@@ -0,0 +1,59 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace LGE {
+
+// Shared worker pool for CPU-heavy engine work (image decoding, baking, scans).
+// Workers are created lazily on first use and live until Shutdown().
+class JobSystem {
+public:
+    using Job = std::function<void()>;
+    using RangeJob = std::function<void(size_t begin, size_t end)>;
+
+    // Start the worker pool (0 = hardware concurrency - 1, at least one worker)
+    static void Initialize(uint32_t numThreads = 0);
+    
+    // Stop and join all workers (pending jobs are still executed)
+    static void Shutdown();
+    
+    // Queue a fire-and-forget job
+    static void Submit(Job job);
+    
+    // Split [0, count) into chunks of grainSize and run them on the pool.
+    // The calling thread participates and returns once every chunk finished.
+    static void ParallelFor(size_t count, size_t grainSize, const RangeJob& func);
+    
+    // Number of worker threads (excluding the caller)
+    static uint32_t GetWorkerCount();
+    
+    // True when called from one of the pool's worker threads
+    static bool IsWorkerThread();
+};
+
+} // namespace LGE
@@ -30,11 +30,23 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #pragma once
 
-#include <iostream>
-#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <string>
+#include <type_traits>
 #include <vector>
 
+// LGE_LOG_* messages below this level are compiled out (arguments are not evaluated)
+#ifndef LGE_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define LGE_LOG_MIN_LEVEL 1
+#else
+#define LGE_LOG_MIN_LEVEL 0
+#endif
+#endif
+
 namespace LGE {
 
 enum class LogLevel {
@@ -45,27 +57,128 @@ enum class LogLevel {
     Fatal
 };
 
+struct LogStats {
+    uint64_t submitted = 0;
+    uint64_t dropped = 0;       // Queue full while called from the logging thread itself
+    uint64_t suppressed = 0;    // Repeats swallowed by the rate limiter
+    uint64_t overflowed = 0;    // Messages too long for a queue slot (heap fallback)
+};
+
+// Argument bytes of a deferred message: a type tag per argument followed by its value
+struct LogPayload {
+    static constexpr size_t kCapacity = 432;
+    
+    char data[kCapacity];
+    size_t size = 0;
+    
+    void Append(bool value) { AppendInteger('u', value ? 1u : 0u); }
+    void Append(char value) { AppendText(&value, 1); }
+    void Append(const char* value) { AppendText(value ? value : "(null)", value ? std::strlen(value) : 6); }
+    void Append(const std::string& value) { AppendText(value.data(), value.size()); }
+    
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type Append(T value) {
+        AppendInteger('i', static_cast<int64_t>(value));
+    }
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type Append(T value) {
+        AppendInteger('u', static_cast<uint64_t>(value));
+    }
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type Append(T value) {
+        AppendInteger('f', static_cast<double>(value));
+    }
+
+private:
+    template <typename T>
+    void AppendInteger(char tag, T value) {
+        if (size + 1 + sizeof(T) > kCapacity) return;
+        data[size++] = tag;
+        std::memcpy(data + size, &value, sizeof(T));
+        size += sizeof(T);
+    }
+    
+    // Strings are copied (truncated to what fits) so callers may free them right away
+    void AppendText(const char* text, size_t length) {
+        if (size + 3 > kCapacity) return;
+        length = length < kCapacity - size - 3 ? length : kCapacity - size - 3;
+        uint16_t length16 = static_cast<uint16_t>(length);
+        data[size++] = 's';
+        std::memcpy(data + size, &length16, sizeof(length16));
+        size += sizeof(length16);
+        std::memcpy(data + size, text, length);
+        size += length;
+    }
+};
+
+// Asynchronous logger. Callers push records into a lock-free bounded queue; a
+// background thread formats them, applies rate limiting and feeds the console,
+// the optional binary file sink and registered callbacks (on that thread).
+// Warn and above wake that thread right away; Trace/Info reach the sinks within
+// a few milliseconds (or on Flush).
 class Log {
 public:
-    // Log callbacks (for UI integration)
+    // Log callbacks (for UI integration); invoked from the logging thread
     using LogCallback = std::function<void(LogLevel level, const std::string& message)>;
     
     static void Trace(const std::string& message);
     static void Info(const std::string& message);
     static void Warn(const std::string& message);
     static void Error(const std::string& message);
-    static void Fatal(const std::string& message);
+    static void Fatal(const std::string& message);   // Flushes before returning
+    
+    // Deferred formatting: arguments are copied into the queue and each "{}" in
+    // format is replaced on the logging thread. format must be a string literal.
+    template <typename... Args>
+    static void Write(LogLevel level, const char* format, const Args&... args) {
+        if (!IsEnabled(level)) {
+            return;
+        }
+        LogPayload payload;
+        int expand[] = { 0, (payload.Append(args), 0)... };
+        (void)expand;
+        Submit(level, format, payload.data, payload.size);
+    }
     
-    // Register a callback to receive log messages
-    static void RegisterCallback(LogCallback callback);
+    // Register a callback to receive log messages; returns an id for UnregisterCallback
+    static uint32_t RegisterCallback(LogCallback callback);
     
     // Unregister a callback
-    static void UnregisterCallback(LogCallback callback);
+    static void UnregisterCallback(uint32_t id);
+    
+    // Runtime filter on top of LGE_LOG_MIN_LEVEL
+    static void SetLevel(LogLevel level);
+    static bool IsEnabled(LogLevel level);
+    
+    // Standard output sink (on by default)
+    static void SetConsoleOutput(bool enabled);
+    
+    // Compact binary sink: formats are stored once, arguments stay unformatted
+    static bool OpenBinarySink(const std::string& filepath);
+    static void CloseBinarySink();
+    
+    // Decode a binary log back into the lines the console would have printed
+    static bool ReadBinaryLog(const std::string& filepath, std::vector<std::string>& outLines);
+    
+    // Block until everything logged so far has reached the sinks
+    static void Flush();
+    
+    // Drain the queue and stop the logging thread (restarted by the next message)
+    static void Shutdown();
+    
+    static LogStats GetStats();
 
 private:
+    static void Submit(LogLevel level, const char* format, const char* payload, size_t size);
     static void Print(LogLevel level, const std::string& message);
-    static std::vector<LogCallback> s_Callbacks;
 };
 
 } // namespace LGE
 
+#define LGE_LOG_AT(levelValue, level, ...) \
+    do { if constexpr ((levelValue) >= LGE_LOG_MIN_LEVEL) ::LGE::Log::Write(level, __VA_ARGS__); } while (0)
+
+#define LGE_LOG_TRACE(...) LGE_LOG_AT(0, ::LGE::LogLevel::Trace, __VA_ARGS__)
+#define LGE_LOG_INFO(...)  LGE_LOG_AT(1, ::LGE::LogLevel::Info, __VA_ARGS__)
+#define LGE_LOG_WARN(...)  LGE_LOG_AT(2, ::LGE::LogLevel::Warn, __VA_ARGS__)
+#define LGE_LOG_ERROR(...) LGE_LOG_AT(3, ::LGE::LogLevel::Error, __VA_ARGS__)
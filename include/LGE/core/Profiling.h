@@ -0,0 +1,166 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define LGE_PROFILE_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LGE_PROFILE_RDTSC 1
+#else
+#include <chrono>
+#define LGE_PROFILE_RDTSC 0
+#endif
+
+// Zones compile away entirely when the build disables profiling
+#ifndef LGE_ENABLE_PROFILING
+#define LGE_ENABLE_PROFILING 1
+#endif
+
+namespace LGE {
+
+// One closed CPU zone. Names are never copied: they must be string literals
+// or pointers returned by Profiling::InternName().
+struct ProfileZone {
+    const char* name = nullptr;
+    uint64_t begin = 0;       // Profiling::Now() ticks
+    uint64_t end = 0;
+    uint32_t threadIndex = 0;
+    uint32_t depth = 0;       // Nesting level on its thread (0 = outermost)
+};
+
+struct ProfileThreadInfo {
+    uint32_t index = 0;
+    std::string name;
+};
+
+// Low-overhead hierarchical CPU instrumentation.
+// Every thread records closed zones into its own fixed-size ring buffer; only the
+// owning thread writes, readers copy the ring and drop slots overwritten meanwhile.
+class Profiling {
+public:
+    static constexpr size_t kZonesPerThread = 1u << 14;
+    static constexpr size_t kFrameHistory = 256;
+    
+    // Raw timestamp (TSC on x86, steady clock nanoseconds elsewhere)
+    static uint64_t Now() {
+#if LGE_PROFILE_RDTSC
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+    
+    // Tick rate of Now(), calibrated once against the steady clock and cached
+    static double GetTicksPerSecond();
+    static double TicksToMilliseconds(uint64_t ticks) { return ticks * 1000.0 / GetTicksPerSecond(); }
+    
+    // Recording can be paused at runtime; zones opened while paused are dropped
+    static void SetEnabled(bool enabled) { s_Enabled.store(enabled, std::memory_order_relaxed); }
+    static bool IsEnabled() { return s_Enabled.load(std::memory_order_relaxed); }
+    
+    // Label the calling thread in the timeline and trace exports
+    static void SetThreadName(const std::string& name);
+    
+    // Stable copy of a runtime string for use as a zone name (takes a lock; cache the result)
+    static const char* InternName(const std::string& name);
+    
+    // Start of a new frame on the main thread
+    static void MarkFrame();
+    
+    // Tick range of a finished frame (0 = the most recently completed one)
+    static bool GetFrameRange(uint32_t framesAgo, uint64_t& outBegin, uint64_t& outEnd);
+    
+    // Zones overlapping [begin, end] from every thread, sorted by thread, then begin time
+    static void CollectZones(uint64_t begin, uint64_t end, std::vector<ProfileZone>& outZones);
+    
+    static std::vector<ProfileThreadInfo> GetThreads();
+    
+    // Everything still in the rings as Chrome trace_event JSON (chrome://tracing, Perfetto)
+    static bool ExportChromeTrace(const std::string& filepath);
+    
+    // Called by ProfileScope; records a closed zone for the calling thread
+    static void Record(const char* name, uint64_t begin, uint64_t end, uint32_t depth);
+    
+    // Extra timeline lane for work timed outside the CPU (e.g. GPU queries).
+    // Zones must be recorded in order of their end time; the lane is never recycled.
+    static uint32_t CreateTrack(const std::string& name);
+    static void RecordTrackZones(uint32_t track, const ProfileZone* zones, size_t count);
+    
+    // Current nesting depth of the calling thread (bumped by ProfileScope)
+    static uint32_t& ThreadDepth() { return s_ThreadDepth; }
+
+private:
+    static std::atomic<bool> s_Enabled;
+    static inline thread_local uint32_t s_ThreadDepth = 0;
+};
+
+// RAII zone, normally created through LGE_PROFILE_SCOPE
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name)
+        : m_Name(Profiling::IsEnabled() ? name : nullptr)
+    {
+        if (m_Name) {
+            m_Depth = Profiling::ThreadDepth()++;
+            m_Begin = Profiling::Now();
+        }
+    }
+    
+    ~ProfileScope() {
+        if (m_Name) {
+            uint64_t end = Profiling::Now();
+            --Profiling::ThreadDepth();
+            Profiling::Record(m_Name, m_Begin, end, m_Depth);
+        }
+    }
+    
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_Name;
+    uint64_t m_Begin = 0;
+    uint32_t m_Depth = 0;
+};
+
+} // namespace LGE
+
+#define LGE_PROFILE_CONCAT_INNER(a, b) a##b
+#define LGE_PROFILE_CONCAT(a, b) LGE_PROFILE_CONCAT_INNER(a, b)
+
+#if LGE_ENABLE_PROFILING
+#define LGE_PROFILE_SCOPE(name) ::LGE::ProfileScope LGE_PROFILE_CONCAT(lgeProfileScope, __LINE__)(name)
+#define LGE_PROFILE_FUNCTION() LGE_PROFILE_SCOPE(__func__)
+#else
+#define LGE_PROFILE_SCOPE(name) ((void)0)
+#define LGE_PROFILE_FUNCTION() ((void)0)
+#endif
@@ -28,7 +28,6 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include <string>
 #include <vector>
 #include <filesystem>
-#include "imgui.h"
 
 namespace LGE {
 
@@ -54,12 +53,15 @@ public:
     std::string query;
     AssetFilter::FilterCriteria criteria;
     
-    // UI color
-    ImVec4 color;
+    // UI color (RGBA, same layout as ImVec4 without pulling ImGui into core)
+    struct Color {
+        float x, y, z, w;
+    };
+    Color color;
     
     AssetCollection()
         : type(CollectionType::Manual)
-        , color(ImVec4(0.5f, 0.5f, 0.5f, 1.0f))
+        , color{0.5f, 0.5f, 0.5f, 1.0f}
     {}
     
     std::string ToJson() const;
@@ -25,9 +25,11 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #include "LGE/core/GUID.h"
 #include "LGE/core/assets/AssetDeletionValidator.h"
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <filesystem>
+#include <unordered_map>
 
 namespace LGE {
 
@@ -35,7 +37,15 @@ namespace LGE {
 class AssetRegistry;
 class DependencyGraph;
 class VirtualFileSystem;
-
+class AssetReferenceIndex;
+class GUIDRegistry;
+
+// Deletes, trashes and restores assets in batches. Each batch is planned up
+// front and written to a journal in the trash folder before any file moves;
+// the files are then moved in parallel, the registry, graph and indices are
+// updated in one pass, and the journal is marked committed. Permanent
+// deletes are staged in the trash folder until the batch commits, so every
+// step before the commit can be undone.
 class AssetDeleter {
 public:
     enum class DeletionMode {
@@ -54,17 +64,42 @@ public:
     };
 
 private:
+    enum class BatchKind : uint8_t { Delete = 1, Trash = 2, Restore = 3 };
+    enum class BatchState : uint8_t { Prepared = 1, Committed = 2 };
+    
+    // One asset of a batch; the .meta file travels alongside
+    struct FileMove {
+        GUID asset;
+        std::string source;
+        std::string destination;
+        std::string metadataJson;   // Trash and restore batches
+        bool hasFile = false;
+        bool hasMeta = false;
+    };
+    
+    // Where a trashed asset came from, for RestoreFromTrash
+    struct TrashEntry {
+        std::string originalFile;
+        std::string trashFile;
+        std::string metadataJson;
+    };
+    
     AssetRegistry* m_Registry;
     DependencyGraph* m_Graph;
     VirtualFileSystem* m_VFS;
+    AssetReferenceIndex* m_ReferenceIndex;
+    GUIDRegistry* m_GUIDRegistry;
     AssetDeletionValidator m_Validator;
     
     std::filesystem::path m_TrashPath;
+    std::unordered_map<GUID, TrashEntry> m_TrashEntries;
+    bool m_TrashLoaded;   // m_TrashEntries read from the trash manifest
 
 public:
-    AssetDeleter(AssetRegistry* registry, DependencyGraph* graph, VirtualFileSystem* vfs);
+    AssetDeleter(AssetRegistry* registry, DependencyGraph* graph, VirtualFileSystem* vfs,
+                 AssetReferenceIndex* referenceIndex = nullptr);
     
-    // Delete assets with specified mode
+    // Delete assets with specified mode; all files of the batch are deleted or none
     DeletionResult DeleteAssets(
         const std::vector<GUID>& assets, 
         DeletionMode mode = DeletionMode::SafeOnly
@@ -75,21 +110,38 @@ public:
     
     // Restore from trash
     bool RestoreFromTrash(const std::vector<GUID>& assets);
+    std::vector<GUID> GetTrashedAssets();
     
     // Set trash directory path
-    void SetTrashPath(const std::filesystem::path& path) { m_TrashPath = path; }
+    void SetTrashPath(const std::filesystem::path& path) { m_TrashPath = path; m_TrashEntries.clear(); m_TrashLoaded = false; }
     const std::filesystem::path& GetTrashPath() const { return m_TrashPath; }
     
+    // Kept in sync with deletions and restores when set
+    void SetGUIDRegistry(GUIDRegistry* guidRegistry) { m_GUIDRegistry = guidRegistry; }
+    
     // Permanently delete from trash
     bool PermanentlyDelete(const std::vector<GUID>& assets);
+    
+    // Finishes a batch interrupted by a crash: rolled back if it had not
+    // committed, replayed otherwise. Call after SetTrashPath, once the
+    // registry, graph and reference index are loaded.
+    bool RecoverJournal();
 
 private:
-    // Helper methods
-    bool DeleteAssetFile(const GUID& asset);
-    bool MoveAssetToTrash(const GUID& asset);
-    bool RestoreAssetFromTrash(const GUID& asset);
-    void BreakReferences(const GUID& asset);
+    // Unknown assets are reported in outFailed and left out of the plan
+    void PlanBatch(BatchKind kind, const std::vector<GUID>& assets, std::vector<FileMove>& outMoves, std::vector<GUID>& outFailed);
+    bool RunBatch(BatchKind kind, bool breakReferences, const std::vector<FileMove>& moves);
+    bool ExecuteMoves(const std::vector<FileMove>& moves);   // Rolls back on failure
+    void ApplyBatch(BatchKind kind, bool breakReferences, const std::vector<FileMove>& moves);
+    void FinishBatch(BatchKind kind, const std::vector<FileMove>& moves);
+    void BreakReferences(const std::vector<GUID>& assets);
+    
+    std::filesystem::path GetJournalPath() const { return m_TrashPath / "deletion_journal.bin"; }
+    bool WriteJournal(BatchKind kind, bool breakReferences, const std::vector<FileMove>& moves);
+    bool SetJournalState(BatchState state);
+    
+    void LoadTrashManifest();
+    bool SaveTrashManifest();
 };
 
 } // namespace LGE
-
@@ -32,6 +32,7 @@ namespace LGE {
 // Forward declarations
 class DependencyGraph;
 class AssetRegistry;
+class AssetReferenceIndex;
 
 class AssetDeletionValidator {
 public:
@@ -47,11 +48,14 @@ public:
 private:
     DependencyGraph* m_Graph;
     AssetRegistry* m_Registry;
+    AssetReferenceIndex* m_ReferenceIndex;
 
 public:
-    AssetDeletionValidator(DependencyGraph* graph, AssetRegistry* registry);
+    AssetDeletionValidator(DependencyGraph* graph, AssetRegistry* registry, AssetReferenceIndex* referenceIndex = nullptr);
     
-    // Check if assets can be safely deleted
+    // Check if assets can be safely deleted. With a reference index the whole
+    // batch is answered in one query, and references from assets that are
+    // themselves in the batch do not block.
     std::vector<DeletionInfo> ValidateDeletion(const std::vector<GUID>& assets);
     
     // Check single asset
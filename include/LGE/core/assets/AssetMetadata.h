@@ -27,6 +27,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include <string>
 #include <vector>
 #include <ctime>
+#include <filesystem>
 #include <map>
 
 namespace LGE {
@@ -77,6 +78,10 @@ struct AssetMetadata {
     // Helper methods
     std::string GetTypeName() const;
     static AssetType GetTypeFromName(const std::string& typeName);
+    
+    // lastModified stamp for a file time; seconds on the file clock, so equal
+    // times always give equal stamps (the open-time reconcile compares them)
+    static std::time_t ToFileStamp(std::filesystem::file_time_type time);
 };
 
 } // namespace LGE
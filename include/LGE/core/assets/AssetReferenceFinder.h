@@ -34,6 +34,7 @@ namespace LGE {
 // Forward declarations
 class AssetRegistry;
 class DependencyGraph;
+class AssetReferenceIndex;
 
 struct AssetReference {
     GUID referencingAsset;
@@ -61,9 +62,12 @@ class AssetReferenceFinder {
 private:
     AssetRegistry* m_Registry;
     DependencyGraph* m_Graph;
+    AssetReferenceIndex* m_ReferenceIndex;   // Optional; answers queries and fills propertyPath
+    
+    AssetReference MakeReference(const AssetMetadata& referencing, const std::string& propertyPath) const;
 
 public:
-    AssetReferenceFinder(AssetRegistry* registry, DependencyGraph* graph);
+    AssetReferenceFinder(AssetRegistry* registry, DependencyGraph* graph, AssetReferenceIndex* referenceIndex = nullptr);
     
     // Find all references to an asset
     std::vector<AssetReference> FindReferences(const GUID& asset);
@@ -0,0 +1,117 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/core/GUID.h"
+#include "LGE/core/filesystem/PathTable.h"
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace LGE {
+
+// One outgoing reference found by DependencyScanner: the asset pointed at and
+// the property that holds it ("diffuseTexture", "shader", "dependencies", ...)
+struct AssetPropertyReference {
+    GUID target;
+    std::string propertyPath;
+};
+
+// Reverse-reference index: for every asset, who references it and through which
+// property. Kept up to date by DependencyScanner and persisted next to the
+// registry cache, so reference queries never walk the registry. Assets live in
+// dense slots, which lets batch queries mark a whole selection in a bitset and
+// answer "who references any of these" in one pass over their incoming edges.
+class AssetReferenceIndex {
+public:
+    struct Reference {
+        GUID asset;        // The other end of the edge
+        PathId property;   // Interned in PathTable::Get()
+    };
+    
+    // Replaces everything source references and marks it as indexed
+    void SetReferences(const GUID& source, const std::vector<AssetPropertyReference>& references);
+    
+    // Drops the asset's outgoing references; references to it stay, so
+    // referencers still show up as broken until they are rescanned
+    void RemoveAsset(const GUID& asset);
+    
+    // Drops every reference from source to target, whatever property holds it
+    void RemoveReference(const GUID& source, const GUID& target);
+    
+    // Assets referencing target, one entry per referencing property
+    void GetReferences(const GUID& target, std::vector<Reference>& outReferences) const;
+    // What source references, one entry per property
+    void GetReferencesFrom(const GUID& source, std::vector<Reference>& outReferences) const;
+    
+    size_t GetReferenceCount(const GUID& target) const;   // Distinct referencing assets
+    bool IsReferenced(const GUID& target) const;
+    
+    // Distinct assets outside targets that reference any of them. When
+    // outPerTarget is given it receives the same, split by target (parallel to targets).
+    std::vector<GUID> FindReferencers(const std::vector<GUID>& targets,
+                                      std::vector<std::vector<GUID>>* outPerTarget = nullptr) const;
+    
+    size_t GetIndexedCount() const { return m_IndexedCount; }   // Assets SetReferences has seen
+    size_t GetEdgeCount() const { return m_EdgeCount; }
+    
+    // Binary snapshot; incoming edges are rebuilt on load. LoadFromFile leaves
+    // the index empty on any mismatch.
+    bool SaveToFile(const std::filesystem::path& path) const;
+    bool LoadFromFile(const std::filesystem::path& path);
+    
+    void Clear();
+
+private:
+    struct Edge {
+        uint32_t slot;       // The other end
+        PathId property;
+        uint32_t twin;       // Index of the mirrored edge in the other end's list
+    };
+    
+    struct Slot {
+        GUID guid;
+        bool indexed = false;
+        std::vector<Edge> outgoing;
+        std::vector<Edge> incoming;
+    };
+    
+    static constexpr uint32_t kNoSlot = UINT32_MAX;
+    
+    uint32_t FindSlot(const GUID& guid) const;
+    uint32_t AcquireSlot(const GUID& guid);
+    void ReleaseIfUnused(uint32_t slot);
+    void RemoveOutgoingAt(uint32_t slot, uint32_t index);
+    void ClearOutgoing(uint32_t slot);
+    
+    std::vector<Slot> m_Slots;
+    std::vector<uint32_t> m_FreeSlots;
+    std::unordered_map<GUID, uint32_t> m_SlotByGuid;
+    size_t m_IndexedCount = 0;
+    size_t m_EdgeCount = 0;
+};
+
+} // namespace LGE
@@ -24,7 +24,10 @@ For more information, visit: https://nexelgames.com/luma-engine
 #pragma once
 
 #include "LGE/core/assets/AssetMetadata.h"
+#include "LGE/core/assets/ChangeJournal.h"
 #include "LGE/core/GUID.h"
+#include "LGE/core/filesystem/PathTable.h"
+#include <cstdint>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -37,12 +40,35 @@ namespace LGE {
 class AssetRegistry {
 private:
     std::unordered_map<GUID, AssetMetadata> m_Assets;
-    std::unordered_map<std::string, GUID> m_PathIndex;
+    std::unordered_map<PathId, GUID> m_PathIndex;   // Keys interned in PathTable::Get()
     std::multimap<AssetType, GUID> m_TypeIndex;
     std::multimap<std::string, GUID> m_TagIndex;
     
+    // Virtual-directory tree over asset paths. Folder names are PathTable ids;
+    // a folder lists its subfolders and the assets directly inside it.
+    struct DirectoryNode {
+        PathId segment = kInvalidPathId;
+        uint32_t parent = 0;
+        std::vector<uint32_t> subfolders;
+        std::vector<GUID> assets;
+    };
+    std::vector<DirectoryNode> m_Directories;        // [0] is the root "/"
+    std::vector<uint32_t> m_FreeDirectories;
+    std::unordered_map<uint64_t, uint32_t> m_DirectoryChildren;   // (parent << 32 | segment) -> folder
+    
+    // The keys each asset was filed under. Callers edit the stored metadata in
+    // place before UpdateAsset (renames do), so removal can't go by its fields.
+    struct IndexedKeys {
+        PathId path = kInvalidPathId;
+        uint32_t directory = 0;
+        AssetType type = AssetType::Unknown;
+        std::vector<std::string> tags;
+    };
+    std::unordered_map<GUID, IndexedKeys> m_IndexedKeys;
+    
     std::filesystem::path m_CacheFilePath;
     bool m_IsDirty;
+    ChangeJournal m_Changes;   // Registered, updated and unregistered GUIDs
 
 public:
     AssetRegistry();
@@ -51,6 +77,8 @@ public:
     // Asset management
     bool RegisterAsset(const AssetMetadata& metadata);
     bool UnregisterAsset(const GUID& guid);
+    // Bulk removal with one pass over each affected index; returns how many were registered
+    size_t UnregisterAssets(const std::vector<GUID>& guids);
     bool UpdateAsset(const GUID& guid, const AssetMetadata& metadata);
     
     // Queries
@@ -65,6 +93,17 @@ public:
     std::vector<AssetMetadata*> SearchAssets(const std::string& query);
     std::vector<const AssetMetadata*> SearchAssets(const std::string& query) const;
     
+    // Visits every asset in unspecified order; the registry must not change meanwhile
+    void ForEachAsset(const std::function<void(const AssetMetadata&)>& func) const;
+    
+    // Directory index: cost is proportional to the folder's direct children.
+    // Directories are virtual paths such as "/Assets/Textures"; backslashes also separate.
+    bool HasDirectory(const std::string& virtualDirectory) const;
+    bool HasSubdirectories(const std::string& virtualDirectory) const;
+    std::vector<std::string> GetSubdirectories(const std::string& virtualDirectory) const;   // Names, unsorted
+    std::vector<AssetMetadata*> GetAssetsInDirectory(const std::string& virtualDirectory);
+    std::vector<const AssetMetadata*> GetAssetsInDirectory(const std::string& virtualDirectory) const;
+    
     // Dependency tracking
     std::vector<GUID> GetDependencies(const GUID& guid);
     std::vector<GUID> GetDependents(const GUID& guid); // What uses this asset
@@ -79,6 +118,10 @@ public:
     size_t GetAssetCount() const { return m_Assets.size(); }
     size_t GetAssetCountByType(AssetType type) const;
     
+    // Assets touched through RegisterAsset/UpdateAsset/UnregisterAsset, for
+    // incremental consumers (edits made through GetAsset pointers are not seen)
+    const ChangeJournal& GetChanges() const { return m_Changes; }
+    
     // Clear all assets
     void Clear();
     
@@ -89,8 +132,14 @@ public:
 private:
     // Helper methods for indexing
     void AddToIndices(const GUID& guid, const AssetMetadata& metadata);
-    void RemoveFromIndices(const GUID& guid, const AssetMetadata& metadata);
-    void UpdateIndices(const GUID& guid, const AssetMetadata& oldMetadata, const AssetMetadata& newMetadata);
+    void RemoveFromIndices(const GUID& guid);
+    void UpdateIndices(const GUID& guid, const AssetMetadata& metadata);
+    
+    // Directory index helpers; FindDirectory returns UINT32_MAX when the folder is unknown
+    uint32_t FindDirectory(const std::string& virtualDirectory) const;
+    uint32_t GetOrCreateDirectory(const std::string& virtualPath, bool includeLastSegment);
+    void PruneDirectory(uint32_t directory);
+    void ResetDirectories();
 };
 
 } // namespace LGE
@@ -44,8 +44,6 @@ private:
     // Track last scan state
     std::unordered_map<std::string, std::time_t> m_LastScanTimes;
     
-    AssetType DetectAssetType(const std::filesystem::path& path);
-    bool ShouldIgnoreFile(const std::filesystem::path& path);
     bool ShouldIgnoreDirectory(const std::filesystem::path& path);
 
 public:
@@ -63,6 +61,14 @@ public:
     // Process single file
     bool ProcessFile(const std::filesystem::path& filePath);
     
+    // Registry path of a file under the assets root. Safe to call from a worker
+    // thread while the VFS mounts are left alone.
+    std::string GetVirtualPath(const std::filesystem::path& filePath) const;
+    
+    // Unknown types and ignored files never become assets
+    static AssetType DetectAssetType(const std::filesystem::path& path);
+    static bool ShouldIgnoreFile(const std::filesystem::path& path);
+    
     // Set assets root
     void SetAssetsRoot(const std::filesystem::path& root) { m_AssetsRoot = root; }
 };
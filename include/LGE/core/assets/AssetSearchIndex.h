@@ -25,6 +25,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #include "LGE/core/GUID.h"
 #include "LGE/core/assets/AssetMetadata.h"
+#include <filesystem>
 #include <vector>
 #include <unordered_map>
 #include <string>
@@ -54,6 +55,7 @@ private:
     std::unordered_map<std::string, std::vector<GUID>> m_WordIndex;
     
     void BuildWordIndex();
+    void RemoveEntryAt(size_t index);   // Swaps the last entry into its slot
     std::vector<std::string> Tokenize(const std::string& text);
     std::string ToLower(const std::string& str) const;
 
@@ -68,6 +70,11 @@ public:
     size_t GetEntryCount() const { return m_Entries.size(); }
     size_t GetWordCount() const { return m_WordIndex.size(); }
     
+    // Persistence: entries are stored in a small binary file; the word index is
+    // rebuilt on load. LoadFromFile leaves the index empty on any mismatch.
+    bool SaveToFile(const std::filesystem::path& path) const;
+    bool LoadFromFile(const std::filesystem::path& path);
+    
     // Clear index
     void Clear();
 };
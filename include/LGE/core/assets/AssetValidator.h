@@ -24,6 +24,8 @@ For more information, visit: https://nexelgames.com/luma-engine
 #pragma once
 
 #include "LGE/core/GUID.h"
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include <string>
 #include <functional>
@@ -60,18 +62,38 @@ public:
 private:
     AssetRegistry* m_Registry;
     DependencyGraph* m_Graph;
+    
+    // Snapshot, indices and issues of the last project sweep; patched in place
+    // by RevalidateChanged
+    struct Sweep;
+    std::unique_ptr<Sweep> m_Sweep;
+    size_t m_LastRevalidatedCount;
+    
+    std::unique_ptr<Sweep> BuildSweep(uint32_t checks) const;
+    void FindCycles(Sweep& sweep, const std::vector<GUID>& seeds) const;
+    std::vector<ValidationResult> CollectResults(const Sweep& sweep) const;
 
 public:
     AssetValidator(AssetRegistry* registry, DependencyGraph* graph);
+    ~AssetValidator();
     
     // Validate single asset
     std::vector<ValidationResult> ValidateAsset(const GUID& guid);
     
-    // Validate entire project
+    // Validate entire project: one sweep over a registry snapshot with the
+    // checks sharded across the JobSystem. Call from the thread that owns the
+    // registry; progress is reported on that thread.
     std::vector<ValidationResult> ValidateProject(
         std::function<void(int, int)> progressCallback = nullptr
     );
     
+    // Rechecks only the assets registered, updated, removed or re-linked since
+    // the previous sweep (plus their dependents and name twins) and returns the
+    // complete current result set. Cheap enough to run every few frames; falls
+    // back to ValidateProject when there is no usable previous sweep.
+    std::vector<ValidationResult> RevalidateChanged();
+    size_t GetLastRevalidatedCount() const { return m_LastRevalidatedCount; }
+    
     // Common validation checks
     std::vector<ValidationResult> CheckMissingDependencies();
     std::vector<ValidationResult> CheckCircularDependencies();
@@ -84,10 +106,10 @@ public:
     
     // Get validation summary
     struct ValidationSummary {
-        int infoCount;
-        int warningCount;
-        int errorCount;
-        int autoFixableCount;
+        int infoCount = 0;
+        int warningCount = 0;
+        int errorCount = 0;
+        int autoFixableCount = 0;
     };
     ValidationSummary GetSummary(const std::vector<ValidationResult>& results) const;
 };
@@ -0,0 +1,73 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/core/GUID.h"
+#include <cstdint>
+#include <vector>
+
+namespace LGE {
+
+// Bounded log of the GUIDs a container touched, for consumers that want to
+// redo only the work affected since they last looked. Each Record bumps the
+// revision by one; a consumer keeps the revision it last saw and asks for
+// everything after it. Old entries are trimmed, and a consumer that fell
+// behind the trimmed range (or predates a Reset) has to do a full pass.
+class ChangeJournal {
+public:
+    static constexpr size_t kMaxEntries = 1 << 16;
+    
+    void Record(const GUID& guid) {
+        if (m_Entries.size() >= kMaxEntries) {
+            size_t dropped = m_Entries.size() / 2;
+            m_Entries.erase(m_Entries.begin(), m_Entries.begin() + static_cast<std::ptrdiff_t>(dropped));
+            m_BaseRevision += dropped;
+        }
+        m_Entries.push_back(guid);
+    }
+    
+    // Everything changed at once (the container was cleared or reloaded)
+    void Reset() {
+        m_BaseRevision = GetRevision() + 1;
+        m_Entries.clear();
+    }
+    
+    uint64_t GetRevision() const { return m_BaseRevision + m_Entries.size(); }
+    
+    // Appends the GUIDs recorded after revision (duplicates included); false
+    // when that range is no longer available
+    bool CollectSince(uint64_t revision, std::vector<GUID>& outChanged) const {
+        if (revision < m_BaseRevision || revision > GetRevision()) {
+            return false;
+        }
+        outChanged.insert(outChanged.end(), m_Entries.begin() + static_cast<std::ptrdiff_t>(revision - m_BaseRevision), m_Entries.end());
+        return true;
+    }
+
+private:
+    std::vector<GUID> m_Entries;   // Entry i was recorded at revision m_BaseRevision + i + 1
+    uint64_t m_BaseRevision = 0;
+};
+
+} // namespace LGE
@@ -24,6 +24,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #pragma once
 
 #include "LGE/core/GUID.h"
+#include "LGE/core/assets/ChangeJournal.h"
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -43,6 +44,7 @@ private:
     std::unordered_map<GUID, std::unordered_set<GUID>> m_Dependents;
     
     AssetRegistry* m_Registry;
+    ChangeJournal m_Changes;   // Assets whose outgoing edges changed
 
     // Helper for recursive dependency collection
     void CollectDependenciesRecursive(const GUID& asset, std::unordered_set<GUID>& visited, std::vector<GUID>& result) const;
@@ -59,6 +61,10 @@ public:
     // Add a dependency relationship
     void AddDependency(const GUID& asset, const GUID& dependency);
     
+    // Replace an asset's dependencies, leaving what depends on it alone; a
+    // no-op (and no journal entry) when nothing changed
+    void SetDependencies(const GUID& asset, const std::vector<GUID>& dependencies);
+    
     // Remove all dependencies for an asset
     void RemoveDependencies(const GUID& asset);
     
@@ -92,6 +98,7 @@ public:
     // Get statistics
     size_t GetDependencyCount() const { return m_Dependencies.size(); }
     size_t GetDependentCount() const { return m_Dependents.size(); }
+    const ChangeJournal& GetChanges() const { return m_Changes; }
     
     // Persistence
     bool SaveToFile(const std::filesystem::path& path) const;
@@ -25,35 +25,76 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #include "LGE/core/GUID.h"
 #include "LGE/core/assets/AssetMetadata.h"
-#include <vector>
+#include "LGE/core/assets/AssetReferenceIndex.h"
+#include <cstdint>
+#include <filesystem>
 #include <functional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace LGE {
 
 // Forward declarations
 class AssetRegistry;
 class DependencyGraph;
+class VirtualFileSystem;
 
 class DependencyScanner {
 private:
+    // What the last parse of an asset's file (.lscene, .prefab, .lmat) found;
+    // reused while the file's content hash is unchanged
+    struct FileScan {
+        uint64_t contentHash = 0;
+        std::vector<AssetPropertyReference> references;
+    };
+    
     AssetRegistry* m_Registry;
     DependencyGraph* m_Graph;
+    AssetReferenceIndex* m_ReferenceIndex;
+    VirtualFileSystem* m_VFS;
+    
+    std::unordered_map<GUID, FileScan> m_FileScans;
+    size_t m_FilesParsed;   // By the last scan
+    size_t m_FilesReused;
     
-    // Type-specific scanners
-    std::vector<GUID> ScanMaterialDependencies(const GUID& materialGuid);
-    std::vector<GUID> ScanSceneDependencies(const GUID& sceneGuid);
-    std::vector<GUID> ScanPrefabDependencies(const GUID& prefabGuid);
+    // Parses the files of the given assets in parallel, skipping those whose
+    // content hash matches the cached scan; serially with one worker or less
+    void RefreshFileScans(const std::vector<GUID>& assets);
+    void RefreshFileScan(const GUID& asset);
+    void StoreFileScan(const GUID& asset, bool readable, bool reused, FileScan& scan);
+    static bool ReadFileScan(const std::string& file, const GUID& asset, const FileScan* cached,
+                             FileScan& outScan, bool& outReused);
+    std::vector<GUID> CollectAllAssets();   // Also drops cached scans of unregistered assets
+    const FileScan* FindFileScan(const GUID& asset) const;
+    void ApplyReferences(const GUID& asset, const std::vector<AssetPropertyReference>& references);
+    
+    std::vector<AssetPropertyReference> ScanMetadata(const AssetMetadata& metadata);
+    
+    // Type-specific scanners; each reference carries the property it was found
+    // under. Without a parsed file they fall back to metadata.dependencies.
+    std::vector<AssetPropertyReference> ScanMaterialDependencies(const AssetMetadata& metadata, const FileScan* file);
+    std::vector<AssetPropertyReference> ScanSceneDependencies(const AssetMetadata& metadata, const FileScan* file);
+    std::vector<AssetPropertyReference> ScanPrefabDependencies(const AssetMetadata& metadata, const FileScan* file);
     
     // Helper to extract GUIDs from JSON (for asset files that reference other assets)
     std::vector<GUID> ExtractGUIDsFromJson(const std::string& jsonString, const std::string& key = "dependencies");
 
 public:
-    DependencyScanner(AssetRegistry* reg, DependencyGraph* graph);
+    DependencyScanner(AssetRegistry* reg, DependencyGraph* graph, AssetReferenceIndex* referenceIndex = nullptr);
     
     // Scan single asset for dependencies
     std::vector<GUID> ScanAsset(const GUID& asset);
     
-    // Scan all assets
+    // Same scan, keeping where each reference was found
+    std::vector<AssetPropertyReference> ScanReferences(const GUID& asset);
+    
+    // Fills index from every registered asset without touching the graph or
+    // the metadata; used when the persisted index is missing or stale
+    void IndexAll(AssetReferenceIndex& index);
+    
+    // Scan all assets; files are parsed in parallel, or one at a time
+    // alongside the graph updates when the pool has a single worker
     void ScanAll(std::function<void(int, int)> progressCallback = nullptr);
     
     // Rescan specific asset (remove old deps and scan again)
@@ -61,6 +102,24 @@ public:
     
     // Get scanner for specific asset type
     std::vector<GUID> ScanByType(const GUID& asset, AssetType type);
+    
+    void SetReferenceIndex(AssetReferenceIndex* referenceIndex) { m_ReferenceIndex = referenceIndex; }
+    
+    // Needed to read asset files; without it only the registered metadata is scanned
+    void SetVirtualFileSystem(VirtualFileSystem* vfs) { m_VFS = vfs; }
+    
+    // Streaming pass over a JSON document that collects every string holding a
+    // GUID, with its JSON path ("gameObjects[2].components[0].meshGUID"). No DOM
+    // is built. Identity fields ("guid") and references to them are skipped, as
+    // is self. Returns false on malformed JSON.
+    static bool ExtractReferences(std::string_view json, const GUID& self, std::vector<AssetPropertyReference>& outReferences);
+    
+    // Cached file scans, stored next to the registry cache
+    bool SaveFileScans(const std::filesystem::path& path) const;
+    bool LoadFileScans(const std::filesystem::path& path);
+    
+    size_t GetFilesParsed() const { return m_FilesParsed; }
+    size_t GetFilesReused() const { return m_FilesReused; }
 };
 
 } // namespace LGE
@@ -26,27 +26,45 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/AssetRegistry.h"
 #include "LGE/core/GUID.h"
 #include "LGE/core/assets/AssetMetadata.h"
-#include "LGE/rendering/Texture.h"
+#include "LGE/rendering/TextureArrayPool.h"
 #include "LGE/core/filesystem/VirtualFileSystem.h"
 #include <filesystem>
 #include <unordered_map>
+#include <unordered_set>
 #include <queue>
 #include <mutex>
 #include <condition_variable>
 #include <thread>
 #include <atomic>
 #include <functional>
-#include <memory>
+#include <cstdint>
+#include <vector>
 
 namespace LGE {
 
+// Generates fixed-size RGBA thumbnails on a background thread. Finished
+// pixels are uploaded on the main thread into layers of one shared texture
+// array, so hundreds of thumbnails cost a single GL allocation.
 class ThumbnailGenerator {
 private:
+    struct GeneratedThumbnail {
+        GUID guid;
+        std::vector<uint8_t> pixels;
+    };
+    
     AssetRegistry* m_Registry;
     VirtualFileSystem* m_VFS;
     std::filesystem::path m_CacheDirectory;
-    std::unordered_map<GUID, std::shared_ptr<Texture>> m_Cache;
-    std::mutex m_CacheMutex;
+    int m_ThumbnailSize;
+    
+    // Main thread only
+    TextureArrayPool m_Pool;
+    std::unordered_map<GUID, uint32_t> m_Cache; // GUID -> pool layer
+    std::unordered_set<GUID> m_Requested;
+    
+    // Generated on the worker, waiting for upload
+    std::vector<GeneratedThumbnail> m_Generated;
+    std::mutex m_GeneratedMutex;
     
     // Background thread for generation
     std::thread m_GeneratorThread;
@@ -56,22 +74,28 @@ private:
     std::atomic<bool> m_IsRunning;
     
     void GeneratorThreadFunc();
-    std::shared_ptr<Texture> GenerateThumbnailForType(const AssetMetadata& metadata, int size = 128);
-    std::shared_ptr<Texture> LoadCachedThumbnail(const GUID& guid);
-    void SaveCachedThumbnail(const GUID& guid, std::shared_ptr<Texture> thumbnail);
+    bool GenerateThumbnailForType(const AssetMetadata& metadata, std::vector<uint8_t>& outPixels);
+    bool LoadCachedThumbnail(const GUID& guid, const std::filesystem::path& sourcePath, std::vector<uint8_t>& outPixels);
+    void SaveCachedThumbnail(const GUID& guid, const std::vector<uint8_t>& pixels);
 
 public:
-    ThumbnailGenerator(AssetRegistry* registry, VirtualFileSystem* vfs, const std::filesystem::path& cacheDir);
+    ThumbnailGenerator(AssetRegistry* registry, VirtualFileSystem* vfs, const std::filesystem::path& cacheDir,
+                       int thumbnailSize = 128);
     ~ThumbnailGenerator();
     
     // Request thumbnail (async)
     void RequestThumbnail(const GUID& guid);
     
-    // Get thumbnail (returns placeholder if not ready)
-    std::shared_ptr<Texture> GetThumbnail(const GUID& guid);
+    // Upload finished thumbnails into the array pool. Call once per frame
+    // with the GL context current; fires onThumbnailReady for each upload.
+    void ProcessUploads(uint32_t maxUploads = 8);
+    
+    // 2D texture view of the thumbnail's layer, or 0 if not ready yet.
+    // View IDs change when the pool grows, so fetch them every frame.
+    uint32_t GetThumbnail(const GUID& guid) const;
     
     // Check if thumbnail is ready
-    bool IsThumbnailReady(const GUID& guid);
+    bool IsThumbnailReady(const GUID& guid) const;
     
     // Regenerate thumbnail
     void RegenerateThumbnail(const GUID& guid);
@@ -79,25 +103,24 @@ public:
     // Clear cache
     void ClearCache();
     
+    int GetThumbnailSize() const { return m_ThumbnailSize; }
+    const TextureArrayPool& GetPool() const { return m_Pool; }
+    
     // Callbacks
     std::function<void(const GUID&)> onThumbnailReady;
-    
-    // Get placeholder texture
-    std::shared_ptr<Texture> GetPlaceholderTexture();
 };
 
-// Type-specific thumbnail generators
+// Type-specific thumbnail generators. Output is size x size RGBA8, top row
+// first, with the source fitted inside and the remainder left transparent.
 class TextureThumbnailGenerator {
 public:
-    static std::shared_ptr<Texture> Generate(const std::filesystem::path& path, int size = 128);
+    static bool Generate(const std::filesystem::path& path, int size, std::vector<uint8_t>& outPixels);
 };
 
 class ModelThumbnailGenerator {
 public:
-    static std::shared_ptr<Texture> Generate(const std::filesystem::path& path, int size = 128);
+    static bool Generate(const std::filesystem::path& path, int size, std::vector<uint8_t>& outPixels);
 };
 
 } // namespace LGE
 
-
-
@@ -0,0 +1,201 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace LGE {
+
+enum class IOPriority : uint8_t {
+    Low,
+    Normal,
+    High,
+    Critical
+};
+
+// Where onComplete runs. The I/O thread must not be held up: only trivial
+// callbacks (copying the bytes, bumping a counter) should use it.
+enum class IOCompletionContext : uint8_t {
+    JobSystem,
+    IOThread
+};
+
+struct IOReadResult {
+    uint64_t id = 0;
+    bool success = false;
+    int error = 0;                    // errno on failure
+    const uint8_t* data = nullptr;    // Only valid inside the callback
+    size_t size = 0;
+    bool missedDeadline = false;
+    double latencyMs = 0.0;           // Submit to completion
+};
+
+struct IOReadRequest {
+    std::string path;
+    uint64_t offset = 0;
+    uint64_t size = 0;                // 0 reads to the end of the file
+    IOPriority priority = IOPriority::Normal;
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+    bool direct = false;              // Unbuffered, sector-aligned reads (large .lpak reads); buffered where unsupported
+    IOCompletionContext context = IOCompletionContext::JobSystem;
+    std::function<void(const IOReadResult&)> onComplete;
+};
+
+struct AsyncIOConfig {
+    uint32_t queueDepth = 64;         // Reads in flight at once
+    uint32_t bufferCount = 64;        // Registered buffers; larger reads get their own
+    size_t bufferSize = 1024 * 1024;
+    uint32_t fallbackThreads = 4;     // pread workers when io_uring is unavailable
+    bool allowIoUring = true;
+};
+
+struct AsyncIOStats {
+    uint64_t submitted = 0;
+    uint64_t completed = 0;
+    uint64_t failed = 0;
+    uint64_t bytesRead = 0;
+    uint64_t deadlineMisses = 0;
+    uint32_t queued = 0;
+    uint32_t inFlight = 0;
+};
+
+// Asynchronous whole-file and range reads. Requests wait in one queue ordered by
+// priority, then deadline, then submission; they are dispatched into a fixed pool
+// of aligned buffers and completed on the JobSystem (or the I/O thread). On Linux
+// reads go through io_uring with the buffers registered up front; elsewhere, or
+// when the kernel refuses a ring, a small pool of threads issues positional reads.
+class AsyncFileIO {
+public:
+    AsyncFileIO();
+    ~AsyncFileIO();
+    AsyncFileIO(const AsyncFileIO&) = delete;
+    AsyncFileIO& operator=(const AsyncFileIO&) = delete;
+    
+    // Shared service used by the streamer and the packager; started on first Submit
+    static AsyncFileIO& Get();
+    
+    bool Initialize(const AsyncIOConfig& config = AsyncIOConfig());
+    
+    // Finishes every queued read, then stops the backend
+    void Shutdown();
+    
+    bool IsInitialized() const { return m_Initialized.load(std::memory_order_acquire); }
+    bool IsUsingIoUring() const { return m_Ring != nullptr; }
+    const char* GetBackendName() const;
+    
+    // Returns the request id passed back in IOReadResult
+    uint64_t Submit(IOReadRequest request);
+    
+    // One lock and one wake-up for the whole batch; ids are consecutive
+    uint64_t SubmitBatch(std::vector<IOReadRequest>& requests);
+    
+    // Blocks until every submitted read has completed and its callback returned
+    void WaitIdle();
+    
+    AsyncIOStats GetStats() const;
+
+private:
+    struct QueuedRead {
+        IOReadRequest request;
+        uint64_t id;
+        std::chrono::steady_clock::time_point submitTime;
+    };
+    
+    // Dispatched read; owns its buffer until the callback has run
+    struct ActiveRead {
+        QueuedRead read;
+        intptr_t file = -1;
+        uint8_t* buffer = nullptr;
+        int bufferIndex = -1;         // -1 = private allocation
+        size_t head = 0;              // Bytes before the requested offset (direct alignment)
+        size_t length = 0;
+        size_t done = 0;              // Bytes read so far (io_uring resubmits the rest)
+        size_t requested = 0;
+        uint64_t fileOffset = 0;      // Aligned start actually read
+        std::string fileKey;
+    };
+    
+    struct OpenFile {
+        intptr_t handle;
+        uint32_t users;
+        bool direct;                  // False when the filesystem refused unbuffered access
+    };
+    
+    struct Ring;
+    
+    void EnsureInitialized();
+    static bool IsLowerPrecedence(const QueuedRead& a, const QueuedRead& b);
+    
+    // Opens the file and claims a buffer. Returns null with outNoBuffer set when
+    // the pool is empty (read untouched), or null after completing the read
+    // itself (open failure, empty range).
+    ActiveRead* PrepareRead(QueuedRead& read, bool& outNoBuffer);
+    void CompleteRead(ActiveRead* active, int64_t result);
+    void FinishRead(ActiveRead* active, const IOReadResult& result);
+    intptr_t AcquireFile(const std::string& path, bool direct, std::string& outKey, bool& outDirect, int& outError);
+    void ReleaseFile(const std::string& key);
+    void Wake();
+    
+    void RingThread();
+    void WorkerThread();
+    bool CreateRing();
+    void DestroyRing();
+    void QueueRingRead(ActiveRead* active);
+    void ArmRingWake();
+    
+    static constexpr size_t kDirectAlignment = 4096;
+    static constexpr size_t kMaxOpenFiles = 64;
+    
+    AsyncIOConfig m_Config;
+    std::atomic<bool> m_Initialized;
+    bool m_Stopping;
+    
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_QueueCV;        // Fallback workers: new reads or free buffers
+    std::condition_variable m_IdleCV;
+    std::mutex m_InitMutex;
+    std::vector<QueuedRead> m_Queue;          // Binary heap ordered by IsLowerPrecedence
+    uint64_t m_NextId;
+    uint32_t m_InFlight;
+    
+    uint8_t* m_BufferMemory;
+    std::vector<int> m_FreeBuffers;
+    std::unordered_map<std::string, OpenFile> m_OpenFiles;
+    
+    Ring* m_Ring;
+    std::vector<std::thread> m_Threads;
+    
+    AsyncIOStats m_Stats;
+};
+
+} // namespace LGE
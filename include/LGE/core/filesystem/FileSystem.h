@@ -30,6 +30,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #pragma once
 
+#include "LGE/core/filesystem/MappedFile.h"
 #include <string>
 #include <vector>
 #include <functional>
@@ -63,8 +64,14 @@ struct FileEntry {
 
 class FileSystem {
 public:
-    // File reading
+    // File reading. Relative paths are tried against the working directory, then
+    // the project root next to the executable; the first hit is cached.
     static std::string ReadFile(const std::string& filepath);
+    static FileView MapFile(const std::string& filepath, FileAccessHint hint = FileAccessHint::Sequential);
+    
+    // Path ReadFile/MapFile would open, empty when no search path has it
+    static std::string ResolveSearchPath(const std::string& filepath);
+    static void ClearSearchPathCache();
     static bool WriteFile(const std::string& filepath, const std::string& content);
     
     // File operations
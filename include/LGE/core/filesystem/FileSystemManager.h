@@ -24,6 +24,8 @@ For more information, visit: https://nexelgames.com/luma-engine
 #pragma once
 
 #include "LGE/core/project/Project.h"
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <filesystem>
 #include <functional>
@@ -37,6 +39,7 @@ class GUIDRegistry;
 class AssetScanner;
 class DependencyGraph;
 class DependencyScanner;
+class AssetReferenceIndex;
 class FileSystemWatcher;
 class AssetHotReloader;
 class AssetSearchIndex;
@@ -48,8 +51,33 @@ class AsyncAssetLoader;
 class AssetRegistryCache;
 class AssetValidator;
 
+// Stages of FileSystemManager::BeginOpen, in order
+enum class ProjectOpenStage {
+    Idle,
+    LoadingState,   // Worker: persisted registry, GUID map, dependency graph and search index
+    Reconciling,    // Worker: walking Assets/ and diffing it against the loaded registry
+    Applying,       // Main thread: registering added/changed files, dropping deleted ones
+    Rebuilding,     // Main thread: dependency and search entries of the dirty assets
+    Ready,
+    Failed
+};
+
+struct ProjectOpenProgress {
+    ProjectOpenStage stage = ProjectOpenStage::Idle;
+    uint32_t done = 0;
+    uint32_t total = 0;
+    double elapsedMs = 0.0;        // Since BeginOpen
+    double interactiveMs = 0.0;    // When the loaded state was published (0 until then)
+    uint32_t changedFiles = 0;
+    uint32_t removedFiles = 0;
+};
+
+const char* GetProjectOpenStageName(ProjectOpenStage stage);
+
 class FileSystemManager {
 private:
+    struct OpenState;
+    
     std::shared_ptr<Project> m_Project;
     
     // Core systems
@@ -61,6 +89,7 @@ private:
     // Dependency management
     std::unique_ptr<DependencyGraph> m_DependencyGraph;
     std::unique_ptr<DependencyScanner> m_DependencyScanner;
+    std::unique_ptr<AssetReferenceIndex> m_ReferenceIndex;   // Maintained by m_DependencyScanner
     
     // File watching
     std::unique_ptr<FileSystemWatcher> m_FileWatcher;
@@ -83,14 +112,43 @@ private:
     std::unique_ptr<AssetValidator> m_AssetValidator;
     
     bool m_IsInitialized;
+    
+    // Project open in flight; owned with the worker job, which may outlive a frame
+    std::shared_ptr<OpenState> m_Open;
+    ProjectOpenProgress m_OpenProgress;
+    
+    static bool LoadPersistentState(OpenState& state);
+    void PublishState(OpenState& state);
+    void StartReconcile();
+    bool ApplyReconcile(OpenState& state, std::chrono::steady_clock::time_point deadline);
+    bool RebuildDirty(OpenState& state, std::chrono::steady_clock::time_point deadline);
+    void WaitForOpenJob();
+    void SavePersistentState();
 
 public:
     FileSystemManager();
     ~FileSystemManager();
     
-    // Initialize with a project
+    // Initialize with a project, loading persisted state on the calling thread
     bool Initialize(std::shared_ptr<Project> project);
     
+    // Opens the project as a pipeline that never blocks the caller: persisted
+    // state loads on a JobSystem worker and is published by Update, which then
+    // starts the watcher, reconciles against disk in the background and rebuilds
+    // only what changed, a time slice per frame. The manager is initialized (and
+    // its systems usable) from the frame the persisted state is published.
+    bool BeginOpen(std::shared_ptr<Project> project);
+    
+    // Main thread, once per frame; applies at most budgetMs of pipeline work
+    void Update(double budgetMs = 4.0);
+    
+    // Blocks until the open's background job finishes or timeoutMs passes; returns
+    // at once when no job is running. For callers without a frame loop to pace Update.
+    void WaitForOpenJob(double timeoutMs);
+    
+    bool IsOpening() const { return m_Open != nullptr; }
+    const ProjectOpenProgress& GetOpenProgress() const { return m_OpenProgress; }
+    
     // Shutdown and cleanup
     void Shutdown();
     
@@ -107,6 +165,7 @@ public:
     AssetScanner* GetAssetScanner() const { return m_AssetScanner.get(); }
     DependencyGraph* GetDependencyGraph() const { return m_DependencyGraph.get(); }
     DependencyScanner* GetDependencyScanner() const { return m_DependencyScanner.get(); }
+    AssetReferenceIndex* GetReferenceIndex() const { return m_ReferenceIndex.get(); }
     AssetHotReloader* GetHotReloader() const { return m_HotReloader.get(); }
     AssetSearchIndex* GetSearchIndex() const { return m_SearchIndex.get(); }
     CollectionManager* GetCollectionManager() const { return m_CollectionManager.get(); }
@@ -36,6 +36,7 @@ namespace LGE {
 class LinuxFileSystemWatcher : public FileSystemWatcher {
 private:
     int m_InotifyFd;
+    int m_WakeFd;   // eventfd; lets StopWatching interrupt the select immediately
     std::thread m_WatchThread;
     std::atomic<bool> m_ShouldStop;
     std::map<int, std::filesystem::path> m_WatchDescriptors;
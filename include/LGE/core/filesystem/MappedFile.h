@@ -0,0 +1,100 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace LGE {
+
+class FileView;
+
+// How a file is about to be read; maps to madvise()/MAP_POPULATE on POSIX
+enum class FileAccessHint {
+    Sequential,   // Read front to back once (decoders, parsers); pages are prefaulted
+    Random,       // Scattered reads (package archives); nothing is prefaulted
+    WillNeed      // Read soon in full; prefaulted and kept
+};
+
+// Read-only contents of a file: a memory mapping when the platform allows it,
+// otherwise a single buffered read. Shared by the FileViews into it and released
+// with the last one. Files rewritten in place while mapped are undefined to read;
+// writers in the engine replace files rather than truncating them.
+class MappedFile {
+private:
+    const uint8_t* m_Data;
+    size_t m_Size;
+    bool m_IsMapped;
+    std::vector<uint8_t> m_Buffer;   // Fallback storage for small files and failed maps
+
+public:
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    
+    // Invalid view when the file cannot be opened
+    static FileView Open(const std::string& path, FileAccessHint hint = FileAccessHint::Sequential);
+    
+    const uint8_t* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+    bool IsMapped() const { return m_IsMapped; }
+
+private:
+    MappedFile();
+    
+    // Below this, one read() beats setting up and tearing down a mapping
+    static constexpr size_t kMapThreshold = 64 * 1024;
+};
+
+// Refcounted, read-only span of a MappedFile. Cheap to copy; sub-views keep the
+// whole file alive.
+class FileView {
+private:
+    std::shared_ptr<const MappedFile> m_File;
+    const uint8_t* m_Data;
+    size_t m_Size;
+
+public:
+    FileView();
+    
+    bool IsValid() const { return m_File != nullptr; }
+    bool IsMapped() const { return m_File && m_File->IsMapped(); }
+    bool Empty() const { return m_Size == 0; }
+    
+    const uint8_t* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+    std::string_view AsStringView() const { return std::string_view(reinterpret_cast<const char*>(m_Data), m_Size); }
+    
+    // Clamped to this view; invalid views stay invalid
+    FileView SubView(size_t offset, size_t length) const;
+
+private:
+    friend class MappedFile;
+    FileView(std::shared_ptr<const MappedFile> file, const uint8_t* data, size_t size);
+};
+
+} // namespace LGE
@@ -0,0 +1,82 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+#pragma once
+
+#include "LGE/core/filesystem/AsyncFileIO.h"
+#include "LGE/core/filesystem/MappedFile.h"
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace LGE {
+
+// Read-only .lpak archive mounted as a VFS layer. Layout: header (magic
+// "LGEPAK01", entry count, table offset), file data, then the entry table
+// (path length, '/'-separated path relative to the archive root, offset, size).
+// The archive is mapped on Open; entries are handed out as views into it.
+class PackageArchive {
+private:
+    struct Entry {
+        uint64_t offset;
+        uint64_t size;
+    };
+    
+    std::filesystem::path m_Path;
+    std::unordered_map<std::string, Entry> m_Entries;
+    std::unordered_map<std::string, std::vector<std::string>> m_Directories;   // "" is the root
+    FileView m_Data;
+
+public:
+    PackageArchive();
+    
+    bool Open(const std::filesystem::path& archivePath);
+    
+    // Packs every regular file under sourceDirectory into a new archive
+    static bool Build(const std::filesystem::path& sourceDirectory, const std::filesystem::path& outputPath);
+    
+    // Paths are relative to the archive root; either separator is accepted
+    bool HasFile(std::string_view path) const;
+    bool HasDirectory(std::string_view path) const;
+    bool ReadFile(std::string_view path, std::vector<uint8_t>& outData) const;
+    FileView GetFileView(std::string_view path) const;   // Invalid when missing
+    
+    // Queues an unbuffered read of one entry on AsyncFileIO, bypassing the
+    // mapping and the page cache; path, offset, size and direct are filled in.
+    // Returns the request id, or 0 when the entry is missing (empty entries
+    // complete immediately on the calling thread).
+    uint64_t SubmitRead(std::string_view path, IOReadRequest request) const;
+    
+    // Appends the names of the files and folders directly inside path
+    void ListDirectory(std::string_view path, std::vector<std::string>& outNames) const;
+    
+    const std::filesystem::path& GetPath() const { return m_Path; }
+    size_t GetFileCount() const { return m_Entries.size(); }
+
+private:
+    static std::string NormalizeEntryPath(std::string_view path);
+};
+
+} // namespace LGE
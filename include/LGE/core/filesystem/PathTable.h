@@ -0,0 +1,84 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace LGE {
+
+// Stable 32-bit handle to an interned path string; 0 is never a valid path
+using PathId = uint32_t;
+constexpr PathId kInvalidPathId = 0;
+
+// Interned path strings shared by the registries. Each distinct string is stored
+// once in an append-only arena and never moves, so views returned by GetString
+// stay valid for the lifetime of the table. Lookups hash the string once and probe
+// an open-addressed id table. Thread-safe.
+class PathTable {
+public:
+    PathTable();
+    
+    // Table shared by AssetRegistry, GUIDRegistry and the VFS
+    static PathTable& Get();
+    
+    // Returns the existing id or adds the string
+    PathId Intern(std::string_view path);
+    
+    // Returns kInvalidPathId when the string was never interned
+    PathId Find(std::string_view path) const;
+    
+    // Null-terminated; empty for kInvalidPathId
+    std::string_view GetString(PathId id) const;
+    
+    size_t GetCount() const;
+    size_t GetMemoryUsage() const;   // Arena plus tables, in bytes
+
+private:
+    // Low 32 bits of the string's hash, enough to place it in any table this
+    // size; compared before the string so a probe rarely touches m_Strings
+    struct Slot {
+        PathId id = kInvalidPathId;
+        uint32_t hash = 0;
+    };
+    
+    static uint32_t Hash(std::string_view path);
+    PathId FindLocked(std::string_view path, uint32_t hash, size_t& outSlot) const;
+    void Grow();
+    
+    static constexpr size_t kChunkSize = 64 * 1024;
+    
+    mutable std::shared_mutex m_Mutex;
+    std::vector<std::unique_ptr<char[]>> m_Chunks;
+    size_t m_ChunkUsed;
+    size_t m_ArenaBytes;
+    std::vector<std::string_view> m_Strings;   // Indexed by id; [0] is the invalid id
+    std::vector<Slot> m_Slots;                 // Open addressing, power-of-two size, id 0 = empty
+};
+
+} // namespace LGE
@@ -23,26 +23,58 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #pragma once
 
+#include "LGE/core/filesystem/MappedFile.h"
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <filesystem>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace LGE {
 
+class PackageArchive;
+
+// Several layers may be mounted at the same virtual path (base .lpak archives,
+// DLC packs, the loose project folder). They form one overlay namespace: a path
+// resolves to the highest-priority layer that contains it, and writes always go
+// to the highest-priority writable (loose, non read-only) layer, so modifying a
+// packaged file copies it up into the project. Nested mount points still shadow
+// their parents entirely (longest-prefix match).
 class VirtualFileSystem {
 private:
     struct MountPoint {
         std::string virtualPath;   // "/Assets"
-        std::filesystem::path physicalPath; // "C:/LumaProject/Assets"
+        std::filesystem::path physicalPath; // "C:/LumaProject/Assets" or "C:/Game/Base.lpak"
         bool readOnly;
+        int priority;              // Higher layers shadow lower ones
+        std::shared_ptr<PackageArchive> archive;   // Set for .lpak layers
         
-        MountPoint(const std::string& vPath, const std::filesystem::path& pPath, bool ro = false)
-            : virtualPath(vPath), physicalPath(pPath), readOnly(ro) {}
+        MountPoint(const std::string& vPath, const std::filesystem::path& pPath, bool ro = false, int prio = 0)
+            : virtualPath(vPath), physicalPath(pPath), readOnly(ro), priority(prio) {}
+    };
+    
+    // Segment trie over mount virtual paths ([0] is "/"). Resolution walks the
+    // path's segments once and keeps the deepest mounted node: longest-prefix match.
+    struct MountNode {
+        std::string segment;
+        std::vector<uint32_t> children;
+        std::vector<uint32_t> mounts;   // Layers at this path, top first
     };
     
     std::vector<MountPoint> m_MountPoints;
+    std::vector<std::string> m_MountPhysicalStrings;   // Generic form, per mount
+    std::vector<MountNode> m_MountTrie;
     std::filesystem::path m_ProjectRoot;
+    std::string m_ProjectRootString;
+    
+    // Normalized virtual path -> mount index of the topmost layer holding it, or
+    // -1 when no layer does. Only paths under stacked layers are cached.
+    mutable std::unordered_map<std::string, int> m_ResolveCache;
+    mutable uint64_t m_ResolveGeneration = 0;   // Bumped on invalidation; stale probes are not cached
+    mutable std::mutex m_ResolveMutex;
 
 public:
     VirtualFileSystem();
@@ -51,27 +83,48 @@ public:
     // Initialize VFS with project root
     void Initialize(const std::filesystem::path& root);
     
-    // Convert virtual to physical path
+    // Convert virtual to physical path. Under stacked layers this is the loose
+    // file that shadows the others, or where a write would land when the path only
+    // exists inside a package (read those through ReadFile).
     std::filesystem::path ResolveVirtualPath(const std::string& virtualPath);
     
+    // Same, into a reusable string (no std::filesystem::path construction)
+    void ResolveVirtualPath(std::string_view virtualPath, std::string& outPhysical) const;
+    
     // Convert physical to virtual path
     std::string GetVirtualPath(const std::filesystem::path& physicalPath);
     
     // Mount a directory
     bool Mount(const std::string& virtualPath, const std::filesystem::path& physicalPath, bool readOnly = false);
     
-    // Unmount a directory
+    // Stack a layer at virtualPath. Sources ending in .lpak are mounted as
+    // read-only packages; equal priorities put the later mount on top.
+    bool MountLayer(const std::string& virtualPath, const std::filesystem::path& source, int priority, bool readOnly = false);
+    
+    // Unmount every layer at a virtual path
     bool Unmount(const std::string& virtualPath);
     
+    // Unmount a single layer
+    bool UnmountLayer(const std::string& virtualPath, const std::filesystem::path& source);
+    
     // File operations using virtual paths
     bool FileExists(const std::string& virtualPath);
     std::vector<uint8_t> ReadFile(const std::string& virtualPath);
+    FileView MapFile(const std::string& virtualPath, FileAccessHint hint = FileAccessHint::Sequential);   // Zero-copy, packages included
     bool WriteFile(const std::string& virtualPath, const std::vector<uint8_t>& data);
     
     // Directory operations
     bool DirectoryExists(const std::string& virtualPath);
     bool CreateDirectory(const std::string& virtualPath);
     
+    // Names directly inside a directory, merged across layers and sorted
+    std::vector<std::string> ListDirectory(const std::string& virtualPath);
+    
+    // Drop cached layer resolution for a changed file or folder on disk; fed by
+    // the file watcher
+    void InvalidatePhysicalPath(const std::filesystem::path& physicalPath);
+    void InvalidateResolutionCache();
+    
     // Get all mount points
     const std::vector<MountPoint>& GetMountPoints() const { return m_MountPoints; }
     
@@ -83,6 +136,13 @@ private:
     MountPoint* FindMountPoint(const std::string& virtualPath);
     const MountPoint* FindMountPoint(const std::string& virtualPath) const;
     std::string NormalizeVirtualPath(const std::string& path) const;
+    const MountPoint* MatchMount(std::string_view virtualPath, size_t& outRemainder) const;
+    const MountNode* MatchMountNode(std::string_view virtualPath, size_t& outRemainder) const;
+    int FindEntryLayer(const MountNode& node, std::string_view virtualPath, size_t remainder) const;
+    int FindWritableLayer(const MountNode& node) const;
+    bool LayerContains(size_t mountIndex, std::string_view relativePath) const;
+    void InvalidateVirtualPath(const std::string& normalizedPath);
+    void RebuildMountTrie();
 };
 
 } // namespace LGE
@@ -25,6 +25,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #include <string>
 #include <memory>
+#include <functional>
 #include "LGE/core/GUID.h"
 
 namespace LGE {
@@ -99,6 +100,11 @@ public:
     void SetDefaultScene(const std::string& scenePath);  // Accepts path, resolves to GUID
     void SetDefaultSceneByGUID(const GUID& guid) { m_DefaultSceneGUID = guid; }
     
+    // Writes the SampleScene of a new project and returns its GUID. Installed by the
+    // editor so projects can be created without linking the scene system (headless tools)
+    using DefaultSceneWriter = std::function<bool(const std::string& scenePath, GUID& outSceneGUID)>;
+    static void SetDefaultSceneWriter(DefaultSceneWriter writer);
+    
     // Initialize project directory structure
     bool InitializeDirectoryStructure();
 
@@ -96,8 +96,8 @@ protected:
     bool m_HasStarted;
 };
 
-// Template implementations
-#include "LGE/core/scene/Component.inl"
+// Template implementations call into GameObject, so GameObject.h includes
+// Component.inl once GameObject is complete
 
 } // namespace LGE
 
@@ -22,7 +22,8 @@ For more information, visit: https://nexelgames.com/luma-engine
 */
 
 // Template implementations for Component helper methods
-// Note: This file is included inside the LGE namespace in Component.h
+// Note: This file is included inside the LGE namespace in GameObject.h, after
+// GameObject is defined
 
 template<typename T>
 T* Component::GetComponent() const {
@@ -55,7 +55,7 @@ public:
     
     // Name
     const std::string& GetName() const { return m_Name; }
-    void SetName(const std::string& name) { m_Name = name; }
+    void SetName(const std::string& name);
     
     // Tag
     const std::string& GetTag() const { return m_Tag; }
@@ -211,5 +211,6 @@ private:
 
 // Template implementations
 #include "LGE/core/scene/GameObject.inl"
+#include "LGE/core/scene/Component.inl"
 
 } // namespace LGE
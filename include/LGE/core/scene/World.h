@@ -23,9 +23,11 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include "LGE/core/GUID.h"
 
@@ -67,6 +69,11 @@ public:
     // GameObject creation
     std::shared_ptr<GameObject> CreateGameObject(const std::string& name = "GameObject");
     
+    // Bumped when objects are added, removed, renamed, reparented or toggled;
+    // editor panels compare it to know when their cached trees are stale
+    uint64_t GetHierarchyVersion() const { return m_HierarchyVersion; }
+    void MarkHierarchyChanged() { ++m_HierarchyVersion; }
+    
     // Update loop
     void Update(float deltaTime);
     void LateUpdate(float deltaTime);
@@ -101,7 +108,7 @@ public:
     // Serialization
     std::string Serialize() const;
     bool SaveToFile(const std::string& path) const;
-    static std::shared_ptr<World> Deserialize(const std::string& json);
+    static std::shared_ptr<World> Deserialize(std::string_view json);
     static std::shared_ptr<World> LoadFromFile(const std::string& path);
 
 private:
@@ -109,6 +116,7 @@ private:
     std::string m_Name;
     std::vector<std::shared_ptr<GameObject>> m_RootGameObjects;
     std::unordered_map<GUID, std::weak_ptr<GameObject>> m_GameObjectMap;
+    uint64_t m_HierarchyVersion;
     
     // Play mode state
     bool m_IsPlaying;
@@ -123,8 +131,8 @@ private:
     void ProcessPendingDestruction();
 };
 
+} // namespace LGE
+
 // Template implementations
 #include "LGE/core/scene/World.inl"
 
-} // namespace LGE
-
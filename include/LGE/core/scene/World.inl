@@ -22,7 +22,12 @@ For more information, visit: https://nexelgames.com/luma-engine
 */
 
 // Template implementations for World component queries
-// Note: This file is included after the World class definition in World.h
+// Note: This file is included after the World class definition in World.h,
+// outside the LGE namespace, and needs GameObject complete
+
+#include "LGE/core/scene/GameObject.h"
+#include <functional>
+#include <type_traits>
 
 template<typename T>
 T* LGE::World::FindObjectOfType() {
@@ -37,7 +42,7 @@ T* LGE::World::FindObjectOfType() {
         }
         
         // Search children recursively
-        std::function<T*(std::shared_ptr<GameObject>)> search = [](std::shared_ptr<GameObject> obj) -> T* {
+        std::function<T*(std::shared_ptr<GameObject>)> search = [&search](std::shared_ptr<GameObject> obj) -> T* {
             if (!obj || obj->IsDestroyed()) return nullptr;
             
             auto comp = obj->GetComponent<T>();
@@ -0,0 +1,94 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace LGE {
+
+// Pixel rectangle inside an atlas page
+struct AtlasRect {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+};
+
+// Normalized texture coordinates of a packed rect (v grows with y)
+struct AtlasUV {
+    float u0 = 0.0f;
+    float v0 = 0.0f;
+    float u1 = 1.0f;
+    float v1 = 1.0f;
+};
+
+// MaxRects bin packer (best short side fit). Tracks the maximal free
+// rectangles of a fixed-size page, so no GL is involved and the packing can
+// be checked headless. Padding is reserved around every rect so the atlas can
+// extrude edge texels and keep linear filtering from bleeding.
+class AtlasPacker {
+public:
+    AtlasPacker();
+    AtlasPacker(int width, int height, int padding = 0);
+    
+    void Reset(int width, int height, int padding = 0);
+    
+    // Place a single rect; outRect is the usable area without padding
+    bool Insert(int width, int height, AtlasRect& outRect);
+    
+    // Place all sizes, largest first. outRects matches the input order.
+    // Fails without partial results if anything does not fit.
+    bool InsertBatch(const std::vector<AtlasRect>& sizes, std::vector<AtlasRect>& outRects);
+    
+    // Smallest power-of-two page (up to maxSize) that holds every size
+    static bool ChooseSize(const std::vector<AtlasRect>& sizes, int padding, int maxSize,
+                           int& outWidth, int& outHeight);
+    
+    static AtlasUV ToUV(const AtlasRect& rect, int atlasWidth, int atlasHeight);
+    
+    int GetWidth() const { return m_Width; }
+    int GetHeight() const { return m_Height; }
+    int GetPadding() const { return m_Padding; }
+    uint64_t GetUsedArea() const { return m_UsedArea; }
+    float GetOccupancy() const;
+    const std::vector<AtlasRect>& GetFreeRects() const { return m_FreeRects; }
+
+private:
+    bool FindPosition(int width, int height, AtlasRect& outRect) const;
+    void Place(const AtlasRect& rect);
+    bool SplitFreeRect(const AtlasRect& freeRect, const AtlasRect& used);
+    void PruneFreeRects();
+    
+    int m_Width;
+    int m_Height;
+    int m_Padding;
+    uint64_t m_UsedArea;
+    std::vector<AtlasRect> m_FreeRects;
+    std::vector<AtlasRect> m_NewFreeRects;
+};
+
+} // namespace LGE
+
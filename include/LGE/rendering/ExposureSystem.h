@@ -22,10 +22,14 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #pragma once
 
+#include "LGE/rendering/LuminanceHistogram.h"
 #include <cstdint>
+#include <memory>
 
 namespace LGE {
 
+class Shader;
+
 // Exposure mode
 enum class EExposureMode {
     Manual,     // Manual exposure control
@@ -36,7 +40,7 @@ enum class EExposureMode {
 class ExposureSystem {
 public:
     ExposureSystem();
-    ~ExposureSystem() = default;
+    ~ExposureSystem();
 
     // Update exposure (call each frame)
     void Update(float deltaTime, uint32_t hdrTextureID, uint32_t width, uint32_t height);
@@ -63,12 +67,37 @@ public:
     float GetMinExposure() const { return m_MinExposure; }
     float GetMaxExposure() const { return m_MaxExposure; }
 
+    // Histogram range and percentile clamp used for auto exposure
+    void SetHistogramSettings(const LuminanceHistogramSettings& settings) { m_HistogramSettings = settings; }
+    const LuminanceHistogramSettings& GetHistogramSettings() const { return m_HistogramSettings; }
+    
+    // Most recent histogram read back from the GPU (one or two frames old)
+    const LuminanceHistogram::Bins& GetLastHistogram() const { return m_LastHistogram; }
+    float GetAverageLuminance() const { return m_LastLuminance; }
+    uint32_t GetReadbackLatency() const { return m_ReadbackLatency; }
+
     // Calculate exposure from EV100 (Exposure Value)
     static float EV100ToExposure(float ev100);
 
 private:
-    // Calculate average luminance from HDR texture (downsampled)
-    float CalculateAverageLuminance(uint32_t hdrTextureID, uint32_t width, uint32_t height);
+    static constexpr uint32_t HISTOGRAM_READBACK_SLOTS = 3;
+    
+    // One histogram buffer per in-flight frame, persistently mapped for reading
+    struct HistogramSlot {
+        uint32_t buffer = 0;
+        const uint32_t* mapped = nullptr;
+        void* fence = nullptr;  // GLsync, set while the GPU owns the slot
+        uint64_t frame = 0;
+    };
+    
+    bool InitializeHistogram();
+    void ReleaseHistogram();
+    
+    // Queue the histogram compute pass into the next free slot (never waits)
+    void DispatchHistogram(uint32_t hdrTextureID, uint32_t width, uint32_t height);
+    
+    // Consume finished slots in submission order; returns true if any arrived
+    bool ReadBackHistogram();
 
     bool m_AutoExposure;
     float m_CurrentExposure;
@@ -82,6 +111,18 @@ private:
     
     // Internal state
     float m_LastLuminance;
+    
+    // GPU histogram
+    LuminanceHistogramSettings m_HistogramSettings;
+    LuminanceHistogram::Bins m_LastHistogram;
+    std::shared_ptr<Shader> m_HistogramShader;
+    HistogramSlot m_HistogramSlots[HISTOGRAM_READBACK_SLOTS];
+    uint32_t m_WriteSlot;
+    uint32_t m_ReadSlot;
+    uint64_t m_FrameIndex;
+    uint32_t m_ReadbackLatency;
+    bool m_HistogramInitialized;
+    bool m_HistogramFailed;
 };
 
 } // namespace LGE
@@ -0,0 +1,209 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/rendering/RenderTargetAllocator.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace LGE {
+
+// Versioned resource handle: every Write returns a new version
+using FrameGraphHandle = uint32_t;
+
+enum class FrameGraphAccess : uint8_t {
+    RenderTarget = 0,   // color attachment
+    DepthStencil,       // depth attachment
+    Sampled,            // texture fetch
+    Storage             // image load/store
+};
+
+// Barriers the backend must issue before a pass, kept API-neutral so the
+// compiled graph can be inspected without a GL context
+namespace FrameGraphBarrier {
+    enum : uint32_t {
+        None         = 0,
+        TextureFetch = 1 << 0,
+        ImageAccess  = 1 << 1,
+        Framebuffer  = 1 << 2
+    };
+}
+
+class FrameGraph;
+
+// Resolved resources handed to a pass while it executes
+class FrameGraphResources {
+public:
+    FrameGraphResources(const FrameGraph& graph, uint32_t framebuffer)
+        : m_Graph(graph)
+        , m_Framebuffer(framebuffer) {}
+    
+    uint32_t GetTexture(FrameGraphHandle handle) const;
+    const RenderTargetDesc& GetDesc(FrameGraphHandle handle) const;
+    
+    // Framebuffer bound for the pass's attachments (0 when it has none)
+    uint32_t GetFramebuffer() const { return m_Framebuffer; }
+
+private:
+    const FrameGraph& m_Graph;
+    uint32_t m_Framebuffer;
+};
+
+// Declares what a pass reads and writes; returned by FrameGraph::AddPass
+class FrameGraphBuilder {
+public:
+    FrameGraphBuilder(FrameGraph& graph, uint32_t pass)
+        : m_Graph(graph)
+        , m_Pass(pass) {}
+    
+    FrameGraphHandle Read(FrameGraphHandle handle, FrameGraphAccess access = FrameGraphAccess::Sampled);
+    // Writes draw over the previous contents, so they depend on the last writer
+    FrameGraphHandle Write(FrameGraphHandle handle, FrameGraphAccess access = FrameGraphAccess::RenderTarget);
+    
+    // The pass has effects outside the graph and is never culled
+    void SetSideEffect();
+    
+    uint32_t GetPassIndex() const { return m_Pass; }
+
+private:
+    FrameGraph& m_Graph;
+    uint32_t m_Pass;
+};
+
+// Supplies the API objects behind the graph's resources
+class FrameGraphBackend {
+public:
+    virtual ~FrameGraphBackend() = default;
+    
+    virtual uint32_t GetTexture(uint32_t target) = 0;
+    virtual uint32_t GetFramebuffer(uint32_t colorTarget, uint32_t depthTarget) = 0;
+    virtual void BeginPass(uint32_t framebuffer, uint32_t width, uint32_t height) = 0;
+    virtual void Barrier(uint32_t barriers) = 0;
+    virtual void EndPasses() = 0;
+};
+
+// Per-frame render graph. Passes declare the resources they read and write;
+// Compile culls passes that do not contribute to an output, orders the rest,
+// places barriers and gives every transient texture a pass range so the
+// allocator can alias them. Compilation never touches GL.
+//
+// Passes bind at most one color and one depth attachment; the backend binds
+// them and sets the viewport before the pass runs.
+class FrameGraph {
+public:
+    static constexpr FrameGraphHandle InvalidHandle = 0xFFFFFFFFu;
+    static constexpr uint32_t InvalidPass = 0xFFFFFFFFu;
+    
+    using ExecuteFn = std::function<void(const FrameGraphResources&)>;
+    
+    FrameGraph();
+    
+    // Drops all passes and resources; call before building each frame
+    void Reset();
+    
+    // Texture owned by the graph, backed by an aliased pool target
+    FrameGraphHandle CreateTexture(const std::string& name, const RenderTargetDesc& desc);
+    // Texture owned elsewhere; framebuffer is bound when a pass renders into it
+    FrameGraphHandle ImportTexture(const std::string& name, const RenderTargetDesc& desc,
+                                   uint32_t texture, uint32_t framebuffer = 0);
+    
+    FrameGraphBuilder AddPass(const std::string& name, ExecuteFn execute);
+    
+    // Passes producing this version (and everything they depend on) are kept
+    void MarkOutput(FrameGraphHandle handle);
+    
+    // allocator may be null, in which case transients get no targets
+    bool Compile(RenderTargetAllocator* allocator);
+    void Execute(FrameGraphBackend& backend);
+    
+    // Inspection of the compiled graph
+    const std::vector<uint32_t>& GetCompiledPasses() const { return m_Order; }
+    uint32_t GetPassCount() const { return static_cast<uint32_t>(m_Passes.size()); }
+    const std::string& GetPassName(uint32_t pass) const { return m_Passes[pass].name; }
+    bool IsCulled(uint32_t pass) const { return m_Passes[pass].culled; }
+    uint32_t GetPassBarriers(uint32_t pass) const { return m_Passes[pass].barriers; }
+    // Positions in GetCompiledPasses; false if no surviving pass uses it
+    bool GetLifetime(FrameGraphHandle handle, uint32_t& outFirst, uint32_t& outLast) const;
+    uint32_t GetTarget(FrameGraphHandle handle) const;
+    const std::string& GetResourceName(FrameGraphHandle handle) const;
+
+private:
+    friend class FrameGraphBuilder;
+    friend class FrameGraphResources;
+    
+    struct Resource {
+        std::string name;
+        RenderTargetDesc desc;
+        bool imported = false;
+        uint32_t texture = 0;       // imported, or resolved at execution
+        uint32_t framebuffer = 0;   // imported only
+        uint32_t firstPass = InvalidPass;
+        uint32_t lastPass = InvalidPass;
+        uint32_t target = RenderTargetAllocator::InvalidHandle;
+        FrameGraphHandle latest = InvalidHandle;
+    };
+    
+    // One version of a resource
+    struct Node {
+        uint32_t resource = 0;
+        FrameGraphHandle previous = InvalidHandle;
+        uint32_t producer = InvalidPass;
+        FrameGraphAccess producerAccess = FrameGraphAccess::RenderTarget;
+        std::vector<uint32_t> readers;
+        bool output = false;
+    };
+    
+    struct Access {
+        FrameGraphHandle node;
+        FrameGraphAccess access;
+    };
+    
+    struct Pass {
+        std::string name;
+        const char* profileName = nullptr;   // Interned once, for the per-frame profiling zone
+        ExecuteFn execute;
+        std::vector<Access> reads;
+        std::vector<Access> writes;
+        bool sideEffect = false;
+        bool culled = true;
+        uint32_t barriers = FrameGraphBarrier::None;
+    };
+    
+    FrameGraphHandle AddNode(uint32_t resource, FrameGraphHandle previous);
+    bool IsValidHandle(FrameGraphHandle handle) const { return handle < m_Nodes.size(); }
+    void CullPasses();
+    bool SortPasses();
+    void ComputeLifetimes();
+    void PlaceBarriers();
+    
+    std::vector<Resource> m_Resources;
+    std::vector<Node> m_Nodes;
+    std::vector<Pass> m_Passes;
+    std::vector<uint32_t> m_Order;
+    bool m_Compiled;
+};
+
+} // namespace LGE
@@ -0,0 +1,52 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/rendering/FrameGraph.h"
+
+namespace LGE {
+
+class RenderTargetPool;
+
+// Runs a compiled frame graph on GL. Transient targets come from the pool;
+// the caller's framebuffer and viewport are captured once and restored after
+// the last pass, so individual passes do not have to save GL state.
+class FrameGraphGLBackend : public FrameGraphBackend {
+public:
+    explicit FrameGraphGLBackend(RenderTargetPool& pool);
+    
+    uint32_t GetTexture(uint32_t target) override;
+    uint32_t GetFramebuffer(uint32_t colorTarget, uint32_t depthTarget) override;
+    void BeginPass(uint32_t framebuffer, uint32_t width, uint32_t height) override;
+    void Barrier(uint32_t barriers) override;
+    void EndPasses() override;
+
+private:
+    RenderTargetPool& m_Pool;
+    bool m_StateSaved;
+    int m_SavedFramebuffer;
+    int m_SavedViewport[4];
+};
+
+} // namespace LGE
@@ -34,6 +34,8 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 namespace LGE {
 
+class RenderTargetPool;
+
 // Framebuffer format options
 enum class EFramebufferFormat {
     LDR,    // RGBA8 - Low Dynamic Range (legacy)
@@ -42,7 +44,10 @@ enum class EFramebufferFormat {
 
 class Framebuffer {
 public:
-    Framebuffer(uint32_t width, uint32_t height, EFramebufferFormat format = EFramebufferFormat::LDR);
+    // With a pool, attachments are borrowed from it and returned on resize or
+    // destruction instead of being deleted; the pool must outlive this object
+    Framebuffer(uint32_t width, uint32_t height, EFramebufferFormat format = EFramebufferFormat::LDR,
+                RenderTargetPool* pool = nullptr);
     ~Framebuffer();
 
     void Bind() const;
@@ -62,8 +67,12 @@ private:
     uint32_t m_Width;
     uint32_t m_Height;
     EFramebufferFormat m_Format;
+    RenderTargetPool* m_Pool;
+    uint32_t m_ColorTarget;
+    uint32_t m_DepthTarget;
 
     void Invalidate();
+    void InvalidateFromPool();
     void Release();
 };
 
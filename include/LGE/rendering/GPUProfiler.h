@@ -0,0 +1,162 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/core/Profiling.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace LGE {
+
+// Graphics API side of the GPU profiler: timestamp queries and the GPU clock.
+// All times are in nanoseconds on the GPU's timeline.
+class GPUTimerBackend {
+public:
+    virtual ~GPUTimerBackend() = default;
+    
+    virtual bool IsSupported() const = 0;
+    virtual void CreateQueries(uint32_t count, uint32_t* outQueries) = 0;
+    virtual void DestroyQueries(uint32_t count, const uint32_t* queries) = 0;
+    
+    // Record the GPU time once all previously submitted commands have completed
+    virtual void WriteTimestamp(uint32_t query) = 0;
+    
+    // Never blocks; GetResult is only called once this returned true
+    virtual bool IsResultAvailable(uint32_t query) = 0;
+    virtual uint64_t GetResult(uint32_t query) = 0;
+    
+    // Current GPU time as seen by the driver, used to line GPU zones up with CPU ticks
+    virtual uint64_t GetGPUTime() = 0;
+};
+
+struct GPUProfilerStats {
+    float frameMs = 0.0f;          // Sum of top-level zones of the last resolved frame
+    uint32_t latencyFrames = 0;    // Frames between submission and readback of that frame
+    uint32_t resolvedFrames = 0;
+    uint32_t droppedFrames = 0;    // Reused before the GPU finished them (never waited on)
+    uint32_t overflowZones = 0;    // Zones beyond kMaxZonesPerFrame
+    uint32_t framesInFlight = 0;   // Query pools in the ring
+    uint32_t framesSinceResolve = 0; // Submitted since the last readback; past framesInFlight, frameMs is stale
+};
+
+// Ring of timestamp query pools, three to start with. Each frame writes a begin/end
+// timestamp per zone into its own pool; pools are read back a few frames later, once
+// the GPU is done, and the zones land on a "GPU" lane of the CPU timeline (Profiler
+// window, trace export). When the GPU is further behind than the ring, a pool is added
+// instead of dropping a frame, up to kMaxFramesInFlight.
+class GPUProfiler {
+public:
+    static constexpr uint32_t kFramesInFlight = 3;
+    static constexpr uint32_t kMaxFramesInFlight = 8;
+    static constexpr uint32_t kMaxZonesPerFrame = 64;
+    static constexpr uint32_t InvalidZone = UINT32_MAX;
+    
+    explicit GPUProfiler(std::unique_ptr<GPUTimerBackend> backend);
+    ~GPUProfiler();
+    
+    GPUProfiler(const GPUProfiler&) = delete;
+    GPUProfiler& operator=(const GPUProfiler&) = delete;
+    
+    // Reads back every finished frame, then starts recording into the next pool
+    void BeginFrame();
+    void EndFrame();
+    
+    // Zones nest; names must outlive the readback (string literals or interned)
+    uint32_t BeginZone(const char* name);
+    void EndZone(uint32_t zone);
+    
+    bool IsSupported() const { return m_Supported; }
+    const GPUProfilerStats& GetStats() const { return m_Stats; }
+    uint32_t GetTrack() const { return m_Track; }
+    
+    // Profiler used by LGE_GPU_SCOPE (null = GPU scopes do nothing)
+    static void SetActive(GPUProfiler* profiler) { s_Active = profiler; }
+    static GPUProfiler* GetActive() { return s_Active; }
+
+private:
+    struct Zone {
+        const char* name = nullptr;
+        uint32_t depth = 0;
+        bool closed = false;
+    };
+    
+    struct FramePool {
+        std::vector<uint32_t> queries;      // Begin/end pair per zone
+        std::vector<Zone> zones;
+        uint64_t frameNumber = 0;
+        uint64_t cpuReference = 0;          // Profiling::Now() and GPU time sampled together
+        uint64_t gpuReference = 0;
+        uint32_t lastQuery = 0;             // Most recently written timestamp
+        bool pending = false;
+    };
+    
+    void CreatePool(FramePool& pool);
+    bool TryResolve(FramePool& pool);
+    
+    std::unique_ptr<GPUTimerBackend> m_Backend;
+    std::vector<FramePool> m_Pools;
+    std::vector<ProfileZone> m_Resolved;
+    GPUProfilerStats m_Stats;
+    uint64_t m_FrameNumber;
+    uint32_t m_Current;
+    uint32_t m_Depth;
+    uint32_t m_Track;
+    bool m_Supported;
+    bool m_InFrame;
+    
+    static GPUProfiler* s_Active;
+};
+
+// RAII GPU zone, normally created through LGE_GPU_SCOPE
+class GPUScope {
+public:
+    explicit GPUScope(const char* name)
+        : m_Profiler(GPUProfiler::GetActive())
+        , m_Zone(m_Profiler ? m_Profiler->BeginZone(name) : GPUProfiler::InvalidZone)
+    {
+    }
+    
+    ~GPUScope() {
+        if (m_Profiler) {
+            m_Profiler->EndZone(m_Zone);
+        }
+    }
+    
+    GPUScope(const GPUScope&) = delete;
+    GPUScope& operator=(const GPUScope&) = delete;
+
+private:
+    GPUProfiler* m_Profiler;
+    uint32_t m_Zone;
+};
+
+} // namespace LGE
+
+#if LGE_ENABLE_PROFILING
+#define LGE_GPU_SCOPE(name) ::LGE::GPUScope LGE_PROFILE_CONCAT(lgeGpuScope, __LINE__)(name)
+#else
+#define LGE_GPU_SCOPE(name) ((void)0)
+#endif
@@ -0,0 +1,43 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/rendering/GPUProfiler.h"
+
+namespace LGE {
+
+// GL_TIMESTAMP queries (GL 3.3 / ARB_timer_query). Availability is polled with
+// GL_QUERY_RESULT_AVAILABLE so readback never stalls the pipeline.
+class GPUTimerGLBackend : public GPUTimerBackend {
+public:
+    bool IsSupported() const override;
+    void CreateQueries(uint32_t count, uint32_t* outQueries) override;
+    void DestroyQueries(uint32_t count, const uint32_t* queries) override;
+    void WriteTimestamp(uint32_t query) override;
+    bool IsResultAvailable(uint32_t query) override;
+    uint64_t GetResult(uint32_t query) override;
+    uint64_t GetGPUTime() override;
+};
+
+} // namespace LGE
@@ -0,0 +1,64 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace LGE {
+
+// Decoded floating point image (tightly packed RGB, row-major, top row first)
+struct HDRImage {
+    int width = 0;
+    int height = 0;
+    std::vector<float> pixels;
+    
+    bool IsValid() const { return width > 0 && height > 0 && pixels.size() == static_cast<size_t>(width) * height * 3; }
+    size_t GetPixelCount() const { return static_cast<size_t>(width) * height; }
+};
+
+// CPU decoders for Radiance (.hdr) and OpenEXR (.exr) images.
+// Decoding is GL-free so it can run on loader threads and in headless tools.
+class HDRDecoder {
+public:
+    // Auto-detect format from extension
+    static bool Load(const std::string& filepath, HDRImage& outImage);
+    
+    // Radiance RGBE. Scanlines are located sequentially, then RLE-decoded and
+    // converted to float in parallel on the JobSystem.
+    static bool LoadRadiance(const std::string& filepath, HDRImage& outImage);
+    static bool DecodeRadiance(const uint8_t* data, size_t size, HDRImage& outImage, std::string* error = nullptr);
+    
+    // OpenEXR via tinyexr (ZIP/ZIPS/PIZ/RLE supported, blocks decompressed in parallel)
+    static bool LoadEXR(const std::string& filepath, HDRImage& outImage);
+    static bool DecodeEXR(const uint8_t* data, size_t size, HDRImage& outImage, std::string* error = nullptr);
+    
+    // SIMD conversion kernels (SSE2 when available, scalar otherwise)
+    static void RGBEToFloat(const uint8_t* rgbe, float* rgb, size_t pixelCount);
+    static void FloatToHalf(const float* src, uint16_t* dst, size_t count);
+};
+
+} // namespace LGE
@@ -0,0 +1,88 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/math/Vector.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace LGE {
+
+struct HDRImage;
+
+// Parameters that affect baked output (part of the cache key)
+struct IBLBakeSettings {
+    uint32_t specularResolution = 128;  // Face size of prefiltered mip 0
+    uint32_t specularMipCount = 6;      // Roughness 0..1 spread across the mips
+    uint32_t sampleCount = 128;         // GGX importance samples per texel (mips > 0)
+};
+
+// CPU-side image based lighting data for one HDRI
+struct IBLBakeResult {
+    uint64_t sourceHash = 0;
+    IBLBakeSettings settings;
+    
+    // L2 spherical harmonics of diffuse irradiance (already convolved with the
+    // clamped cosine lobe). Diffuse radiance = albedo / PI * EvaluateIrradianceSH(n).
+    std::array<Math::Vector3, 9> irradianceSH;
+    
+    // GGX-prefiltered specular cubemap. One entry per mip; each holds the six
+    // faces (+X, -X, +Y, -Y, +Z, -Z) of size*size tightly packed RGB floats.
+    std::vector<std::vector<float>> specularMips;
+    
+    bool IsValid() const { return !specularMips.empty(); }
+    uint32_t GetMipResolution(uint32_t mip) const;
+};
+
+// Offline/background IBL baker working from equirectangular HDR images.
+// Everything here is GL-free and safe to run on JobSystem workers.
+class IBLBaker {
+public:
+    // Project radiance onto L2 SH and convolve with the cosine lobe.
+    // Rows are reduced in parallel; each pixel is accumulated with SIMD over RGB.
+    static void ProjectIrradianceSH(const HDRImage& equirect, std::array<Math::Vector3, 9>& outSH);
+    
+    // Irradiance arriving at a surface with the given (normalized) normal
+    static Math::Vector3 EvaluateIrradianceSH(const std::array<Math::Vector3, 9>& sh, const Math::Vector3& normal);
+    
+    // GGX-prefiltered specular cube mip chain using importance sampling with
+    // PDF-based source mip selection (filtered importance sampling)
+    static void PrefilterSpecular(const HDRImage& equirect, const IBLBakeSettings& settings, std::vector<std::vector<float>>& outMips);
+    
+    // Full bake (SH + specular chain)
+    static bool Bake(const HDRImage& equirect, const IBLBakeSettings& settings, IBLBakeResult& outResult);
+    
+    // Disk cache keyed by the HDRI content hash and the bake settings
+    static std::string GetCacheFilePath(const std::string& cacheDirectory, uint64_t sourceHash, const IBLBakeSettings& settings);
+    static bool SaveToCache(const std::string& cacheFile, const IBLBakeResult& result);
+    static bool LoadFromCache(const std::string& cacheFile, IBLBakeResult& outResult);
+    
+    // Hash the HDRI and return the cached bake, or decode, bake and store it
+    static bool LoadOrBake(const std::string& hdriPath, const std::string& cacheDirectory,
+                           const IBLBakeSettings& settings, IBLBakeResult& outResult);
+};
+
+} // namespace LGE
@@ -60,6 +60,11 @@ public:
     
     // Shadow mapping
     void RenderShadowMaps(World& world, Camera* camera);
+    // Split form for the frame graph: Prepare picks the caster and its matrix
+    // (false when nothing casts), Render draws the casters into the map
+    bool PrepareDirectionalShadow(Camera* camera);
+    void RenderDirectionalShadow(World& world);
+    static constexpr uint32_t GetShadowMapSize() { return SHADOW_MAP_SIZE; }
     const DirectionalLightShadow* GetDirectionalShadow() const { return m_DirectionalShadow.IsValid ? &m_DirectionalShadow : nullptr; }
     
     // Cascaded Shadow Maps (CSM) - future
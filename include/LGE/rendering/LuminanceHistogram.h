@@ -0,0 +1,67 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace LGE {
+
+// Log2 luminance range covered by the histogram
+struct LuminanceHistogramSettings {
+    float minLog2Luminance = -10.0f;
+    float maxLog2Luminance = 10.0f;
+    float lowPercentile = 0.10f;    // Darkest fraction of pixels ignored
+    float highPercentile = 0.90f;   // Brightest fraction above this ignored
+};
+
+// CPU reference for the auto-exposure histogram. Binning matches
+// assets/shaders/PostProcess/LuminanceHistogram.comp exactly: bin 0 holds
+// pixels darker than the range (and NaNs), bins 1..255 split the log2 range.
+class LuminanceHistogram {
+public:
+    static constexpr uint32_t BinCount = 256;
+    using Bins = std::array<uint32_t, BinCount>;
+    
+    static float Luminance(float r, float g, float b) { return 0.2126f * r + 0.7152f * g + 0.0722f * b; }
+    static uint32_t BinForLuminance(float luminance, const LuminanceHistogramSettings& settings);
+    
+    // Log2 luminance at the center of a bin (bins >= 1)
+    static float BinCenterLog2(uint32_t bin, const LuminanceHistogramSettings& settings);
+    
+    // Accumulate an image of 'channels' floats per pixel (RGB first) into bins
+    static void Accumulate(const float* pixels, size_t pixelCount, uint32_t channels,
+                           const LuminanceHistogramSettings& settings, Bins& bins);
+    
+    // Geometric mean of the pixels between the low and high percentiles.
+    // Returns 2^minLog2Luminance when no pixel falls inside the range.
+    static float ComputeAverageLuminance(const Bins& bins, const LuminanceHistogramSettings& settings);
+    
+    // Exposure that brings the average luminance to the target, clamped to
+    // [minExposure, maxExposure]; the average is held to [0.01, 10] first
+    static float ComputeTargetExposure(float averageLuminance, float targetLuminance, float minExposure, float maxExposure);
+};
+
+} // namespace LGE
@@ -60,6 +60,7 @@ public:
     Math::Vector3 GetVector3(const std::string& name) const;
     Math::Vector4 GetVector4(const std::string& name) const;
     std::shared_ptr<Texture> GetTexture(const std::string& name) const;
+    const std::unordered_map<std::string, std::shared_ptr<Texture>>& GetTextures() const { return m_TextureProperties; }
 
     // Remove parameter
     void RemoveFloat(const std::string& name);
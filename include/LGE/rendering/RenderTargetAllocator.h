@@ -0,0 +1,163 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/core/Hash.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace LGE {
+
+enum class RenderTargetFormat : uint8_t {
+    RGBA8 = 0,
+    RGBA16F,
+    RGBA32F,
+    RG16F,
+    R32F,
+    Depth24Stencil8,
+    Depth32F
+};
+
+// Pool key: targets are only ever shared between identical descriptions
+struct RenderTargetDesc {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    RenderTargetFormat format = RenderTargetFormat::RGBA8;
+    uint32_t samples = 1;
+    
+    bool operator==(const RenderTargetDesc& other) const {
+        return width == other.width && height == other.height &&
+               format == other.format && samples == other.samples;
+    }
+    bool operator!=(const RenderTargetDesc& other) const { return !(*this == other); }
+};
+
+struct RenderTargetDescHash {
+    size_t operator()(const RenderTargetDesc& desc) const {
+        uint64_t packed = (static_cast<uint64_t>(desc.width) << 32) | desc.height;
+        uint64_t extra = (static_cast<uint64_t>(desc.format) << 32) | desc.samples;
+        return static_cast<size_t>(Hash::Combine(Hash::Mix64(packed), extra));
+    }
+};
+
+// Memory report for the pool
+struct RenderTargetStats {
+    uint32_t targetCount = 0;
+    uint32_t inUseCount = 0;
+    uint64_t totalBytes = 0;
+    uint64_t inUseBytes = 0;
+    uint64_t peakBytes = 0;
+    
+    // Last compiled frame
+    uint32_t transientRequests = 0;
+    uint32_t aliasedRequests = 0;      // served by a target another transient already used
+    uint64_t transientBytesRequested = 0;
+    uint64_t transientBytesAllocated = 0;
+    
+    uint32_t createdThisFrame = 0;
+    uint32_t destroyedThisFrame = 0;
+};
+
+// CPU-side bookkeeping for pooled render targets. Decides which physical
+// target each request maps to and when idle targets are destroyed, without
+// touching GL, so reuse and aliasing can be checked headless.
+//
+// Persistent targets are held from Acquire until Release. Transient targets
+// live for a range of pass indices within one frame; requests whose ranges do
+// not overlap share a target. Handles stay valid until reported destroyed.
+class RenderTargetAllocator {
+public:
+    static constexpr uint32_t InvalidHandle = 0xFFFFFFFFu;
+    
+    RenderTargetAllocator();
+    
+    static uint32_t GetBytesPerPixel(RenderTargetFormat format);
+    static uint64_t GetBytes(const RenderTargetDesc& desc);
+    static bool IsDepthFormat(RenderTargetFormat format);
+    
+    // Free targets unused for this many frames are destroyed
+    void SetMaxIdleFrames(uint32_t frames) { m_MaxIdleFrames = frames; }
+    // Free targets beyond this many bytes are destroyed oldest first
+    void SetFreeBudget(uint64_t bytes) { m_FreeBudget = bytes; }
+    
+    uint32_t Acquire(const RenderTargetDesc& desc);
+    void Release(uint32_t handle);
+    
+    // Declare all transients for the frame, then compile once before use
+    uint32_t DeclareTransient(const RenderTargetDesc& desc, uint32_t firstPass, uint32_t lastPass);
+    void CompileTransients();
+    uint32_t GetTransientTarget(uint32_t transient) const;
+    
+    // Ends the frame: transients are returned and idle targets trimmed.
+    // outDestroyed receives handles whose GL objects must be deleted.
+    void EndFrame(std::vector<uint32_t>& outDestroyed);
+    
+    // Destroys every target that is not in use
+    void Trim(std::vector<uint32_t>& outDestroyed);
+    
+    bool IsValid(uint32_t handle) const;
+    const RenderTargetDesc& GetDesc(uint32_t handle) const { return m_Targets[handle].desc; }
+    uint64_t GetFrameIndex() const { return m_FrameIndex; }
+    const RenderTargetStats& GetStats() const { return m_Stats; }
+
+private:
+    struct Target {
+        RenderTargetDesc desc;
+        uint64_t bytes = 0;
+        uint64_t lastUsedFrame = 0;
+        bool alive = false;
+        bool persistent = false;    // held by Acquire
+        bool transient = false;     // serving transients this frame
+        uint32_t busyUntilPass = 0; // last pass of the current transient owner
+    };
+    
+    struct TransientRequest {
+        RenderTargetDesc desc;
+        uint32_t firstPass = 0;
+        uint32_t lastPass = 0;
+        uint32_t target = InvalidHandle;
+    };
+    
+    uint32_t FindFree(const RenderTargetDesc& desc) const;
+    uint32_t Create(const RenderTargetDesc& desc);
+    void Destroy(uint32_t handle, std::vector<uint32_t>& outDestroyed);
+    void UpdateTotals();
+    
+    std::vector<Target> m_Targets;
+    std::vector<uint32_t> m_FreeSlots;
+    std::unordered_map<RenderTargetDesc, std::vector<uint32_t>, RenderTargetDescHash> m_ByDesc;
+    std::vector<TransientRequest> m_Transients;
+    
+    uint64_t m_FrameIndex;
+    uint32_t m_MaxIdleFrames;
+    uint64_t m_FreeBudget;
+    uint32_t m_CreatedThisFrame;
+    uint64_t m_CompiledFrame;
+    RenderTargetStats m_Stats;
+};
+
+} // namespace LGE
+
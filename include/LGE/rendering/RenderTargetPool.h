@@ -0,0 +1,82 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/rendering/RenderTargetAllocator.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace LGE {
+
+// GL side of the render target pool. Textures are created the first time a
+// handle is used and deleted when the allocator retires it; framebuffers are
+// cached per attachment pair so rebinding a pooled target costs no GL calls.
+class RenderTargetPool {
+public:
+    static constexpr uint32_t InvalidHandle = RenderTargetAllocator::InvalidHandle;
+    
+    RenderTargetPool();
+    ~RenderTargetPool();
+    
+    RenderTargetPool(const RenderTargetPool&) = delete;
+    RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+    
+    void Shutdown();
+    
+    uint32_t Acquire(const RenderTargetDesc& desc) { return m_Allocator.Acquire(desc); }
+    void Release(uint32_t handle) { m_Allocator.Release(handle); }
+    
+    uint32_t DeclareTransient(const RenderTargetDesc& desc, uint32_t firstPass, uint32_t lastPass) {
+        return m_Allocator.DeclareTransient(desc, firstPass, lastPass);
+    }
+    void CompileTransients() { m_Allocator.CompileTransients(); }
+    uint32_t GetTransientTarget(uint32_t transient) const { return m_Allocator.GetTransientTarget(transient); }
+    
+    // GL texture behind a handle (0 for invalid handles)
+    uint32_t GetTexture(uint32_t handle);
+    
+    // Framebuffer with the given color and/or depth target attached
+    uint32_t GetFramebuffer(uint32_t colorHandle, uint32_t depthHandle = InvalidHandle);
+    
+    // Once per frame, after the last pass that uses transient targets
+    void EndFrame();
+    
+    // Free every pooled target that is not in use right now
+    void Trim();
+    
+    RenderTargetAllocator& GetAllocator() { return m_Allocator; }
+    const RenderTargetStats& GetStats() const { return m_Allocator.GetStats(); }
+
+private:
+    void DestroyResources(const std::vector<uint32_t>& handles);
+    
+    RenderTargetAllocator m_Allocator;
+    std::vector<uint32_t> m_Textures;                   // indexed by handle
+    std::unordered_map<uint64_t, uint32_t> m_Framebuffers; // (color << 32 | depth) -> FBO
+    std::vector<uint32_t> m_Destroyed;
+};
+
+} // namespace LGE
+
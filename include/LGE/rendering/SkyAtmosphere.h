@@ -0,0 +1,131 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/rendering/HDRDecoder.h"
+#include "LGE/math/Vector.h"
+#include <cstdint>
+
+namespace LGE {
+
+// Earth-like atmosphere. Distances in km, coefficients per km.
+struct AtmosphereParameters {
+    float groundRadius = 6360.0f;
+    float topRadius = 6460.0f;
+    
+    Math::Vector3 rayleighScattering = Math::Vector3(5.802e-3f, 13.558e-3f, 33.1e-3f);
+    float rayleighScaleHeight = 8.0f;
+    
+    float mieScattering = 3.996e-3f;
+    float mieExtinction = 4.440e-3f;
+    float mieScaleHeight = 1.2f;
+    float mieAnisotropy = 0.8f;
+    
+    // Tent profile centered at ozoneCenter, zero beyond +-ozoneHalfWidth
+    Math::Vector3 ozoneAbsorption = Math::Vector3(0.650e-3f, 1.881e-3f, 0.085e-3f);
+    float ozoneCenter = 25.0f;
+    float ozoneHalfWidth = 15.0f;
+    
+    Math::Vector3 groundAlbedo = Math::Vector3(0.3f);
+    
+    // Points toward the sun
+    Math::Vector3 sunDirection = Math::Vector3(0.0f, 1.0f, 0.0f);
+    Math::Vector3 sunIlluminance = Math::Vector3(10.0f);
+    
+    // Viewer altitude the sky-view LUT is baked for
+    float viewHeight = 0.2f;
+};
+
+// LUT resolutions and integration steps (part of the bake key)
+struct SkyAtmosphereSettings {
+    uint32_t transmittanceWidth = 256;
+    uint32_t transmittanceHeight = 64;
+    uint32_t multiScatteringSize = 32;
+    uint32_t skyViewWidth = 96;     // half a turn of azimuth
+    uint32_t skyViewHeight = 108;
+    
+    uint32_t transmittanceSteps = 40;
+    uint32_t multiScatteringSteps = 20;
+    uint32_t multiScatteringDirections = 64;
+    uint32_t skyViewSteps = 32;
+};
+
+// Baked lookup tables, stored as RGB float images
+struct SkyAtmosphereLUTs {
+    AtmosphereParameters parameters;
+    SkyAtmosphereSettings settings;
+    uint64_t hash = 0;
+    uint64_t mediumHash = 0;     // transmittance + multiple scattering inputs only
+    
+    HDRImage transmittance;      // (view zenith, height) -> transmittance to the top of the atmosphere
+    HDRImage multiScattering;    // (sun zenith, height) -> isotropic multiple scattering per unit illuminance
+    HDRImage skyView;            // (azimuth from sun, latitude) -> radiance seen from viewHeight
+    
+    bool IsValid() const { return transmittance.IsValid() && multiScattering.IsValid() && skyView.IsValid(); }
+};
+
+// Precomputed sky model after Hillaire, "A Scalable and Production Ready Sky
+// and Atmosphere Rendering Technique" (2020). Transmittance and multiple
+// scattering LUTs are integrated once per parameter change; the sky-view LUT
+// turns per-pixel sky shading into one texture fetch. GL-free, rows are baked
+// on the JobSystem.
+//
+// Sky-view mapping (shared with Skybox.frag): u = azimuth relative to the sun
+// / PI (the sky is symmetric about the sun's vertical plane), v = 0.5 - 0.5 *
+// sign(lat) * sqrt(|lat| / (PI/2)) so the horizon gets most rows.
+class SkyAtmosphere {
+public:
+    // Changes whenever anything affecting the baked LUTs changes
+    static uint64_t ComputeHash(const AtmosphereParameters& parameters, const SkyAtmosphereSettings& settings);
+    // Ignores the sun and viewer, which only the sky-view LUT depends on
+    static uint64_t ComputeMediumHash(const AtmosphereParameters& parameters, const SkyAtmosphereSettings& settings);
+    
+    static void BakeTransmittance(const AtmosphereParameters& parameters, const SkyAtmosphereSettings& settings,
+                                  HDRImage& outLUT);
+    static void BakeMultiScattering(const AtmosphereParameters& parameters, const SkyAtmosphereSettings& settings,
+                                    const HDRImage& transmittance, HDRImage& outLUT);
+    static void BakeSkyView(const AtmosphereParameters& parameters, const SkyAtmosphereSettings& settings,
+                            const HDRImage& transmittance, const HDRImage& multiScattering, HDRImage& outLUT);
+    
+    // All three LUTs. Transmittance and multiple scattering already in outLUTs
+    // are kept when only the sun or viewer changed.
+    static bool Bake(const AtmosphereParameters& parameters, const SkyAtmosphereSettings& settings,
+                     SkyAtmosphereLUTs& outLUTs);
+    
+    // Bilinear LUT lookups. height is above ground in km.
+    static Math::Vector3 SampleTransmittance(const SkyAtmosphereLUTs& luts, float height, float cosZenith);
+    static Math::Vector3 SampleMultiScattering(const SkyAtmosphereLUTs& luts, float height, float cosSunZenith);
+    static Math::Vector3 SampleSkyView(const SkyAtmosphereLUTs& luts, const Math::Vector3& direction);
+    
+    // Brute-force reference for validation: ray marches the view ray and every
+    // sun ray numerically instead of using the transmittance LUT. Multiple
+    // scattering still comes from the LUT.
+    static Math::Vector3 ComputeRadianceReference(const SkyAtmosphereLUTs& luts, const Math::Vector3& direction,
+                                                  uint32_t viewSteps = 256, uint32_t sunSteps = 128);
+    
+    // Resample the sky-view LUT into an equirectangular image (IBL baking input)
+    static void BuildEquirect(const SkyAtmosphereLUTs& luts, int width, int height, HDRImage& outImage);
+};
+
+} // namespace LGE
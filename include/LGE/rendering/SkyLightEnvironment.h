@@ -0,0 +1,105 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/rendering/IBLBaker.h"
+#include "LGE/rendering/SkyAtmosphere.h"
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace LGE {
+
+class World;
+class Shader;
+class Texture;
+
+// Owns the GPU side of the scene's SkyLightComponent: bakes (or loads cached)
+// IBL data on a JobSystem worker and uploads it on the main thread.
+class SkyLightEnvironment {
+public:
+    SkyLightEnvironment();
+    ~SkyLightEnvironment();
+    
+    // Where baked IBL data is cached (e.g. Packages/Intermediate/IBLCache)
+    void SetCacheDirectory(const std::string& directory) { m_CacheDirectory = directory; }
+    const std::string& GetCacheDirectory() const { return m_CacheDirectory; }
+    
+    // Base directory for relative EnvironmentMapPath values
+    void SetAssetRoot(const std::string& directory) { m_AssetRoot = directory; }
+    
+    void SetBakeSettings(const IBLBakeSettings& settings);
+    const IBLBakeSettings& GetBakeSettings() const { return m_Settings; }
+    
+    // Procedural sky used by sky lights without an EnvironmentMapPath (null disables)
+    void SetProceduralSky(std::shared_ptr<const SkyAtmosphereLUTs> luts) { m_ProceduralSky = std::move(luts); }
+    
+    // Pick up sky light changes and finished bakes. Call once per frame (main thread).
+    void Update(World& world);
+    
+    // Bind IBL textures/uniforms for a lit shader
+    void Apply(Shader& shader, uint32_t textureSlot = 5) const;
+    
+    bool IsReady() const { return m_Ready; }
+    bool IsBaking() const { return m_BakePending; }
+    
+private:
+    // Shared with the bake job so it can outlive this object
+    struct BakeState {
+        std::mutex mutex;
+        uint64_t requestId = 0;
+        bool completed = false;
+        bool succeeded = false;
+        IBLBakeResult result;
+    };
+    
+    void RequestBake(const std::string& hdriPath);
+    void RequestProceduralBake(std::shared_ptr<const SkyAtmosphereLUTs> luts);
+    void UploadFinishedBake();
+    void UploadResult(const IBLBakeResult& result);
+    std::string ResolvePath(const std::string& path) const;
+    
+    std::shared_ptr<BakeState> m_BakeState;
+    std::shared_ptr<const SkyAtmosphereLUTs> m_ProceduralSky;
+    std::unique_ptr<Texture> m_PrefilteredEnv;
+    
+    std::string m_CacheDirectory;
+    std::string m_AssetRoot;
+    IBLBakeSettings m_Settings;
+    
+    // Current sky light parameters (source is the HDRI path or the atmosphere hash)
+    std::string m_SourcePath;
+    bool m_HasSkyLight;
+    float m_Intensity;
+    bool m_UseDiffuse;
+    bool m_UseSpecular;
+    
+    std::array<Math::Vector3, 9> m_IrradianceSH;
+    uint32_t m_MipCount;
+    bool m_Ready;
+    bool m_BakePending;
+    bool m_SettingsDirty;
+};
+
+} // namespace LGE
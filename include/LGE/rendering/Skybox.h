@@ -31,17 +31,22 @@ For more information, visit: https://nexelgames.com/luma-engine
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "LGE/rendering/Shader.h"
 #include "LGE/rendering/VertexBuffer.h"
 #include "LGE/rendering/VertexArray.h"
 #include "LGE/rendering/Texture.h"
+#include "LGE/rendering/SkyAtmosphere.h"
 #include "LGE/math/Vector.h"
 #include "LGE/math/Matrix.h"
 
 namespace LGE {
 
+// Without an HDRI the sky comes from SkyAtmosphere LUTs, re-baked on a
+// JobSystem worker only when the sun or atmosphere parameters change. The
+// gradient is shown until the first bake is uploaded.
 class Skybox {
 public:
     Skybox();
@@ -52,18 +57,48 @@ public:
     void Render(const class Camera& camera, float cloudOffset = 0.0f);
     void SetTopColor(const Math::Vector3& color) { m_TopColor = color; }
     void SetBottomColor(const Math::Vector3& color) { m_BottomColor = color; }
+    
+    // Procedural sky
+    void SetAtmosphere(const AtmosphereParameters& parameters) { m_Atmosphere = parameters; }
+    const AtmosphereParameters& GetAtmosphere() const { return m_Atmosphere; }
+    void SetSunDirection(const Math::Vector3& direction) { m_Atmosphere.sunDirection = direction; }
+    
+    // Start a bake if parameters changed and upload finished ones. Call once per frame (main thread).
+    void Update();
+    
+    bool UsesAtmosphere() const { return !m_HasTexture; }
+    // Last uploaded LUTs (null until the first bake finishes)
+    std::shared_ptr<const SkyAtmosphereLUTs> GetAtmosphereLUTs() const { return m_AtmosphereLUTs; }
 
 private:
+    // Shared with the bake job so it can outlive this object
+    struct AtmosphereBakeState {
+        std::mutex mutex;
+        uint64_t requestId = 0;
+        bool completed = false;
+        std::shared_ptr<const SkyAtmosphereLUTs> result;
+    };
+    
+    void RequestAtmosphereBake();
+    
     std::unique_ptr<Shader> m_Shader;
     std::unique_ptr<VertexBuffer> m_VertexBuffer;
     std::unique_ptr<VertexArray> m_VertexArray;
     std::unique_ptr<Texture> m_Texture;
+    std::unique_ptr<Texture> m_SkyViewLUT;
     
     Math::Vector3 m_TopColor;
     Math::Vector3 m_BottomColor;
     bool m_Initialized;
     bool m_HasTexture;
     float m_Scale;
+    
+    AtmosphereParameters m_Atmosphere;
+    SkyAtmosphereSettings m_AtmosphereSettings;
+    std::shared_ptr<AtmosphereBakeState> m_AtmosphereState;
+    std::shared_ptr<const SkyAtmosphereLUTs> m_AtmosphereLUTs;
+    uint64_t m_RequestedHash;
+    bool m_AtmosphereBakePending;
 };
 
 } // namespace LGE
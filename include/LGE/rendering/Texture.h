@@ -32,9 +32,12 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace LGE {
 
+struct HDRImage;
+
 // Texture filtering modes
 enum class TextureFilter {
     Nearest = 0,
@@ -87,6 +90,13 @@ public:
     void CreateCubemap(uint32_t resolution, bool isHDR = true);
     void CreateCubemapFromData(uint32_t resolution, const float* data, bool isHDR = true);
     
+    // HDR cubemap with an explicit mip chain (e.g. prefiltered specular IBL).
+    // Each entry holds the six faces of that mip as tightly packed RGB floats.
+    void CreateCubemapFromMips(uint32_t resolution, const std::vector<std::vector<float>>& mips);
+    
+    // Create a GL_RGB32F 2D texture from decoded HDR pixels (or baked float LUTs)
+    void CreateHDRTexture(const HDRImage& image);
+    
     // 2D Array texture (for compute shader processing)
     void Create2DArray(uint32_t width, uint32_t height, uint32_t layers, bool isHDR = true);
     void Copy2DArrayToCubemap(const Texture& arrayTexture);
@@ -115,6 +125,9 @@ public:
     const std::string& GetFilePath() const { return m_FilePath; }
 
 private:
+    // Swaps storage in and out as mips stream
+    friend class TextureStreamer;
+    
     // Internal helper to apply texture parameters
     void ApplyTextureParameters();
     
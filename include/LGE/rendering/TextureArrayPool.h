@@ -0,0 +1,84 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace LGE {
+
+// Fixed-size RGBA8 layers in a single GL_TEXTURE_2D_ARRAY. Each allocated
+// layer also gets a 2D texture view over the shared storage so ImGui and
+// other 2D-only consumers can draw it without a separate texture upload.
+// Storage grows by doubling; views are recreated, so fetch IDs every frame.
+class TextureArrayPool {
+public:
+    static constexpr uint32_t InvalidLayer = 0xFFFFFFFFu;
+    
+    TextureArrayPool();
+    ~TextureArrayPool();
+    
+    TextureArrayPool(const TextureArrayPool&) = delete;
+    TextureArrayPool& operator=(const TextureArrayPool&) = delete;
+    
+    bool Initialize(int layerWidth, int layerHeight, uint32_t initialLayers = 32,
+                    uint32_t maxLayers = 1024, uint32_t mipCount = 3, bool gammaCorrected = true);
+    void Shutdown();
+    bool IsInitialized() const { return m_RendererID != 0; }
+    
+    uint32_t Allocate();
+    void Free(uint32_t layer);
+    
+    // Pixels must be exactly layerWidth x layerHeight RGBA8, top row first.
+    // Smaller mips are box filtered on the CPU so other layers are untouched.
+    bool Upload(uint32_t layer, const uint8_t* rgba);
+    
+    uint32_t GetRendererID() const { return m_RendererID; }
+    uint32_t GetLayerView(uint32_t layer) const;
+    
+    int GetLayerWidth() const { return m_LayerWidth; }
+    int GetLayerHeight() const { return m_LayerHeight; }
+    uint32_t GetCapacity() const { return m_Capacity; }
+    uint32_t GetUsedCount() const { return m_UsedCount; }
+
+private:
+    bool Grow(uint32_t capacity);
+    void CreateView(uint32_t layer);
+    
+    uint32_t m_RendererID;
+    int m_LayerWidth;
+    int m_LayerHeight;
+    uint32_t m_MipCount;
+    uint32_t m_Capacity;
+    uint32_t m_MaxLayers;
+    uint32_t m_UsedCount;
+    uint32_t m_InternalFormat;
+    
+    std::vector<uint32_t> m_Views;      // per layer, 0 when free
+    std::vector<uint8_t> m_Used;
+    std::vector<uint32_t> m_FreeLayers;
+};
+
+} // namespace LGE
+
@@ -0,0 +1,83 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/rendering/AtlasPacker.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace LGE {
+
+// Where a named image ended up in the atlas
+struct AtlasRegion {
+    AtlasRect rect;
+    AtlasUV uv;
+};
+
+// Packs many small RGBA images into one texture. Images are staged on the
+// CPU, then Build() packs them with AtlasPacker and uploads a single page.
+class TextureAtlas {
+public:
+    TextureAtlas();
+    ~TextureAtlas();
+    
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+    
+    // Stage tightly packed RGBA8 pixels (top row first)
+    bool AddImage(const std::string& name, const uint8_t* rgba, int width, int height);
+    bool AddImageFile(const std::string& name, const std::string& filepath);
+    bool HasImage(const std::string& name) const;
+    
+    // Pack and upload everything staged so far. Padding texels are filled by
+    // extruding each image's edges, which also bounds the usable mip count.
+    bool Build(int padding = 4, int maxSize = 4096, bool gammaCorrected = true);
+    void Release();
+    
+    const AtlasRegion* GetRegion(const std::string& name) const;
+    
+    uint32_t GetRendererID() const { return m_RendererID; }
+    int GetWidth() const { return m_Width; }
+    int GetHeight() const { return m_Height; }
+    size_t GetRegionCount() const { return m_Regions.size(); }
+
+private:
+    struct StagedImage {
+        int width = 0;
+        int height = 0;
+        std::vector<uint8_t> pixels;
+    };
+    
+    std::unordered_map<std::string, StagedImage> m_Staged;
+    std::unordered_map<std::string, AtlasRegion> m_Regions;
+    
+    uint32_t m_RendererID;
+    int m_Width;
+    int m_Height;
+};
+
+} // namespace LGE
+
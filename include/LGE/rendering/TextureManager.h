@@ -29,6 +29,8 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 namespace LGE {
 
+class TextureStreamer;
+
 // TextureManager - Handles texture caching and loading
 class TextureManager {
 public:
@@ -56,6 +58,14 @@ public:
     
     // Get cache statistics
     size_t GetCacheSize() const { return m_TextureCache.size(); }
+    
+    // When set, LDR textures load asynchronously through the streamer instead of blocking
+    // A stream that fails is evicted from the cache, so the next load retries the file
+    void SetStreamer(TextureStreamer* streamer);
+    TextureStreamer* GetStreamer() const { return m_Streamer; }
+    
+    // Desired-mip feedback for streamed textures (no-op otherwise)
+    void ReportScreenSize(const Texture& texture, float screenPixels);
 
 private:
     // Normalize filepath for cache key (handles relative/absolute paths)
@@ -63,6 +73,8 @@ private:
     
     // Texture cache: filepath -> texture
     std::unordered_map<std::string, std::shared_ptr<Texture>> m_TextureCache;
+    
+    TextureStreamer* m_Streamer;
 };
 
 } // namespace LGE
@@ -0,0 +1,124 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace LGE {
+
+// Size of a streamed texture as seen by the residency planner
+struct TextureResidencyDesc {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t mipCount = 1;
+    uint32_t bytesPerPixel = 4;
+};
+
+// One mip level to upload or evict
+struct MipTransfer {
+    uint32_t handle = 0;
+    uint32_t mip = 0;
+    uint64_t bytes = 0;
+};
+
+// CPU-side mip residency decisions for streamed textures.
+// Resident mips always form a contiguous tail [residentMip, mipCount), so a
+// texture is uploaded coarse to fine and evicted fine to coarse. No GL calls,
+// so the planner can be driven and checked without a context.
+class TextureResidency {
+public:
+    static constexpr uint32_t InvalidHandle = 0;
+    
+    TextureResidency();
+    
+    uint32_t Register(const TextureResidencyDesc& desc);
+    void Unregister(uint32_t handle);
+    
+    // Resident + in-flight bytes are kept under this limit (pinned mips excepted)
+    void SetBudget(uint64_t bytes) { m_Budget = bytes; }
+    uint64_t GetBudget() const { return m_Budget; }
+    
+    // Mips at or below this size (largest dimension) are always resident
+    void SetPinnedMipSize(uint32_t pixels) { m_PinnedMipSize = pixels; }
+    
+    // Frames without feedback before a texture falls back to its pinned mips
+    void SetIdleFrames(uint32_t frames) { m_IdleFrames = frames; }
+    
+    // Feedback for the current frame; the finest request wins
+    void RequestMip(uint32_t handle, uint32_t mip);
+    void ReportScreenSize(uint32_t handle, float screenPixels);
+    
+    // Mip whose largest dimension best matches the on-screen size in pixels
+    static uint32_t ComputeDesiredMip(uint32_t width, uint32_t height, uint32_t mipCount, float screenPixels);
+    static uint64_t GetMipBytes(const TextureResidencyDesc& desc, uint32_t mip);
+    
+    // Consume this frame's feedback and plan transfers. Evictions take effect
+    // immediately; uploads are in flight until MarkResident is called.
+    void Update(uint32_t maxUploads, uint64_t maxUploadBytes,
+                std::vector<MipTransfer>& outUploads, std::vector<MipTransfer>& outEvictions);
+    
+    // An upload returned by Update has completed
+    void MarkResident(uint32_t handle, uint32_t mip);
+    
+    // mipCount when nothing is resident yet
+    uint32_t GetResidentMip(uint32_t handle) const;
+    uint32_t GetDesiredMip(uint32_t handle) const;
+    uint32_t GetPinnedMip(uint32_t handle) const;
+    bool HasPendingUploads(uint32_t handle) const;
+    
+    uint64_t GetResidentBytes() const { return m_ResidentBytes; }
+    uint64_t GetInFlightBytes() const { return m_InFlightBytes; }
+    size_t GetTextureCount() const { return m_Entries.size(); }
+    uint64_t GetFrameIndex() const { return m_FrameIndex; }
+
+private:
+    struct Entry {
+        TextureResidencyDesc desc;
+        uint32_t residentMip = 0;    // Finest resident level (mipCount = none)
+        uint32_t requestedMip = 0;   // Finest level with an upload issued
+        uint32_t arrivedMask = 0;    // Uploads finer than residentMip that completed out of order
+        uint32_t desiredMip = 0;
+        uint32_t frameRequest = 0;   // Finest feedback this frame (mipCount = none)
+        uint32_t pinnedMip = 0;
+        uint64_t lastUsedFrame = 0;
+    };
+    
+    void Evict(uint32_t handle, Entry& entry, std::vector<MipTransfer>& outEvictions);
+    bool MakeRoom(uint64_t bytes, uint32_t requester, std::vector<MipTransfer>& outEvictions);
+    
+    std::unordered_map<uint32_t, Entry> m_Entries;
+    uint32_t m_NextHandle;
+    uint64_t m_FrameIndex;
+    
+    uint64_t m_Budget;
+    uint64_t m_ResidentBytes;
+    uint64_t m_InFlightBytes;
+    uint32_t m_PinnedMipSize;
+    uint32_t m_IdleFrames;
+};
+
+} // namespace LGE
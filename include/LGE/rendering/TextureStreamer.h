@@ -0,0 +1,148 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/rendering/Texture.h"
+#include "LGE/rendering/TextureResidency.h"
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace LGE {
+
+// Per-frame streaming counters (shown in the Profiler panel)
+struct TextureStreamingStats {
+    uint32_t streamedTextures = 0;
+    uint32_t pendingDecodes = 0;
+    uint64_t residentBytes = 0;
+    uint64_t budgetBytes = 0;
+    uint32_t uploadsThisFrame = 0;
+    uint64_t uploadBytesThisFrame = 0;
+    uint32_t evictionsThisFrame = 0;
+    uint32_t queuedUploads = 0;
+    
+    // Main-thread cost of Update(); spikes are frames above kSpikeThresholdMs
+    float updateMs = 0.0f;
+    float peakUpdateMs = 0.0f;       // Worst frame in the last kStatsWindow frames
+    uint32_t spikeFrames = 0;        // Spiking frames in the last kStatsWindow frames
+    uint32_t ringStalls = 0;         // Frames skipped because the PBO ring was busy
+    
+    static constexpr float kSpikeThresholdMs = 2.0f;
+    static constexpr size_t kStatsWindow = 300;
+};
+
+// Streams LDR textures in the background: files are read through AsyncFileIO,
+// pixels are decoded and mipped on a JobSystem worker, then uploaded coarse to fine through a ring of persistently
+// mapped PBOs with a fixed per-frame byte allowance. Which mips are resident is
+// decided by TextureResidency from screen-size feedback and the VRAM budget.
+class TextureStreamer {
+public:
+    TextureStreamer();
+    ~TextureStreamer();
+    
+    bool Initialize(uint64_t budgetBytes = 512ull * 1024 * 1024,
+                    uint32_t ringSegments = 3, uint32_t segmentBytes = 8 * 1024 * 1024);
+    void Shutdown();
+    bool IsInitialized() const { return m_PixelBuffer != 0; }
+    
+    // Returns immediately. The texture has no storage until its coarse mips arrive.
+    std::shared_ptr<Texture> Stream(const TextureSpec& spec);
+    bool IsStreamed(const Texture& texture) const;
+    
+    // Desired-mip feedback: on-screen size (pixels) of the texture this frame
+    void ReportScreenSize(const Texture& texture, float screenPixels);
+    
+    // Apply decodes, evictions and uploads. Call once per frame on the GL thread.
+    void Update();
+    
+    // Called from Update for a texture whose read or decode failed; the texture
+    // stays without storage and is no longer streamed
+    void SetFailureCallback(std::function<void(const Texture&, const std::string& path)> callback) { m_OnFailure = std::move(callback); }
+    
+    void SetBudget(uint64_t bytes) { m_Residency.SetBudget(bytes); }
+    TextureResidency& GetResidency() { return m_Residency; }
+    const TextureStreamingStats& GetStats() const { return m_Stats; }
+    
+private:
+    // CPU copy of every mip, so evicted levels can come back without decoding
+    struct DecodedImage {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::vector<std::vector<uint8_t>> mips;  // RGBA8
+    };
+    
+    // Shared with the decode job
+    struct DecodeState {
+        std::mutex mutex;
+        bool done = false;
+        std::shared_ptr<DecodedImage> image;
+        std::string error;
+    };
+    
+    struct Entry {
+        std::weak_ptr<Texture> texture;
+        TextureSpec spec;
+        std::shared_ptr<DecodeState> decode;
+        std::shared_ptr<DecodedImage> image;
+        uint32_t handle = TextureResidency::InvalidHandle;
+        uint32_t storageID = 0;
+        uint32_t storageTopMip = 0;   // Finest allocated level
+    };
+    
+    struct PendingUpload {
+        const Texture* key;
+        uint32_t mip;
+        uint32_t rowsDone;
+    };
+    
+    static std::shared_ptr<DecodedImage> DecodeImage(const uint8_t* bytes, size_t size, bool generateMipmaps, bool srgb, std::string& error);
+    
+    void ResizeStorage(Entry& entry, Texture& texture, uint32_t topMip);
+    void ApplyLevelRange(Entry& entry, Texture& texture);
+    void ProcessUploads();
+    void RemoveEntry(const Texture* key);
+    void RecordFrameTime(float ms);
+    
+    TextureResidency m_Residency;
+    std::unordered_map<const Texture*, Entry> m_Entries;
+    std::unordered_map<uint32_t, const Texture*> m_HandleToKey;
+    std::deque<PendingUpload> m_UploadQueue;
+    
+    // Persistently mapped upload ring, one fence per segment
+    uint32_t m_PixelBuffer;
+    uint8_t* m_MappedRing;
+    uint32_t m_SegmentBytes;
+    uint32_t m_CurrentSegment;
+    std::vector<void*> m_SegmentFences;  // GLsync
+    
+    TextureStreamingStats m_Stats;
+    std::deque<float> m_FrameTimes;
+    std::function<void(const Texture&, const std::string&)> m_OnFailure;
+};
+
+} // namespace LGE
@@ -23,6 +23,9 @@ For more information, visit: https://nexelgames.com/luma-engine
 #pragma once
 
 #include "LGE/core/Log.h"
+#include <cstdint>
+#include <ctime>
+#include <deque>
 #include <string>
 #include <vector>
 #include <mutex>
@@ -33,33 +36,33 @@ struct ImVec4;
 namespace LGE {
 
 struct LogEntry {
-    LogLevel level;
+    LogLevel level = LogLevel::Info;
     std::string message;
-    std::string timestamp;
-    
-    LogEntry(LogLevel lvl, const std::string& msg, const std::string& time)
-        : level(lvl), message(msg), timestamp(time) {}
+    char timestamp[12] = {};   // HH:MM:SS
 };
 
 class Console {
 public:
+    // Entries kept before the oldest are overwritten
+    static constexpr uint64_t kCapacity = 1 << 20;
+    
     Console();
     ~Console();
 
     void OnUIRender();
     
-    // Add a log entry
+    // Add a log entry (any thread; picked up on the next UI frame)
     void AddLog(LogLevel level, const std::string& message);
     
     // Clear all logs
     void Clear();
     
     // Filter settings
-    void SetShowTrace(bool show) { m_ShowTrace = show; }
-    void SetShowInfo(bool show) { m_ShowInfo = show; }
-    void SetShowWarn(bool show) { m_ShowWarn = show; }
-    void SetShowError(bool show) { m_ShowError = show; }
-    void SetShowFatal(bool show) { m_ShowFatal = show; }
+    void SetShowTrace(bool show) { m_ShowTrace = show; m_FilterDirty = true; }
+    void SetShowInfo(bool show) { m_ShowInfo = show; m_FilterDirty = true; }
+    void SetShowWarn(bool show) { m_ShowWarn = show; m_FilterDirty = true; }
+    void SetShowError(bool show) { m_ShowError = show; m_FilterDirty = true; }
+    void SetShowFatal(bool show) { m_ShowFatal = show; m_FilterDirty = true; }
     
     bool GetShowTrace() const { return m_ShowTrace; }
     bool GetShowInfo() const { return m_ShowInfo; }
@@ -70,6 +73,9 @@ public:
     // Auto-scroll to bottom
     void SetAutoScroll(bool autoScroll) { m_AutoScroll = autoScroll; }
     bool GetAutoScroll() const { return m_AutoScroll; }
+    
+    size_t GetLogCount() const { return static_cast<size_t>(m_NextSequence - m_FirstSequence); }
+    size_t GetVisibleCount() const { return m_Visible.size(); }
 
 private:
     void RenderToolbar();
@@ -77,9 +83,25 @@ private:
     struct ImVec4 GetLogColor(LogLevel level) const;
     std::string GetLogLevelString(LogLevel level) const;
     
-    std::vector<LogEntry> m_Logs;
+    // Ring and indices are only touched on the UI thread
+    void DrainPending();
+    void Append(LogEntry&& entry);
+    void RebuildVisible();
+    bool IsLevelShown(LogLevel level) const;
+    bool MatchesSearch(const LogEntry& entry) const;
+    const LogEntry& GetEntry(uint64_t sequence) const { return m_Logs[sequence % kCapacity]; }
+    std::string FormatEntry(const LogEntry& entry) const;
+    
+    std::vector<LogEntry> m_Pending;   // Filled by AddLog, guarded by m_LogsMutex
     std::mutex m_LogsMutex;
-    int m_MaxLogs;  // Maximum number of logs to keep
+    std::time_t m_PendingSecond;       // Timestamp cache, guarded by m_LogsMutex
+    char m_PendingTime[12];
+    
+    std::vector<LogEntry> m_Logs;      // Ring storage, slot = sequence % kCapacity
+    uint64_t m_FirstSequence;
+    uint64_t m_NextSequence;
+    std::deque<uint64_t> m_LevelIndices[5];   // Sequences per LogLevel, oldest first
+    std::deque<uint64_t> m_Visible;           // Sequences passing the current filter
     
     // Filter flags
     bool m_ShowTrace;
@@ -87,6 +109,8 @@ private:
     bool m_ShowWarn;
     bool m_ShowError;
     bool m_ShowFatal;
+    bool m_FilterDirty;
+    std::string m_SearchLower;
     
     // UI state
     bool m_AutoScroll;
@@ -94,4 +118,3 @@ private:
 };
 
 } // namespace LGE
-
@@ -40,8 +40,8 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 namespace LGE {
 
-// Forward declarations
-class Texture;
+class AssetRegistry;
+class ContentBrowserModel;
 
 // Directory tree node for folder hierarchy
 struct DirectoryNode {
@@ -71,6 +71,13 @@ public:
     void SetProjectRoot(const std::string& root);
     std::string GetProjectRoot() const { return m_AssetsRoot; }
     
+    // Build the folder tree from the registry's directory index instead of scanning
+    // the disk. virtualRoot is the virtual path of the project root (e.g. "/Assets").
+    void SetAssetRegistry(AssetRegistry* registry, const std::string& virtualRoot = "/");
+    
+    // Registry-backed listing used for the search box (results for the current folder)
+    void SetModel(ContentBrowserModel* model);
+    
     // Callback for scene opening
     void SetOnSceneOpened(std::function<void(const std::string&)> callback) { m_OnSceneOpened = callback; }
     
@@ -91,6 +98,9 @@ private:
     std::shared_ptr<DirectoryNode> BuildDirectoryTree(const std::string& rootPath);
     void ScanDirectory(std::shared_ptr<DirectoryNode> node);
     std::shared_ptr<DirectoryNode> FindNodeByPath(std::shared_ptr<DirectoryNode> root, const std::string& path);
+    std::string GetVirtualDirectory(const std::string& path) const;
+    std::string GetDiskPath(const std::string& virtualPath) const;
+    void RenderSearchResults();
     
     // File operations
     void OnFileSelected(const FileEntry& entry);
@@ -105,6 +115,10 @@ private:
     int m_HistoryIndex;
     
     // Directory tree
+    AssetRegistry* m_Registry;
+    std::string m_RegistryRoot;
+    ContentBrowserModel* m_Model;
+    std::string m_SearchQuery;
     std::shared_ptr<DirectoryNode> m_RootNode;
     std::set<std::string> m_ExpandedPaths;  // Track expanded folders
     
@@ -129,13 +143,6 @@ private:
     std::function<void(const std::string&)> m_OnSceneOpened;
     std::function<void(const std::string&, const std::string&)> m_OnSceneRenamed;  // oldPath, newPath
     
-    // Thumbnail textures
-    std::shared_ptr<Texture> m_FolderThumbnail;
-    std::shared_ptr<Texture> m_ScriptThumbnail;
-    std::shared_ptr<Texture> m_ShaderThumbnail;
-    
-    void LoadThumbnails();
-    
     // Helper to get display name (strips .lscene extension for scenes)
     std::string GetDisplayName(const FileEntry& entry) const;
 };
@@ -36,6 +36,8 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 namespace LGE {
 
+class AssetSearchIndex;
+
 struct ContentBrowserItem {
     enum class ItemType {
         Folder,
@@ -62,6 +64,7 @@ struct ContentBrowserItem {
 class ContentBrowserModel {
 private:
     AssetRegistry* m_Registry;
+    AssetSearchIndex* m_SearchIndex;
     VirtualFileSystem* m_VFS;
     std::filesystem::path m_CurrentDirectory;
     std::vector<ContentBrowserItem> m_CurrentItems;
@@ -112,6 +115,10 @@ public:
     
     // Set VFS
     void SetVFS(VirtualFileSystem* vfs) { m_VFS = vfs; }
+    
+    // Search queries go through the index when one is set (word matches),
+    // otherwise the current folder's assets are filtered by name
+    void SetSearchIndex(AssetSearchIndex* index) { m_SearchIndex = index; }
 };
 
 } // namespace LGE
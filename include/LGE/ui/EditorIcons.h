@@ -0,0 +1,61 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace LGE {
+
+struct AtlasRegion;
+
+enum class EditorIcon {
+    Translate = 0,
+    Rotate,
+    Scale,
+    ShowGrid,
+    Lit,
+    LightActor,
+    Plus,
+    Search,
+    Folder,
+    Script,
+    Shader,
+    Count
+};
+
+// Every editor icon and built-in thumbnail packed into one atlas texture.
+// Candidate paths are probed once on first use; panels share the result.
+// Needs a current GL context for Load/Release.
+class EditorIcons {
+public:
+    static void Load();
+    static void Release();
+    
+    // nullptr when the icon file was not found; callers draw their fallback
+    static const AtlasRegion* Get(EditorIcon icon);
+    static uint32_t GetRendererID();
+};
+
+} // namespace LGE
+
@@ -30,6 +30,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #pragma once
 
+#include "LGE/ui/HierarchyTreeCache.h"
 #include <vector>
 #include <memory>
 #include <functional>
@@ -38,7 +39,6 @@ For more information, visit: https://nexelgames.com/luma-engine
 namespace LGE {
 
 class GameObject;
-class Texture;
 
 class Hierarchy {
 public:
@@ -47,7 +47,8 @@ public:
 
     void OnUIRender();
     
-    void SetGameObjects(const std::vector<std::shared_ptr<GameObject>>& objects) { m_GameObjects = objects; }
+    // Rebuilds the tree cache; call when the world's hierarchy changes, not every frame
+    void SetGameObjects(const std::vector<std::shared_ptr<GameObject>>& objects);
     void SetSelectedObject(GameObject* obj) { m_SelectedObject = obj; }
     GameObject* GetSelectedObject() const { return m_SelectedObject; }
     
@@ -55,16 +56,12 @@ public:
     void SetOnCreateGameObject(std::function<void(const std::string&)> callback) { m_OnCreateGameObject = callback; }
 
 private:
-    void LoadIcons();
+    void RenderTree();
     
     std::vector<std::shared_ptr<GameObject>> m_GameObjects;
     GameObject* m_SelectedObject;
-    
-    // Icons
-    std::shared_ptr<Texture> m_PlusIcon;
-    std::shared_ptr<Texture> m_SearchIcon;
-    std::shared_ptr<Texture> m_LightActorIcon;
-    bool m_IconsLoaded;
+    HierarchyTreeCache m_TreeCache;
+    char m_SearchBuffer[256];
     
     // Callback for creating GameObjects
     std::function<void(const std::string&)> m_OnCreateGameObject;
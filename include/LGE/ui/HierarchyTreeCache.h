@@ -0,0 +1,93 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#pragma once
+
+#include "LGE/core/GUID.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace LGE {
+
+class GameObject;
+
+// One visible line of an outliner
+struct HierarchyRow {
+    GameObject* object = nullptr;
+    int depth = 0;
+    bool hasChildren = false;
+    bool expanded = false;
+    bool matches = true;       // False for ancestors kept only to show a matching descendant
+};
+
+// Flattened GameObject tree for virtualized outliners. The full tree is walked
+// once per hierarchy change; expanding, collapsing and searching only rebuild
+// the visible row list, and drawing a frame touches nothing but the rows in view.
+class HierarchyTreeCache {
+public:
+    // Replace the tree; children are reached through GameObject::GetChildren
+    void SetRoots(const std::vector<std::shared_ptr<GameObject>>& roots);
+    void Clear();
+    
+    // Expansion is keyed by GUID, so it survives SetRoots and never carries over
+    // to a new object that reuses a destroyed one's address
+    bool IsExpanded(const GameObject* object) const;
+    void SetExpanded(const GameObject* object, bool expanded);
+    
+    // Case-insensitive name filter. Narrowing an existing query only re-tests the previous matches.
+    void SetFilter(const std::string& filter);
+    const std::string& GetFilter() const { return m_Filter; }
+    
+    const std::vector<HierarchyRow>& GetRows();
+    size_t GetNodeCount() const { return m_Nodes.size(); }
+    size_t GetMatchCount() const { return m_Matches.size(); }
+
+private:
+    // Preorder node: the subtree of node i is [i + 1, subtreeEnd)
+    struct Node {
+        std::shared_ptr<GameObject> object;
+        std::string lowerName;
+        int parent = -1;
+        int depth = 0;
+        uint32_t subtreeEnd = 0;
+    };
+    
+    void AddSubtree(const std::shared_ptr<GameObject>& object, int parent, int depth);
+    void ApplyFilter(bool narrowing);
+    void RebuildRows();
+    
+    std::vector<Node> m_Nodes;
+    std::unordered_set<GUID> m_Expanded;   // Pruned to objects still in the tree on SetRoots
+    
+    std::string m_Filter;
+    std::vector<uint32_t> m_Matches;   // Node indices whose name contains m_Filter
+    std::vector<uint8_t> m_Keep;       // 1 = match, 2 = ancestor of a match
+    
+    std::vector<HierarchyRow> m_Rows;
+    bool m_RowsDirty = true;
+};
+
+} // namespace LGE
@@ -22,6 +22,8 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #pragma once
 
+#include "LGE/ui/HierarchyTreeCache.h"
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -49,14 +51,22 @@ public:
     void SetSelectedGameObject(std::shared_ptr<GameObject> gameObject);
 
 private:
-    // Render a single GameObject node in the tree
-    void RenderGameObjectNode(std::shared_ptr<GameObject> gameObject);
+    // Refresh the tree cache when the world's hierarchy version moved
+    void SyncTreeCache();
+    
+    // Render a single row of the flattened tree
+    void RenderRow(const HierarchyRow& row);
     
     // Show context menu for GameObject
     void ShowContextMenu(std::shared_ptr<GameObject> gameObject);
     
     World* m_World;
     std::weak_ptr<GameObject> m_SelectedGameObject;
+    
+    HierarchyTreeCache m_TreeCache;
+    uint64_t m_CachedVersion;
+    bool m_CacheValid;
+    char m_SearchBuffer[256];
 };
 
 } // namespace LGE
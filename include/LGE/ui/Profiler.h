@@ -29,6 +29,9 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #pragma once
 
+#include "LGE/core/Profiling.h"
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <deque>
 
@@ -36,6 +39,10 @@ struct ImVec2;
 
 namespace LGE {
 
+struct TextureStreamingStats;
+struct RenderTargetStats;
+struct GPUProfilerStats;
+
 class Profiler {
 public:
     Profiler();
@@ -46,16 +53,43 @@ public:
     
     void SetFPS(float fps) { m_CurrentFPS = fps; }
     void SetFrameTime(float frameTime) { m_CurrentFrameTime = frameTime; }
+    
+    // Optional streaming counters to display (owned by the TextureStreamer)
+    void SetTextureStreamingStats(const TextureStreamingStats* stats) { m_StreamingStats = stats; }
+    
+    // Optional render target pool memory report (owned by the RenderTargetPool)
+    void SetRenderTargetStats(const RenderTargetStats* stats) { m_RenderTargetStats = stats; }
+    
+    // Optional GPU timer readback report (owned by the GPUProfiler)
+    void SetGPUStats(const GPUProfilerStats* stats) { m_GPUStats = stats; }
 
 private:
     float m_CurrentFPS;
     float m_CurrentFrameTime;
+    const TextureStreamingStats* m_StreamingStats;
+    const RenderTargetStats* m_RenderTargetStats;
+    const GPUProfilerStats* m_GPUStats;
     
     // History for graphs
     std::deque<float> m_FPSHistory;
     std::deque<float> m_FrameTimeHistory;
     static constexpr size_t MAX_HISTORY_SIZE = 100;
     
+    // CPU zones of the last finished frame, or of the frame the view was frozen on
+    std::vector<ProfileZone> m_TimelineZones;
+    std::vector<ProfileThreadInfo> m_TimelineThreads;
+    uint64_t m_TimelineBegin;
+    uint64_t m_TimelineEnd;
+    float m_TimelineZoom;
+    bool m_TimelinePaused;
+    bool m_FreezeOnSpike;
+    
+    void CaptureTimeline();
+    void DrawTimeline();
+    void DrawZoneSummary();
+    void DrawStreamingStats();
+    void DrawRenderTargetStats();
+    void DrawGPUStats();
     void DrawPerformanceGraph(const char* label, const std::deque<float>& history, float min, float max, ImVec2 size);
 };
 
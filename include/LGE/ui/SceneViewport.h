@@ -36,6 +36,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include <vector>
 
 #include "LGE/rendering/Framebuffer.h"
+#include "LGE/rendering/FrameGraph.h"
 #include "LGE/math/Vector.h"
 
 // Forward declare GL types
@@ -45,10 +46,10 @@ namespace LGE {
 
 class Camera;
 class Renderer;
-class Texture;
 class GameObject;
 class PostProcessor;
 class ExposureSystem;
+class RenderTargetPool;
 
 
 class SceneViewport {
@@ -59,10 +60,17 @@ public:
     void OnUpdate(float deltaTime);
     void OnUIRender();
     
-    void BeginRender();  // Begin rendering to framebuffer (binds framebuffer, clears, sets viewport)
-    void EndRender();    // End rendering to framebuffer (unbinds framebuffer, restores viewport)
+    // Creates the viewport's output target; false if there is nothing to render to
+    bool PrepareRender();
+    // HDR scene color the frame graph allocates for the viewport each frame
+    RenderTargetDesc GetSceneColorDesc() const;
+    // Adds exposure and tone mapping from sceneColor into the viewport's LDR target
+    FrameGraphHandle AddPostProcessPasses(FrameGraph& graph, FrameGraphHandle sceneColor);
 
     void SetCamera(Camera* camera) { m_Camera = camera; }
+    
+    // Framebuffers created after this borrow their attachments from the pool
+    void SetRenderTargetPool(RenderTargetPool* pool) { m_RenderTargetPool = pool; }
     Camera* GetCamera() const { return m_Camera; }
 
     bool IsFocused() const { return m_Focused; }
@@ -80,30 +88,19 @@ public:
     bool IsLit() const { return m_IsLit; }
 
 private:
-    void LoadIcons(); // Load icon textures
     void HandleMouseInput(); // Handle mouse input for selection and transform
     Math::Vector3 ScreenToWorldRay(float screenX, float screenY); // Convert screen coordinates to world ray
-    void ApplyToneMapping(); // Apply tone mapping from HDR to LDR framebuffer
     
-    std::unique_ptr<Framebuffer> m_Framebuffer;      // HDR framebuffer
     std::unique_ptr<Framebuffer> m_LDRFramebuffer;  // LDR framebuffer for tone-mapped result
     std::unique_ptr<PostProcessor> m_PostProcessor;
     std::unique_ptr<ExposureSystem> m_ExposureSystem;
+    RenderTargetPool* m_RenderTargetPool;
     Camera* m_Camera;
     uint32_t m_Width;
     uint32_t m_Height;
     bool m_Focused;
     bool m_Hovered;
     bool m_ViewportSizeChanged;
-    GLint m_StoredViewport[4];  // Store viewport to restore after framebuffer rendering
-    
-    // Icon textures
-    std::shared_ptr<Texture> m_TranslateIcon;
-    std::shared_ptr<Texture> m_RotateIcon;
-    std::shared_ptr<Texture> m_ScaleIcon;
-    std::shared_ptr<Texture> m_ShowGridIcon;
-    std::shared_ptr<Texture> m_LightActorIcon;
-    bool m_IconsLoaded;
     
     // Grid toggle
     bool m_ShowGrid;
@@ -111,7 +108,6 @@ private:
     // Viewport settings
     bool m_IsLit; // Lighting enabled/disabled
     int m_ProjectionType; // 0=Perspective, 1=Orthographic
-    std::shared_ptr<Texture> m_LitIcon;
     
     // Selection and transform
     GameObject* m_SelectedObject;
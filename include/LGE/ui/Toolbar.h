@@ -47,6 +47,9 @@ public:
     // Set the current scene name to display
     void SetCurrentSceneName(const std::string& sceneName) { m_CurrentSceneName = sceneName; }
     const std::string& GetCurrentSceneName() const { return m_CurrentSceneName; }
+    
+    // Background work shown at the right edge; an empty status hides it
+    void SetStatus(const std::string& status, float progress) { m_Status = status; m_StatusProgress = progress; }
 
 private:
     void LoadIcons();
@@ -56,6 +59,8 @@ private:
     std::shared_ptr<Texture> m_StopIcon;
     bool m_IconsLoaded;
     std::string m_CurrentSceneName;
+    std::string m_Status;
+    float m_StatusProgress = 0.0f;
 };
 
 } // namespace LGE
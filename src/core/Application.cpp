@@ -32,6 +32,9 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/Window.h"
 #include "LGE/core/LayerStack.h"
 #include "LGE/core/SplashScreen.h"
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/filesystem/AsyncFileIO.h"
+#include "LGE/core/Profiling.h"
 #include "LGE/rendering/Renderer.h"
 #include "LGE/core/Log.h"
 #include "LGE/ui/UI.h"
@@ -51,6 +54,9 @@ Application::~Application() {
 bool Application::Initialize() {
     Log::Info("Initializing " + m_Name + "...");
 
+    // Worker pool for decoding and other background CPU work
+    JobSystem::Initialize();
+
     // Create window
     WindowProperties props;
     props.Title = m_Name;
@@ -98,8 +104,11 @@ void Application::Run() {
     }
 
     auto lastTime = std::chrono::high_resolution_clock::now();
+    Profiling::SetThreadName("Main");
 
     while (m_Running && !m_Window->ShouldClose()) {
+        Profiling::MarkFrame();
+        
         auto currentTime = std::chrono::high_resolution_clock::now();
         auto deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
         lastTime = currentTime;
@@ -110,23 +119,38 @@ void Application::Run() {
         m_Renderer->BeginFrame();
         
         // Update layers
-        m_LayerStack->OnUpdate(deltaTime);
-        OnUpdate(deltaTime);
+        {
+            LGE_PROFILE_SCOPE("Update");
+            m_LayerStack->OnUpdate(deltaTime);
+            OnUpdate(deltaTime);
+        }
         
         // Render main application UI first
-        OnRender();
-        
-        // Render layers and overlays (splash screen should be on top)
-        m_LayerStack->OnRender();
+        {
+            LGE_PROFILE_SCOPE("Render");
+            OnRender();
+            
+            // Render layers and overlays (splash screen should be on top)
+            m_LayerStack->OnRender();
+        }
         
         m_Renderer->EndFrame();
         
         // End UI frame and render
-        UI::EndFrame();
-        UI::Render();
+        {
+            LGE_PROFILE_SCOPE("UI::Render");
+            UI::EndFrame();
+            UI::Render();
+        }
         
-        m_Window->SwapBuffers();
-        m_Window->OnUpdate();
+        {
+            LGE_PROFILE_SCOPE("SwapBuffers");
+            m_Window->SwapBuffers();
+        }
+        {
+            LGE_PROFILE_SCOPE("PollEvents");
+            m_Window->OnUpdate();
+        }
     }
 }
 
@@ -143,6 +167,10 @@ void Application::Shutdown() {
         m_Window.reset();
     }
 
+    // Pending reads complete onto the JobSystem, so drain them first
+    AsyncFileIO::Get().Shutdown();
+    JobSystem::Shutdown();
+
     m_Running = false;
     Log::Info("Application shut down.");
 }
@@ -22,6 +22,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 */
 
 #include "LGE/core/GUID.h"
+#include <algorithm>
 #include <random>
 #include <sstream>
 #include <iomanip>
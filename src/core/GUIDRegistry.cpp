@@ -23,12 +23,36 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #include "LGE/core/GUIDRegistry.h"
 #include "LGE/core/filesystem/FileSystem.h"
+#include "LGE/core/filesystem/MappedFile.h"
 #include "LGE/core/Log.h"
-#include <sstream>
 #include <algorithm>
+#include <cstring>
+#include <fstream>
 
 namespace LGE {
 
+namespace {
+
+constexpr char kGUIDRegistryMagic[8] = { 'L', 'G', 'E', 'G', 'I', 'D', '0', '1' };
+
+// Fixed-size record; the path is a slice of the string block after the records
+struct GUIDRecord {
+    uint64_t high;
+    uint64_t low;
+    uint32_t pathOffset;
+    uint32_t pathLength;
+};
+static_assert(sizeof(GUIDRecord) == 24, "GUIDRecord is written as-is");
+
+struct GUIDFileHeader {
+    char magic[8];
+    uint64_t count;
+    uint64_t stringBytes;
+};
+static_assert(sizeof(GUIDFileHeader) == 24, "GUIDFileHeader is written as-is");
+
+} // namespace
+
 GUIDRegistry::GUIDRegistry() {
 }
 
@@ -36,22 +60,35 @@ GUIDRegistry::~GUIDRegistry() {
 }
 
 GUID GUIDRegistry::RegisterAsset(const std::string& virtualPath) {
-    std::string normalized = NormalizePath(virtualPath);
+    PathId pathId = InternPath(virtualPath);
     
     // Check if already registered
-    auto it = m_PathToGUID.find(normalized);
-    if (it != m_PathToGUID.end()) {
-        return it->second;
+    GUID existing = FindByPath(pathId);
+    if (existing.IsValid()) {
+        return existing;
     }
     
     // Generate new GUID
     GUID guid = GUID::Generate();
+    Link(guid, pathId);
+    return guid;
+}
+
+bool GUIDRegistry::RegisterAsset(const GUID& guid, const std::string& virtualPath) {
+    PathId pathId = InternPath(virtualPath);
     
-    // Register in both maps
-    m_PathToGUID[normalized] = guid;
-    m_GUIDToPath[guid] = normalized;
+    GUID existing = FindByPath(pathId);
+    if (existing.IsValid()) {
+        return existing == guid;
+    }
     
-    return guid;
+    // Drop a stale path the GUID may still map to
+    if (const PathId* oldPath = m_GUIDToPath.Find(guid)) {
+        UnlinkPath(*oldPath);
+    }
+    
+    Link(guid, pathId);
+    return true;
 }
 
 GUID GUIDRegistry::GetOrCreateGUID(const std::string& virtualPath) {
@@ -59,95 +96,89 @@ GUID GUIDRegistry::GetOrCreateGUID(const std::string& virtualPath) {
 }
 
 std::string GUIDRegistry::GetPathFromGUID(const GUID& guid) {
-    auto it = m_GUIDToPath.find(guid);
-    if (it != m_GUIDToPath.end()) {
-        return it->second;
+    const PathId* pathId = m_GUIDToPath.Find(guid);
+    if (pathId) {
+        return std::string(PathTable::Get().GetString(*pathId));
     }
     return "";
 }
 
 GUID GUIDRegistry::GetGUIDFromPath(const std::string& path) {
-    std::string normalized = NormalizePath(path);
-    auto it = m_PathToGUID.find(normalized);
-    if (it != m_PathToGUID.end()) {
-        return it->second;
-    }
-    return GUID::Invalid();
+    return FindByPath(FindPath(path));
 }
 
 bool GUIDRegistry::UpdatePath(const GUID& guid, const std::string& newPath) {
-    auto it = m_GUIDToPath.find(guid);
-    if (it == m_GUIDToPath.end()) {
+    const PathId* oldPath = m_GUIDToPath.Find(guid);
+    if (!oldPath) {
         return false;
     }
     
-    std::string oldPath = it->second;
-    std::string normalized = NormalizePath(newPath);
-    
-    // Remove old path entry
-    m_PathToGUID.erase(oldPath);
-    
-    // Update both maps
-    m_GUIDToPath[guid] = normalized;
-    m_PathToGUID[normalized] = guid;
-    
+    // Remove old path entry, then point both directions at the new one
+    UnlinkPath(*oldPath);
+    Link(guid, InternPath(newPath));
     return true;
 }
 
 bool GUIDRegistry::RemoveAsset(const GUID& guid) {
-    auto it = m_GUIDToPath.find(guid);
-    if (it == m_GUIDToPath.end()) {
+    const PathId* pathId = m_GUIDToPath.Find(guid);
+    if (!pathId) {
         return false;
     }
     
-    std::string path = it->second;
-    m_GUIDToPath.erase(it);
-    m_PathToGUID.erase(path);
-    
+    UnlinkPath(*pathId);
+    m_GUIDToPath.Erase(guid);
     return true;
 }
 
 bool GUIDRegistry::RemoveAsset(const std::string& path) {
-    std::string normalized = NormalizePath(path);
-    auto it = m_PathToGUID.find(normalized);
-    if (it == m_PathToGUID.end()) {
+    PathId pathId = FindPath(path);
+    GUID guid = FindByPath(pathId);
+    if (!guid.IsValid()) {
         return false;
     }
     
-    GUID guid = it->second;
-    m_PathToGUID.erase(it);
-    m_GUIDToPath.erase(guid);
-    
+    UnlinkPath(pathId);
+    m_GUIDToPath.Erase(guid);
     return true;
 }
 
 bool GUIDRegistry::SaveToFile(const std::filesystem::path& path) {
-    std::ostringstream json;
-    json << "{\n";
-    json << "  \"assets\": [\n";
-    
-    size_t index = 0;
-    for (const auto& [guid, assetPath] : m_GUIDToPath) {
-        json << "    {\n";
-        json << "      \"guid\": \"" << guid.ToString() << "\",\n";
-        json << "      \"path\": \"" << assetPath << "\"\n";
-        json << "    }";
-        if (index < m_GUIDToPath.size() - 1) {
-            json << ",";
+    // Written in PathId order, which is roughly the order the paths were first
+    // interned in; loading then walks the path table mostly sequentially
+    std::vector<GUIDRecord> records;
+    records.reserve(m_GUIDToPath.Size());
+    std::string strings;
+    for (PathId pathId = 1; pathId < m_PathToGUID.size(); ++pathId) {
+        const GUID& guid = m_PathToGUID[pathId];
+        if (!guid.IsValid()) {
+            continue;
         }
-        json << "\n";
-        ++index;
+        std::string_view assetPath = PathTable::Get().GetString(pathId);
+        records.push_back({ guid.GetHigh(), guid.GetLow(), static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(assetPath.size()) });
+        strings.append(assetPath);
     }
     
-    json << "  ]\n";
-    json << "}\n";
+    GUIDFileHeader header;
+    std::memcpy(header.magic, kGUIDRegistryMagic, sizeof(header.magic));
+    header.count = records.size();
+    header.stringBytes = strings.size();
     
-    if (!FileSystem::WriteFile(path.string(), json.str())) {
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+    }
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (out.is_open()) {
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(GUIDRecord)));
+        out.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+    }
+    if (!out.is_open() || !out.good()) {
         Log::Error("Failed to save GUID registry to: " + path.string());
         return false;
     }
     
-    Log::Info("Saved GUID registry with " + std::to_string(m_GUIDToPath.size()) + " assets to: " + path.string());
+    Log::Info("Saved GUID registry with " + std::to_string(records.size()) + " assets to: " + path.string());
     return true;
 }
 
@@ -157,14 +188,47 @@ bool GUIDRegistry::LoadFromFile(const std::filesystem::path& path) {
         return false;
     }
     
-    std::string json = FileSystem::ReadFile(path.string());
-    if (json.empty()) {
+    FileView file = MappedFile::Open(path.string(), FileAccessHint::Sequential);
+    if (!file.IsValid() || file.Empty()) {
         Log::Error("Failed to read GUID registry from: " + path.string());
         return false;
     }
     
     Clear();
     
+    GUIDFileHeader header;
+    if (file.GetSize() < sizeof(header) || std::memcmp(file.GetData(), kGUIDRegistryMagic, sizeof(kGUIDRegistryMagic)) != 0) {
+        return LoadFromJson(std::string(file.AsStringView()), path);
+    }
+    
+    // Records are read in place from the mapping; only the paths are copied (into the PathTable)
+    std::memcpy(&header, file.GetData(), sizeof(header));
+    size_t available = file.GetSize() - sizeof(header);
+    if (header.count > available / sizeof(GUIDRecord) || header.stringBytes != available - header.count * sizeof(GUIDRecord)) {
+        Log::Error("GUID registry is truncated: " + path.string());
+        return false;
+    }
+    
+    const uint8_t* recordData = file.GetData() + sizeof(header);
+    const char* strings = reinterpret_cast<const char*>(recordData + header.count * sizeof(GUIDRecord));
+    m_GUIDToPath.Reserve(header.count);
+    for (uint64_t i = 0; i < header.count; ++i) {
+        GUIDRecord record;
+        std::memcpy(&record, recordData + i * sizeof(GUIDRecord), sizeof(record));
+        GUID guid(record.high, record.low);
+        if (!guid.IsValid() || uint64_t(record.pathOffset) + record.pathLength > header.stringBytes) {
+            Log::Error("GUID registry is corrupt: " + path.string());
+            Clear();
+            return false;
+        }
+        Link(guid, PathTable::Get().Intern(std::string_view(strings + record.pathOffset, record.pathLength)));
+    }
+    
+    Log::Info("Loaded GUID registry with " + std::to_string(m_GUIDToPath.Size()) + " assets from: " + path.string());
+    return true;
+}
+
+bool GUIDRegistry::LoadFromJson(const std::string& json, const std::filesystem::path& path) {
     // Simple JSON parsing (basic implementation)
     // In production, use a proper JSON library
     
@@ -214,9 +278,7 @@ bool GUIDRegistry::LoadFromFile(const std::filesystem::path& path) {
                 
                 GUID guid = GUID::FromString(guidStr);
                 if (guid.IsValid()) {
-                    std::string normalized = NormalizePath(assetPath);
-                    m_GUIDToPath[guid] = normalized;
-                    m_PathToGUID[normalized] = guid;
+                    Link(guid, InternPath(assetPath));
                 }
             }
         }
@@ -224,15 +286,58 @@ bool GUIDRegistry::LoadFromFile(const std::filesystem::path& path) {
         pos = entryEnd + 1;
     }
     
-    Log::Info("Loaded GUID registry with " + std::to_string(m_GUIDToPath.size()) + " assets from: " + path.string());
+    Log::Info("Loaded GUID registry with " + std::to_string(m_GUIDToPath.Size()) + " assets from: " + path.string());
     return true;
 }
 
 void GUIDRegistry::Clear() {
-    m_GUIDToPath.clear();
+    m_GUIDToPath.Clear();
     m_PathToGUID.clear();
 }
 
+size_t GUIDRegistry::GetMemoryUsage() const {
+    return m_GUIDToPath.GetMemoryUsage() + m_PathToGUID.capacity() * sizeof(GUID);
+}
+
+bool GUIDRegistry::IsNormalized(const std::string& path) {
+    return !path.empty() && path[0] == '/' && (path.size() == 1 || path.back() != '/') &&
+           path.find('\\') == std::string::npos;
+}
+
+PathId GUIDRegistry::FindPath(const std::string& path) const {
+    // Paths handed out by the registries are already normalized; probing them
+    // as-is skips building a copy on every lookup
+    return IsNormalized(path) ? PathTable::Get().Find(path) : PathTable::Get().Find(NormalizePath(path));
+}
+
+PathId GUIDRegistry::InternPath(const std::string& path) const {
+    return IsNormalized(path) ? PathTable::Get().Intern(path) : PathTable::Get().Intern(NormalizePath(path));
+}
+
+GUID GUIDRegistry::FindByPath(PathId pathId) const {
+    return pathId != kInvalidPathId && pathId < m_PathToGUID.size() ? m_PathToGUID[pathId] : GUID::Invalid();
+}
+
+void GUIDRegistry::Link(const GUID& guid, PathId pathId) {
+    // A path has one GUID; one that loses its path (UpdatePath onto a taken
+    // path) would otherwise linger in the forward map only
+    GUID previous = FindByPath(pathId);
+    if (previous.IsValid() && previous != guid) {
+        m_GUIDToPath.Erase(previous);
+    }
+    m_GUIDToPath[guid] = pathId;
+    if (pathId >= m_PathToGUID.size()) {
+        m_PathToGUID.resize(pathId + 1);
+    }
+    m_PathToGUID[pathId] = guid;
+}
+
+void GUIDRegistry::UnlinkPath(PathId pathId) {
+    if (pathId < m_PathToGUID.size()) {
+        m_PathToGUID[pathId] = GUID::Invalid();
+    }
+}
+
 std::string GUIDRegistry::NormalizePath(const std::string& path) const {
     std::string normalized = path;
     
@@ -253,4 +358,3 @@ std::string GUIDRegistry::NormalizePath(const std::string& path) const {
 }
 
 } // namespace LGE
-
@@ -0,0 +1,145 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/core/Hash.h"
+#include "LGE/core/filesystem/MappedFile.h"
+#include <cstring>
+
+namespace LGE {
+
+namespace {
+
+constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+constexpr uint64_t kPrime3 = 0x165667B19E3779F9ull;
+constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ull;
+constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ull;
+
+inline uint64_t RotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t Read64(const uint8_t* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t Read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint64_t Round(uint64_t acc, uint64_t input) {
+    acc += input * kPrime2;
+    acc = RotateLeft(acc, 31);
+    return acc * kPrime1;
+}
+
+inline uint64_t MergeRound(uint64_t acc, uint64_t value) {
+    acc ^= Round(0, value);
+    return acc * kPrime1 + kPrime4;
+}
+
+} // namespace
+
+// XXH64-style: four independent lanes over 32-byte stripes, then a tail and avalanche
+uint64_t Hash::Bytes(const void* data, size_t size, uint64_t seed) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    const uint8_t* end = p + size;
+    uint64_t hash;
+    
+    if (size >= 32) {
+        uint64_t v1 = seed + kPrime1 + kPrime2;
+        uint64_t v2 = seed + kPrime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - kPrime1;
+        
+        const uint8_t* limit = end - 32;
+        do {
+            v1 = Round(v1, Read64(p));
+            v2 = Round(v2, Read64(p + 8));
+            v3 = Round(v3, Read64(p + 16));
+            v4 = Round(v4, Read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+        
+        hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+        hash = MergeRound(hash, v1);
+        hash = MergeRound(hash, v2);
+        hash = MergeRound(hash, v3);
+        hash = MergeRound(hash, v4);
+    } else {
+        hash = seed + kPrime5;
+    }
+    
+    hash += static_cast<uint64_t>(size);
+    
+    while (p + 8 <= end) {
+        hash ^= Round(0, Read64(p));
+        hash = RotateLeft(hash, 27) * kPrime1 + kPrime4;
+        p += 8;
+    }
+    
+    if (p + 4 <= end) {
+        hash ^= static_cast<uint64_t>(Read32(p)) * kPrime1;
+        hash = RotateLeft(hash, 23) * kPrime2 + kPrime3;
+        p += 4;
+    }
+    
+    while (p < end) {
+        hash ^= static_cast<uint64_t>(*p) * kPrime5;
+        hash = RotateLeft(hash, 11) * kPrime1;
+        ++p;
+    }
+    
+    hash ^= hash >> 33;
+    hash *= kPrime2;
+    hash ^= hash >> 29;
+    hash *= kPrime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+bool Hash::File(const std::string& filepath, uint64_t& outHash) {
+    FileView file = MappedFile::Open(filepath, FileAccessHint::Sequential);
+    if (!file.IsValid()) {
+        return false;
+    }
+    
+    outHash = Bytes(file.GetData(), file.GetSize());
+    return true;
+}
+
+std::string Hash::ToHex(uint64_t hash) {
+    static const char* digits = "0123456789abcdef";
+    std::string result(16, '0');
+    for (int i = 15; i >= 0; --i) {
+        result[i] = digits[hash & 0xF];
+        hash >>= 4;
+    }
+    return result;
+}
+
+} // namespace LGE
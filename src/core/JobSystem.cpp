@@ -0,0 +1,232 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace LGE {
+
+namespace {
+
+struct JobPool {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<JobSystem::Job> queue;
+    std::vector<std::thread> workers;
+    bool running = false;
+    
+    // Join workers if Shutdown() was never called before static destruction
+    ~JobPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+        }
+        cv.notify_all();
+        for (auto& worker : workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+    }
+};
+
+JobPool& GetPool() {
+    static JobPool pool;
+    return pool;
+}
+
+thread_local bool t_IsWorkerThread = false;
+
+void WorkerThreadFunc(uint32_t workerIndex) {
+    t_IsWorkerThread = true;
+    Profiling::SetThreadName("Worker " + std::to_string(workerIndex));
+    JobPool& pool = GetPool();
+    
+    while (true) {
+        JobSystem::Job job;
+        {
+            std::unique_lock<std::mutex> lock(pool.mutex);
+            pool.cv.wait(lock, [&pool] { return !pool.queue.empty() || !pool.running; });
+            
+            if (pool.queue.empty()) {
+                break; // Not running and nothing left to do
+            }
+            
+            job = std::move(pool.queue.front());
+            pool.queue.pop_front();
+        }
+        
+        LGE_PROFILE_SCOPE("Job");
+        job();
+    }
+}
+
+// Shared between the caller of ParallelFor and the helper jobs it queues.
+// Helpers may still be dequeued after the caller returned, so it is refcounted.
+struct ParallelForState {
+    JobSystem::RangeJob func;
+    size_t count = 0;
+    size_t grainSize = 1;
+    size_t chunkCount = 0;
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<size_t> completedChunks{0};
+    std::mutex doneMutex;
+    std::condition_variable doneCV;
+    
+    // Process chunks until none are left; returns once this thread ran out of work
+    void Drain() {
+        while (true) {
+            size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= chunkCount) {
+                return;
+            }
+            
+            size_t begin = chunk * grainSize;
+            size_t end = std::min(begin + grainSize, count);
+            {
+                LGE_PROFILE_SCOPE("ParallelFor");
+                func(begin, end);
+            }
+            
+            if (completedChunks.fetch_add(1, std::memory_order_acq_rel) + 1 == chunkCount) {
+                std::lock_guard<std::mutex> lock(doneMutex);
+                doneCV.notify_all();
+            }
+        }
+    }
+};
+
+} // namespace
+
+void JobSystem::Initialize(uint32_t numThreads) {
+    JobPool& pool = GetPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    
+    if (pool.running) {
+        return;
+    }
+    
+    if (numThreads == 0) {
+        uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        numThreads = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    }
+    
+    pool.running = true;
+    for (uint32_t i = 0; i < numThreads; ++i) {
+        pool.workers.emplace_back(WorkerThreadFunc, i);
+    }
+    
+    Log::Info("JobSystem started with " + std::to_string(numThreads) + " worker threads");
+}
+
+void JobSystem::Shutdown() {
+    JobPool& pool = GetPool();
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (!pool.running) {
+            return;
+        }
+        pool.running = false;
+        workers.swap(pool.workers);
+    }
+    pool.cv.notify_all();
+    
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void JobSystem::Submit(Job job) {
+    if (!job) {
+        return;
+    }
+    
+    Initialize();
+    
+    JobPool& pool = GetPool();
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.queue.push_back(std::move(job));
+    }
+    pool.cv.notify_one();
+}
+
+void JobSystem::ParallelFor(size_t count, size_t grainSize, const RangeJob& func) {
+    if (count == 0 || !func) {
+        return;
+    }
+    
+    grainSize = std::max<size_t>(grainSize, 1);
+    size_t chunkCount = (count + grainSize - 1) / grainSize;
+    
+    // Not worth waking anyone up for a single chunk
+    if (chunkCount == 1) {
+        func(0, count);
+        return;
+    }
+    
+    Initialize();
+    
+    auto state = std::make_shared<ParallelForState>();
+    state->func = func;
+    state->count = count;
+    state->grainSize = grainSize;
+    state->chunkCount = chunkCount;
+    
+    // The caller takes one share of the work itself
+    size_t helperCount = std::min<size_t>(GetWorkerCount(), chunkCount - 1);
+    for (size_t i = 0; i < helperCount; ++i) {
+        Submit([state]() { state->Drain(); });
+    }
+    
+    state->Drain();
+    
+    std::unique_lock<std::mutex> lock(state->doneMutex);
+    state->doneCV.wait(lock, [&state] {
+        return state->completedChunks.load(std::memory_order_acquire) == state->chunkCount;
+    });
+}
+
+uint32_t JobSystem::GetWorkerCount() {
+    JobPool& pool = GetPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return static_cast<uint32_t>(pool.workers.size());
+}
+
+bool JobSystem::IsWorkerThread() {
+    return t_IsWorkerThread;
+}
+
+} // namespace LGE
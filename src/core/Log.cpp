@@ -29,58 +29,731 @@ For more information, visit: https://nexelgames.com/luma-engine
 */
 
 #include "LGE/core/Log.h"
-#include <iostream>
-#include <iomanip>
-#include <ctime>
+#include "LGE/core/Profiling.h"
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 
 namespace LGE {
 
-std::vector<Log::LogCallback> Log::s_Callbacks;
+namespace {
 
-void Log::Print(LogLevel level, const std::string& message) {
-    auto now = std::time(nullptr);
-    auto tm = *std::localtime(&now);
+constexpr uint64_t kQueueSize = 4096;                 // Power of two
+constexpr uint64_t kWakeInterval = 512;               // Info/Trace wake the logging thread once per this many records
+constexpr int kSleepMs = 5;                           // Latency bound for messages that do not wake it
+constexpr size_t kRateLimitSlots = 256;
+constexpr uint32_t kRepeatBurst = 10;                 // Identical messages let through per window
+constexpr int64_t kRateWindowNs = 1000000000;
+constexpr size_t kSinkBufferLimit = 64 * 1024;
+constexpr uint32_t kPlainTextFormat = UINT32_MAX;
+constexpr char kBinaryMagic[8] = { 'L', 'G', 'E', 'L', 'O', 'G', '0', '1' };
+
+// One queued message. Deferred messages keep the format pointer and encoded
+// arguments; plain messages carry their text (or a heap copy when it is too long).
+struct LogRecord {
+    const char* format = nullptr;
+    std::string* longText = nullptr;
+    uint64_t ticks = 0;                   // Profiling::Now() at submit; wall time is derived on the logging thread
+    uint32_t threadId = 0;
+    uint16_t size = 0;
+    LogLevel level = LogLevel::Info;
+    char payload[LogPayload::kCapacity];
+};
+
+// Bounded MPMC cell (Vyukov): sequence == position means free for that producer,
+// position + 1 means published for the consumer
+struct alignas(64) Cell {
+    std::atomic<uint64_t> sequence{0};
+    LogRecord record;
+};
+
+struct RateSlot {
+    uint64_t hash = 0;
+    int64_t windowStart = 0;
+    uint32_t count = 0;
+    uint32_t suppressed = 0;
+    LogLevel level = LogLevel::Info;
+    std::string sample;
+};
+
+struct Logger {
+    std::unique_ptr<Cell[]> cells;
+    alignas(64) std::atomic<uint64_t> enqueuePos{0};
+    alignas(64) uint64_t dequeuePos = 0;   // Logging thread only
+    
+    std::mutex wakeMutex;
+    std::condition_variable wakeCV;
+    std::condition_variable flushedCV;
+    std::atomic<bool> sleeping{false};
+    bool stopRequested = false;            // Guarded by wakeMutex
+    bool flushRequested = false;           // Guarded by wakeMutex
+    uint64_t flushedPos = 0;               // Guarded by wakeMutex
+    
+    std::mutex startMutex;
+    std::thread thread;
+    std::atomic<bool> running{false};
+    std::atomic<bool> finalized{false};    // Static destruction started: log synchronously
+    
+    std::mutex callbackMutex;
+    std::vector<std::pair<uint32_t, Log::LogCallback>> callbacks;
+    std::atomic<bool> hasCallbacks{false};
+    uint32_t nextCallbackId = 1;
     
-    std::string levelStr;
+    std::atomic<int> minLevel{LGE_LOG_MIN_LEVEL};
+    std::atomic<bool> consoleOutput{true};
+    
+    std::mutex sinkMutex;                  // Binary file and its format table
+    std::FILE* binaryFile = nullptr;
+    std::unordered_map<const char*, uint32_t> formatIds;
+    const char* lastFormat = nullptr;      // Most recent formatIds hit; bursts tend to repeat a format
+    uint32_t lastFormatId = 0;
+    std::string binaryBuffer;
+    
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint64_t> suppressed{0};
+    std::atomic<uint64_t> overflowed{0};
+    
+    // Logging thread only
+    std::string consoleBuffer;
+    std::string line;
+    RateSlot rateSlots[kRateLimitSlots];
+    uint32_t pendingSummaries = 0;
+    int64_t cachedSecond = -1;
+    char cachedTime[16] = {};
+    uint64_t anchorTicks = 0;              // Tick/wall clock pair records are converted against
+    int64_t anchorNs = 0;
+    double nsPerTick = 1.0;
+    
+    Logger() : cells(new Cell[kQueueSize]) {
+        for (uint64_t i = 0; i < kQueueSize; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+};
+
+// Never destroyed: messages logged during static destruction still have somewhere to go
+Logger& GetLogger() {
+    static Logger* logger = new Logger();
+    return *logger;
+}
+
+// Drains the queue and joins the thread when static objects are destroyed
+struct LoggerFinalizer {
+    ~LoggerFinalizer() {
+        Log::Shutdown();
+        GetLogger().finalized.store(true, std::memory_order_release);
+    }
+} s_LoggerFinalizer;
+
+std::atomic<uint32_t> s_NextThreadId{1};
+thread_local uint32_t t_ThreadId = 0;
+thread_local bool t_IsLogThread = false;
+
+const char* GetLevelString(LogLevel level) {
     switch (level) {
-        case LogLevel::Trace: levelStr = "[TRACE]"; break;
-        case LogLevel::Info:  levelStr = "[INFO] "; break;
-        case LogLevel::Warn:  levelStr = "[WARN] "; break;
-        case LogLevel::Error: levelStr = "[ERROR]"; break;
-        case LogLevel::Fatal: levelStr = "[FATAL]"; break;
+        case LogLevel::Trace: return "[TRACE]";
+        case LogLevel::Info:  return "[INFO] ";
+        case LogLevel::Warn:  return "[WARN] ";
+        case LogLevel::Error: return "[ERROR]";
+        case LogLevel::Fatal: return "[FATAL]";
+    }
+    return "[?]    ";
+}
+
+int64_t NowNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Re-taken on every wake-up and every queue's worth of records, so tick rate
+// error never accumulates for long
+void Reanchor(Logger& logger) {
+    logger.anchorTicks = Profiling::Now();
+    logger.anchorNs = NowNanoseconds();
+}
+
+int64_t ToWallClock(const Logger& logger, uint64_t ticks) {
+    int64_t delta = static_cast<int64_t>(ticks - logger.anchorTicks);
+    return logger.anchorNs + static_cast<int64_t>(static_cast<double>(delta) * logger.nsPerTick);
+}
+
+void FormatClock(int64_t timestamp, char* out, size_t size) {
+    std::time_t seconds = static_cast<std::time_t>(timestamp / 1000000000);
+    std::tm tm{};
+#ifdef _WIN32
+    localtime_s(&tm, &seconds);
+#else
+    localtime_r(&seconds, &tm);
+#endif
+    std::strftime(out, size, "%H:%M:%S", &tm);
+}
+
+// Replaces each "{}" with the next encoded argument
+void FormatMessage(const char* format, const char* payload, size_t size, std::string& out) {
+    size_t cursor = 0;
+    char number[64];
+    for (const char* c = format; *c; ++c) {
+        if (c[0] != '{' || c[1] != '}' || cursor >= size) {
+            out += *c;
+            continue;
+        }
+        ++c;
+        
+        char tag = payload[cursor++];
+        if (tag == 's') {
+            uint16_t length = 0;
+            std::memcpy(&length, payload + cursor, sizeof(length));
+            cursor += sizeof(length);
+            out.append(payload + cursor, std::min<size_t>(length, size - cursor));
+            cursor += length;
+        } else if (tag == 'i') {
+            int64_t value = 0;
+            std::memcpy(&value, payload + cursor, sizeof(value));
+            cursor += sizeof(value);
+            std::snprintf(number, sizeof(number), "%lld", static_cast<long long>(value));
+            out += number;
+        } else if (tag == 'u') {
+            uint64_t value = 0;
+            std::memcpy(&value, payload + cursor, sizeof(value));
+            cursor += sizeof(value);
+            std::snprintf(number, sizeof(number), "%llu", static_cast<unsigned long long>(value));
+            out += number;
+        } else if (tag == 'f') {
+            double value = 0.0;
+            std::memcpy(&value, payload + cursor, sizeof(value));
+            cursor += sizeof(value);
+            std::snprintf(number, sizeof(number), "%g", value);
+            out += number;
+        } else {
+            cursor = size; // Corrupt payload; print the rest of the format verbatim
+        }
+    }
+}
+
+void FormatRecord(const LogRecord& record, std::string& out) {
+    out.clear();
+    if (record.longText) {
+        out = *record.longText;
+    } else if (record.format) {
+        FormatMessage(record.format, record.payload, record.size, out);
+    } else {
+        out.assign(record.payload, record.size);
+    }
+}
+
+template <typename T>
+void AppendBinary(std::string& buffer, const T& value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// 'F' id length text   - a format string, written the first time it is used
+// 'M' level thread timestamp formatId size bytes - a message (arguments left encoded)
+void WriteBinaryRecord(Logger& logger, LogLevel level, uint32_t threadId, int64_t timestamp,
+                       const char* format, const char* bytes, size_t size) {
+    std::lock_guard<std::mutex> lock(logger.sinkMutex);
+    if (!logger.binaryFile) {
+        return;
+    }
+    
+    uint32_t formatId = kPlainTextFormat;
+    if (format && format == logger.lastFormat) {
+        formatId = logger.lastFormatId;
+    } else if (format) {
+        auto it = logger.formatIds.find(format);
+        if (it == logger.formatIds.end()) {
+            formatId = static_cast<uint32_t>(logger.formatIds.size());
+            logger.formatIds.emplace(format, formatId);
+            uint32_t length = static_cast<uint32_t>(std::strlen(format));
+            logger.binaryBuffer += 'F';
+            AppendBinary(logger.binaryBuffer, formatId);
+            AppendBinary(logger.binaryBuffer, length);
+            logger.binaryBuffer.append(format, length);
+        } else {
+            formatId = it->second;
+        }
+        logger.lastFormat = format;
+        logger.lastFormatId = formatId;
+    }
+    
+    // Fixed part of the record packed up front so the buffer grows twice, not seven times
+    char header[2 + sizeof(threadId) + sizeof(timestamp) + sizeof(formatId) + sizeof(uint32_t)];
+    uint32_t size32 = static_cast<uint32_t>(size);
+    header[0] = 'M';
+    header[1] = static_cast<char>(level);
+    std::memcpy(header + 2, &threadId, sizeof(threadId));
+    std::memcpy(header + 6, &timestamp, sizeof(timestamp));
+    std::memcpy(header + 14, &formatId, sizeof(formatId));
+    std::memcpy(header + 18, &size32, sizeof(size32));
+    logger.binaryBuffer.append(header, sizeof(header));
+    logger.binaryBuffer.append(bytes, size);
+    
+    if (logger.binaryBuffer.size() > kSinkBufferLimit) {
+        std::fwrite(logger.binaryBuffer.data(), 1, logger.binaryBuffer.size(), logger.binaryFile);
+        logger.binaryBuffer.clear();
+    }
+}
+
+void AppendConsoleLine(Logger& logger, LogLevel level, int64_t timestamp, const std::string& text) {
+    int64_t second = timestamp / 1000000000;
+    if (second != logger.cachedSecond) {
+        logger.cachedSecond = second;
+        FormatClock(timestamp, logger.cachedTime, sizeof(logger.cachedTime));
+    }
+    logger.consoleBuffer += logger.cachedTime;
+    logger.consoleBuffer += ' ';
+    logger.consoleBuffer += GetLevelString(level);
+    logger.consoleBuffer += ' ';
+    logger.consoleBuffer += text;
+    logger.consoleBuffer += '\n';
+    
+    if (logger.consoleBuffer.size() > kSinkBufferLimit) {
+        std::fwrite(logger.consoleBuffer.data(), 1, logger.consoleBuffer.size(), stdout);
+        logger.consoleBuffer.clear();
+    }
+}
+
+void NotifyCallbacks(Logger& logger, LogLevel level, const std::string& text) {
+    std::lock_guard<std::mutex> lock(logger.callbackMutex);
+    for (const auto& entry : logger.callbacks) {
+        if (entry.second) {
+            entry.second(level, text);
+        }
+    }
+}
+
+// Sends an already formatted message to the text sinks
+void EmitText(Logger& logger, LogLevel level, int64_t timestamp, const std::string& text) {
+    if (logger.consoleOutput.load(std::memory_order_relaxed)) {
+        AppendConsoleLine(logger, level, timestamp, text);
+    }
+    if (logger.hasCallbacks.load(std::memory_order_relaxed)) {
+        NotifyCallbacks(logger, level, text);
+    }
+}
+
+void EmitSummary(Logger& logger, RateSlot& slot, int64_t timestamp) {
+    std::string text = "Suppressed " + std::to_string(slot.suppressed) + " repeats of: " + slot.sample;
+    EmitText(logger, slot.level, timestamp, text);
+    WriteBinaryRecord(logger, slot.level, 0, timestamp, nullptr, text.data(), text.size());
+    slot.suppressed = 0;
+    logger.pendingSummaries--;
+}
+
+uint64_t HashRecord(const LogRecord& record) {
+    std::string_view bytes = record.longText ? std::string_view(*record.longText) : std::string_view(record.payload, record.size);
+    uint64_t hash = std::hash<std::string_view>()(bytes);
+    hash ^= reinterpret_cast<uintptr_t>(record.format) * 0x9E3779B97F4A7C15ull;
+    return hash ^ (static_cast<uint64_t>(record.level) << 56);
+}
+
+void ProcessRecord(Logger& logger, const LogRecord& record) {
+    int64_t timestamp = ToWallClock(logger, record.ticks);
+    
+    // Rate limit identical messages (same format, arguments and level)
+    uint64_t hash = HashRecord(record);
+    RateSlot& slot = logger.rateSlots[hash % kRateLimitSlots];
+    if (slot.hash == hash && timestamp - slot.windowStart < kRateWindowNs) {
+        if (++slot.count > kRepeatBurst) {
+            if (slot.suppressed++ == 0) {
+                logger.pendingSummaries++;
+            }
+            logger.suppressed.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    } else {
+        if (slot.suppressed > 0) {
+            EmitSummary(logger, slot, timestamp);
+        }
+        slot.hash = hash;
+        slot.windowStart = timestamp;
+        slot.count = 1;
+        slot.level = record.level;
+    }
+    
+    bool needsText = logger.consoleOutput.load(std::memory_order_relaxed) ||
+                     logger.hasCallbacks.load(std::memory_order_relaxed) || slot.count == kRepeatBurst;
+    if (needsText) {
+        FormatRecord(record, logger.line);
+        if (slot.count == kRepeatBurst) {
+            slot.sample = logger.line;
+        }
+        EmitText(logger, record.level, timestamp, logger.line);
+    }
+    
+    if (record.longText) {
+        WriteBinaryRecord(logger, record.level, record.threadId, timestamp, nullptr,
+                          record.longText->data(), record.longText->size());
+    } else {
+        WriteBinaryRecord(logger, record.level, record.threadId, timestamp, record.format,
+                          record.payload, record.size);
+    }
+}
+
+// Writes buffered output and reports repeats whose window has closed
+void FlushSinks(Logger& logger) {
+    if (logger.pendingSummaries > 0) {
+        int64_t now = NowNanoseconds();
+        for (RateSlot& slot : logger.rateSlots) {
+            if (slot.suppressed > 0 && now - slot.windowStart >= kRateWindowNs) {
+                EmitSummary(logger, slot, now);
+                slot.hash = 0;
+            }
+        }
+    }
+    
+    if (!logger.consoleBuffer.empty()) {
+        std::fwrite(logger.consoleBuffer.data(), 1, logger.consoleBuffer.size(), stdout);
+        logger.consoleBuffer.clear();
+    }
+    std::fflush(stdout);
+    
+    std::lock_guard<std::mutex> lock(logger.sinkMutex);
+    if (logger.binaryFile) {
+        if (!logger.binaryBuffer.empty()) {
+            std::fwrite(logger.binaryBuffer.data(), 1, logger.binaryBuffer.size(), logger.binaryFile);
+            logger.binaryBuffer.clear();
+        }
+        std::fflush(logger.binaryFile);
+    }
+}
+
+bool HasPending(Logger& logger) {
+    const Cell& cell = logger.cells[logger.dequeuePos & (kQueueSize - 1)];
+    return cell.sequence.load(std::memory_order_acquire) == logger.dequeuePos + 1;
+}
+
+size_t Drain(Logger& logger) {
+    size_t processed = 0;
+    while (HasPending(logger)) {
+        if ((logger.dequeuePos & (kQueueSize - 1)) == 0) {
+            Reanchor(logger);
+        }
+        Cell& cell = logger.cells[logger.dequeuePos & (kQueueSize - 1)];
+        ProcessRecord(logger, cell.record);
+        delete cell.record.longText;
+        cell.record.longText = nullptr;
+        cell.sequence.store(logger.dequeuePos + kQueueSize, std::memory_order_release);
+        logger.dequeuePos++;
+        processed++;
+    }
+    return processed;
+}
+
+void LoggerThreadFunc() {
+    t_IsLogThread = true;
+    Logger& logger = GetLogger();
+    logger.nsPerTick = 1e9 / Profiling::GetTicksPerSecond();
+    Reanchor(logger);
+    
+    while (true) {
+        if (Drain(logger) > 0) {
+            continue;
+        }
+        
+        FlushSinks(logger);
+        
+        std::unique_lock<std::mutex> lock(logger.wakeMutex);
+        logger.flushRequested = false;
+        logger.flushedPos = logger.dequeuePos;
+        logger.flushedCV.notify_all();
+        if (logger.stopRequested && !HasPending(logger)) {
+            break;
+        }
+        
+        // Producers only notify while this is set; the timeout covers a missed wake-up
+        logger.sleeping.store(true, std::memory_order_seq_cst);
+        logger.wakeCV.wait_for(lock, std::chrono::milliseconds(kSleepMs), [&logger] {
+            return logger.stopRequested || logger.flushRequested || HasPending(logger);
+        });
+        logger.sleeping.store(false, std::memory_order_relaxed);
+        Reanchor(logger);
+    }
+}
+
+void EnsureStarted(Logger& logger) {
+    if (logger.running.load(std::memory_order_acquire)) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(logger.startMutex);
+    if (!logger.running.load(std::memory_order_relaxed)) {
+        {
+            std::lock_guard<std::mutex> wakeLock(logger.wakeMutex);
+            logger.stopRequested = false;
+        }
+        logger.thread = std::thread(LoggerThreadFunc);
+        logger.running.store(true, std::memory_order_release);
     }
+}
+
+// Only the first producer after the logging thread went to sleep pays for the
+// notify; on a busy core the thread can stay asleep for many more messages
+void WakeLogger(Logger& logger) {
+    if (logger.sleeping.load(std::memory_order_seq_cst) && logger.sleeping.exchange(false, std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(logger.wakeMutex);
+        logger.wakeCV.notify_one();
+    }
+}
+
+} // namespace
 
-    std::cout << std::put_time(&tm, "%H:%M:%S") << " " << levelStr << " " << message << std::endl;
+void Log::Submit(LogLevel level, const char* format, const char* payload, size_t size) {
+    Logger& logger = GetLogger();
+    uint64_t ticks = Profiling::Now();   // Cheaper than the wall clock on the caller's thread
     
-    // Notify all registered callbacks
-    for (const auto& callback : s_Callbacks) {
-        if (callback) {
-            callback(level, message);
+    // Too late for the logging thread: write straight through
+    if (logger.finalized.load(std::memory_order_acquire)) {
+        LogRecord record;
+        record.format = format;
+        record.level = level;
+        record.size = static_cast<uint16_t>(std::min(size, LogPayload::kCapacity));
+        std::memcpy(record.payload, payload, record.size);
+        std::string text;
+        FormatRecord(record, text);
+        std::fprintf(stdout, "%s %s\n", GetLevelString(level), text.c_str());
+        std::fflush(stdout);
+        return;
+    }
+    
+    EnsureStarted(logger);
+    if (t_ThreadId == 0) {
+        t_ThreadId = s_NextThreadId.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    // Claim a cell; when the queue is full, wait for the logging thread to catch up
+    uint64_t pos = logger.enqueuePos.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (!cell) {
+        Cell& candidate = logger.cells[pos & (kQueueSize - 1)];
+        uint64_t sequence = candidate.sequence.load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+        if (diff == 0) {
+            if (logger.enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell = &candidate;
+            }
+        } else if (diff < 0) {
+            if (t_IsLogThread) {
+                logger.dropped.fetch_add(1, std::memory_order_relaxed);
+                return; // A callback logging into a full queue would wait on itself
+            }
+            WakeLogger(logger);
+            std::this_thread::yield();
+            pos = logger.enqueuePos.load(std::memory_order_relaxed);
+        } else {
+            pos = logger.enqueuePos.load(std::memory_order_relaxed);
         }
     }
+    
+    LogRecord& record = cell->record;
+    record.format = format;
+    record.ticks = ticks;
+    record.threadId = t_ThreadId;
+    record.level = level;
+    if (size <= LogPayload::kCapacity) {
+        record.longText = nullptr;
+        record.size = static_cast<uint16_t>(size);
+        std::memcpy(record.payload, payload, size);
+    } else {
+        record.longText = new std::string(payload, size);
+        record.size = 0;
+        logger.overflowed.fetch_add(1, std::memory_order_relaxed);
+    }
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    
+    // Waking the logging thread for every message makes it preempt the producer
+    // and drain one record at a time; routine messages wait for its timeout or
+    // the next batch boundary instead
+    if (level >= LogLevel::Warn || (pos & (kWakeInterval - 1)) == 0) {
+        WakeLogger(logger);
+    }
 }
 
-void Log::RegisterCallback(LogCallback callback) {
-    s_Callbacks.push_back(callback);
+void Log::Print(LogLevel level, const std::string& message) {
+    if (IsEnabled(level)) {
+        Submit(level, nullptr, message.data(), message.size());
+    }
 }
 
-void Log::UnregisterCallback(LogCallback callback) {
-    // Note: std::function objects cannot be directly compared with ==
-    // This is a simplified implementation that may not work perfectly
-    // For production use, consider using callback IDs or a different mechanism
-    // For now, we'll use a workaround by comparing target addresses
-    // This may not work for all cases, especially with lambdas
-    s_Callbacks.erase(
-        std::remove_if(s_Callbacks.begin(), s_Callbacks.end(),
-            [&callback](const LogCallback& cb) {
-                // Try to compare by checking if they're the same object
-                // This is a workaround and may not work for all cases
-                return cb.target<void(LogLevel, const std::string&)>() == 
-                       callback.target<void(LogLevel, const std::string&)>();
-            }),
-        s_Callbacks.end()
+uint32_t Log::RegisterCallback(LogCallback callback) {
+    Logger& logger = GetLogger();
+    std::lock_guard<std::mutex> lock(logger.callbackMutex);
+    uint32_t id = logger.nextCallbackId++;
+    logger.callbacks.emplace_back(id, std::move(callback));
+    logger.hasCallbacks.store(true, std::memory_order_relaxed);
+    return id;
+}
+
+void Log::UnregisterCallback(uint32_t id) {
+    // Taking the lock also waits out a callback that is running right now
+    Logger& logger = GetLogger();
+    std::lock_guard<std::mutex> lock(logger.callbackMutex);
+    logger.callbacks.erase(
+        std::remove_if(logger.callbacks.begin(), logger.callbacks.end(),
+            [id](const std::pair<uint32_t, LogCallback>& entry) { return entry.first == id; }),
+        logger.callbacks.end()
     );
+    logger.hasCallbacks.store(!logger.callbacks.empty(), std::memory_order_relaxed);
+}
+
+void Log::SetLevel(LogLevel level) {
+    GetLogger().minLevel.store(std::max(static_cast<int>(level), LGE_LOG_MIN_LEVEL), std::memory_order_relaxed);
+}
+
+bool Log::IsEnabled(LogLevel level) {
+    return static_cast<int>(level) >= GetLogger().minLevel.load(std::memory_order_relaxed);
+}
+
+void Log::SetConsoleOutput(bool enabled) {
+    GetLogger().consoleOutput.store(enabled, std::memory_order_relaxed);
+}
+
+bool Log::OpenBinarySink(const std::string& filepath) {
+    CloseBinarySink();
+    
+    Logger& logger = GetLogger();
+    std::FILE* file = std::fopen(filepath.c_str(), "wb");
+    if (!file) {
+        Error("Failed to open binary log: " + filepath);
+        return false;
+    }
+    std::fwrite(kBinaryMagic, 1, sizeof(kBinaryMagic), file);
+    
+    std::lock_guard<std::mutex> lock(logger.sinkMutex);
+    logger.binaryFile = file;
+    logger.formatIds.clear();
+    logger.lastFormat = nullptr;
+    logger.binaryBuffer.clear();
+    logger.binaryBuffer.reserve(kSinkBufferLimit + LogPayload::kCapacity + sizeof(LogRecord));
+    return true;
+}
+
+void Log::CloseBinarySink() {
+    Flush();
+    
+    Logger& logger = GetLogger();
+    std::lock_guard<std::mutex> lock(logger.sinkMutex);
+    if (logger.binaryFile) {
+        std::fwrite(logger.binaryBuffer.data(), 1, logger.binaryBuffer.size(), logger.binaryFile);
+        std::fclose(logger.binaryFile);
+        logger.binaryFile = nullptr;
+        logger.binaryBuffer.clear();
+        logger.formatIds.clear();
+        logger.lastFormat = nullptr;
+    }
+}
+
+bool Log::ReadBinaryLog(const std::string& filepath, std::vector<std::string>& outLines) {
+    std::FILE* file = std::fopen(filepath.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    std::string data;
+    char chunk[64 * 1024];
+    size_t read = 0;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        data.append(chunk, read);
+    }
+    std::fclose(file);
+    
+    if (data.size() < sizeof(kBinaryMagic) || std::memcmp(data.data(), kBinaryMagic, sizeof(kBinaryMagic)) != 0) {
+        return false;
+    }
+    
+    std::unordered_map<uint32_t, std::string> formats;
+    size_t cursor = sizeof(kBinaryMagic);
+    auto readValue = [&data, &cursor](auto& value) {
+        if (cursor + sizeof(value) > data.size()) return false;
+        std::memcpy(&value, data.data() + cursor, sizeof(value));
+        cursor += sizeof(value);
+        return true;
+    };
+    
+    std::string text;
+    char clock[16];
+    while (cursor < data.size()) {
+        char tag = data[cursor++];
+        if (tag == 'F') {
+            uint32_t id = 0;
+            uint32_t length = 0;
+            if (!readValue(id) || !readValue(length) || cursor + length > data.size()) return false;
+            formats[id].assign(data.data() + cursor, length);
+            cursor += length;
+        } else if (tag == 'M') {
+            if (cursor >= data.size()) return false;
+            LogLevel level = static_cast<LogLevel>(data[cursor++]);
+            uint32_t threadId = 0;
+            int64_t timestamp = 0;
+            uint32_t formatId = 0;
+            uint32_t size = 0;
+            if (!readValue(threadId) || !readValue(timestamp) || !readValue(formatId) || !readValue(size) ||
+                cursor + size > data.size()) {
+                return false;
+            }
+            
+            text.clear();
+            if (formatId == kPlainTextFormat) {
+                text.assign(data.data() + cursor, size);
+            } else {
+                auto it = formats.find(formatId);
+                if (it == formats.end()) return false;
+                FormatMessage(it->second.c_str(), data.data() + cursor, size, text);
+            }
+            cursor += size;
+            
+            FormatClock(timestamp, clock, sizeof(clock));
+            outLines.push_back(std::string(clock) + " " + GetLevelString(level) + " " + text);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Log::Flush() {
+    Logger& logger = GetLogger();
+    if (t_IsLogThread || !logger.running.load(std::memory_order_acquire)) {
+        return;
+    }
+    
+    uint64_t target = logger.enqueuePos.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(logger.wakeMutex);
+    logger.flushRequested = true;
+    logger.wakeCV.notify_one();
+    logger.flushedCV.wait(lock, [&logger, target] { return logger.flushedPos >= target; });
+}
+
+void Log::Shutdown() {
+    Logger& logger = GetLogger();
+    std::lock_guard<std::mutex> startLock(logger.startMutex);
+    if (!logger.running.load(std::memory_order_acquire) || t_IsLogThread) {
+        return;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(logger.wakeMutex);
+        logger.stopRequested = true;
+    }
+    logger.wakeCV.notify_one();
+    logger.thread.join();
+    logger.running.store(false, std::memory_order_release);
+}
+
+LogStats Log::GetStats() {
+    Logger& logger = GetLogger();
+    LogStats stats;
+    stats.submitted = logger.enqueuePos.load(std::memory_order_relaxed);
+    stats.dropped = logger.dropped.load(std::memory_order_relaxed);
+    stats.suppressed = logger.suppressed.load(std::memory_order_relaxed);
+    stats.overflowed = logger.overflowed.load(std::memory_order_relaxed);
+    return stats;
 }
 
 void Log::Trace(const std::string& message) {
@@ -101,7 +774,7 @@ void Log::Error(const std::string& message) {
 
 void Log::Fatal(const std::string& message) {
     Print(LogLevel::Fatal, message);
+    Flush();
 }
 
 } // namespace LGE
-
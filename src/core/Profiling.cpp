@@ -0,0 +1,390 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/core/Profiling.h"
+#include "LGE/core/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace LGE {
+
+std::atomic<bool> Profiling::s_Enabled{true};
+
+namespace {
+
+constexpr uint64_t kRingMask = Profiling::kZonesPerThread - 1;
+static_assert((Profiling::kZonesPerThread & kRingMask) == 0, "Zone ring size must be a power of two");
+constexpr size_t kMaxThreadBuffers = 64;
+
+// Fields are relaxed atomics so a reader racing the owning thread is well defined;
+// on x86 these compile to plain moves
+struct ZoneSlot {
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> begin{0};
+    std::atomic<uint64_t> end{0};
+    std::atomic<uint32_t> depth{0};
+};
+
+// Seqlock-style ring: the owner bumps 'started', writes the slot, then publishes 'head'.
+// A reader copies slots and afterwards discards any that 'started' shows were reused.
+struct ThreadBuffer {
+    uint32_t index = 0;
+    std::string name;           // Guarded by the registry mutex
+    bool inUse = true;          // Guarded by the registry mutex
+    std::atomic<uint64_t> started{0};
+    std::atomic<uint64_t> head{0};
+    std::unique_ptr<ZoneSlot[]> slots{new ZoneSlot[Profiling::kZonesPerThread]};
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> threads;
+    std::unordered_set<std::string> names;   // Node-based, so c_str() stays valid
+    std::deque<uint64_t> frames;             // Start tick of each recent frame
+    
+    uint64_t calibrationTicks = Profiling::Now();
+    std::chrono::steady_clock::time_point calibrationTime = std::chrono::steady_clock::now();
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+thread_local ThreadBuffer* t_Buffer = nullptr;
+
+// Hands the buffer back for reuse once its thread exits (short-lived loader threads)
+struct ThreadBufferRelease {
+    ~ThreadBufferRelease() {
+        if (t_Buffer) {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            t_Buffer->inUse = false;
+            t_Buffer = nullptr;
+        }
+    }
+};
+
+ThreadBuffer* AcquireThreadBuffer() {
+    thread_local ThreadBufferRelease release;
+    (void)release;
+    
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    
+    // Exited threads keep their zones visible until the registry fills up
+    for (auto& buffer : registry.threads) {
+        if (registry.threads.size() >= kMaxThreadBuffers && !buffer->inUse) {
+            buffer->inUse = true;
+            buffer->name.clear();
+            buffer->started.store(0, std::memory_order_relaxed);
+            buffer->head.store(0, std::memory_order_relaxed);
+            t_Buffer = buffer.get();
+            return t_Buffer;
+        }
+    }
+    
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->index = static_cast<uint32_t>(registry.threads.size());
+    t_Buffer = buffer.get();
+    registry.threads.push_back(std::move(buffer));
+    return t_Buffer;
+}
+
+// Copies a thread's zones ending at or after minEnd, newest first.
+// Must be called with the registry mutex held so the buffer is not recycled.
+void CopyZones(const ThreadBuffer& buffer, uint64_t minEnd, std::vector<ProfileZone>& outZones) {
+    uint64_t head = buffer.head.load(std::memory_order_acquire);
+    uint64_t first = head > Profiling::kZonesPerThread ? head - Profiling::kZonesPerThread : 0;
+    size_t outStart = outZones.size();
+    
+    // Zones are recorded when they close, so end times only grow along the ring
+    for (uint64_t i = head; i > first; --i) {
+        const ZoneSlot& slot = buffer.slots[(i - 1) & kRingMask];
+        ProfileZone zone;
+        zone.name = slot.name.load(std::memory_order_relaxed);
+        zone.begin = slot.begin.load(std::memory_order_relaxed);
+        zone.end = slot.end.load(std::memory_order_relaxed);
+        zone.depth = slot.depth.load(std::memory_order_relaxed);
+        zone.threadIndex = buffer.index;
+        if (zone.end < minEnd) {
+            break;
+        }
+        outZones.push_back(zone);
+    }
+    
+    // Drop slots the owner started overwriting while we were copying
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t started = buffer.started.load(std::memory_order_relaxed);
+    uint64_t oldestValid = started > Profiling::kZonesPerThread ? started - Profiling::kZonesPerThread : 0;
+    uint64_t validCount = head > oldestValid ? head - oldestValid : 0;
+    outZones.resize(outStart + std::min<uint64_t>(validCount, outZones.size() - outStart));
+}
+
+// Only the buffer's single writer may call this (its thread, or a track's owner under the lock)
+void WriteZone(ThreadBuffer& buffer, const char* name, uint64_t begin, uint64_t end, uint32_t depth) {
+    uint64_t index = buffer.head.load(std::memory_order_relaxed);
+    buffer.started.store(index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    
+    ZoneSlot& slot = buffer.slots[index & kRingMask];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.begin.store(begin, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+    slot.depth.store(depth, std::memory_order_relaxed);
+    
+    buffer.head.store(index + 1, std::memory_order_release);
+}
+
+void AppendEscaped(std::string& out, const char* text) {
+    for (const char* c = text; *c; ++c) {
+        switch (*c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(*c));
+                    out += escaped;
+                } else {
+                    out += *c;
+                }
+                break;
+        }
+    }
+}
+
+std::string GetThreadLabel(const ThreadBuffer& buffer) {
+    return buffer.name.empty() ? "Thread " + std::to_string(buffer.index) : buffer.name;
+}
+
+} // namespace
+
+double Profiling::GetTicksPerSecond() {
+#if LGE_PROFILE_RDTSC
+    // Measured once against the steady clock over at least kCalibrationSeconds
+    // since the registry was created; only a call that early has to wait
+    static const double s_Rate = []() {
+        constexpr double kCalibrationSeconds = 0.02;
+        Registry& registry = GetRegistry();
+        double seconds = 0.0;
+        uint64_t ticks = 0;
+        uint64_t bracket = 0;
+        do {
+            // Bracket the clock read so a preempted sample is not accepted
+            ticks = Now();
+            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - registry.calibrationTime).count();
+            bracket = Now() - ticks;
+        } while (seconds < kCalibrationSeconds || bracket > 100000);
+        return (ticks + bracket / 2 - registry.calibrationTicks) / seconds;
+    }();
+    return s_Rate;
+#else
+    using Period = std::chrono::steady_clock::period;
+    return static_cast<double>(Period::den) / static_cast<double>(Period::num);
+#endif
+}
+
+void Profiling::SetThreadName(const std::string& name) {
+    ThreadBuffer* buffer = t_Buffer ? t_Buffer : AcquireThreadBuffer();
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    buffer->name = name;
+}
+
+const char* Profiling::InternName(const std::string& name) {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.names.insert(name).first->c_str();
+}
+
+void Profiling::MarkFrame() {
+    uint64_t now = Now();
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.frames.push_back(now);
+    if (registry.frames.size() > kFrameHistory) {
+        registry.frames.pop_front();
+    }
+}
+
+bool Profiling::GetFrameRange(uint32_t framesAgo, uint64_t& outBegin, uint64_t& outEnd) {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    size_t count = registry.frames.size();
+    if (count < static_cast<size_t>(framesAgo) + 2) {
+        return false;
+    }
+    outBegin = registry.frames[count - 2 - framesAgo];
+    outEnd = registry.frames[count - 1 - framesAgo];
+    return true;
+}
+
+void Profiling::CollectZones(uint64_t begin, uint64_t end, std::vector<ProfileZone>& outZones) {
+    outZones.clear();
+    {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (const auto& buffer : registry.threads) {
+            CopyZones(*buffer, begin, outZones);
+        }
+    }
+    
+    outZones.erase(std::remove_if(outZones.begin(), outZones.end(), [begin, end](const ProfileZone& zone) {
+        return zone.begin > end || zone.end < begin;
+    }), outZones.end());
+    
+    std::sort(outZones.begin(), outZones.end(), [](const ProfileZone& a, const ProfileZone& b) {
+        if (a.threadIndex != b.threadIndex) return a.threadIndex < b.threadIndex;
+        if (a.begin != b.begin) return a.begin < b.begin;
+        return a.depth < b.depth;
+    });
+}
+
+std::vector<ProfileThreadInfo> Profiling::GetThreads() {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::vector<ProfileThreadInfo> threads;
+    threads.reserve(registry.threads.size());
+    for (const auto& buffer : registry.threads) {
+        threads.push_back({buffer->index, GetThreadLabel(*buffer)});
+    }
+    return threads;
+}
+
+bool Profiling::ExportChromeTrace(const std::string& filepath) {
+    std::vector<ProfileZone> zones;
+    std::vector<ProfileThreadInfo> threads;
+    std::vector<uint64_t> frames;
+    {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (const auto& buffer : registry.threads) {
+            CopyZones(*buffer, 0, zones);
+            threads.push_back({buffer->index, GetThreadLabel(*buffer)});
+        }
+        frames.assign(registry.frames.begin(), registry.frames.end());
+    }
+    
+    uint64_t origin = UINT64_MAX;
+    for (const ProfileZone& zone : zones) {
+        origin = std::min(origin, zone.begin);
+    }
+    for (uint64_t frame : frames) {
+        origin = std::min(origin, frame);
+    }
+    if (origin == UINT64_MAX) {
+        origin = 0;
+    }
+    
+    const double toMicroseconds = 1000000.0 / GetTicksPerSecond();
+    std::string json;
+    json.reserve(zones.size() * 96 + 256);
+    json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    
+    char number[64];
+    bool first = true;
+    auto beginEvent = [&]() {
+        if (!first) json += ",\n";
+        first = false;
+    };
+    
+    for (const ProfileThreadInfo& thread : threads) {
+        beginEvent();
+        json += "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" + std::to_string(thread.index) + ",\"args\":{\"name\":\"";
+        AppendEscaped(json, thread.name.c_str());
+        json += "\"}}";
+    }
+    
+    for (uint64_t frame : frames) {
+        beginEvent();
+        std::snprintf(number, sizeof(number), "%.3f", (frame - origin) * toMicroseconds);
+        json += "{\"ph\":\"i\",\"s\":\"g\",\"name\":\"Frame\",\"pid\":1,\"tid\":0,\"ts\":";
+        json += number;
+        json += "}";
+    }
+    
+    for (const ProfileZone& zone : zones) {
+        beginEvent();
+        json += "{\"ph\":\"X\",\"cat\":\"cpu\",\"name\":\"";
+        AppendEscaped(json, zone.name ? zone.name : "?");
+        std::snprintf(number, sizeof(number), "\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                      zone.threadIndex, (zone.begin - origin) * toMicroseconds,
+                      (zone.end - zone.begin) * toMicroseconds);
+        json += number;
+    }
+    
+    json += "\n]}\n";
+    
+    std::ofstream file(filepath, std::ios::binary);
+    if (!file.is_open()) {
+        Log::Error("Profiling: Failed to write trace: " + filepath);
+        return false;
+    }
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    if (!file.good()) {
+        Log::Error("Profiling: Failed to write trace: " + filepath);
+        return false;
+    }
+    
+    Log::Info("Profiling: Exported " + std::to_string(zones.size()) + " zones to " + filepath);
+    return true;
+}
+
+void Profiling::Record(const char* name, uint64_t begin, uint64_t end, uint32_t depth) {
+    ThreadBuffer* buffer = t_Buffer ? t_Buffer : AcquireThreadBuffer();
+    WriteZone(*buffer, name, begin, end, depth);
+}
+
+uint32_t Profiling::CreateTrack(const std::string& name) {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->index = static_cast<uint32_t>(registry.threads.size());
+    buffer->name = name;
+    registry.threads.push_back(std::move(buffer));
+    return registry.threads.back()->index;
+}
+
+void Profiling::RecordTrackZones(uint32_t track, const ProfileZone* zones, size_t count) {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    if (track >= registry.threads.size()) {
+        return;
+    }
+    
+    ThreadBuffer& buffer = *registry.threads[track];
+    for (size_t i = 0; i < count; ++i) {
+        WriteZone(buffer, zones[i].name, zones[i].begin, zones[i].end, zones[i].depth);
+    }
+}
+
+} // namespace LGE
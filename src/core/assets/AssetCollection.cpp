@@ -132,7 +132,7 @@ AssetCollection AssetCollection::FromJson(const std::string& json) {
             float r, g, b, a;
             char comma;
             if (iss >> r >> comma >> g >> comma >> b >> comma >> a) {
-                collection.color = ImVec4(r, g, b, a);
+                collection.color = {r, g, b, a};
             }
         }
     }
@@ -24,18 +24,133 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/AssetDeleter.h"
 #include "LGE/core/assets/AssetRegistry.h"
 #include "LGE/core/assets/DependencyGraph.h"
+#include "LGE/core/assets/AssetReferenceIndex.h"
 #include "LGE/core/filesystem/VirtualFileSystem.h"
-#include "LGE/core/filesystem/FileSystem.h"
+#include "LGE/core/filesystem/MappedFile.h"
+#include "LGE/core/GUIDRegistry.h"
+#include "LGE/core/JobSystem.h"
 #include "LGE/core/Log.h"
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <unordered_set>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
 namespace LGE {
 
-AssetDeleter::AssetDeleter(AssetRegistry* registry, DependencyGraph* graph, VirtualFileSystem* vfs)
+namespace {
+
+constexpr char kJournalMagic[8] = { 'L', 'G', 'E', 'D', 'J', 'N', '0', '1' };
+constexpr char kTrashMagic[8] = { 'L', 'G', 'E', 'T', 'R', 'S', '0', '1' };
+constexpr long kJournalStateOffset = sizeof(kJournalMagic);
+constexpr size_t kMoveGrain = 32;   // Renames per job
+
+template <typename T>
+void AppendValue(std::string& buffer, const T& value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void AppendString(std::string& buffer, const std::string& value) {
+    AppendValue(buffer, static_cast<uint32_t>(value.size()));
+    buffer.append(value);
+}
+
+// Bounds-checked cursor over a mapped journal or manifest
+struct JournalReader {
+    const uint8_t* data;
+    size_t size;
+    size_t offset = 0;
+    
+    template <typename T>
+    bool Read(T& value) {
+        if (size - offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+    
+    bool ReadString(std::string& value) {
+        uint32_t length = 0;
+        if (!Read(length) || size - offset < length) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(data + offset), length);
+        offset += length;
+        return true;
+    }
+};
+
+// Flushes the file to disk, so the journal is durable before files move
+bool SyncFile(std::FILE* file) {
+    if (std::fflush(file) != 0) {
+        return false;
+    }
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+// Writes through a temporary file so readers never see a partial file
+bool WriteFileDurably(const std::filesystem::path& path, const std::string& data) {
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+    std::FILE* file = std::fopen(tempPath.string().c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size() && SyncFile(file);
+    ok = std::fclose(file) == 0 && ok;
+    
+    std::error_code ec;
+    if (ok) {
+        std::filesystem::rename(tempPath, path, ec);
+        ok = !ec;
+    }
+    if (!ok) {
+        std::filesystem::remove(tempPath, ec);
+    }
+    return ok;
+}
+
+std::string MetaPath(const std::string& path) {
+    return path + ".meta";
+}
+
+// Moves a file unless it already got there; never overwrites. Repeating a
+// move (forward or back) after a crash is therefore safe.
+bool MoveIfPresent(const std::string& from, const std::string& to) {
+    std::error_code ec;
+    if (std::filesystem::exists(to, ec)) {
+        return !std::filesystem::exists(from, ec);   // Done before, unless both exist
+    }
+    std::filesystem::rename(from, to, ec);
+    return !ec;
+}
+
+// An asset file and its .meta file
+bool MovePair(const std::string& from, const std::string& to, bool hasFile, bool hasMeta) {
+    return (!hasFile || MoveIfPresent(from, to)) && (!hasMeta || MoveIfPresent(MetaPath(from), MetaPath(to)));
+}
+
+} // namespace
+
+AssetDeleter::AssetDeleter(AssetRegistry* registry, DependencyGraph* graph, VirtualFileSystem* vfs,
+                           AssetReferenceIndex* referenceIndex)
     : m_Registry(registry)
     , m_Graph(graph)
     , m_VFS(vfs)
-    , m_Validator(graph, registry)
+    , m_ReferenceIndex(referenceIndex)
+    , m_GUIDRegistry(nullptr)
+    , m_Validator(graph, registry, referenceIndex)
+    , m_TrashLoaded(false)
 {
     // Default trash path
     m_TrashPath = std::filesystem::current_path() / "Trash";
@@ -64,37 +179,33 @@ AssetDeleter::DeletionResult AssetDeleter::DeleteAssets(
     
     // Collect all assets to delete (including dependents for cascade mode)
     std::vector<GUID> assetsToDelete = assets;
-    if (mode == DeletionMode::CascadeDelete) {
-        for (const auto& asset : assets) {
-            std::vector<GUID> dependents = m_Graph->GetAllDependents(asset, true);
-            assetsToDelete.insert(assetsToDelete.end(), dependents.begin(), dependents.end());
+    if (mode == DeletionMode::CascadeDelete && m_Graph) {
+        // One walk for the whole batch; shared dependents are visited once
+        std::unordered_set<GUID> visited(assets.begin(), assets.end());
+        for (size_t i = 0; i < assetsToDelete.size(); ++i) {
+            for (const auto& dependent : m_Graph->GetDependents(assetsToDelete[i])) {
+                if (visited.insert(dependent).second) {
+                    assetsToDelete.push_back(dependent);
+                }
+            }
         }
-        // Remove duplicates
-        std::sort(assetsToDelete.begin(), assetsToDelete.end());
-        assetsToDelete.erase(std::unique(assetsToDelete.begin(), assetsToDelete.end()), assetsToDelete.end());
     }
     
-    // Delete each asset
-    for (const auto& asset : assetsToDelete) {
-        if (mode == DeletionMode::BreakReferences) {
-            BreakReferences(asset);
-        }
-        
-        if (DeleteAssetFile(asset)) {
-            // Remove from registry
-            if (m_Registry) {
-                m_Registry->UnregisterAsset(asset);
-            }
-            
-            // Remove from dependency graph
-            if (m_Graph) {
-                m_Graph->RemoveDependencies(asset);
-            }
-            
-            result.deletedAssets.push_back(asset);
-        } else {
-            result.failedAssets.push_back(asset);
+    std::vector<FileMove> moves;
+    PlanBatch(BatchKind::Delete, assetsToDelete, moves, result.failedAssets);
+    if (!RunBatch(BatchKind::Delete, mode == DeletionMode::BreakReferences, moves)) {
+        for (const auto& move : moves) {
+            result.failedAssets.push_back(move.asset);
         }
+        result.errorMessage = "Failed to delete " + std::to_string(moves.size()) + " asset(s); nothing was deleted";
+        return result;
+    }
+    
+    for (const auto& move : moves) {
+        result.deletedAssets.push_back(move.asset);
+    }
+    if (!moves.empty()) {
+        Log::Info("Deleted " + std::to_string(moves.size()) + " asset(s)");
     }
     
     result.success = result.failedAssets.empty();
@@ -105,63 +216,273 @@ AssetDeleter::DeletionResult AssetDeleter::DeleteAssets(
     return result;
 }
 
-bool AssetDeleter::DeleteAssetFile(const GUID& asset) {
-    if (!m_Registry || !m_VFS) {
+void AssetDeleter::PlanBatch(BatchKind kind, const std::vector<GUID>& assets, std::vector<FileMove>& outMoves, std::vector<GUID>& outFailed) {
+    if (kind == BatchKind::Restore) {
+        LoadTrashManifest();
+    }
+    
+    std::unordered_set<GUID> planned;
+    planned.reserve(assets.size());
+    outMoves.reserve(assets.size());
+    for (const auto& asset : assets) {
+        if (!planned.insert(asset).second) {
+            continue;
+        }
+        
+        FileMove move;
+        move.asset = asset;
+        if (kind == BatchKind::Restore) {
+            auto it = m_TrashEntries.find(asset);
+            if (it == m_TrashEntries.end()) {
+                Log::Warn("Asset is not in the trash: " + asset.ToString());
+                outFailed.push_back(asset);
+                continue;
+            }
+            move.source = it->second.trashFile;
+            move.destination = it->second.originalFile;
+            move.metadataJson = it->second.metadataJson;
+        } else {
+            const AssetMetadata* metadata = m_Registry ? m_Registry->GetAsset(asset) : nullptr;
+            if (!metadata || !m_VFS) {
+                Log::Warn("Asset not found for deletion: " + asset.ToString());
+                outFailed.push_back(asset);
+                continue;
+            }
+            m_VFS->ResolveVirtualPath(metadata->virtualPath, move.source);
+            if (kind == BatchKind::Trash) {
+                move.metadataJson = metadata->ToJson();
+            }
+        }
+        outMoves.push_back(std::move(move));
+    }
+    if (outMoves.empty()) {
+        return;
+    }
+    
+    // One stat per file; run them on the pool
+    JobSystem::ParallelFor(outMoves.size(), kMoveGrain, [&](size_t begin, size_t end) {
+        std::error_code ec;
+        for (size_t i = begin; i < end; ++i) {
+            FileMove& move = outMoves[i];
+            move.hasFile = std::filesystem::exists(move.source, ec);
+            move.hasMeta = std::filesystem::exists(MetaPath(move.source), ec);
+        }
+    });
+    
+    std::error_code ec;
+    if (kind == BatchKind::Delete) {
+        // Staged under the GUID, which is unique, until the batch commits
+        std::filesystem::path stagingPath = m_TrashPath / ".staged";
+        std::filesystem::create_directories(stagingPath, ec);
+        for (auto& move : outMoves) {
+            move.destination = (stagingPath / (move.asset.ToString() + std::filesystem::path(move.source).extension().string())).string();
+        }
+    } else if (kind == BatchKind::Trash) {
+        // Names are made unique against one listing of the trash folder
+        std::filesystem::create_directories(m_TrashPath, ec);
+        std::unordered_set<std::string> taken;
+        for (const auto& entry : std::filesystem::directory_iterator(m_TrashPath, ec)) {
+            taken.insert(entry.path().filename().string());
+        }
+        for (auto& move : outMoves) {
+            std::filesystem::path sourcePath(move.source);
+            std::string name = sourcePath.filename().string();
+            int counter = 1;
+            while (taken.count(name) || taken.count(MetaPath(name))) {
+                name = sourcePath.stem().string() + "_" + std::to_string(counter) + sourcePath.extension().string();
+                counter++;
+            }
+            taken.insert(name);
+            move.destination = (m_TrashPath / name).string();
+        }
+    } else {
+        std::unordered_set<std::string> folders;
+        for (const auto& move : outMoves) {
+            folders.insert(std::filesystem::path(move.destination).parent_path().string());
+        }
+        for (const auto& folder : folders) {
+            std::filesystem::create_directories(folder, ec);
+        }
+    }
+}
+
+bool AssetDeleter::RunBatch(BatchKind kind, bool breakReferences, const std::vector<FileMove>& moves) {
+    if (moves.empty()) {
+        return true;
+    }
+    
+    if (!WriteJournal(kind, breakReferences, moves)) {
+        Log::Error("Failed to write deletion journal: " + GetJournalPath().string());
         return false;
     }
     
-    const AssetMetadata* metadata = m_Registry->GetAsset(asset);
-    if (!metadata) {
-        Log::Warn("Asset not found for deletion: " + asset.ToString());
+    std::error_code ec;
+    if (!ExecuteMoves(moves)) {
+        std::filesystem::remove(GetJournalPath(), ec);
         return false;
     }
     
-    std::filesystem::path filePath = m_VFS->ResolveVirtualPath(metadata->virtualPath);
+    ApplyBatch(kind, breakReferences, moves);
     
-    try {
-        if (std::filesystem::exists(filePath)) {
-            std::filesystem::remove(filePath);
-            
-            // Also delete .meta file if it exists
-            std::filesystem::path metaPath = filePath.string() + ".meta";
-            if (std::filesystem::exists(metaPath)) {
-                std::filesystem::remove(metaPath);
+    // From here on a crash replays the batch instead of rolling it back
+    if (!SetJournalState(BatchState::Committed)) {
+        Log::Warn("Failed to mark deletion journal as committed: " + GetJournalPath().string());
+    }
+    FinishBatch(kind, moves);
+    std::filesystem::remove(GetJournalPath(), ec);
+    return true;
+}
+
+bool AssetDeleter::ExecuteMoves(const std::vector<FileMove>& moves) {
+    std::vector<uint8_t> failed(moves.size(), 0);
+    JobSystem::ParallelFor(moves.size(), kMoveGrain, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const FileMove& move = moves[i];
+            failed[i] = MovePair(move.source, move.destination, move.hasFile, move.hasMeta) ? 0 : 1;
+        }
+    });
+    
+    size_t failedCount = 0;
+    for (size_t i = 0; i < moves.size(); ++i) {
+        if (failed[i]) {
+            if (failedCount == 0) {
+                Log::Error("Failed to move asset file: " + moves[i].source + " -> " + moves[i].destination);
             }
-            
-            Log::Info("Deleted asset file: " + metadata->virtualPath);
-            return true;
-        } else {
-            Log::Warn("Asset file does not exist: " + metadata->virtualPath);
-            return true; // Consider it successful if file doesn't exist
+            ++failedCount;
         }
-    } catch (const std::exception& e) {
-        Log::Error("Failed to delete asset file: " + std::string(e.what()));
-        return false;
     }
+    if (failedCount == 0) {
+        return true;
+    }
+    
+    Log::Error("Rolling back batch of " + std::to_string(moves.size()) + " asset(s) after " +
+               std::to_string(failedCount) + " failed move(s)");
+    JobSystem::ParallelFor(moves.size(), kMoveGrain, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            MovePair(moves[i].destination, moves[i].source, moves[i].hasFile, moves[i].hasMeta);
+        }
+    });
+    return false;
+}
+
+void AssetDeleter::ApplyBatch(BatchKind kind, bool breakReferences, const std::vector<FileMove>& moves) {
+    if (kind == BatchKind::Restore) {
+        // Edges from other assets to the restored ones, and property paths,
+        // come back with the next dependency scan
+        LoadTrashManifest();
+        for (const auto& move : moves) {
+            AssetMetadata metadata = AssetMetadata::FromJson(move.metadataJson);
+            m_TrashEntries.erase(move.asset);
+            if (!metadata.guid.IsValid()) {
+                continue;
+            }
+            if (m_Registry) {
+                m_Registry->RegisterAsset(metadata);
+            }
+            if (m_Graph) {
+                m_Graph->SetDependencies(metadata.guid, metadata.dependencies);
+            }
+            if (m_ReferenceIndex) {
+                std::vector<AssetPropertyReference> references;
+                for (const auto& dependency : metadata.dependencies) {
+                    references.push_back({ dependency, std::string() });
+                }
+                m_ReferenceIndex->SetReferences(metadata.guid, references);
+            }
+            if (m_GUIDRegistry) {
+                m_GUIDRegistry->RegisterAsset(metadata.guid, metadata.virtualPath);
+            }
+        }
+        return;
+    }
+    
+    std::vector<GUID> assets;
+    assets.reserve(moves.size());
+    for (const auto& move : moves) {
+        assets.push_back(move.asset);
+    }
+    
+    if (kind == BatchKind::Trash) {
+        LoadTrashManifest();
+        for (const auto& move : moves) {
+            m_TrashEntries[move.asset] = { move.source, move.destination, move.metadataJson };
+        }
+    }
+    
+    if (breakReferences) {
+        BreakReferences(assets);
+    }
+    if (m_Registry) {
+        m_Registry->UnregisterAssets(assets);
+    }
+    for (const auto& asset : assets) {
+        if (m_Graph) {
+            m_Graph->RemoveDependencies(asset);
+        }
+        if (m_ReferenceIndex) {
+            m_ReferenceIndex->RemoveAsset(asset);
+        }
+        if (m_GUIDRegistry) {
+            m_GUIDRegistry->RemoveAsset(asset);
+        }
+    }
+}
+
+void AssetDeleter::FinishBatch(BatchKind kind, const std::vector<FileMove>& moves) {
+    if (kind != BatchKind::Delete) {
+        SaveTrashManifest();
+        return;
+    }
+    
+    JobSystem::ParallelFor(moves.size(), kMoveGrain, [&](size_t begin, size_t end) {
+        std::error_code ec;
+        for (size_t i = begin; i < end; ++i) {
+            std::filesystem::remove(moves[i].destination, ec);
+            std::filesystem::remove(MetaPath(moves[i].destination), ec);
+        }
+    });
 }
 
-void AssetDeleter::BreakReferences(const GUID& asset) {
+void AssetDeleter::BreakReferences(const std::vector<GUID>& assets) {
     if (!m_Graph) {
         return;
     }
     
-    // Get all assets that depend on this one
-    std::vector<GUID> dependents = m_Graph->GetDependents(asset);
+    // References between assets of the batch go away with the assets; each
+    // remaining dependent is rewritten once however many of its targets go
+    std::unordered_set<GUID> deleted(assets.begin(), assets.end());
+    std::unordered_set<GUID> touched;
+    std::vector<GUID> dependents;
+    for (const auto& asset : assets) {
+        for (const auto& dependent : m_Graph->GetDependents(asset)) {
+            if (deleted.count(dependent)) {
+                continue;
+            }
+            
+            // Remove the dependency relationship
+            m_Graph->RemoveDependency(dependent, asset);
+            if (m_ReferenceIndex) {
+                m_ReferenceIndex->RemoveReference(dependent, asset);
+            }
+            if (touched.insert(dependent).second) {
+                dependents.push_back(dependent);
+            }
+        }
+    }
     
+    // Update metadata to remove the dependencies
+    if (!m_Registry) {
+        return;
+    }
     for (const auto& dependent : dependents) {
-        // Remove the dependency relationship
-        m_Graph->RemoveDependency(dependent, asset);
-        
-        // Update metadata to remove the dependency
-        if (m_Registry) {
-            AssetMetadata* metadata = m_Registry->GetAsset(dependent);
-            if (metadata) {
-                metadata->dependencies.erase(
-                    std::remove(metadata->dependencies.begin(), metadata->dependencies.end(), asset),
-                    metadata->dependencies.end()
-                );
-                m_Registry->UpdateAsset(dependent, *metadata);
-            }
+        AssetMetadata* metadata = m_Registry->GetAsset(dependent);
+        if (metadata) {
+            metadata->dependencies.erase(
+                std::remove_if(metadata->dependencies.begin(), metadata->dependencies.end(),
+                               [&](const GUID& dependency) { return deleted.count(dependency) != 0; }),
+                metadata->dependencies.end()
+            );
+            m_Registry->UpdateAsset(dependent, *metadata);
         }
     }
 }
@@ -172,89 +493,235 @@ bool AssetDeleter::MoveToTrash(const std::vector<GUID>& assets) {
         return false;
     }
     
-    // Create trash directory if it doesn't exist
-    if (!std::filesystem::exists(m_TrashPath)) {
-        std::filesystem::create_directories(m_TrashPath);
+    std::vector<FileMove> moves;
+    std::vector<GUID> failed;
+    PlanBatch(BatchKind::Trash, assets, moves, failed);
+    if (!RunBatch(BatchKind::Trash, false, moves)) {
+        return false;
     }
     
-    bool allSuccess = true;
-    for (const auto& asset : assets) {
-        if (!MoveAssetToTrash(asset)) {
-            allSuccess = false;
-        }
+    if (!moves.empty()) {
+        Log::Info("Moved " + std::to_string(moves.size()) + " asset(s) to trash");
     }
-    
-    return allSuccess;
+    return failed.empty();
 }
 
-bool AssetDeleter::MoveAssetToTrash(const GUID& asset) {
-    if (!m_Registry || !m_VFS) {
+bool AssetDeleter::RestoreFromTrash(const std::vector<GUID>& assets) {
+    std::vector<FileMove> moves;
+    std::vector<GUID> failed;
+    PlanBatch(BatchKind::Restore, assets, moves, failed);
+    if (!RunBatch(BatchKind::Restore, false, moves)) {
         return false;
     }
     
-    const AssetMetadata* metadata = m_Registry->GetAsset(asset);
-    if (!metadata) {
-        return false;
+    if (!moves.empty()) {
+        Log::Info("Restored " + std::to_string(moves.size()) + " asset(s) from trash");
+    }
+    return failed.empty();
+}
+
+std::vector<GUID> AssetDeleter::GetTrashedAssets() {
+    LoadTrashManifest();
+    std::vector<GUID> assets;
+    assets.reserve(m_TrashEntries.size());
+    for (const auto& [asset, entry] : m_TrashEntries) {
+        assets.push_back(asset);
     }
+    return assets;
+}
+
+bool AssetDeleter::PermanentlyDelete(const std::vector<GUID>& assets) {
+    LoadTrashManifest();
     
-    std::filesystem::path sourcePath = m_VFS->ResolveVirtualPath(metadata->virtualPath);
+    std::vector<std::string> trashFiles;
+    std::vector<GUID> registered;
+    for (const auto& asset : assets) {
+        auto it = m_TrashEntries.find(asset);
+        if (it == m_TrashEntries.end()) {
+            registered.push_back(asset);
+            continue;
+        }
+        trashFiles.push_back(it->second.trashFile);
+        m_TrashEntries.erase(it);
+    }
     
-    if (!std::filesystem::exists(sourcePath)) {
-        Log::Warn("Asset file does not exist: " + metadata->virtualPath);
-        return true; // Consider it successful
+    bool success = true;
+    if (!trashFiles.empty()) {
+        // The manifest goes first; a crash in between only leaves unlisted files in the trash
+        if (!SaveTrashManifest()) {
+            return false;
+        }
+        JobSystem::ParallelFor(trashFiles.size(), kMoveGrain, [&](size_t begin, size_t end) {
+            std::error_code ec;
+            for (size_t i = begin; i < end; ++i) {
+                std::filesystem::remove(trashFiles[i], ec);
+                std::filesystem::remove(MetaPath(trashFiles[i]), ec);
+            }
+        });
     }
     
-    try {
-        std::filesystem::path destPath = m_TrashPath / sourcePath.filename();
-        
-        // Handle name conflicts
-        int counter = 1;
-        while (std::filesystem::exists(destPath)) {
-            std::string stem = sourcePath.stem().string();
-            std::string ext = sourcePath.extension().string();
-            destPath = m_TrashPath / (stem + "_" + std::to_string(counter) + ext);
-            counter++;
+    // Assets that were never trashed are deleted directly
+    if (!registered.empty()) {
+        success = DeleteAssets(registered, DeletionMode::SafeOnly).success;
+    }
+    return success;
+}
+
+bool AssetDeleter::RecoverJournal() {
+    std::filesystem::path journalPath = GetJournalPath();
+    std::error_code ec;
+    if (!std::filesystem::exists(journalPath, ec)) {
+        return true;
+    }
+    
+    uint8_t state = 0;
+    uint8_t kind = 0;
+    uint8_t breakReferences = 0;
+    std::vector<FileMove> moves;
+    bool ok = true;
+    {
+        FileView file = MappedFile::Open(journalPath.string(), FileAccessHint::Sequential);
+        JournalReader reader{ file.GetData(), file.GetSize() };
+        char magic[sizeof(kJournalMagic)];
+        uint32_t count = 0;
+        ok = file.IsValid() && reader.Read(magic) && std::memcmp(magic, kJournalMagic, sizeof(magic)) == 0;
+        ok = ok && reader.Read(state) && reader.Read(kind) && reader.Read(breakReferences) && reader.Read(count);
+        ok = ok && (state == static_cast<uint8_t>(BatchState::Prepared) || state == static_cast<uint8_t>(BatchState::Committed));
+        ok = ok && kind >= static_cast<uint8_t>(BatchKind::Delete) && kind <= static_cast<uint8_t>(BatchKind::Restore);
+        // Each entry takes at least 30 bytes; reject counts the file cannot hold
+        ok = ok && count <= (reader.size - reader.offset) / 30;
+        if (ok) {
+            moves.resize(count);
         }
-        
-        std::filesystem::rename(sourcePath, destPath);
-        
-        // Also move .meta file if it exists
-        std::filesystem::path metaSource = sourcePath.string() + ".meta";
-        if (std::filesystem::exists(metaSource)) {
-            std::filesystem::path metaDest = destPath.string() + ".meta";
-            std::filesystem::rename(metaSource, metaDest);
+        for (uint32_t i = 0; ok && i < count; ++i) {
+            FileMove& move = moves[i];
+            uint64_t high = 0;
+            uint64_t low = 0;
+            uint8_t hasFile = 0;
+            uint8_t hasMeta = 0;
+            ok = reader.Read(high) && reader.Read(low) && reader.Read(hasFile) && reader.Read(hasMeta)
+                && reader.ReadString(move.source) && reader.ReadString(move.destination) && reader.ReadString(move.metadataJson);
+            move.asset = GUID(high, low);
+            move.hasFile = hasFile != 0;
+            move.hasMeta = hasMeta != 0;
         }
-        
-        Log::Info("Moved asset to trash: " + metadata->virtualPath);
-        return true;
-    } catch (const std::exception& e) {
-        Log::Error("Failed to move asset to trash: " + std::string(e.what()));
+    }
+    if (!ok) {
+        // Left in place so the files it names can be sorted out by hand
+        Log::Error("Deletion journal is unreadable: " + journalPath.string());
         return false;
     }
+    
+    BatchKind batchKind = static_cast<BatchKind>(kind);
+    if (state == static_cast<uint8_t>(BatchState::Committed)) {
+        // Indices may have been saved either way; the replay is idempotent
+        JobSystem::ParallelFor(moves.size(), kMoveGrain, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                MovePair(moves[i].source, moves[i].destination, moves[i].hasFile, moves[i].hasMeta);
+            }
+        });
+        ApplyBatch(batchKind, breakReferences != 0, moves);
+        FinishBatch(batchKind, moves);
+        Log::Info("Replayed interrupted batch of " + std::to_string(moves.size()) + " asset(s)");
+    } else {
+        JobSystem::ParallelFor(moves.size(), kMoveGrain, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                MovePair(moves[i].destination, moves[i].source, moves[i].hasFile, moves[i].hasMeta);
+            }
+        });
+        Log::Info("Rolled back interrupted batch of " + std::to_string(moves.size()) + " asset(s)");
+    }
+    
+    std::filesystem::remove(journalPath, ec);
+    return true;
 }
 
-bool AssetDeleter::RestoreFromTrash(const std::vector<GUID>& assets) {
-    bool allSuccess = true;
-    for (const auto& asset : assets) {
-        if (!RestoreAssetFromTrash(asset)) {
-            allSuccess = false;
-        }
+bool AssetDeleter::WriteJournal(BatchKind kind, bool breakReferences, const std::vector<FileMove>& moves) {
+    std::error_code ec;
+    std::filesystem::create_directories(m_TrashPath, ec);
+    
+    std::string buffer;
+    buffer.append(kJournalMagic, sizeof(kJournalMagic));
+    AppendValue(buffer, static_cast<uint8_t>(BatchState::Prepared));   // At kJournalStateOffset
+    AppendValue(buffer, static_cast<uint8_t>(kind));
+    AppendValue(buffer, static_cast<uint8_t>(breakReferences ? 1 : 0));
+    AppendValue(buffer, static_cast<uint32_t>(moves.size()));
+    for (const auto& move : moves) {
+        AppendValue(buffer, move.asset.GetHigh());
+        AppendValue(buffer, move.asset.GetLow());
+        AppendValue(buffer, static_cast<uint8_t>(move.hasFile ? 1 : 0));
+        AppendValue(buffer, static_cast<uint8_t>(move.hasMeta ? 1 : 0));
+        AppendString(buffer, move.source);
+        AppendString(buffer, move.destination);
+        AppendString(buffer, move.metadataJson);
     }
-    return allSuccess;
+    return WriteFileDurably(GetJournalPath(), buffer);
 }
 
-bool AssetDeleter::RestoreAssetFromTrash(const GUID& asset) {
-    // This would require tracking where assets were moved from
-    // For now, this is a placeholder
-    Log::Warn("Restore from trash not fully implemented");
-    return false;
+bool AssetDeleter::SetJournalState(BatchState state) {
+    std::FILE* file = std::fopen(GetJournalPath().string().c_str(), "r+b");
+    if (!file) {
+        return false;
+    }
+    bool ok = std::fseek(file, kJournalStateOffset, SEEK_SET) == 0
+        && std::fputc(static_cast<int>(state), file) != EOF
+        && SyncFile(file);
+    return std::fclose(file) == 0 && ok;
 }
 
-bool AssetDeleter::PermanentlyDelete(const std::vector<GUID>& assets) {
-    // Delete assets from trash directory
-    // This is similar to DeleteAssets but operates on trash directory
-    return DeleteAssets(assets, DeletionMode::SafeOnly).success;
+void AssetDeleter::LoadTrashManifest() {
+    if (m_TrashLoaded) {
+        return;
+    }
+    m_TrashLoaded = true;
+    m_TrashEntries.clear();
+    
+    std::filesystem::path path = m_TrashPath / "trash_manifest.bin";
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec)) {
+        return;
+    }
+    
+    FileView file = MappedFile::Open(path.string(), FileAccessHint::Sequential);
+    JournalReader reader{ file.GetData(), file.GetSize() };
+    char magic[sizeof(kTrashMagic)];
+    uint32_t count = 0;
+    bool ok = file.IsValid() && reader.Read(magic) && std::memcmp(magic, kTrashMagic, sizeof(magic)) == 0 && reader.Read(count);
+    for (uint32_t i = 0; ok && i < count; ++i) {
+        uint64_t high = 0;
+        uint64_t low = 0;
+        TrashEntry entry;
+        ok = reader.Read(high) && reader.Read(low) && reader.ReadString(entry.originalFile)
+            && reader.ReadString(entry.trashFile) && reader.ReadString(entry.metadataJson);
+        if (ok) {
+            m_TrashEntries[GUID(high, low)] = std::move(entry);
+        }
+    }
+    if (!ok) {
+        Log::Warn("Trash manifest is truncated: " + path.string());
+        m_TrashEntries.clear();
+    }
 }
 
-} // namespace LGE
+bool AssetDeleter::SaveTrashManifest() {
+    std::string buffer;
+    buffer.append(kTrashMagic, sizeof(kTrashMagic));
+    AppendValue(buffer, static_cast<uint32_t>(m_TrashEntries.size()));
+    for (const auto& [asset, entry] : m_TrashEntries) {
+        AppendValue(buffer, asset.GetHigh());
+        AppendValue(buffer, asset.GetLow());
+        AppendString(buffer, entry.originalFile);
+        AppendString(buffer, entry.trashFile);
+        AppendString(buffer, entry.metadataJson);
+    }
+    
+    std::error_code ec;
+    std::filesystem::create_directories(m_TrashPath, ec);
+    if (!WriteFileDurably(m_TrashPath / "trash_manifest.bin", buffer)) {
+        Log::Error("Failed to save trash manifest: " + m_TrashPath.string());
+        return false;
+    }
+    return true;
+}
 
+} // namespace LGE
@@ -24,13 +24,15 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/AssetDeletionValidator.h"
 #include "LGE/core/assets/DependencyGraph.h"
 #include "LGE/core/assets/AssetRegistry.h"
+#include "LGE/core/assets/AssetReferenceIndex.h"
 #include "LGE/core/Log.h"
 
 namespace LGE {
 
-AssetDeletionValidator::AssetDeletionValidator(DependencyGraph* graph, AssetRegistry* registry)
+AssetDeletionValidator::AssetDeletionValidator(DependencyGraph* graph, AssetRegistry* registry, AssetReferenceIndex* referenceIndex)
     : m_Graph(graph)
     , m_Registry(registry)
+    , m_ReferenceIndex(referenceIndex)
 {
 }
 
@@ -38,6 +40,10 @@ AssetDeletionValidator::DeletionInfo AssetDeletionValidator::ValidateSingleAsset
     DeletionInfo info;
     info.asset = asset;
     
+    if (m_ReferenceIndex) {
+        return ValidateDeletion({ asset }).front();
+    }
+    
     if (!m_Graph) {
         info.canSafelyDelete = true;
         info.reason = "No dependency graph available";
@@ -62,8 +68,28 @@ AssetDeletionValidator::DeletionInfo AssetDeletionValidator::ValidateSingleAsset
 std::vector<AssetDeletionValidator::DeletionInfo> AssetDeletionValidator::ValidateDeletion(const std::vector<GUID>& assets) {
     std::vector<DeletionInfo> results;
     
-    for (const auto& asset : assets) {
-        results.push_back(ValidateSingleAsset(asset));
+    if (!m_ReferenceIndex) {
+        for (const auto& asset : assets) {
+            results.push_back(ValidateSingleAsset(asset));
+        }
+        return results;
+    }
+    
+    std::vector<std::vector<GUID>> blockers;
+    m_ReferenceIndex->FindReferencers(assets, &blockers);
+    
+    results.resize(assets.size());
+    for (size_t i = 0; i < assets.size(); ++i) {
+        DeletionInfo& info = results[i];
+        info.asset = assets[i];
+        if (blockers[i].empty()) {
+            info.canSafelyDelete = true;
+            info.reason = "No assets outside the selection depend on this asset";
+        } else {
+            info.canSafelyDelete = false;
+            info.reason = "Asset is referenced by " + std::to_string(blockers[i].size()) + " other asset(s)";
+            info.blockingDependents = std::move(blockers[i]);
+        }
     }
     
     return results;
@@ -53,6 +53,13 @@ void AssetHotReloader::Enable(const std::filesystem::path& assetsDirectory) {
     }
     
     m_Watcher->SetCallback([this](const FileChangeEvent& event) {
+        // Layer resolution changes immediately; reloads wait for the debouncer
+        if (m_VFS && event.type != FileChangeType::Modified) {
+            m_VFS->InvalidatePhysicalPath(event.path);
+            if (!event.oldPath.empty()) {
+                m_VFS->InvalidatePhysicalPath(event.oldPath);
+            }
+        }
         m_Debouncer->AddEvent(event);
     });
     
@@ -148,13 +155,9 @@ void AssetHotReloader::ReloadAsset(const GUID& guid) {
     }
     
     // Update file metadata
-    std::filesystem::path physicalPath = m_VFS ? m_VFS->ResolveVirtualPath(asset->virtualPath) : asset->virtualPath;
+    std::filesystem::path physicalPath = m_VFS ? m_VFS->ResolveVirtualPath(asset->virtualPath) : std::filesystem::path(asset->virtualPath);
     if (std::filesystem::exists(physicalPath)) {
-        auto lastWriteTime = std::filesystem::last_write_time(physicalPath);
-        auto sctp = std::chrono::time_point_cast<std::chrono::system_clock::duration>(
-            lastWriteTime - std::filesystem::file_time_type::clock::now() + std::chrono::system_clock::now());
-        auto timeT = std::chrono::system_clock::to_time_t(sctp);
-        asset->lastModified = timeT;
+        asset->lastModified = AssetMetadata::ToFileStamp(std::filesystem::last_write_time(physicalPath));
         asset->fileSize = std::filesystem::file_size(physicalPath);
         m_Registry->UpdateAsset(guid, *asset);
     }
@@ -24,6 +24,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/AssetLoader.h"
 #include "LGE/core/assets/AssetRegistry.h"
 #include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
 #include <algorithm>
 
 namespace LGE {
@@ -89,6 +90,7 @@ void AssetLoader::OnAssetReleased(const GUID& guid) {
 }
 
 std::shared_ptr<void> AssetLoader::LoadGeneric(const GUID& guid, AssetType type) {
+    LGE_PROFILE_SCOPE("AssetLoader::LoadGeneric");
     auto it = m_LoadedAssets.find(guid);
     if (it != m_LoadedAssets.end()) {
         m_ReferenceCount[guid]++;
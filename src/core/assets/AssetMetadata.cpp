@@ -24,6 +24,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/AssetMetadata.h"
 #include <sstream>
 #include <algorithm>
+#include <chrono>
 #include <ctime>
 
 namespace LGE {
@@ -154,9 +155,10 @@ AssetMetadata AssetMetadata::FromJson(const std::string& json) {
     size_t modPos = json.find("\"lastModified\"");
     if (modPos != std::string::npos) {
         size_t colonPos = json.find(':', modPos);
-        size_t numStart = json.find_first_of("0123456789", colonPos);
+        // Signed: file clocks whose epoch is after 1970 (libstdc++) give negative seconds
+        size_t numStart = json.find_first_of("-0123456789", colonPos);
         if (numStart != std::string::npos) {
-            size_t numEnd = json.find_first_not_of("0123456789", numStart);
+            size_t numEnd = json.find_first_not_of("0123456789", numStart + 1);
             if (numEnd == std::string::npos) numEnd = json.length();
             metadata.lastModified = std::stoll(json.substr(numStart, numEnd - numStart));
         }
@@ -282,6 +284,11 @@ AssetType AssetMetadata::GetTypeFromName(const std::string& typeName) {
     return AssetType::Unknown;
 }
 
+std::time_t AssetMetadata::ToFileStamp(std::filesystem::file_time_type time) {
+    return static_cast<std::time_t>(std::chrono::duration_cast<std::chrono::seconds>(
+        time.time_since_epoch()).count());
+}
+
 } // namespace LGE
 
 
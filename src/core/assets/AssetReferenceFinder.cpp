@@ -24,21 +24,57 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/AssetReferenceFinder.h"
 #include "LGE/core/assets/AssetRegistry.h"
 #include "LGE/core/assets/DependencyGraph.h"
+#include "LGE/core/assets/AssetReferenceIndex.h"
 #include "LGE/core/Log.h"
 #include <algorithm>
 
 namespace LGE {
 
-AssetReferenceFinder::AssetReferenceFinder(AssetRegistry* registry, DependencyGraph* graph)
+AssetReferenceFinder::AssetReferenceFinder(AssetRegistry* registry, DependencyGraph* graph, AssetReferenceIndex* referenceIndex)
     : m_Registry(registry)
     , m_Graph(graph)
+    , m_ReferenceIndex(referenceIndex)
 {
 }
 
+AssetReference AssetReferenceFinder::MakeReference(const AssetMetadata& referencing, const std::string& propertyPath) const {
+    AssetReference ref;
+    ref.referencingAsset = referencing.guid;
+    ref.assetType = referencing.type;
+    ref.assetName = referencing.name;
+    ref.assetPath = referencing.virtualPath;
+    ref.propertyPath = propertyPath;
+    ref.referenceType = AssetReference::ReferenceType::Direct;
+    
+    // Determine reference type based on asset type
+    if (referencing.type == AssetType::Scene) {
+        ref.referenceType = AssetReference::ReferenceType::Scene;
+    } else if (referencing.type == AssetType::Script) {
+        ref.referenceType = AssetReference::ReferenceType::Code;
+    }
+    return ref;
+}
+
 std::vector<AssetReference> AssetReferenceFinder::FindReferences(const GUID& asset) {
     std::vector<AssetReference> references;
     
-    if (!m_Graph || !m_Registry) {
+    if (!m_Registry) {
+        return references;
+    }
+    
+    if (m_ReferenceIndex) {
+        std::vector<AssetReferenceIndex::Reference> indexed;
+        m_ReferenceIndex->GetReferences(asset, indexed);
+        for (const auto& entry : indexed) {
+            const AssetMetadata* metadata = m_Registry->GetAsset(entry.asset);
+            if (metadata) {
+                references.push_back(MakeReference(*metadata, std::string(PathTable::Get().GetString(entry.property))));
+            }
+        }
+        return references;
+    }
+    
+    if (!m_Graph) {
         return references;
     }
     
@@ -47,25 +83,9 @@ std::vector<AssetReference> AssetReferenceFinder::FindReferences(const GUID& ass
     
     for (const auto& dependentGuid : dependents) {
         const AssetMetadata* metadata = m_Registry->GetAsset(dependentGuid);
-        if (!metadata) {
-            continue;
+        if (metadata) {
+            references.push_back(MakeReference(*metadata, std::string()));
         }
-        
-        AssetReference ref;
-        ref.referencingAsset = dependentGuid;
-        ref.assetType = metadata->type;
-        ref.assetName = metadata->name;
-        ref.assetPath = metadata->virtualPath;
-        ref.referenceType = AssetReference::ReferenceType::Direct;
-        
-        // Determine reference type based on asset type
-        if (metadata->type == AssetType::Scene) {
-            ref.referenceType = AssetReference::ReferenceType::Scene;
-        } else if (metadata->type == AssetType::Script) {
-            ref.referenceType = AssetReference::ReferenceType::Code;
-        }
-        
-        references.push_back(ref);
     }
     
     return references;
@@ -83,14 +103,21 @@ std::vector<AssetReference> AssetReferenceFinder::FindReferencesIn(const GUID& s
         return references;
     }
     
+    if (m_ReferenceIndex) {
+        std::vector<AssetReferenceIndex::Reference> indexed;
+        m_ReferenceIndex->GetReferencesFrom(searchIn, indexed);
+        for (const auto& entry : indexed) {
+            if (entry.asset == target) {
+                references.push_back(MakeReference(*searchMetadata, std::string(PathTable::Get().GetString(entry.property))));
+            }
+        }
+        return references;
+    }
+    
     // Check if target is in the dependencies
     auto it = std::find(searchMetadata->dependencies.begin(), searchMetadata->dependencies.end(), target);
     if (it != searchMetadata->dependencies.end()) {
-        AssetReference ref;
-        ref.referencingAsset = searchIn;
-        ref.assetType = searchMetadata->type;
-        ref.assetName = searchMetadata->name;
-        ref.assetPath = searchMetadata->virtualPath;
+        AssetReference ref = MakeReference(*searchMetadata, std::string());
         ref.referenceType = AssetReference::ReferenceType::Direct;
         references.push_back(ref);
     }
@@ -101,6 +128,15 @@ std::vector<AssetReference> AssetReferenceFinder::FindReferencesIn(const GUID& s
 std::vector<GUID> AssetReferenceFinder::FindUnusedAssets() {
     std::vector<GUID> unused;
     
+    if (m_Registry && m_ReferenceIndex) {
+        m_Registry->ForEachAsset([&](const AssetMetadata& metadata) {
+            if (!m_ReferenceIndex->IsReferenced(metadata.guid)) {
+                unused.push_back(metadata.guid);
+            }
+        });
+        return unused;
+    }
+    
     if (!m_Registry || !m_Graph) {
         return unused;
     }
@@ -166,6 +202,10 @@ std::map<GUID, std::vector<GUID>> AssetReferenceFinder::FindMissingReferences()
 }
 
 size_t AssetReferenceFinder::GetReferenceCount(const GUID& asset) const {
+    if (m_ReferenceIndex) {
+        return m_ReferenceIndex->GetReferenceCount(asset);
+    }
+    
     if (!m_Graph) {
         return 0;
     }
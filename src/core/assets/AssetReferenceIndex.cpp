@@ -0,0 +1,470 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/core/assets/AssetReferenceIndex.h"
+#include "LGE/core/Log.h"
+#include "LGE/core/filesystem/MappedFile.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace LGE {
+
+namespace {
+
+constexpr char kReferenceIndexMagic[8] = { 'L', 'G', 'E', 'R', 'I', 'X', '0', '1' };
+
+// One bit per slot
+class SlotBits {
+public:
+    explicit SlotBits(size_t count) : m_Words((count + 63) / 64, 0) {}
+    
+    void Set(uint32_t slot) { m_Words[slot >> 6] |= uint64_t(1) << (slot & 63); }
+    bool Test(uint32_t slot) const { return (m_Words[slot >> 6] >> (slot & 63)) & 1; }
+    
+    // Sets the bit and reports whether it was clear before
+    bool TestAndSet(uint32_t slot) {
+        uint64_t mask = uint64_t(1) << (slot & 63);
+        bool wasClear = (m_Words[slot >> 6] & mask) == 0;
+        m_Words[slot >> 6] |= mask;
+        return wasClear;
+    }
+
+private:
+    std::vector<uint64_t> m_Words;
+};
+
+template <typename T>
+void WriteValue(std::ofstream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Bounds-checked cursor over the mapped index file
+struct IndexReader {
+    const uint8_t* data;
+    size_t size;
+    size_t offset = 0;
+    
+    template <typename T>
+    bool Read(T& value) {
+        if (size - offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+    
+    bool ReadString(std::string& value) {
+        uint32_t length = 0;
+        if (!Read(length) || size - offset < length) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(data + offset), length);
+        offset += length;
+        return true;
+    }
+};
+
+} // namespace
+
+uint32_t AssetReferenceIndex::FindSlot(const GUID& guid) const {
+    auto it = m_SlotByGuid.find(guid);
+    return it != m_SlotByGuid.end() ? it->second : kNoSlot;
+}
+
+uint32_t AssetReferenceIndex::AcquireSlot(const GUID& guid) {
+    auto it = m_SlotByGuid.find(guid);
+    if (it != m_SlotByGuid.end()) {
+        return it->second;
+    }
+    
+    uint32_t slot;
+    if (!m_FreeSlots.empty()) {
+        slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(m_Slots.size());
+        m_Slots.emplace_back();
+    }
+    m_Slots[slot].guid = guid;
+    m_SlotByGuid.emplace(guid, slot);
+    return slot;
+}
+
+void AssetReferenceIndex::ReleaseIfUnused(uint32_t slot) {
+    Slot& entry = m_Slots[slot];
+    if (entry.indexed || !entry.outgoing.empty() || !entry.incoming.empty()) {
+        return;
+    }
+    m_SlotByGuid.erase(entry.guid);
+    entry.guid = GUID::Invalid();
+    entry.outgoing.shrink_to_fit();
+    entry.incoming.shrink_to_fit();
+    m_FreeSlots.push_back(slot);
+}
+
+void AssetReferenceIndex::RemoveOutgoingAt(uint32_t slot, uint32_t index) {
+    // Every edge knows where its twin sits in the other list, so removal is two
+    // swap-erases instead of a search through a popular target's referencers
+    Edge edge = m_Slots[slot].outgoing[index];
+    
+    std::vector<Edge>& incoming = m_Slots[edge.slot].incoming;
+    if (edge.twin + 1 != incoming.size()) {
+        incoming[edge.twin] = incoming.back();
+        const Edge& moved = incoming[edge.twin];
+        m_Slots[moved.slot].outgoing[moved.twin].twin = edge.twin;
+    }
+    incoming.pop_back();
+    
+    std::vector<Edge>& outgoing = m_Slots[slot].outgoing;
+    if (index + 1 != outgoing.size()) {
+        outgoing[index] = outgoing.back();
+        const Edge& moved = outgoing[index];
+        m_Slots[moved.slot].incoming[moved.twin].twin = index;
+    }
+    outgoing.pop_back();
+    --m_EdgeCount;
+    
+    if (edge.slot != slot) {
+        ReleaseIfUnused(edge.slot);
+    }
+}
+
+void AssetReferenceIndex::ClearOutgoing(uint32_t slot) {
+    while (!m_Slots[slot].outgoing.empty()) {
+        RemoveOutgoingAt(slot, static_cast<uint32_t>(m_Slots[slot].outgoing.size() - 1));
+    }
+}
+
+void AssetReferenceIndex::SetReferences(const GUID& source, const std::vector<AssetPropertyReference>& references) {
+    if (!source.IsValid()) {
+        return;
+    }
+    
+    uint32_t slot = AcquireSlot(source);
+    if (!m_Slots[slot].indexed) {
+        m_Slots[slot].indexed = true;
+        ++m_IndexedCount;
+    }
+    
+    // Rescans mostly find what was there; the edges keep the input order, so
+    // an unchanged list is recognized without any lookups
+    PathTable& paths = PathTable::Get();
+    const std::vector<Edge>& current = m_Slots[slot].outgoing;
+    if (current.size() == references.size()) {
+        bool unchanged = true;
+        for (size_t i = 0; i < current.size() && unchanged; ++i) {
+            unchanged = m_Slots[current[i].slot].guid == references[i].target &&
+                        paths.GetString(current[i].property) == references[i].propertyPath;
+        }
+        if (unchanged) {
+            return;
+        }
+    }
+    ClearOutgoing(slot);
+    
+    for (const AssetPropertyReference& reference : references) {
+        if (!reference.target.IsValid()) {
+            continue;
+        }
+        PathId property = paths.Intern(reference.propertyPath);
+        uint32_t target = AcquireSlot(reference.target);   // May grow m_Slots
+        
+        std::vector<Edge>& outgoing = m_Slots[slot].outgoing;
+        bool duplicate = std::any_of(outgoing.begin(), outgoing.end(), [&](const Edge& edge) {
+            return edge.slot == target && edge.property == property;
+        });
+        if (duplicate) {
+            continue;
+        }
+        
+        std::vector<Edge>& incoming = m_Slots[target].incoming;
+        outgoing.push_back({ target, property, static_cast<uint32_t>(incoming.size()) });
+        incoming.push_back({ slot, property, static_cast<uint32_t>(outgoing.size() - 1) });
+        ++m_EdgeCount;
+    }
+}
+
+void AssetReferenceIndex::RemoveAsset(const GUID& asset) {
+    uint32_t slot = FindSlot(asset);
+    if (slot == kNoSlot) {
+        return;
+    }
+    
+    ClearOutgoing(slot);
+    if (m_Slots[slot].indexed) {
+        m_Slots[slot].indexed = false;
+        --m_IndexedCount;
+    }
+    ReleaseIfUnused(slot);
+}
+
+void AssetReferenceIndex::RemoveReference(const GUID& source, const GUID& target) {
+    uint32_t slot = FindSlot(source);
+    uint32_t targetSlot = FindSlot(target);
+    if (slot == kNoSlot || targetSlot == kNoSlot) {
+        return;
+    }
+    
+    for (uint32_t i = static_cast<uint32_t>(m_Slots[slot].outgoing.size()); i-- > 0;) {
+        if (m_Slots[slot].outgoing[i].slot == targetSlot) {
+            RemoveOutgoingAt(slot, i);
+        }
+    }
+    ReleaseIfUnused(slot);
+}
+
+void AssetReferenceIndex::GetReferences(const GUID& target, std::vector<Reference>& outReferences) const {
+    uint32_t slot = FindSlot(target);
+    if (slot == kNoSlot) {
+        return;
+    }
+    for (const Edge& edge : m_Slots[slot].incoming) {
+        outReferences.push_back({ m_Slots[edge.slot].guid, edge.property });
+    }
+}
+
+void AssetReferenceIndex::GetReferencesFrom(const GUID& source, std::vector<Reference>& outReferences) const {
+    uint32_t slot = FindSlot(source);
+    if (slot == kNoSlot) {
+        return;
+    }
+    for (const Edge& edge : m_Slots[slot].outgoing) {
+        outReferences.push_back({ m_Slots[edge.slot].guid, edge.property });
+    }
+}
+
+size_t AssetReferenceIndex::GetReferenceCount(const GUID& target) const {
+    uint32_t slot = FindSlot(target);
+    if (slot == kNoSlot) {
+        return 0;
+    }
+    
+    std::vector<uint32_t> sources;
+    sources.reserve(m_Slots[slot].incoming.size());
+    for (const Edge& edge : m_Slots[slot].incoming) {
+        sources.push_back(edge.slot);
+    }
+    std::sort(sources.begin(), sources.end());
+    return static_cast<size_t>(std::unique(sources.begin(), sources.end()) - sources.begin());
+}
+
+bool AssetReferenceIndex::IsReferenced(const GUID& target) const {
+    uint32_t slot = FindSlot(target);
+    return slot != kNoSlot && !m_Slots[slot].incoming.empty();
+}
+
+std::vector<GUID> AssetReferenceIndex::FindReferencers(const std::vector<GUID>& targets,
+                                                       std::vector<std::vector<GUID>>* outPerTarget) const {
+    std::vector<GUID> referencers;
+    if (outPerTarget) {
+        outPerTarget->assign(targets.size(), {});
+    }
+    
+    // Mark the whole selection first so references from inside it are skipped
+    std::vector<uint32_t> slots(targets.size(), kNoSlot);
+    SlotBits selected(m_Slots.size());
+    for (size_t i = 0; i < targets.size(); ++i) {
+        slots[i] = FindSlot(targets[i]);
+        if (slots[i] != kNoSlot) {
+            selected.Set(slots[i]);
+        }
+    }
+    
+    SlotBits reported(m_Slots.size());
+    std::vector<uint32_t> sources;
+    for (size_t i = 0; i < targets.size(); ++i) {
+        if (slots[i] == kNoSlot) {
+            continue;
+        }
+        
+        sources.clear();
+        for (const Edge& edge : m_Slots[slots[i]].incoming) {
+            if (selected.Test(edge.slot)) {
+                continue;
+            }
+            if (reported.TestAndSet(edge.slot)) {
+                referencers.push_back(m_Slots[edge.slot].guid);
+            }
+            if (outPerTarget) {
+                sources.push_back(edge.slot);
+            }
+        }
+        
+        if (outPerTarget && !sources.empty()) {
+            std::sort(sources.begin(), sources.end());
+            sources.erase(std::unique(sources.begin(), sources.end()), sources.end());
+            std::vector<GUID>& perTarget = (*outPerTarget)[i];
+            perTarget.reserve(sources.size());
+            for (uint32_t source : sources) {
+                perTarget.push_back(m_Slots[source].guid);
+            }
+        }
+    }
+    return referencers;
+}
+
+bool AssetReferenceIndex::SaveToFile(const std::filesystem::path& path) const {
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+    }
+    
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        Log::Error("Failed to save reference index: " + path.string());
+        return false;
+    }
+    
+    // Live slots are written densely; property ids are process-local, so the
+    // file carries its own string table
+    std::vector<uint32_t> fileSlot(m_Slots.size(), kNoSlot);
+    uint32_t slotCount = 0;
+    std::unordered_map<PathId, uint32_t> fileProperty;
+    std::vector<PathId> properties;
+    for (size_t slot = 0; slot < m_Slots.size(); ++slot) {
+        if (!m_Slots[slot].guid.IsValid()) {
+            continue;
+        }
+        fileSlot[slot] = slotCount++;
+        for (const Edge& edge : m_Slots[slot].outgoing) {
+            if (fileProperty.emplace(edge.property, static_cast<uint32_t>(properties.size())).second) {
+                properties.push_back(edge.property);
+            }
+        }
+    }
+    
+    out.write(kReferenceIndexMagic, sizeof(kReferenceIndexMagic));
+    WriteValue(out, static_cast<uint32_t>(properties.size()));
+    for (PathId property : properties) {
+        std::string_view name = PathTable::Get().GetString(property);
+        WriteValue(out, static_cast<uint32_t>(name.size()));
+        out.write(name.data(), static_cast<std::streamsize>(name.size()));
+    }
+    
+    WriteValue(out, slotCount);
+    for (const Slot& entry : m_Slots) {
+        if (!entry.guid.IsValid()) {
+            continue;
+        }
+        WriteValue(out, entry.guid.GetHigh());
+        WriteValue(out, entry.guid.GetLow());
+        WriteValue(out, static_cast<uint8_t>(entry.indexed ? 1 : 0));
+        WriteValue(out, static_cast<uint32_t>(entry.outgoing.size()));
+        for (const Edge& edge : entry.outgoing) {
+            WriteValue(out, fileSlot[edge.slot]);
+            WriteValue(out, fileProperty[edge.property]);
+        }
+    }
+    return out.good();
+}
+
+bool AssetReferenceIndex::LoadFromFile(const std::filesystem::path& path) {
+    Clear();
+    FileView file = MappedFile::Open(path, FileAccessHint::Sequential);
+    if (!file.IsValid()) {
+        return false;
+    }
+    
+    IndexReader reader{ file.GetData(), file.GetSize() };
+    char magic[sizeof(kReferenceIndexMagic)];
+    if (!reader.Read(magic) || std::memcmp(magic, kReferenceIndexMagic, sizeof(magic)) != 0) {
+        Log::Warn("Reference index has an unknown format: " + path.string());
+        return false;
+    }
+    
+    bool ok = true;
+    uint32_t propertyCount = 0;
+    ok = reader.Read(propertyCount);
+    std::vector<PathId> properties;
+    std::string name;
+    for (uint32_t i = 0; ok && i < propertyCount; ++i) {
+        ok = reader.ReadString(name);
+        properties.push_back(PathTable::Get().Intern(name));
+    }
+    
+    uint32_t slotCount = 0;
+    ok = ok && reader.Read(slotCount);
+    if (ok) {
+        // Each slot takes at least 21 bytes; reject counts the file cannot hold
+        ok = slotCount <= (reader.size - reader.offset) / 21;
+    }
+    if (ok) {
+        m_Slots.resize(slotCount);
+        m_SlotByGuid.reserve(slotCount);
+    }
+    
+    for (uint32_t slot = 0; ok && slot < slotCount; ++slot) {
+        uint64_t high = 0;
+        uint64_t low = 0;
+        uint8_t indexed = 0;
+        uint32_t edgeCount = 0;
+        ok = reader.Read(high) && reader.Read(low) && reader.Read(indexed) && reader.Read(edgeCount);
+        
+        Slot& entry = m_Slots[slot];
+        entry.guid = GUID(high, low);
+        entry.indexed = indexed != 0;
+        ok = ok && entry.guid.IsValid() && m_SlotByGuid.emplace(entry.guid, slot).second;
+        ok = ok && edgeCount <= (reader.size - reader.offset) / 8;
+        if (ok) {
+            entry.outgoing.reserve(edgeCount);
+        }
+        for (uint32_t i = 0; ok && i < edgeCount; ++i) {
+            uint32_t target = 0;
+            uint32_t property = 0;
+            ok = reader.Read(target) && reader.Read(property) && target < slotCount && property < propertyCount;
+            if (ok) {
+                entry.outgoing.push_back({ target, properties[property], 0 });
+            }
+        }
+        m_IndexedCount += entry.indexed ? 1 : 0;
+    }
+    
+    if (!ok) {
+        Log::Warn("Reference index is truncated: " + path.string());
+        Clear();
+        return false;
+    }
+    
+    for (uint32_t slot = 0; slot < slotCount; ++slot) {
+        std::vector<Edge>& outgoing = m_Slots[slot].outgoing;
+        for (uint32_t i = 0; i < outgoing.size(); ++i) {
+            std::vector<Edge>& incoming = m_Slots[outgoing[i].slot].incoming;
+            outgoing[i].twin = static_cast<uint32_t>(incoming.size());
+            incoming.push_back({ slot, outgoing[i].property, i });
+        }
+        m_EdgeCount += outgoing.size();
+    }
+    return true;
+}
+
+void AssetReferenceIndex::Clear() {
+    m_Slots.clear();
+    m_FreeSlots.clear();
+    m_SlotByGuid.clear();
+    m_IndexedCount = 0;
+    m_EdgeCount = 0;
+}
+
+} // namespace LGE
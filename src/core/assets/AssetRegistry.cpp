@@ -24,15 +24,44 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/AssetRegistry.h"
 #include "LGE/core/filesystem/FileSystem.h"
 #include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
 #include <algorithm>
 #include <sstream>
 #include <cctype>
+#include <unordered_set>
 
 namespace LGE {
 
+namespace {
+
+constexpr uint32_t kNoDirectory = UINT32_MAX;
+
+uint64_t DirectoryKey(uint32_t parent, uint32_t segment) {
+    return (static_cast<uint64_t>(parent) << 32) | segment;
+}
+
+// Calls visit(segment) for each non-empty path segment
+template <typename Visitor>
+void ForEachSegment(const std::string& path, Visitor&& visit) {
+    size_t start = 0;
+    while (start < path.size()) {
+        size_t end = path.find_first_of("/\\", start);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+        if (end > start) {
+            visit(start, end);
+        }
+        start = end + 1;
+    }
+}
+
+} // namespace
+
 AssetRegistry::AssetRegistry()
     : m_IsDirty(false)
 {
+    ResetDirectories();
 }
 
 AssetRegistry::~AssetRegistry() {
@@ -59,6 +88,7 @@ bool AssetRegistry::RegisterAsset(const AssetMetadata& metadata) {
     // Add to indices
     AddToIndices(metadata.guid, metadata);
     
+    m_Changes.Record(metadata.guid);
     m_IsDirty = true;
     return true;
 }
@@ -69,25 +99,97 @@ bool AssetRegistry::UnregisterAsset(const GUID& guid) {
         return false;
     }
     
-    AssetMetadata metadata = it->second;
-    RemoveFromIndices(guid, metadata);
+    RemoveFromIndices(guid);
     m_Assets.erase(it);
     
+    m_Changes.Record(guid);
     m_IsDirty = true;
     return true;
 }
 
+size_t AssetRegistry::UnregisterAssets(const std::vector<GUID>& guids) {
+    // RemoveFromIndices scans the whole type range and folder per asset; here
+    // each touched type, tag and folder is filtered once for the whole batch
+    std::unordered_set<GUID> removed;
+    removed.reserve(guids.size());
+    std::vector<AssetType> types;
+    std::vector<std::string> tags;
+    std::vector<uint32_t> directories;
+    for (const GUID& guid : guids) {
+        auto it = m_Assets.find(guid);
+        if (it == m_Assets.end() || !removed.insert(guid).second) {
+            continue;
+        }
+        
+        auto keysIt = m_IndexedKeys.find(guid);
+        if (keysIt == m_IndexedKeys.end()) {
+            continue;
+        }
+        const IndexedKeys& keys = keysIt->second;
+        auto pathIt = m_PathIndex.find(keys.path);
+        if (pathIt != m_PathIndex.end() && pathIt->second == guid) {
+            m_PathIndex.erase(pathIt);
+        }
+        types.push_back(keys.type);
+        tags.insert(tags.end(), keys.tags.begin(), keys.tags.end());
+        directories.push_back(keys.directory);
+    }
+    if (removed.empty()) {
+        return 0;
+    }
+    
+    auto sortUnique = [](auto& values) {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+    };
+    sortUnique(types);
+    sortUnique(tags);
+    sortUnique(directories);
+    
+    auto eraseRemoved = [&](auto& index, const auto& key) {
+        auto range = index.equal_range(key);
+        for (auto it = range.first; it != range.second; ) {
+            it = removed.count(it->second) ? index.erase(it) : std::next(it);
+        }
+    };
+    for (AssetType type : types) {
+        eraseRemoved(m_TypeIndex, type);
+    }
+    for (const auto& tag : tags) {
+        eraseRemoved(m_TagIndex, tag);
+    }
+    
+    for (uint32_t directory : directories) {
+        auto& assets = m_Directories[directory].assets;
+        assets.erase(std::remove_if(assets.begin(), assets.end(), [&](const GUID& guid) { return removed.count(guid) != 0; }), assets.end());
+    }
+    for (uint32_t directory : directories) {
+        // Pruning a child can already have freed this folder
+        if (m_Directories[directory].segment != kInvalidPathId) {
+            PruneDirectory(directory);
+        }
+    }
+    
+    for (const GUID& guid : guids) {
+        if (m_Assets.erase(guid)) {
+            m_IndexedKeys.erase(guid);
+            m_Changes.Record(guid);
+        }
+    }
+    m_IsDirty = true;
+    return removed.size();
+}
+
 bool AssetRegistry::UpdateAsset(const GUID& guid, const AssetMetadata& metadata) {
     auto it = m_Assets.find(guid);
     if (it == m_Assets.end()) {
         return RegisterAsset(metadata);
     }
     
-    AssetMetadata oldMetadata = it->second;
     it->second = metadata;
+    UpdateIndices(guid, metadata);
     
-    UpdateIndices(guid, oldMetadata, metadata);
-    
+    m_Changes.Record(guid);
     m_IsDirty = true;
     return true;
 }
@@ -109,7 +211,7 @@ const AssetMetadata* AssetRegistry::GetAsset(const GUID& guid) const {
 }
 
 AssetMetadata* AssetRegistry::GetAssetByPath(const std::string& virtualPath) {
-    auto it = m_PathIndex.find(virtualPath);
+    auto it = m_PathIndex.find(PathTable::Get().Find(virtualPath));
     if (it != m_PathIndex.end()) {
         return GetAsset(it->second);
     }
@@ -117,7 +219,7 @@ AssetMetadata* AssetRegistry::GetAssetByPath(const std::string& virtualPath) {
 }
 
 const AssetMetadata* AssetRegistry::GetAssetByPath(const std::string& virtualPath) const {
-    auto it = m_PathIndex.find(virtualPath);
+    auto it = m_PathIndex.find(PathTable::Get().Find(virtualPath));
     if (it != m_PathIndex.end()) {
         return GetAsset(it->second);
     }
@@ -244,6 +346,55 @@ std::vector<const AssetMetadata*> AssetRegistry::SearchAssets(const std::string&
     return result;
 }
 
+bool AssetRegistry::HasDirectory(const std::string& virtualDirectory) const {
+    return FindDirectory(virtualDirectory) != kNoDirectory;
+}
+
+bool AssetRegistry::HasSubdirectories(const std::string& virtualDirectory) const {
+    uint32_t directory = FindDirectory(virtualDirectory);
+    return directory != kNoDirectory && !m_Directories[directory].subfolders.empty();
+}
+
+std::vector<std::string> AssetRegistry::GetSubdirectories(const std::string& virtualDirectory) const {
+    std::vector<std::string> result;
+    uint32_t directory = FindDirectory(virtualDirectory);
+    if (directory != kNoDirectory) {
+        result.reserve(m_Directories[directory].subfolders.size());
+        for (uint32_t subfolder : m_Directories[directory].subfolders) {
+            result.emplace_back(PathTable::Get().GetString(m_Directories[subfolder].segment));
+        }
+    }
+    return result;
+}
+
+std::vector<AssetMetadata*> AssetRegistry::GetAssetsInDirectory(const std::string& virtualDirectory) {
+    std::vector<AssetMetadata*> result;
+    uint32_t directory = FindDirectory(virtualDirectory);
+    if (directory != kNoDirectory) {
+        result.reserve(m_Directories[directory].assets.size());
+        for (const GUID& guid : m_Directories[directory].assets) {
+            if (AssetMetadata* asset = GetAsset(guid)) {
+                result.push_back(asset);
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<const AssetMetadata*> AssetRegistry::GetAssetsInDirectory(const std::string& virtualDirectory) const {
+    std::vector<const AssetMetadata*> result;
+    uint32_t directory = FindDirectory(virtualDirectory);
+    if (directory != kNoDirectory) {
+        result.reserve(m_Directories[directory].assets.size());
+        for (const GUID& guid : m_Directories[directory].assets) {
+            if (const AssetMetadata* asset = GetAsset(guid)) {
+                result.push_back(asset);
+            }
+        }
+    }
+    return result;
+}
+
 std::vector<GUID> AssetRegistry::GetDependencies(const GUID& guid) {
     const AssetMetadata* asset = GetAsset(guid);
     if (asset) {
@@ -301,6 +452,7 @@ bool AssetRegistry::SaveToCache() {
 }
 
 bool AssetRegistry::LoadFromCache() {
+    LGE_PROFILE_SCOPE("AssetRegistry::LoadFromCache");
     if (m_CacheFilePath.empty() || !FileSystem::Exists(m_CacheFilePath.string())) {
         Log::Warn("Asset registry cache file not found: " + m_CacheFilePath.string());
         return false;
@@ -321,8 +473,9 @@ bool AssetRegistry::LoadFromCache() {
         return false;
     }
     
+    // Entries carry arrays of their own; the assets array is the outermost one
     size_t arrayStart = json.find('[', assetsPos);
-    size_t arrayEnd = json.find(']', arrayStart);
+    size_t arrayEnd = json.rfind(']');
     if (arrayStart == std::string::npos || arrayEnd == std::string::npos) {
         Log::Error("Invalid asset registry cache format: missing assets array");
         return false;
@@ -358,6 +511,12 @@ bool AssetRegistry::LoadFromCache() {
     return true;
 }
 
+void AssetRegistry::ForEachAsset(const std::function<void(const AssetMetadata&)>& func) const {
+    for (const auto& [guid, metadata] : m_Assets) {
+        func(metadata);
+    }
+}
+
 size_t AssetRegistry::GetAssetCountByType(AssetType type) const {
     return m_TypeIndex.count(type);
 }
@@ -365,30 +524,51 @@ size_t AssetRegistry::GetAssetCountByType(AssetType type) const {
 void AssetRegistry::Clear() {
     m_Assets.clear();
     m_PathIndex.clear();
+    m_IndexedKeys.clear();
     m_TypeIndex.clear();
     m_TagIndex.clear();
+    ResetDirectories();
+    m_Changes.Reset();
     m_IsDirty = false;
 }
 
 void AssetRegistry::AddToIndices(const GUID& guid, const AssetMetadata& metadata) {
+    IndexedKeys& keys = m_IndexedKeys[guid];
+    
     // Path index
-    m_PathIndex[metadata.virtualPath] = guid;
+    keys.path = PathTable::Get().Intern(metadata.virtualPath);
+    m_PathIndex[keys.path] = guid;
     
     // Type index
+    keys.type = metadata.type;
     m_TypeIndex.insert({metadata.type, guid});
     
     // Tag index
+    keys.tags = metadata.tags;
     for (const auto& tag : metadata.tags) {
         m_TagIndex.insert({tag, guid});
     }
+    
+    // Directory index
+    keys.directory = GetOrCreateDirectory(metadata.virtualPath, false);
+    m_Directories[keys.directory].assets.push_back(guid);
 }
 
-void AssetRegistry::RemoveFromIndices(const GUID& guid, const AssetMetadata& metadata) {
-    // Path index
-    m_PathIndex.erase(metadata.virtualPath);
+void AssetRegistry::RemoveFromIndices(const GUID& guid) {
+    auto keysIt = m_IndexedKeys.find(guid);
+    if (keysIt == m_IndexedKeys.end()) {
+        return;
+    }
+    const IndexedKeys& keys = keysIt->second;
+    
+    // Path index; another asset may have taken the path since
+    auto pathIt = m_PathIndex.find(keys.path);
+    if (pathIt != m_PathIndex.end() && pathIt->second == guid) {
+        m_PathIndex.erase(pathIt);
+    }
     
     // Type index
-    auto typeRange = m_TypeIndex.equal_range(metadata.type);
+    auto typeRange = m_TypeIndex.equal_range(keys.type);
     for (auto it = typeRange.first; it != typeRange.second; ) {
         if (it->second == guid) {
             it = m_TypeIndex.erase(it);
@@ -398,7 +578,7 @@ void AssetRegistry::RemoveFromIndices(const GUID& guid, const AssetMetadata& met
     }
     
     // Tag index
-    for (const auto& tag : metadata.tags) {
+    for (const auto& tag : keys.tags) {
         auto tagRange = m_TagIndex.equal_range(tag);
         for (auto it = tagRange.first; it != tagRange.second; ) {
             if (it->second == guid) {
@@ -408,11 +588,104 @@ void AssetRegistry::RemoveFromIndices(const GUID& guid, const AssetMetadata& met
             }
         }
     }
+    
+    // Directory index; the folder holds this asset, so it can't have been pruned
+    auto& assets = m_Directories[keys.directory].assets;
+    auto it = std::find(assets.begin(), assets.end(), guid);
+    if (it != assets.end()) {
+        *it = assets.back();
+        assets.pop_back();
+    }
+    PruneDirectory(keys.directory);
+    
+    m_IndexedKeys.erase(keysIt);
+}
+
+void AssetRegistry::UpdateIndices(const GUID& guid, const AssetMetadata& metadata) {
+    // Most updates only refresh the file stamp. Re-keying is not free: removing
+    // from the type index walks every asset of that type
+    auto keysIt = m_IndexedKeys.find(guid);
+    if (keysIt != m_IndexedKeys.end()) {
+        const IndexedKeys& keys = keysIt->second;
+        if (keys.path == PathTable::Get().Find(metadata.virtualPath) && keys.type == metadata.type &&
+            keys.tags == metadata.tags) {
+            return;
+        }
+    }
+    RemoveFromIndices(guid);
+    AddToIndices(guid, metadata);
+}
+
+uint32_t AssetRegistry::FindDirectory(const std::string& virtualDirectory) const {
+    uint32_t directory = 0;
+    ForEachSegment(virtualDirectory, [&](size_t start, size_t end) {
+        if (directory == kNoDirectory) {
+            return;
+        }
+        PathId segment = PathTable::Get().Find(std::string_view(virtualDirectory).substr(start, end - start));
+        if (segment == kInvalidPathId) {
+            directory = kNoDirectory;
+            return;
+        }
+        auto childIt = m_DirectoryChildren.find(DirectoryKey(directory, segment));
+        directory = childIt != m_DirectoryChildren.end() ? childIt->second : kNoDirectory;
+    });
+    return directory;
+}
+
+uint32_t AssetRegistry::GetOrCreateDirectory(const std::string& virtualPath, bool includeLastSegment) {
+    // For an asset path the last segment is the file name
+    size_t limit = includeLastSegment ? virtualPath.size() : virtualPath.find_last_of("/\\");
+    if (limit == std::string::npos) {
+        return 0;
+    }
+    
+    uint32_t directory = 0;
+    ForEachSegment(virtualPath.substr(0, limit), [&](size_t start, size_t end) {
+        PathId segment = PathTable::Get().Intern(std::string_view(virtualPath).substr(start, end - start));
+        uint64_t key = DirectoryKey(directory, segment);
+        auto it = m_DirectoryChildren.find(key);
+        if (it != m_DirectoryChildren.end()) {
+            directory = it->second;
+            return;
+        }
+        
+        uint32_t child;
+        if (!m_FreeDirectories.empty()) {
+            child = m_FreeDirectories.back();
+            m_FreeDirectories.pop_back();
+        } else {
+            child = static_cast<uint32_t>(m_Directories.size());
+            m_Directories.emplace_back();
+        }
+        DirectoryNode& node = m_Directories[child];
+        node.segment = segment;
+        node.parent = directory;
+        m_Directories[directory].subfolders.push_back(child);
+        m_DirectoryChildren.emplace(key, child);
+        directory = child;
+    });
+    return directory;
+}
+
+void AssetRegistry::PruneDirectory(uint32_t directory) {
+    // Walk up while folders are left empty; the root always stays
+    while (directory != 0 && m_Directories[directory].assets.empty() && m_Directories[directory].subfolders.empty()) {
+        DirectoryNode& node = m_Directories[directory];
+        uint32_t parent = node.parent;
+        m_DirectoryChildren.erase(DirectoryKey(parent, node.segment));
+        auto& siblings = m_Directories[parent].subfolders;
+        siblings.erase(std::remove(siblings.begin(), siblings.end(), directory), siblings.end());
+        node = DirectoryNode();
+        m_FreeDirectories.push_back(directory);
+        directory = parent;
+    }
 }
 
-void AssetRegistry::UpdateIndices(const GUID& guid, const AssetMetadata& oldMetadata, const AssetMetadata& newMetadata) {
-    RemoveFromIndices(guid, oldMetadata);
-    AddToIndices(guid, newMetadata);
+void AssetRegistry::ResetDirectories() {
+    m_Directories.assign(1, DirectoryNode());
+    m_FreeDirectories.clear();
+    m_DirectoryChildren.clear();
 }
 
 } // namespace LGE
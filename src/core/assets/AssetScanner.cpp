@@ -24,6 +24,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/AssetScanner.h"
 #include "LGE/core/filesystem/FileSystem.h"
 #include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
 #include <algorithm>
 #include <cctype>
 #include <filesystem>
@@ -50,6 +51,7 @@ AssetType AssetScanner::DetectAssetType(const std::filesystem::path& path) {
         {".dds", AssetType::Texture},
         {".hdr", AssetType::Texture},
         {".exr", AssetType::Texture},
+        {".ltex", AssetType::Texture},
         {".fbx", AssetType::Model},
         {".obj", AssetType::Model},
         {".gltf", AssetType::Model},
@@ -133,6 +135,7 @@ bool AssetScanner::ShouldIgnoreDirectory(const std::filesystem::path& path) {
 }
 
 void AssetScanner::ScanAll(std::function<void(int, int)> progressCallback) {
+    LGE_PROFILE_SCOPE("AssetScanner::ScanAll");
     if (!std::filesystem::exists(m_AssetsRoot)) {
         Log::Warn("Assets root does not exist: " + m_AssetsRoot.string());
         return;
@@ -167,6 +170,7 @@ void AssetScanner::ScanAll(std::function<void(int, int)> progressCallback) {
 }
 
 void AssetScanner::ScanIncremental() {
+    LGE_PROFILE_SCOPE("AssetScanner::ScanIncremental");
     if (!std::filesystem::exists(m_AssetsRoot)) {
         return;
     }
@@ -221,6 +225,15 @@ void AssetScanner::ScanDirectory(const std::filesystem::path& directory, bool re
     }
 }
 
+std::string AssetScanner::GetVirtualPath(const std::filesystem::path& filePath) const {
+    std::string virtualPath = m_VFS ? m_VFS->GetVirtualPath(filePath) : filePath.string();
+    if (virtualPath.empty()) {
+        virtualPath = "/" + std::filesystem::relative(filePath, m_AssetsRoot).string();
+        std::replace(virtualPath.begin(), virtualPath.end(), '\\', '/');
+    }
+    return virtualPath;
+}
+
 bool AssetScanner::ProcessFile(const std::filesystem::path& filePath) {
     if (!std::filesystem::exists(filePath) || !std::filesystem::is_regular_file(filePath)) {
         return false;
@@ -233,11 +246,7 @@ bool AssetScanner::ProcessFile(const std::filesystem::path& filePath) {
     }
     
     // Get virtual path
-    std::string virtualPath = m_VFS ? m_VFS->GetVirtualPath(filePath) : filePath.string();
-    if (virtualPath.empty()) {
-        virtualPath = "/" + std::filesystem::relative(filePath, m_AssetsRoot).string();
-        std::replace(virtualPath.begin(), virtualPath.end(), '\\', '/');
-    }
+    std::string virtualPath = GetVirtualPath(filePath);
     
     // Get or create GUID
     GUID guid = m_GUIDRegistry ? m_GUIDRegistry->GetOrCreateGUID(virtualPath) : GUID::Generate();
@@ -246,13 +255,13 @@ bool AssetScanner::ProcessFile(const std::filesystem::path& filePath) {
     AssetMetadata* existing = m_Registry->GetAssetByPath(virtualPath);
     if (existing && existing->guid == guid) {
         // Update last modified time
-        auto lastWriteTime = std::filesystem::last_write_time(filePath);
-        auto lastWriteTimeT = std::chrono::duration_cast<std::chrono::seconds>(
-            lastWriteTime.time_since_epoch()).count();
+        std::time_t lastModified = AssetMetadata::ToFileStamp(std::filesystem::last_write_time(filePath));
         
-        if (static_cast<std::time_t>(lastWriteTimeT) > existing->lastModified) {
-            existing->lastModified = static_cast<std::time_t>(lastWriteTimeT);
-            existing->fileSize = std::filesystem::file_size(filePath);
+        // Matches the reconcile: an older stamp (restored backup, VCS checkout) is a change too
+        uint64_t fileSize = std::filesystem::file_size(filePath);
+        if (lastModified != existing->lastModified || fileSize != existing->fileSize) {
+            existing->lastModified = lastModified;
+            existing->fileSize = fileSize;
             m_Registry->UpdateAsset(guid, *existing);
         }
         return true;
@@ -266,10 +275,7 @@ bool AssetScanner::ProcessFile(const std::filesystem::path& filePath) {
     metadata.name = filePath.filename().string();
     metadata.fileSize = std::filesystem::file_size(filePath);
     
-    auto lastWriteTime = std::filesystem::last_write_time(filePath);
-    auto lastWriteTimeT = std::chrono::duration_cast<std::chrono::seconds>(
-        lastWriteTime.time_since_epoch()).count();
-    metadata.lastModified = static_cast<std::time_t>(lastWriteTimeT);
+    metadata.lastModified = AssetMetadata::ToFileStamp(std::filesystem::last_write_time(filePath));
     metadata.importDate = std::time(nullptr);
     
     // Set category based on parent directory
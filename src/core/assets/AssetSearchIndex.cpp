@@ -24,9 +24,12 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/AssetSearchIndex.h"
 #include "LGE/core/assets/AssetRegistry.h"
 #include "LGE/core/Log.h"
+#include "LGE/core/filesystem/MappedFile.h"
 #include <algorithm>
-#include <sstream>
 #include <cctype>
+#include <cstring>
+#include <fstream>
+#include <sstream>
 
 namespace LGE {
 
@@ -72,26 +75,7 @@ void AssetSearchIndex::UpdateAsset(const GUID& guid, AssetRegistry* registry) {
     // Remove old entry if exists
     auto it = m_GuidToIndex.find(guid);
     if (it != m_GuidToIndex.end()) {
-        size_t oldIndex = it->second;
-        // Remove from word index
-        std::vector<std::string> oldWords = Tokenize(m_Entries[oldIndex].searchableText);
-        for (const auto& word : oldWords) {
-            auto wordIt = m_WordIndex.find(word);
-            if (wordIt != m_WordIndex.end()) {
-                auto& guids = wordIt->second;
-                guids.erase(std::remove(guids.begin(), guids.end(), guid), guids.end());
-                if (guids.empty()) {
-                    m_WordIndex.erase(wordIt);
-                }
-            }
-        }
-        // Remove entry
-        m_Entries.erase(m_Entries.begin() + oldIndex);
-        // Update indices
-        m_GuidToIndex.clear();
-        for (size_t i = 0; i < m_Entries.size(); ++i) {
-            m_GuidToIndex[m_Entries[i].guid] = i;
-        }
+        RemoveEntryAt(it->second);
     }
     
     // Create new entry
@@ -128,9 +112,12 @@ void AssetSearchIndex::RemoveAsset(const GUID& guid) {
     if (it == m_GuidToIndex.end()) {
         return;
     }
-    
-    size_t index = it->second;
-    SearchEntry& entry = m_Entries[index];
+    RemoveEntryAt(it->second);
+}
+
+void AssetSearchIndex::RemoveEntryAt(size_t index) {
+    const SearchEntry& entry = m_Entries[index];
+    GUID guid = entry.guid;
     
     // Remove from word index
     std::vector<std::string> words = Tokenize(entry.searchableText);
@@ -145,14 +132,14 @@ void AssetSearchIndex::RemoveAsset(const GUID& guid) {
         }
     }
     
-    // Remove entry
-    m_Entries.erase(m_Entries.begin() + index);
-    
-    // Rebuild index map
-    m_GuidToIndex.clear();
-    for (size_t i = 0; i < m_Entries.size(); ++i) {
-        m_GuidToIndex[m_Entries[i].guid] = i;
+    // Entry order carries no meaning, so fill the hole with the last entry
+    // instead of shifting everything after it
+    m_GuidToIndex.erase(guid);
+    if (index + 1 != m_Entries.size()) {
+        m_Entries[index] = std::move(m_Entries.back());
+        m_GuidToIndex[m_Entries[index].guid] = index;
     }
+    m_Entries.pop_back();
 }
 
 std::vector<GUID> AssetSearchIndex::Search(const std::string& query) {
@@ -193,19 +180,19 @@ std::vector<GUID> AssetSearchIndex::Search(const std::string& query) {
 }
 
 std::vector<std::string> AssetSearchIndex::Tokenize(const std::string& text) {
+    // Whitespace-separated words, lowercased with punctuation dropped; one pass
+    // with no stream, since loading a saved index tokenizes every entry
     std::vector<std::string> tokens;
-    std::string lowerText = ToLower(text);
-    
-    std::istringstream iss(lowerText);
     std::string token;
-    
-    while (iss >> token) {
-        // Remove punctuation
-        token.erase(std::remove_if(token.begin(), token.end(), 
-            [](char c) { return !std::isalnum(c); }), token.end());
-        
-        if (!token.empty() && token.length() >= 2) { // Ignore single characters
-            tokens.push_back(token);
+    for (size_t i = 0; i <= text.size(); ++i) {
+        unsigned char c = i < text.size() ? static_cast<unsigned char>(text[i]) : ' ';
+        if (std::isspace(c)) {
+            if (token.length() >= 2) { // Ignore single characters
+                tokens.push_back(token);
+            }
+            token.clear();
+        } else if (std::isalnum(c)) {
+            token += static_cast<char>(std::tolower(c));
         }
     }
     
@@ -229,6 +216,127 @@ void AssetSearchIndex::BuildWordIndex() {
     }
 }
 
+namespace {
+
+constexpr char kSearchIndexMagic[8] = { 'L', 'G', 'E', 'S', 'I', 'X', '0', '1' };
+
+void WriteString(std::ofstream& out, const std::string& value) {
+    uint32_t length = static_cast<uint32_t>(value.size());
+    out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    out.write(value.data(), length);
+}
+
+// Bounds-checked cursor over the mapped index file
+struct IndexReader {
+    const uint8_t* data;
+    size_t size;
+    size_t offset = 0;
+    
+    template <typename T>
+    bool Read(T& value) {
+        if (size - offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+    
+    bool ReadString(std::string& value) {
+        uint32_t length = 0;
+        if (!Read(length) || size - offset < length) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(data + offset), length);
+        offset += length;
+        return true;
+    }
+};
+
+} // namespace
+
+bool AssetSearchIndex::SaveToFile(const std::filesystem::path& path) const {
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+    }
+    
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        Log::Error("Failed to save search index: " + path.string());
+        return false;
+    }
+    
+    out.write(kSearchIndexMagic, sizeof(kSearchIndexMagic));
+    uint32_t count = static_cast<uint32_t>(m_Entries.size());
+    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (const SearchEntry& entry : m_Entries) {
+        uint64_t high = entry.guid.GetHigh();
+        uint64_t low = entry.guid.GetLow();
+        uint8_t type = static_cast<uint8_t>(entry.type);
+        out.write(reinterpret_cast<const char*>(&high), sizeof(high));
+        out.write(reinterpret_cast<const char*>(&low), sizeof(low));
+        out.write(reinterpret_cast<const char*>(&type), sizeof(type));
+        WriteString(out, entry.name);
+        WriteString(out, entry.path);
+        uint32_t tagCount = static_cast<uint32_t>(entry.tags.size());
+        out.write(reinterpret_cast<const char*>(&tagCount), sizeof(tagCount));
+        for (const std::string& tag : entry.tags) {
+            WriteString(out, tag);
+        }
+    }
+    return out.good();
+}
+
+bool AssetSearchIndex::LoadFromFile(const std::filesystem::path& path) {
+    Clear();
+    FileView file = MappedFile::Open(path, FileAccessHint::Sequential);
+    if (!file.IsValid()) {
+        return false;
+    }
+    
+    IndexReader reader{ file.GetData(), file.GetSize() };
+    char magic[sizeof(kSearchIndexMagic)];
+    uint32_t count = 0;
+    if (!reader.Read(magic) || std::memcmp(magic, kSearchIndexMagic, sizeof(magic)) != 0 || !reader.Read(count)) {
+        Log::Warn("Search index has an unknown format: " + path.string());
+        return false;
+    }
+    
+    m_Entries.reserve(count);
+    m_GuidToIndex.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        SearchEntry entry;
+        uint64_t high = 0;
+        uint64_t low = 0;
+        uint8_t type = 0;
+        uint32_t tagCount = 0;
+        bool ok = reader.Read(high) && reader.Read(low) && reader.Read(type) &&
+                  reader.ReadString(entry.name) && reader.ReadString(entry.path) && reader.Read(tagCount);
+        for (uint32_t tag = 0; ok && tag < tagCount; ++tag) {
+            entry.tags.emplace_back();
+            ok = reader.ReadString(entry.tags.back());
+        }
+        if (!ok) {
+            Log::Warn("Search index is truncated: " + path.string());
+            Clear();
+            return false;
+        }
+        
+        entry.guid = GUID(high, low);
+        entry.type = static_cast<AssetType>(type);
+        entry.searchableText = entry.name + " " + entry.path + " ";
+        for (const auto& tag : entry.tags) {
+            entry.searchableText += tag + " ";
+        }
+        m_GuidToIndex[entry.guid] = m_Entries.size();
+        m_Entries.push_back(std::move(entry));
+    }
+    
+    BuildWordIndex();
+    return true;
+}
+
 void AssetSearchIndex::Clear() {
     m_Entries.clear();
     m_GuidToIndex.clear();
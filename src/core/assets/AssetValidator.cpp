@@ -26,6 +26,8 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/DependencyGraph.h"
 #include "LGE/core/filesystem/VirtualFileSystem.h"
 #include "LGE/core/filesystem/FileSystem.h"
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/Profiling.h"
 #include "LGE/core/Log.h"
 #include <algorithm>
 #include <unordered_set>
@@ -33,12 +35,123 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 namespace LGE {
 
+namespace {
+
+using ValidationResult = AssetValidator::ValidationResult;
+using ValidationSeverity = AssetValidator::ValidationSeverity;
+
+// Which checks a sweep runs; the single-check entry points run one each
+constexpr uint32_t kCheckMetadata = 1 << 0;
+constexpr uint32_t kCheckDependencies = 1 << 1;
+constexpr uint32_t kCheckCycles = 1 << 2;
+constexpr uint32_t kCheckNames = 1 << 3;
+constexpr uint32_t kCheckAll = kCheckMetadata | kCheckDependencies | kCheckCycles | kCheckNames;
+
+constexpr size_t kRecordGrain = 256;
+constexpr size_t kCheckShardSize = 512;
+
+// What the checks need from one asset, copied out of the registry and graph so
+// the checks themselves never touch either
+struct AssetRecord {
+    GUID guid;
+    std::string name;
+    bool hasVirtualPath = false;
+    std::vector<GUID> dependencies;   // Metadata and graph dependencies, sorted and unique
+    std::vector<GUID> edges;          // Graph dependencies only; cycles are found over these
+};
+
+AssetRecord MakeRecord(const AssetMetadata& metadata, const DependencyGraph* graph) {
+    AssetRecord record;
+    record.guid = metadata.guid;
+    record.name = metadata.name;
+    record.hasVirtualPath = !metadata.virtualPath.empty();
+    if (graph) {
+        record.edges = graph->GetDependencies(metadata.guid);
+    }
+    record.dependencies = metadata.dependencies;
+    record.dependencies.insert(record.dependencies.end(), record.edges.begin(), record.edges.end());
+    std::sort(record.dependencies.begin(), record.dependencies.end());
+    record.dependencies.erase(std::unique(record.dependencies.begin(), record.dependencies.end()), record.dependencies.end());
+    return record;
+}
+
+ValidationResult MakeResult(ValidationSeverity severity, const GUID& asset, std::string message, std::string details) {
+    ValidationResult result;
+    result.severity = severity;
+    result.asset = asset;
+    result.message = std::move(message);
+    result.details = std::move(details);
+    return result;
+}
+
+template <typename Exists>
+void CheckRecord(const AssetRecord& record, uint32_t checks, const Exists& exists, std::vector<ValidationResult>& out) {
+    if (checks & kCheckMetadata) {
+        if (!record.guid.IsValid()) {
+            out.push_back(MakeResult(ValidationSeverity::Error, GUID::Invalid(), "Invalid GUID in metadata", "Asset has invalid GUID"));
+        }
+        if (record.name.empty()) {
+            out.push_back(MakeResult(ValidationSeverity::Warning, record.guid, "Asset has empty name", ""));
+        }
+        if (!record.hasVirtualPath) {
+            out.push_back(MakeResult(ValidationSeverity::Error, record.guid, "Empty virtual path", "Asset has no virtual path"));
+        }
+    }
+    if (checks & kCheckDependencies) {
+        for (const GUID& dependency : record.dependencies) {
+            if (!exists(dependency)) {
+                out.push_back(MakeResult(ValidationSeverity::Error, record.guid,
+                    "Missing dependency: " + dependency.ToString(),
+                    "Asset depends on " + dependency.ToString() + " which is not in registry"));
+            }
+        }
+    }
+}
+
+template <typename T>
+void EraseValue(std::vector<T>& values, const T& value) {
+    auto it = std::find(values.begin(), values.end(), value);
+    if (it != values.end()) {
+        *it = std::move(values.back());
+        values.pop_back();
+    }
+}
+
+} // namespace
+
+struct AssetValidator::Sweep {
+    uint32_t checks = kCheckAll;
+    uint64_t registryRevision = 0;
+    uint64_t graphRevision = 0;
+    
+    std::vector<AssetRecord> records;
+    std::unordered_map<GUID, uint32_t> index;                    // Asset -> records slot
+    std::unordered_map<GUID, std::vector<GUID>> dependents;      // Dependency -> assets listing it
+    std::unordered_map<std::string, std::vector<GUID>> names;
+    std::unordered_set<std::string> duplicateNames;
+    
+    std::unordered_map<GUID, std::vector<ValidationResult>> issues;   // Per-asset checks; failing assets only
+    std::unordered_map<GUID, uint32_t> cycleOf;                  // Asset -> its cycle
+    std::unordered_map<uint32_t, std::vector<GUID>> cycles;      // Strongly connected components of 2+ assets
+    uint32_t nextCycle = 0;
+    
+    bool Exists(const GUID& guid) const { return index.find(guid) != index.end(); }
+    const AssetRecord* Find(const GUID& guid) const {
+        auto it = index.find(guid);
+        return it != index.end() ? &records[it->second] : nullptr;
+    }
+};
+
 AssetValidator::AssetValidator(AssetRegistry* registry, DependencyGraph* graph)
     : m_Registry(registry)
     , m_Graph(graph)
+    , m_LastRevalidatedCount(0)
 {
 }
 
+AssetValidator::~AssetValidator() {
+}
+
 std::vector<AssetValidator::ValidationResult> AssetValidator::ValidateAsset(const GUID& guid) {
     std::vector<ValidationResult> results;
     
@@ -48,253 +161,425 @@ std::vector<AssetValidator::ValidationResult> AssetValidator::ValidateAsset(cons
     
     const AssetMetadata* metadata = m_Registry->GetAsset(guid);
     if (!metadata) {
-        ValidationResult result;
-        result.severity = ValidationSeverity::Error;
-        result.asset = guid;
-        result.message = "Asset not found in registry";
-        results.push_back(result);
+        results.push_back(MakeResult(ValidationSeverity::Error, guid, "Asset not found in registry", ""));
         return results;
     }
     
-    // Check if file exists
-    // This would require VFS, but for now we'll skip
-    
-    // Check for invalid GUID
-    if (!metadata->guid.IsValid()) {
-        ValidationResult result;
-        result.severity = ValidationSeverity::Error;
-        result.asset = guid;
-        result.message = "Invalid GUID";
-        results.push_back(result);
-    }
-    
-    // Check for empty name
-    if (metadata->name.empty()) {
-        ValidationResult result;
-        result.severity = ValidationSeverity::Warning;
-        result.asset = guid;
-        result.message = "Asset has empty name";
-        results.push_back(result);
-    }
-    
-    // Check dependencies
-    if (m_Graph) {
-        std::vector<GUID> deps = m_Graph->GetDependencies(guid);
-        for (const auto& dep : deps) {
-            const AssetMetadata* depMetadata = m_Registry->GetAsset(dep);
-            if (!depMetadata) {
-                ValidationResult result;
-                result.severity = ValidationSeverity::Error;
-                result.asset = guid;
-                result.message = "Missing dependency: " + dep.ToString();
-                result.details = "Asset depends on " + dep.ToString() + " which is not in registry";
-                results.push_back(result);
-            }
-        }
-    }
-    
+    const AssetRegistry& registry = *m_Registry;
+    CheckRecord(MakeRecord(*metadata, m_Graph), kCheckMetadata | kCheckDependencies,
+        [&](const GUID& dependency) { return registry.GetAsset(dependency) != nullptr; }, results);
     return results;
 }
 
-std::vector<AssetValidator::ValidationResult> AssetValidator::ValidateProject(
-    std::function<void(int, int)> progressCallback)
-{
-    std::vector<ValidationResult> allResults;
+std::unique_ptr<AssetValidator::Sweep> AssetValidator::BuildSweep(uint32_t checks) const {
+    LGE_PROFILE_SCOPE("AssetValidator::BuildSweep");
+    auto sweep = std::make_unique<Sweep>();
+    sweep->checks = checks;
+    sweep->registryRevision = m_Registry->GetChanges().GetRevision();
+    sweep->graphRevision = m_Graph ? m_Graph->GetChanges().GetRevision() : 0;
+    
+    // Snapshot: registry and graph are only read, on the workers, until this returns
+    std::vector<const AssetMetadata*> assets;
+    assets.reserve(m_Registry->GetAssetCount());
+    m_Registry->ForEachAsset([&](const AssetMetadata& metadata) {
+        assets.push_back(&metadata);
+    });
+    
+    std::vector<AssetRecord>& records = sweep->records;
+    records.resize(assets.size());
+    JobSystem::ParallelFor(assets.size(), kRecordGrain, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            records[i] = MakeRecord(*assets[i], m_Graph);
+        }
+    });
+    
+    // The three indices are independent of each other
+    JobSystem::ParallelFor(3, 1, [&](size_t begin, size_t end) {
+        for (size_t task = begin; task < end; ++task) {
+            if (task == 0) {
+                sweep->index.reserve(records.size());
+                for (size_t i = 0; i < records.size(); ++i) {
+                    sweep->index[records[i].guid] = static_cast<uint32_t>(i);
+                }
+            } else if (task == 1) {
+                for (const AssetRecord& record : records) {
+                    std::vector<GUID>& owners = sweep->names[record.name];
+                    owners.push_back(record.guid);
+                    if (owners.size() == 2 && (checks & kCheckNames)) {
+                        sweep->duplicateNames.insert(record.name);
+                    }
+                }
+            } else {
+                for (const AssetRecord& record : records) {
+                    for (const GUID& dependency : record.dependencies) {
+                        sweep->dependents[dependency].push_back(record.guid);
+                    }
+                }
+            }
+        }
+    });
+    
+    // Per-asset checks in shards, with the cycle search running as one more task
+    size_t shardCount = (records.size() + kCheckShardSize - 1) / kCheckShardSize;
+    std::vector<std::vector<std::pair<GUID, std::vector<ValidationResult>>>> shardIssues(shardCount);
+    const Sweep& snapshot = *sweep;
+    JobSystem::ParallelFor(shardCount + 1, 1, [&](size_t begin, size_t end) {
+        for (size_t task = begin; task < end; ++task) {
+            if (task == shardCount) {
+                if (checks & kCheckCycles) {
+                    std::vector<GUID> seeds;
+                    seeds.reserve(records.size());
+                    for (const AssetRecord& record : records) {
+                        seeds.push_back(record.guid);
+                    }
+                    FindCycles(*sweep, seeds);
+                }
+                continue;
+            }
+            size_t first = task * kCheckShardSize;
+            size_t last = std::min(first + kCheckShardSize, records.size());
+            for (size_t i = first; i < last; ++i) {
+                std::vector<ValidationResult> issues;
+                CheckRecord(records[i], checks, [&](const GUID& guid) { return snapshot.Exists(guid); }, issues);
+                if (!issues.empty()) {
+                    shardIssues[task].emplace_back(records[i].guid, std::move(issues));
+                }
+            }
+        }
+    });
     
-    if (!m_Registry) {
-        return allResults;
+    for (auto& shard : shardIssues) {
+        for (auto& [guid, issues] : shard) {
+            sweep->issues[guid] = std::move(issues);
+        }
     }
+    return sweep;
+}
+
+// Iterative Tarjan SCC over the graph edges of registered assets, started
+// from seeds. Any cycle that includes a visited asset is reachable from it,
+// so visited assets drop their old cycle and get whatever this pass found.
+void AssetValidator::FindCycles(Sweep& sweep, const std::vector<GUID>& seeds) const {
+    LGE_PROFILE_SCOPE("AssetValidator::FindCycles");
+    struct NodeState {
+        uint32_t order;
+        uint32_t lowLink;
+        bool onStack;
+    };
+    struct Frame {
+        GUID node;
+        const std::vector<GUID>* edges;
+        size_t next;
+    };
     
-    // Get all assets
-    std::vector<AssetType> allTypes = {
-        AssetType::Texture, AssetType::Model, AssetType::Material,
-        AssetType::Shader, AssetType::Script, AssetType::Audio,
-        AssetType::Scene, AssetType::Prefab, AssetType::Animation, AssetType::Font
+    std::unordered_map<GUID, NodeState> visited;
+    std::vector<GUID> stack;
+    std::vector<Frame> frames;
+    std::vector<std::vector<GUID>> found;
+    uint32_t counter = 0;
+    
+    auto enter = [&](const GUID& node, const AssetRecord& record) {
+        visited[node] = { counter, counter, true };
+        ++counter;
+        stack.push_back(node);
+        frames.push_back({ node, &record.edges, 0 });
     };
     
-    int totalAssets = 0;
-    for (AssetType type : allTypes) {
-        totalAssets += static_cast<int>(m_Registry->GetAssetCountByType(type));
-    }
-    
-    int processed = 0;
-    for (AssetType type : allTypes) {
-        std::vector<AssetMetadata*> assets = m_Registry->GetAssetsByType(type);
-        for (AssetMetadata* metadata : assets) {
-            if (metadata) {
-                std::vector<ValidationResult> assetResults = ValidateAsset(metadata->guid);
-                allResults.insert(allResults.end(), assetResults.begin(), assetResults.end());
-                processed++;
-                
-                if (progressCallback) {
-                    progressCallback(processed, totalAssets);
+    for (const GUID& seed : seeds) {
+        const AssetRecord* seedRecord = sweep.Find(seed);
+        if (!seedRecord || visited.count(seed)) {
+            continue;
+        }
+        enter(seed, *seedRecord);
+        
+        while (!frames.empty()) {
+            Frame& frame = frames.back();
+            if (frame.next < frame.edges->size()) {
+                const GUID& target = (*frame.edges)[frame.next++];
+                auto it = visited.find(target);
+                if (it == visited.end()) {
+                    // Unregistered dependencies have no edges to follow
+                    if (const AssetRecord* targetRecord = sweep.Find(target)) {
+                        enter(target, *targetRecord);
+                    }
+                } else if (it->second.onStack) {
+                    NodeState& state = visited[frame.node];
+                    state.lowLink = std::min(state.lowLink, it->second.order);
                 }
+                continue;
+            }
+            
+            GUID node = frame.node;
+            const std::vector<GUID>* edges = frame.edges;
+            frames.pop_back();
+            NodeState& state = visited[node];
+            if (!frames.empty()) {
+                NodeState& parent = visited[frames.back().node];
+                parent.lowLink = std::min(parent.lowLink, state.lowLink);
+            }
+            if (state.lowLink != state.order) {
+                continue;
+            }
+            
+            std::vector<GUID> component;
+            GUID member;
+            do {
+                member = stack.back();
+                stack.pop_back();
+                visited[member].onStack = false;
+                component.push_back(member);
+            } while (member != node);
+            
+            bool selfLoop = std::find(edges->begin(), edges->end(), node) != edges->end();
+            if (component.size() > 1 || selfLoop) {
+                found.push_back(std::move(component));
             }
         }
     }
     
-    // Run common checks
-    std::vector<ValidationResult> missingDeps = CheckMissingDependencies();
-    allResults.insert(allResults.end(), missingDeps.begin(), missingDeps.end());
-    
-    std::vector<ValidationResult> circularDeps = CheckCircularDependencies();
-    allResults.insert(allResults.end(), circularDeps.begin(), circularDeps.end());
-    
-    std::vector<ValidationResult> duplicateNames = CheckDuplicateNames();
-    allResults.insert(allResults.end(), duplicateNames.begin(), duplicateNames.end());
+    // Retire the old cycles of everything visited (and of seeds no longer registered)
+    std::unordered_set<uint32_t> retired;
+    auto retire = [&](const GUID& guid) {
+        auto it = sweep.cycleOf.find(guid);
+        if (it != sweep.cycleOf.end()) {
+            retired.insert(it->second);
+        }
+    };
+    for (const auto& [guid, state] : visited) {
+        retire(guid);
+    }
+    for (const GUID& seed : seeds) {
+        retire(seed);
+    }
+    for (uint32_t cycle : retired) {
+        auto it = sweep.cycles.find(cycle);
+        if (it == sweep.cycles.end()) {
+            continue;
+        }
+        for (const GUID& member : it->second) {
+            sweep.cycleOf.erase(member);
+        }
+        sweep.cycles.erase(it);
+    }
     
-    return allResults;
+    for (std::vector<GUID>& component : found) {
+        uint32_t cycle = sweep.nextCycle++;
+        for (const GUID& member : component) {
+            sweep.cycleOf[member] = cycle;
+        }
+        sweep.cycles[cycle] = std::move(component);
+    }
 }
 
-std::vector<AssetValidator::ValidationResult> AssetValidator::CheckMissingDependencies() {
+std::vector<AssetValidator::ValidationResult> AssetValidator::CollectResults(const Sweep& sweep) const {
     std::vector<ValidationResult> results;
     
-    if (!m_Registry || !m_Graph) {
-        return results;
+    // Stable order for reports: per-asset issues by asset, then cycles, then names
+    std::vector<GUID> failing;
+    failing.reserve(sweep.issues.size());
+    for (const auto& [guid, issues] : sweep.issues) {
+        failing.push_back(guid);
+    }
+    std::sort(failing.begin(), failing.end());
+    for (const GUID& guid : failing) {
+        const std::vector<ValidationResult>& issues = sweep.issues.at(guid);
+        results.insert(results.end(), issues.begin(), issues.end());
     }
     
-    std::vector<AssetType> allTypes = {
-        AssetType::Texture, AssetType::Model, AssetType::Material,
-        AssetType::Shader, AssetType::Script, AssetType::Audio,
-        AssetType::Scene, AssetType::Prefab, AssetType::Animation, AssetType::Font
-    };
+    std::vector<GUID> cyclic;
+    cyclic.reserve(sweep.cycleOf.size());
+    for (const auto& [guid, cycle] : sweep.cycleOf) {
+        cyclic.push_back(guid);
+    }
+    std::sort(cyclic.begin(), cyclic.end());
+    for (const GUID& guid : cyclic) {
+        size_t length = sweep.cycles.at(sweep.cycleOf.at(guid)).size();
+        results.push_back(MakeResult(ValidationSeverity::Warning, guid, "Circular dependency detected",
+            "Asset is part of a dependency cycle of " + std::to_string(length) + " asset(s)"));
+    }
     
-    for (AssetType type : allTypes) {
-        std::vector<AssetMetadata*> assets = m_Registry->GetAssetsByType(type);
-        for (AssetMetadata* metadata : assets) {
-            if (!metadata) continue;
-            
-            for (const auto& depGuid : metadata->dependencies) {
-                const AssetMetadata* depMetadata = m_Registry->GetAsset(depGuid);
-                if (!depMetadata) {
-                    ValidationResult result;
-                    result.severity = ValidationSeverity::Error;
-                    result.asset = metadata->guid;
-                    result.message = "Missing dependency";
-                    result.details = "Asset depends on " + depGuid.ToString() + " which is not in registry";
-                    result.canAutoFix = false;
-                    results.push_back(result);
-                }
-            }
+    std::vector<std::string> duplicates(sweep.duplicateNames.begin(), sweep.duplicateNames.end());
+    std::sort(duplicates.begin(), duplicates.end());
+    for (const std::string& name : duplicates) {
+        std::vector<GUID> owners = sweep.names.at(name);
+        std::sort(owners.begin(), owners.end());
+        for (const GUID& guid : owners) {
+            results.push_back(MakeResult(ValidationSeverity::Warning, guid, "Duplicate asset name",
+                "Multiple assets share the name: " + name));
         }
     }
-    
     return results;
 }
 
-std::vector<AssetValidator::ValidationResult> AssetValidator::CheckCircularDependencies() {
-    std::vector<ValidationResult> results;
+std::vector<AssetValidator::ValidationResult> AssetValidator::ValidateProject(
+    std::function<void(int, int)> progressCallback)
+{
+    if (!m_Registry) {
+        return {};
+    }
     
-    if (!m_Registry || !m_Graph) {
-        return results;
+    LGE_PROFILE_SCOPE("AssetValidator::ValidateProject");
+    int totalAssets = static_cast<int>(m_Registry->GetAssetCount());
+    if (progressCallback) {
+        progressCallback(0, totalAssets);
     }
     
-    std::vector<AssetType> allTypes = {
-        AssetType::Texture, AssetType::Model, AssetType::Material,
-        AssetType::Shader, AssetType::Script, AssetType::Audio,
-        AssetType::Scene, AssetType::Prefab, AssetType::Animation, AssetType::Font
-    };
+    m_Sweep = BuildSweep(kCheckAll);
+    m_LastRevalidatedCount = m_Sweep->records.size();
     
-    for (AssetType type : allTypes) {
-        std::vector<AssetMetadata*> assets = m_Registry->GetAssetsByType(type);
-        for (AssetMetadata* metadata : assets) {
-            if (!metadata) continue;
-            
-            if (m_Graph->HasCircularDependency(metadata->guid)) {
-                ValidationResult result;
-                result.severity = ValidationSeverity::Warning;
-                result.asset = metadata->guid;
-                result.message = "Circular dependency detected";
-                result.details = "Asset has circular dependency in dependency graph";
-                result.canAutoFix = false;
-                results.push_back(result);
-            }
-        }
+    if (progressCallback) {
+        progressCallback(totalAssets, totalAssets);
     }
-    
-    return results;
+    return CollectResults(*m_Sweep);
 }
 
-std::vector<AssetValidator::ValidationResult> AssetValidator::CheckDuplicateNames() {
-    std::vector<ValidationResult> results;
-    
+std::vector<AssetValidator::ValidationResult> AssetValidator::RevalidateChanged() {
     if (!m_Registry) {
-        return results;
+        return {};
     }
     
-    std::unordered_map<std::string, std::vector<GUID>> nameMap;
+    LGE_PROFILE_SCOPE("AssetValidator::RevalidateChanged");
+    std::vector<GUID> touched;
+    bool incremental = m_Sweep && m_Sweep->checks == kCheckAll &&
+        m_Registry->GetChanges().CollectSince(m_Sweep->registryRevision, touched) &&
+        (!m_Graph || m_Graph->GetChanges().CollectSince(m_Sweep->graphRevision, touched));
+    if (!incremental) {
+        return ValidateProject();
+    }
     
-    std::vector<AssetType> allTypes = {
-        AssetType::Texture, AssetType::Model, AssetType::Material,
-        AssetType::Shader, AssetType::Script, AssetType::Audio,
-        AssetType::Scene, AssetType::Prefab, AssetType::Animation, AssetType::Font
-    };
+    Sweep& sweep = *m_Sweep;
+    sweep.registryRevision = m_Registry->GetChanges().GetRevision();
+    sweep.graphRevision = m_Graph ? m_Graph->GetChanges().GetRevision() : 0;
+    std::sort(touched.begin(), touched.end());
+    touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+    
+    const AssetRegistry& registry = *m_Registry;
+    std::vector<GUID> recheck;
+    std::vector<GUID> seeds;
+    std::unordered_set<std::string> renamed;
+    for (const GUID& guid : touched) {
+        // Take the old record out of the indices
+        auto slot = sweep.index.find(guid);
+        if (slot != sweep.index.end()) {
+            const AssetRecord& old = sweep.records[slot->second];
+            auto owners = sweep.names.find(old.name);
+            if (owners != sweep.names.end()) {
+                EraseValue(owners->second, guid);
+                renamed.insert(old.name);
+            }
+            for (const GUID& dependency : old.dependencies) {
+                auto listed = sweep.dependents.find(dependency);
+                if (listed != sweep.dependents.end()) {
+                    EraseValue(listed->second, guid);
+                    if (listed->second.empty()) {
+                        sweep.dependents.erase(listed);
+                    }
+                }
+            }
+        }
+        
+        // A cycle through this asset may have broken: search all of it again
+        auto cycle = sweep.cycleOf.find(guid);
+        if (cycle != sweep.cycleOf.end()) {
+            const std::vector<GUID>& members = sweep.cycles.at(cycle->second);
+            seeds.insert(seeds.end(), members.begin(), members.end());
+        }
+        seeds.push_back(guid);
+        recheck.push_back(guid);
+        
+        const AssetMetadata* metadata = registry.GetAsset(guid);
+        if (metadata) {
+            AssetRecord record = MakeRecord(*metadata, m_Graph);
+            sweep.names[record.name].push_back(guid);
+            renamed.insert(record.name);
+            for (const GUID& dependency : record.dependencies) {
+                sweep.dependents[dependency].push_back(guid);
+            }
+            if (slot != sweep.index.end()) {
+                sweep.records[slot->second] = std::move(record);
+            } else {
+                sweep.index[guid] = static_cast<uint32_t>(sweep.records.size());
+                sweep.records.push_back(std::move(record));
+            }
+        } else if (slot != sweep.index.end()) {
+            uint32_t index = slot->second;
+            sweep.index.erase(slot);
+            if (index + 1 != sweep.records.size()) {
+                sweep.records[index] = std::move(sweep.records.back());
+                sweep.index[sweep.records[index].guid] = index;
+            }
+            sweep.records.pop_back();
+        }
+        
+        // Assets listing this one may have gained or lost a missing dependency
+        auto listed = sweep.dependents.find(guid);
+        if (listed != sweep.dependents.end()) {
+            recheck.insert(recheck.end(), listed->second.begin(), listed->second.end());
+        }
+    }
     
-    for (AssetType type : allTypes) {
-        std::vector<AssetMetadata*> assets = m_Registry->GetAssetsByType(type);
-        for (AssetMetadata* metadata : assets) {
-            if (!metadata) continue;
-            
-            nameMap[metadata->name].push_back(metadata->guid);
+    for (const std::string& name : renamed) {
+        auto owners = sweep.names.find(name);
+        size_t count = owners != sweep.names.end() ? owners->second.size() : 0;
+        if (count == 0 && owners != sweep.names.end()) {
+            sweep.names.erase(owners);
+        }
+        if (count > 1) {
+            sweep.duplicateNames.insert(name);
+        } else {
+            sweep.duplicateNames.erase(name);
         }
     }
     
-    for (const auto& pair : nameMap) {
-        if (pair.second.size() > 1) {
-            for (const auto& guid : pair.second) {
-                ValidationResult result;
-                result.severity = ValidationSeverity::Warning;
-                result.asset = guid;
-                result.message = "Duplicate asset name";
-                result.details = "Multiple assets share the name: " + pair.first;
-                result.canAutoFix = false;
-                results.push_back(result);
+    std::sort(recheck.begin(), recheck.end());
+    recheck.erase(std::unique(recheck.begin(), recheck.end()), recheck.end());
+    std::vector<std::vector<ValidationResult>> rechecked(recheck.size());
+    JobSystem::ParallelFor(recheck.size(), kCheckShardSize, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (const AssetRecord* record = sweep.Find(recheck[i])) {
+                CheckRecord(*record, kCheckAll, [&](const GUID& guid) { return sweep.Exists(guid); }, rechecked[i]);
             }
         }
+    });
+    for (size_t i = 0; i < recheck.size(); ++i) {
+        if (rechecked[i].empty()) {
+            sweep.issues.erase(recheck[i]);
+        } else {
+            sweep.issues[recheck[i]] = std::move(rechecked[i]);
+        }
     }
     
-    return results;
+    FindCycles(sweep, seeds);
+    m_LastRevalidatedCount = recheck.size();
+    return CollectResults(sweep);
 }
 
-std::vector<AssetValidator::ValidationResult> AssetValidator::CheckInvalidMetadata() {
-    std::vector<ValidationResult> results;
-    
+std::vector<AssetValidator::ValidationResult> AssetValidator::CheckMissingDependencies() {
     if (!m_Registry) {
-        return results;
+        return {};
     }
-    
-    std::vector<AssetType> allTypes = {
-        AssetType::Texture, AssetType::Model, AssetType::Material,
-        AssetType::Shader, AssetType::Script, AssetType::Audio,
-        AssetType::Scene, AssetType::Prefab, AssetType::Animation, AssetType::Font
-    };
-    
-    for (AssetType type : allTypes) {
-        std::vector<AssetMetadata*> assets = m_Registry->GetAssetsByType(type);
-        for (AssetMetadata* metadata : assets) {
-            if (!metadata) continue;
-            
-            if (!metadata->guid.IsValid()) {
-                ValidationResult result;
-                result.severity = ValidationSeverity::Error;
-                result.asset = GUID::Invalid();
-                result.message = "Invalid GUID in metadata";
-                result.details = "Asset has invalid GUID";
-                results.push_back(result);
-            }
-            
-            if (metadata->virtualPath.empty()) {
-                ValidationResult result;
-                result.severity = ValidationSeverity::Error;
-                result.asset = metadata->guid;
-                result.message = "Empty virtual path";
-                result.details = "Asset has no virtual path";
-                results.push_back(result);
-            }
-        }
+    return CollectResults(*BuildSweep(kCheckDependencies));
+}
+
+std::vector<AssetValidator::ValidationResult> AssetValidator::CheckCircularDependencies() {
+    if (!m_Registry || !m_Graph) {
+        return {};
     }
-    
-    return results;
+    return CollectResults(*BuildSweep(kCheckCycles));
+}
+
+std::vector<AssetValidator::ValidationResult> AssetValidator::CheckDuplicateNames() {
+    if (!m_Registry) {
+        return {};
+    }
+    return CollectResults(*BuildSweep(kCheckNames));
+}
+
+std::vector<AssetValidator::ValidationResult> AssetValidator::CheckInvalidMetadata() {
+    if (!m_Registry) {
+        return {};
+    }
+    return CollectResults(*BuildSweep(kCheckMetadata));
 }
 
 std::vector<AssetValidator::ValidationResult> AssetValidator::CheckOrphanedMetaFiles() {
@@ -47,8 +47,56 @@ void DependencyGraph::AddDependency(const GUID& asset, const GUID& dependency) {
     
     // Add to reverse dependents map
     m_Dependents[dependency].insert(asset);
+    m_Changes.Record(asset);
     
-    Log::Info("Added dependency: " + asset.ToString() + " -> " + dependency.ToString());
+    LGE_LOG_TRACE("Added dependency: {} -> {}", asset.ToString(), dependency.ToString());
+}
+
+void DependencyGraph::SetDependencies(const GUID& asset, const std::vector<GUID>& dependencies) {
+    auto it = m_Dependencies.find(asset);
+    if (it != m_Dependencies.end() && it->second.size() == dependencies.size()) {
+        bool same = std::all_of(dependencies.begin(), dependencies.end(), [&](const GUID& dependency) {
+            return it->second.count(dependency) != 0;
+        });
+        if (same) {
+            return;
+        }
+    }
+    
+    std::unordered_set<GUID> wanted;
+    wanted.reserve(dependencies.size());
+    for (const GUID& dependency : dependencies) {
+        if (dependency != asset) {
+            wanted.insert(dependency);
+        }
+    }
+    
+    if (it != m_Dependencies.end()) {
+        for (const GUID& old : it->second) {
+            if (wanted.count(old)) {
+                continue;
+            }
+            auto dependents = m_Dependents.find(old);
+            if (dependents != m_Dependents.end()) {
+                dependents->second.erase(asset);
+                if (dependents->second.empty()) {
+                    m_Dependents.erase(dependents);
+                }
+            }
+        }
+    }
+    
+    for (const GUID& dependency : wanted) {
+        m_Dependents[dependency].insert(asset);
+    }
+    if (wanted.empty()) {
+        if (it != m_Dependencies.end()) {
+            m_Dependencies.erase(it);
+        }
+    } else {
+        m_Dependencies[asset] = std::move(wanted);
+    }
+    m_Changes.Record(asset);
 }
 
 void DependencyGraph::RemoveDependencies(const GUID& asset) {
@@ -66,6 +114,7 @@ void DependencyGraph::RemoveDependencies(const GUID& asset) {
             }
         }
         m_Dependencies.erase(depIt);
+        m_Changes.Record(asset);
     }
     
     // Also remove from dependents map (assets that depend on this one)
@@ -76,6 +125,7 @@ void DependencyGraph::RemoveDependencies(const GUID& asset) {
             auto depIt4 = m_Dependencies.find(dependent);
             if (depIt4 != m_Dependencies.end()) {
                 depIt4->second.erase(asset);
+                m_Changes.Record(dependent);
                 if (depIt4->second.empty()) {
                     m_Dependencies.erase(depIt4);
                 }
@@ -90,6 +140,7 @@ void DependencyGraph::RemoveDependency(const GUID& asset, const GUID& dependency
     auto depIt = m_Dependencies.find(asset);
     if (depIt != m_Dependencies.end()) {
         depIt->second.erase(dependency);
+        m_Changes.Record(asset);
         if (depIt->second.empty()) {
             m_Dependencies.erase(depIt);
         }
@@ -292,6 +343,7 @@ bool DependencyGraph::Validate() const {
 void DependencyGraph::Clear() {
     m_Dependencies.clear();
     m_Dependents.clear();
+    m_Changes.Reset();
     Log::Info("Dependency graph cleared");
 }
 
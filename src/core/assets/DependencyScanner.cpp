@@ -26,159 +26,546 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/DependencyGraph.h"
 #include "LGE/core/filesystem/VirtualFileSystem.h"
 #include "LGE/core/filesystem/FileSystem.h"
+#include "LGE/core/filesystem/MappedFile.h"
+#include "LGE/core/Hash.h"
+#include "LGE/core/JobSystem.h"
 #include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 
 namespace LGE {
 
-DependencyScanner::DependencyScanner(AssetRegistry* reg, DependencyGraph* graph)
-    : m_Registry(reg)
-    , m_Graph(graph)
-{
+namespace {
+
+constexpr char kFileScanMagic[8] = { 'L', 'G', 'E', 'D', 'S', 'C', '0', '1' };
+
+// Adds the GUIDs listed in metadata.dependencies that no named property already covers
+void AppendListedDependencies(const AssetMetadata& metadata, std::vector<AssetPropertyReference>& references) {
+    size_t named = references.size();
+    for (const GUID& dependency : metadata.dependencies) {
+        auto first = references.begin();
+        auto last = references.begin() + static_cast<std::ptrdiff_t>(named);
+        bool covered = std::any_of(first, last, [&](const AssetPropertyReference& reference) {
+            return reference.target == dependency;
+        });
+        if (!covered) {
+            references.push_back({ dependency, "dependencies" });
+        }
+    }
 }
 
-std::vector<GUID> DependencyScanner::ScanAsset(const GUID& asset) {
-    if (!m_Registry) {
-        Log::Error("AssetRegistry is null in DependencyScanner");
-        return {};
+std::vector<GUID> UniqueTargets(const std::vector<AssetPropertyReference>& references) {
+    std::vector<GUID> targets;
+    targets.reserve(references.size());
+    for (const AssetPropertyReference& reference : references) {
+        targets.push_back(reference.target);
+    }
+    std::sort(targets.begin(), targets.end());
+    targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+    return targets;
+}
+
+// Asset files that are JSON documents referencing other assets by GUID
+bool HasReferenceFile(const AssetMetadata& metadata) {
+    static const char* const kExtensions[] = { ".lscene", ".prefab", ".lmat" };
+    const std::string& path = metadata.virtualPath;
+    for (const char* extension : kExtensions) {
+        size_t length = std::strlen(extension);
+        if (path.size() >= length && path.compare(path.size() - length, length, extension) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int HexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Same formats as GUID::FromString (dashed or 32 hex digits) without the
+// allocations, since it runs on every string in every scanned file
+bool ParseGUID(std::string_view text, GUID& outGuid) {
+    if (text.size() != 36 && text.size() != 32) {
+        return false;
     }
     
-    const AssetMetadata* metadata = m_Registry->GetAsset(asset);
-    if (!metadata) {
-        Log::Warn("Asset not found for dependency scanning: " + asset.ToString());
-        return {};
+    uint64_t halves[2] = { 0, 0 };
+    int digits = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (text.size() == 36 && (i == 8 || i == 13 || i == 18 || i == 23)) {
+            if (text[i] != '-') {
+                return false;
+            }
+            continue;
+        }
+        int value = HexValue(text[i]);
+        if (value < 0) {
+            return false;
+        }
+        uint64_t& half = halves[digits / 16];
+        half = (half << 4) | static_cast<uint64_t>(value);
+        ++digits;
     }
     
-    return ScanByType(asset, metadata->type);
+    outGuid = GUID(halves[0], halves[1]);
+    return outGuid.IsValid();
 }
 
-std::vector<GUID> DependencyScanner::ScanByType(const GUID& asset, AssetType type) {
-    switch (type) {
-        case AssetType::Material:
-            return ScanMaterialDependencies(asset);
-        case AssetType::Scene:
-            return ScanSceneDependencies(asset);
-        case AssetType::Prefab:
-            return ScanPrefabDependencies(asset);
-        default:
-            // For other types, check if metadata already has dependencies
-            const AssetMetadata* metadata = m_Registry->GetAsset(asset);
-            if (metadata) {
-                return metadata->dependencies;
+// Streaming (SAX-style) pass over a JSON document: no DOM and no copies, keys
+// are views into the text and only strings of GUID length are looked at. Tracks
+// the JSON path of the current value for the references it reports. Values
+// under "guid" name the object itself (the world, a game object); references to
+// those stay inside the file and are dropped at the end.
+class ReferenceScanner {
+public:
+    ReferenceScanner(std::string_view text, const GUID& self)
+        : m_Text(text)
+        , m_Pos(0)
+        , m_Self(self)
+    {
+    }
+    
+    // Appends what was found (before any syntax error) to outReferences
+    bool Run(std::vector<AssetPropertyReference>& outReferences) {
+        bool ok = ParseDocument();
+        std::sort(m_Identities.begin(), m_Identities.end());
+        for (AssetPropertyReference& reference : m_Found) {
+            if (!std::binary_search(m_Identities.begin(), m_Identities.end(), reference.target)) {
+                outReferences.push_back(std::move(reference));
             }
-            return {};
+        }
+        return ok;
     }
-}
 
-std::vector<GUID> DependencyScanner::ScanMaterialDependencies(const GUID& materialGuid) {
-    std::vector<GUID> dependencies;
+private:
+    struct Frame {
+        bool isArray;
+        size_t index;           // Arrays: position of the current element
+        std::string_view key;   // Objects: key of the current member (raw, escapes kept)
+    };
     
-    const AssetMetadata* metadata = m_Registry->GetAsset(materialGuid);
-    if (!metadata) {
-        return dependencies;
+    void SkipWhitespace() {
+        while (m_Pos < m_Text.size() && (m_Text[m_Pos] == ' ' || m_Text[m_Pos] == '\n' || m_Text[m_Pos] == '\r' || m_Text[m_Pos] == '\t')) {
+            ++m_Pos;
+        }
     }
     
-    // Materials typically depend on textures and shaders
-    // Check importSettings for texture references (it's stored as a JSON string)
-    if (!metadata->importSettings.empty()) {
-        // Look for common texture property names
-        std::vector<std::string> textureKeys = {"diffuseTexture", "normalTexture", "specularTexture", 
-                                                 "albedoTexture", "metallicTexture", "roughnessTexture",
-                                                 "emissiveTexture", "occlusionTexture"};
-        
-        for (const auto& key : textureKeys) {
-            std::string searchKey = "\"" + key + "\"";
-            size_t keyPos = metadata->importSettings.find(searchKey);
-            if (keyPos != std::string::npos) {
-                // Find the value after the colon
-                size_t colonPos = metadata->importSettings.find(':', keyPos);
-                if (colonPos != std::string::npos) {
-                    // Find the quoted value
-                    size_t valueStart = metadata->importSettings.find('"', colonPos);
-                    if (valueStart != std::string::npos) {
-                        size_t valueEnd = metadata->importSettings.find('"', valueStart + 1);
-                        if (valueEnd != std::string::npos) {
-                            std::string textureGuidStr = metadata->importSettings.substr(valueStart + 1, valueEnd - valueStart - 1);
-                            GUID textureGuid = GUID::FromString(textureGuidStr);
-                            if (textureGuid.IsValid()) {
-                                dependencies.push_back(textureGuid);
-                            }
-                        }
-                    }
+    // At an opening quote; returns the raw contents and moves past the closing one
+    bool ReadString(std::string_view& outValue) {
+        size_t start = ++m_Pos;
+        while (m_Pos < m_Text.size()) {
+            const void* quote = std::memchr(m_Text.data() + m_Pos, '"', m_Text.size() - m_Pos);
+            if (!quote) {
+                return false;
+            }
+            size_t end = static_cast<size_t>(static_cast<const char*>(quote) - m_Text.data());
+            m_Pos = end + 1;
+            
+            // Escaped when preceded by an odd run of backslashes
+            size_t backslashes = 0;
+            while (end - backslashes > start && m_Text[end - backslashes - 1] == '\\') {
+                ++backslashes;
+            }
+            if (backslashes % 2 == 0) {
+                outValue = m_Text.substr(start, end - start);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    // Numbers, true, false, null
+    bool SkipLiteral() {
+        size_t start = m_Pos;
+        while (m_Pos < m_Text.size()) {
+            char c = m_Text[m_Pos];
+            bool literal = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c == '-' || c == '+' || c == '.' || c == 'E';
+            if (!literal) {
+                break;
+            }
+            ++m_Pos;
+        }
+        return m_Pos > start;
+    }
+    
+    void OnString(std::string_view value) {
+        GUID guid;
+        if (!ParseGUID(value, guid)) {
+            return;
+        }
+        if (!m_Frames.empty() && !m_Frames.back().isArray && m_Frames.back().key == "guid") {
+            m_Identities.push_back(guid);
+        } else if (guid != m_Self) {
+            m_Found.push_back({ guid, BuildPath() });
+        }
+    }
+    
+    std::string BuildPath() const {
+        std::string path;
+        for (const Frame& frame : m_Frames) {
+            if (frame.isArray) {
+                char index[24];
+                int length = std::snprintf(index, sizeof(index), "[%zu]", frame.index);
+                path.append(index, static_cast<size_t>(length));
+            } else {
+                if (!path.empty()) {
+                    path += '.';
                 }
+                path.append(frame.key.data(), frame.key.size());
             }
         }
-        
-        // Check for shader reference
-        size_t shaderPos = metadata->importSettings.find("\"shader\"");
-        if (shaderPos != std::string::npos) {
-            size_t colonPos = metadata->importSettings.find(':', shaderPos);
-            if (colonPos != std::string::npos) {
-                size_t valueStart = metadata->importSettings.find('"', colonPos);
-                if (valueStart != std::string::npos) {
-                    size_t valueEnd = metadata->importSettings.find('"', valueStart + 1);
-                    if (valueEnd != std::string::npos) {
-                        std::string shaderGuidStr = metadata->importSettings.substr(valueStart + 1, valueEnd - valueStart - 1);
-                        GUID shaderGuid = GUID::FromString(shaderGuidStr);
-                        if (shaderGuid.IsValid()) {
-                            dependencies.push_back(shaderGuid);
-                        }
+        return path;
+    }
+    
+    // Reads "key": inside an object, leaving the cursor on the value
+    bool ParseKey() {
+        SkipWhitespace();
+        if (m_Pos >= m_Text.size() || m_Text[m_Pos] != '"' || !ReadString(m_Frames.back().key)) {
+            return false;
+        }
+        SkipWhitespace();
+        if (m_Pos >= m_Text.size() || m_Text[m_Pos] != ':') {
+            return false;
+        }
+        ++m_Pos;
+        return true;
+    }
+    
+    bool ParseDocument() {
+        // Iterative so deeply nested files cannot overflow the stack
+        bool expectValue = true;
+        while (true) {
+            SkipWhitespace();
+            if (!expectValue && m_Frames.empty()) {
+                return true;
+            }
+            if (m_Pos >= m_Text.size()) {
+                return false;
+            }
+            
+            if (expectValue) {
+                char c = m_Text[m_Pos];
+                if (c == '{' || c == '[') {
+                    bool isArray = c == '[';
+                    ++m_Pos;
+                    m_Frames.push_back({ isArray, 0, std::string_view() });
+                    SkipWhitespace();
+                    if (m_Pos < m_Text.size() && m_Text[m_Pos] == (isArray ? ']' : '}')) {
+                        ++m_Pos;
+                        m_Frames.pop_back();
+                        expectValue = false;
+                    } else if (!isArray && !ParseKey()) {
+                        return false;
                     }
+                    continue;
                 }
+                if (c == '"') {
+                    std::string_view value;
+                    if (!ReadString(value)) {
+                        return false;
+                    }
+                    OnString(value);
+                } else if (!SkipLiteral()) {
+                    return false;
+                }
+                expectValue = false;
+                continue;
+            }
+            
+            // After a value the container goes on or closes
+            Frame& frame = m_Frames.back();
+            char c = m_Text[m_Pos++];
+            if (c == ',') {
+                if (frame.isArray) {
+                    ++frame.index;
+                } else if (!ParseKey()) {
+                    return false;
+                }
+                expectValue = true;
+            } else if (c == (frame.isArray ? ']' : '}')) {
+                m_Frames.pop_back();
+            } else {
+                return false;
             }
         }
     }
     
-    // Also check metadata dependencies
-    dependencies.insert(dependencies.end(), metadata->dependencies.begin(), metadata->dependencies.end());
+    std::string_view m_Text;
+    size_t m_Pos;
+    GUID m_Self;
+    std::vector<Frame> m_Frames;
+    std::vector<AssetPropertyReference> m_Found;
+    std::vector<GUID> m_Identities;
+};
+
+void WriteString(std::ofstream& out, const std::string& value) {
+    uint32_t length = static_cast<uint32_t>(value.size());
+    out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    out.write(value.data(), length);
+}
+
+// Bounds-checked cursor over the mapped cache file
+struct IndexReader {
+    const uint8_t* data;
+    size_t size;
+    size_t offset = 0;
+    
+    template <typename T>
+    bool Read(T& value) {
+        if (size - offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+    
+    bool ReadString(std::string& value) {
+        uint32_t length = 0;
+        if (!Read(length) || size - offset < length) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(data + offset), length);
+        offset += length;
+        return true;
+    }
+};
+
+} // namespace
+
+DependencyScanner::DependencyScanner(AssetRegistry* reg, DependencyGraph* graph, AssetReferenceIndex* referenceIndex)
+    : m_Registry(reg)
+    , m_Graph(graph)
+    , m_ReferenceIndex(referenceIndex)
+    , m_VFS(nullptr)
+    , m_FilesParsed(0)
+    , m_FilesReused(0)
+{
+}
+
+bool DependencyScanner::ExtractReferences(std::string_view json, const GUID& self, std::vector<AssetPropertyReference>& outReferences) {
+    // A truncated file still yields the references before the damage
+    return ReferenceScanner(json, self).Run(outReferences);
+}
+
+bool DependencyScanner::ReadFileScan(const std::string& file, const GUID& asset, const FileScan* cached,
+                                     FileScan& outScan, bool& outReused) {
+    outReused = false;
+    FileView view = MappedFile::Open(file, FileAccessHint::Sequential);
+    if (!view.IsValid()) {
+        return false;
+    }
     
-    // Remove duplicates
-    std::sort(dependencies.begin(), dependencies.end());
-    dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+    uint64_t contentHash = Hash::Bytes(view.GetData(), view.GetSize());
+    if (cached && cached->contentHash == contentHash) {
+        outReused = true;
+        return true;
+    }
     
-    return dependencies;
+    outScan.contentHash = contentHash;
+    outScan.references.clear();
+    if (!view.Empty() && !ExtractReferences(view.AsStringView(), asset, outScan.references)) {
+        Log::Warn("Malformed JSON while scanning dependencies: " + file);
+    }
+    return true;
 }
 
-std::vector<GUID> DependencyScanner::ScanSceneDependencies(const GUID& sceneGuid) {
-    std::vector<GUID> dependencies;
+void DependencyScanner::RefreshFileScans(const std::vector<GUID>& assets) {
+    m_FilesParsed = 0;
+    m_FilesReused = 0;
+    if (!m_Registry || !m_VFS) {
+        return;
+    }
     
-    const AssetMetadata* metadata = m_Registry->GetAsset(sceneGuid);
-    if (!metadata) {
-        return dependencies;
+    // A lone worker would only take turns with this thread on the same files
+    if (JobSystem::GetWorkerCount() <= 1) {
+        for (const GUID& asset : assets) {
+            RefreshFileScan(asset);
+        }
+        return;
     }
     
-    // Scenes can reference many assets (models, materials, textures, prefabs, etc.)
-    // For now, we'll check the metadata dependencies and try to parse the scene file
-    dependencies = metadata->dependencies;
+    struct PendingFile {
+        GUID asset;
+        std::string file;
+        const FileScan* cached = nullptr;
+        FileScan scan;
+        bool reused = false;
+        bool readable = false;
+    };
     
-    // TODO: Parse scene file format to extract all referenced assets
-    // This would require reading the actual scene file and parsing it
+    std::vector<PendingFile> pending;
+    for (const GUID& asset : assets) {
+        const AssetMetadata* metadata = m_Registry->GetAsset(asset);
+        if (!metadata || !HasReferenceFile(*metadata)) {
+            continue;
+        }
+        PendingFile entry;
+        entry.asset = asset;
+        m_VFS->ResolveVirtualPath(metadata->virtualPath, entry.file);
+        entry.cached = FindFileScan(asset);
+        pending.push_back(std::move(entry));
+    }
+    
+    // Files are independent; the cache is only read until every parse is done
+    JobSystem::ParallelFor(pending.size(), 8, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            PendingFile& entry = pending[i];
+            entry.readable = ReadFileScan(entry.file, entry.asset, entry.cached, entry.scan, entry.reused);
+        }
+    });
+    
+    for (PendingFile& entry : pending) {
+        StoreFileScan(entry.asset, entry.readable, entry.reused, entry.scan);
+    }
+}
+
+void DependencyScanner::RefreshFileScan(const GUID& asset) {
+    const AssetMetadata* metadata = m_Registry->GetAsset(asset);
+    if (!metadata || !HasReferenceFile(*metadata)) {
+        return;
+    }
     
-    // Remove duplicates
-    std::sort(dependencies.begin(), dependencies.end());
-    dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+    std::string file;
+    m_VFS->ResolveVirtualPath(metadata->virtualPath, file);
+    FileScan scan;
+    bool reused = false;
+    bool readable = ReadFileScan(file, asset, FindFileScan(asset), scan, reused);
+    StoreFileScan(asset, readable, reused, scan);
+}
+
+void DependencyScanner::StoreFileScan(const GUID& asset, bool readable, bool reused, FileScan& scan) {
+    if (!readable) {
+        m_FileScans.erase(asset);
+    } else if (reused) {
+        ++m_FilesReused;
+    } else {
+        m_FileScans[asset] = std::move(scan);
+        ++m_FilesParsed;
+    }
+}
+
+std::vector<GUID> DependencyScanner::CollectAllAssets() {
+    std::vector<GUID> assets;
+    assets.reserve(m_Registry->GetAssetCount());
+    m_Registry->ForEachAsset([&](const AssetMetadata& metadata) {
+        if (metadata.guid.IsValid()) {
+            assets.push_back(metadata.guid);
+        }
+    });
     
-    return dependencies;
+    // Cached scans of assets that are gone would otherwise be saved forever
+    for (auto it = m_FileScans.begin(); it != m_FileScans.end();) {
+        it = m_Registry->GetAsset(it->first) ? std::next(it) : m_FileScans.erase(it);
+    }
+    return assets;
 }
 
-std::vector<GUID> DependencyScanner::ScanPrefabDependencies(const GUID& prefabGuid) {
-    std::vector<GUID> dependencies;
+const DependencyScanner::FileScan* DependencyScanner::FindFileScan(const GUID& asset) const {
+    auto it = m_FileScans.find(asset);
+    return it != m_FileScans.end() ? &it->second : nullptr;
+}
+
+std::vector<GUID> DependencyScanner::ScanAsset(const GUID& asset) {
+    return UniqueTargets(ScanReferences(asset));
+}
+
+std::vector<AssetPropertyReference> DependencyScanner::ScanReferences(const GUID& asset) {
+    if (!m_Registry) {
+        Log::Error("AssetRegistry is null in DependencyScanner");
+        return {};
+    }
     
-    const AssetMetadata* metadata = m_Registry->GetAsset(prefabGuid);
+    const AssetMetadata* metadata = m_Registry->GetAsset(asset);
     if (!metadata) {
-        return dependencies;
+        Log::Warn("Asset not found for dependency scanning: " + asset.ToString());
+        return {};
     }
     
-    // Prefabs can reference models, materials, textures, other prefabs, etc.
-    dependencies = metadata->dependencies;
+    RefreshFileScans({ asset });
+    return ScanMetadata(*metadata);
+}
+
+std::vector<AssetPropertyReference> DependencyScanner::ScanMetadata(const AssetMetadata& metadata) {
+    const FileScan* file = FindFileScan(metadata.guid);
+    switch (metadata.type) {
+        case AssetType::Material:
+            return ScanMaterialDependencies(metadata, file);
+        case AssetType::Scene:
+            return ScanSceneDependencies(metadata, file);
+        case AssetType::Prefab:
+            return ScanPrefabDependencies(metadata, file);
+        default: {
+            // For other types, check if metadata already has dependencies
+            std::vector<AssetPropertyReference> references;
+            AppendListedDependencies(metadata, references);
+            return references;
+        }
+    }
+}
+
+std::vector<GUID> DependencyScanner::ScanByType(const GUID& asset, AssetType type) {
+    const AssetMetadata* metadata = m_Registry ? m_Registry->GetAsset(asset) : nullptr;
+    if (!metadata) {
+        return {};
+    }
+    
+    const FileScan* file = FindFileScan(asset);
+    switch (type) {
+        case AssetType::Material:
+            return UniqueTargets(ScanMaterialDependencies(*metadata, file));
+        case AssetType::Scene:
+            return UniqueTargets(ScanSceneDependencies(*metadata, file));
+        case AssetType::Prefab:
+            return UniqueTargets(ScanPrefabDependencies(*metadata, file));
+        default:
+            return metadata->dependencies;
+    }
+}
+
+std::vector<AssetPropertyReference> DependencyScanner::ScanMaterialDependencies(const AssetMetadata& metadata, const FileScan* file) {
+    std::vector<AssetPropertyReference> references;
     
-    // TODO: Parse prefab file format to extract all referenced assets
+    // Materials typically depend on textures and shaders, named in the import
+    // settings (a JSON string) and in the .lmat itself
+    if (!metadata.importSettings.empty()) {
+        ExtractReferences(metadata.importSettings, metadata.guid, references);
+    }
     
-    // Remove duplicates
-    std::sort(dependencies.begin(), dependencies.end());
-    dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+    if (file) {
+        references.insert(references.end(), file->references.begin(), file->references.end());
+    } else {
+        AppendListedDependencies(metadata, references);
+    }
+    return references;
+}
+
+std::vector<AssetPropertyReference> DependencyScanner::ScanSceneDependencies(const AssetMetadata& metadata, const FileScan* file) {
+    // Scenes can reference many assets (models, materials, textures, prefabs, etc.)
+    if (file) {
+        return file->references;
+    }
     
-    return dependencies;
+    std::vector<AssetPropertyReference> references;
+    AppendListedDependencies(metadata, references);
+    return references;
+}
+
+std::vector<AssetPropertyReference> DependencyScanner::ScanPrefabDependencies(const AssetMetadata& metadata, const FileScan* file) {
+    // Prefabs can reference models, materials, textures, other prefabs, etc.
+    if (file) {
+        return file->references;
+    }
+    
+    std::vector<AssetPropertyReference> references;
+    AppendListedDependencies(metadata, references);
+    return references;
 }
 
 std::vector<GUID> DependencyScanner::ExtractGUIDsFromJson(const std::string& jsonString, const std::string& key) {
@@ -225,71 +612,166 @@ std::vector<GUID> DependencyScanner::ExtractGUIDsFromJson(const std::string& jso
 }
 
 void DependencyScanner::ScanAll(std::function<void(int, int)> progressCallback) {
+    LGE_PROFILE_SCOPE("DependencyScanner::ScanAll");
     if (!m_Registry || !m_Graph) {
         Log::Error("AssetRegistry or DependencyGraph is null in DependencyScanner");
         return;
     }
     
-    // Get all assets
-    std::vector<AssetType> allTypes = {
-        AssetType::Texture, AssetType::Model, AssetType::Material,
-        AssetType::Shader, AssetType::Script, AssetType::Audio,
-        AssetType::Scene, AssetType::Prefab, AssetType::Animation, AssetType::Font
-    };
-    
-    int totalAssets = 0;
-    for (AssetType type : allTypes) {
-        totalAssets += static_cast<int>(m_Registry->GetAssetCountByType(type));
+    std::vector<GUID> assets = CollectAllAssets();
+    
+    // Parse every file up front in parallel; the graph, index and registry
+    // are then updated on this thread. With a single worker the up-front pass
+    // only adds hand-offs, so each file is parsed right before it is applied.
+    bool streaming = JobSystem::GetWorkerCount() <= 1 && m_VFS;
+    if (streaming) {
+        m_FilesParsed = 0;
+        m_FilesReused = 0;
+    } else {
+        RefreshFileScans(assets);
     }
     
+    int totalAssets = static_cast<int>(assets.size());
     int processed = 0;
-    
-    for (AssetType type : allTypes) {
-        std::vector<AssetMetadata*> assets = m_Registry->GetAssetsByType(type);
-        for (AssetMetadata* metadata : assets) {
-            if (metadata && metadata->guid.IsValid()) {
-                RescanAsset(metadata->guid);
-                processed++;
-                
-                if (progressCallback) {
-                    progressCallback(processed, totalAssets);
-                }
-            }
+    for (const GUID& asset : assets) {
+        if (streaming) {
+            RefreshFileScan(asset);
+        }
+        const AssetMetadata* metadata = m_Registry->GetAsset(asset);
+        if (metadata) {
+            ApplyReferences(asset, ScanMetadata(*metadata));
+        }
+        processed++;
+        
+        if (progressCallback) {
+            progressCallback(processed, totalAssets);
         }
     }
     
-    Log::Info("Dependency scanning complete. Scanned " + std::to_string(processed) + " assets.");
+    Log::Info("Dependency scanning complete. Scanned " + std::to_string(processed) + " assets (" +
+              std::to_string(m_FilesParsed) + " files parsed, " + std::to_string(m_FilesReused) + " unchanged).");
 }
 
-void DependencyScanner::RescanAsset(const GUID& asset) {
-    if (!m_Graph) {
-        return;
-    }
+void DependencyScanner::ApplyReferences(const GUID& asset, const std::vector<AssetPropertyReference>& references) {
+    std::vector<GUID> dependencies = UniqueTargets(references);
     
-    // Remove old dependencies
-    m_Graph->RemoveDependencies(asset);
+    // Only the outgoing edges: what depends on this asset is the other assets' business
+    m_Graph->SetDependencies(asset, dependencies);
     
-    // Scan for new dependencies
-    std::vector<GUID> dependencies = ScanAsset(asset);
-    
-    // Add new dependencies to graph
-    for (const auto& dep : dependencies) {
-        m_Graph->AddDependency(asset, dep);
+    if (m_ReferenceIndex) {
+        m_ReferenceIndex->SetReferences(asset, references);
     }
     
     // Update metadata dependencies
     if (m_Registry) {
         AssetMetadata* metadata = m_Registry->GetAsset(asset);
-        if (metadata) {
+        if (metadata && metadata->dependencies != dependencies) {
             metadata->dependencies = dependencies;
+            // Marked dirty only: writing the whole cache per asset made ScanAll quadratic
             m_Registry->UpdateAsset(asset, *metadata);
             m_Registry->SetDirty(true);
-            m_Registry->SaveToCache();
         }
     }
+}
+
+void DependencyScanner::RescanAsset(const GUID& asset) {
+    if (!m_Graph) {
+        return;
+    }
+    
+    std::vector<AssetPropertyReference> references = ScanReferences(asset);
+    ApplyReferences(asset, references);
+    
+    Log::Info("Rescanned dependencies for asset: " + asset.ToString() + " (" + std::to_string(UniqueTargets(references).size()) + " dependencies)");
+}
+
+void DependencyScanner::IndexAll(AssetReferenceIndex& index) {
+    LGE_PROFILE_SCOPE("DependencyScanner::IndexAll");
+    index.Clear();
+    if (!m_Registry) {
+        return;
+    }
+    
+    std::vector<GUID> assets = CollectAllAssets();
+    RefreshFileScans(assets);
+    
+    for (const GUID& asset : assets) {
+        index.SetReferences(asset, ScanMetadata(*m_Registry->GetAsset(asset)));
+    }
+}
+
+bool DependencyScanner::SaveFileScans(const std::filesystem::path& path) const {
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+    }
+    
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        Log::Error("Failed to save dependency scan cache: " + path.string());
+        return false;
+    }
+    
+    out.write(kFileScanMagic, sizeof(kFileScanMagic));
+    uint32_t count = static_cast<uint32_t>(m_FileScans.size());
+    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (const auto& [asset, scan] : m_FileScans) {
+        uint64_t high = asset.GetHigh();
+        uint64_t low = asset.GetLow();
+        uint32_t referenceCount = static_cast<uint32_t>(scan.references.size());
+        out.write(reinterpret_cast<const char*>(&high), sizeof(high));
+        out.write(reinterpret_cast<const char*>(&low), sizeof(low));
+        out.write(reinterpret_cast<const char*>(&scan.contentHash), sizeof(scan.contentHash));
+        out.write(reinterpret_cast<const char*>(&referenceCount), sizeof(referenceCount));
+        for (const AssetPropertyReference& reference : scan.references) {
+            high = reference.target.GetHigh();
+            low = reference.target.GetLow();
+            out.write(reinterpret_cast<const char*>(&high), sizeof(high));
+            out.write(reinterpret_cast<const char*>(&low), sizeof(low));
+            WriteString(out, reference.propertyPath);
+        }
+    }
+    return out.good();
+}
+
+bool DependencyScanner::LoadFileScans(const std::filesystem::path& path) {
+    m_FileScans.clear();
+    FileView file = MappedFile::Open(path.string(), FileAccessHint::Sequential);
+    if (!file.IsValid()) {
+        return false;
+    }
     
-    Log::Info("Rescanned dependencies for asset: " + asset.ToString() + " (" + std::to_string(dependencies.size()) + " dependencies)");
+    IndexReader reader{ file.GetData(), file.GetSize() };
+    char magic[sizeof(kFileScanMagic)];
+    uint32_t count = 0;
+    if (!reader.Read(magic) || std::memcmp(magic, kFileScanMagic, sizeof(magic)) != 0 || !reader.Read(count)) {
+        Log::Warn("Dependency scan cache has an unknown format: " + path.string());
+        return false;
+    }
+    
+    m_FileScans.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        uint64_t high = 0;
+        uint64_t low = 0;
+        uint32_t referenceCount = 0;
+        FileScan scan;
+        bool ok = reader.Read(high) && reader.Read(low) && reader.Read(scan.contentHash) && reader.Read(referenceCount);
+        for (uint32_t r = 0; ok && r < referenceCount; ++r) {
+            AssetPropertyReference reference;
+            uint64_t targetHigh = 0;
+            uint64_t targetLow = 0;
+            ok = reader.Read(targetHigh) && reader.Read(targetLow) && reader.ReadString(reference.propertyPath);
+            reference.target = GUID(targetHigh, targetLow);
+            scan.references.push_back(std::move(reference));
+        }
+        if (!ok) {
+            Log::Warn("Dependency scan cache is truncated: " + path.string());
+            m_FileScans.clear();
+            return false;
+        }
+        m_FileScans[GUID(high, low)] = std::move(scan);
+    }
+    return true;
 }
 
 } // namespace LGE
-
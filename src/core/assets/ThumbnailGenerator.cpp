@@ -24,18 +24,26 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/ThumbnailGenerator.h"
 #include "LGE/core/Log.h"
 #include "LGE/core/filesystem/FileSystem.h"
-#include "LGE/rendering/Texture.h"
 #include <algorithm>
+#include <fstream>
 
 // Include stb_image (already implemented in Texture.cpp)
 #include "../../third_party/stb_image.h"
 
 namespace LGE {
 
-ThumbnailGenerator::ThumbnailGenerator(AssetRegistry* registry, VirtualFileSystem* vfs, const std::filesystem::path& cacheDir)
+namespace {
+
+constexpr uint32_t kThumbnailCacheMagic = 0x4D48544C; // 'LTHM'
+
+} // namespace
+
+ThumbnailGenerator::ThumbnailGenerator(AssetRegistry* registry, VirtualFileSystem* vfs, const std::filesystem::path& cacheDir,
+                                       int thumbnailSize)
     : m_Registry(registry)
     , m_VFS(vfs)
     , m_CacheDirectory(cacheDir)
+    , m_ThumbnailSize(std::max(thumbnailSize, 1))
     , m_IsRunning(true)
 {
     // Create cache directory if it doesn't exist
@@ -57,68 +65,94 @@ ThumbnailGenerator::~ThumbnailGenerator() {
 }
 
 void ThumbnailGenerator::RequestThumbnail(const GUID& guid) {
-    // Check if already in cache
-    {
-        std::lock_guard<std::mutex> lock(m_CacheMutex);
-        if (m_Cache.find(guid) != m_Cache.end()) {
-            return; // Already cached
-        }
+    // Already cached or on its way
+    if (!m_Requested.insert(guid).second) {
+        return;
     }
     
-    // Check if already in queue
     {
         std::lock_guard<std::mutex> lock(m_QueueMutex);
-        // Simple check - in production, would use a set to avoid duplicates
         m_GenerationQueue.push(guid);
     }
     
     m_QueueCV.notify_one();
 }
 
-std::shared_ptr<Texture> ThumbnailGenerator::GetThumbnail(const GUID& guid) {
-    std::lock_guard<std::mutex> lock(m_CacheMutex);
+void ThumbnailGenerator::ProcessUploads(uint32_t maxUploads) {
+    std::vector<GeneratedThumbnail> generated;
+    {
+        std::lock_guard<std::mutex> lock(m_GeneratedMutex);
+        if (m_Generated.empty()) {
+            return;
+        }
+        size_t count = std::min<size_t>(maxUploads, m_Generated.size());
+        generated.assign(std::make_move_iterator(m_Generated.begin()),
+                         std::make_move_iterator(m_Generated.begin() + count));
+        m_Generated.erase(m_Generated.begin(), m_Generated.begin() + count);
+    }
     
-    auto it = m_Cache.find(guid);
-    if (it != m_Cache.end()) {
-        return it->second;
+    if (!m_Pool.IsInitialized() && !m_Pool.Initialize(m_ThumbnailSize, m_ThumbnailSize)) {
+        Log::Error("Failed to create thumbnail texture array");
+        return;
     }
     
-    // Return placeholder
-    return GetPlaceholderTexture();
+    for (auto& thumbnail : generated) {
+        // Cleared or regenerated while the worker was busy
+        if (m_Requested.find(thumbnail.guid) == m_Requested.end()) {
+            continue;
+        }
+        
+        uint32_t layer = m_Pool.Allocate();
+        if (layer == TextureArrayPool::InvalidLayer) {
+            continue;
+        }
+        if (!m_Pool.Upload(layer, thumbnail.pixels.data())) {
+            m_Pool.Free(layer);
+            continue;
+        }
+        
+        auto it = m_Cache.find(thumbnail.guid);
+        if (it != m_Cache.end()) {
+            m_Pool.Free(it->second);
+        }
+        m_Cache[thumbnail.guid] = layer;
+        
+        // Notify callback
+        if (onThumbnailReady) {
+            onThumbnailReady(thumbnail.guid);
+        }
+    }
 }
 
-bool ThumbnailGenerator::IsThumbnailReady(const GUID& guid) {
-    std::lock_guard<std::mutex> lock(m_CacheMutex);
+uint32_t ThumbnailGenerator::GetThumbnail(const GUID& guid) const {
+    auto it = m_Cache.find(guid);
+    return it != m_Cache.end() ? m_Pool.GetLayerView(it->second) : 0;
+}
+
+bool ThumbnailGenerator::IsThumbnailReady(const GUID& guid) const {
     return m_Cache.find(guid) != m_Cache.end();
 }
 
 void ThumbnailGenerator::RegenerateThumbnail(const GUID& guid) {
-    // Remove from cache
-    {
-        std::lock_guard<std::mutex> lock(m_CacheMutex);
-        m_Cache.erase(guid);
-    }
+    // Keep the old layer visible until the new pixels arrive
+    m_Requested.erase(guid);
+    std::filesystem::path cachePath = m_CacheDirectory / (guid.ToString() + ".thumb");
+    std::error_code ec;
+    std::filesystem::remove(cachePath, ec);
     
     // Request regeneration
     RequestThumbnail(guid);
 }
 
 void ThumbnailGenerator::ClearCache() {
-    std::lock_guard<std::mutex> lock(m_CacheMutex);
-    m_Cache.clear();
-}
-
-std::shared_ptr<Texture> ThumbnailGenerator::GetPlaceholderTexture() {
-    // Create a simple placeholder texture (1x1 gray pixel)
-    static std::shared_ptr<Texture> placeholder = nullptr;
-    
-    if (!placeholder) {
-        placeholder = std::make_shared<Texture>();
-        uint8_t grayData[4] = {128, 128, 128, 255};
-        // Create texture from data (simplified - would need proper Texture creation)
+    for (const auto& pair : m_Cache) {
+        m_Pool.Free(pair.second);
     }
+    m_Cache.clear();
+    m_Requested.clear();
     
-    return placeholder;
+    std::lock_guard<std::mutex> lock(m_GeneratedMutex);
+    m_Generated.clear();
 }
 
 void ThumbnailGenerator::GeneratorThreadFunc() {
@@ -146,85 +180,139 @@ void ThumbnailGenerator::GeneratorThreadFunc() {
         const AssetMetadata* metadata = m_Registry->GetAsset(guid);
         if (!metadata) continue;
         
-        std::shared_ptr<Texture> thumbnail = GenerateThumbnailForType(*metadata);
-        
-        if (thumbnail) {
-            // Store in cache
-            {
-                std::lock_guard<std::mutex> lock(m_CacheMutex);
-                m_Cache[guid] = thumbnail;
-            }
-            
-            // Notify callback
-            if (onThumbnailReady) {
-                onThumbnailReady(guid);
-            }
+        GeneratedThumbnail thumbnail;
+        thumbnail.guid = guid;
+        if (GenerateThumbnailForType(*metadata, thumbnail.pixels)) {
+            std::lock_guard<std::mutex> lock(m_GeneratedMutex);
+            m_Generated.push_back(std::move(thumbnail));
         }
     }
 }
 
-std::shared_ptr<Texture> ThumbnailGenerator::GenerateThumbnailForType(const AssetMetadata& metadata, int size) {
-    std::filesystem::path assetPath = m_VFS ? m_VFS->ResolveVirtualPath(metadata.virtualPath) : metadata.virtualPath;
+bool ThumbnailGenerator::GenerateThumbnailForType(const AssetMetadata& metadata, std::vector<uint8_t>& outPixels) {
+    std::filesystem::path assetPath = m_VFS ? m_VFS->ResolveVirtualPath(metadata.virtualPath) : std::filesystem::path(metadata.virtualPath);
     
+    if (LoadCachedThumbnail(metadata.guid, assetPath, outPixels)) {
+        return true;
+    }
+    
+    bool generated = false;
     switch (metadata.type) {
         case AssetType::Texture:
-            return TextureThumbnailGenerator::Generate(assetPath, size);
+            generated = TextureThumbnailGenerator::Generate(assetPath, m_ThumbnailSize, outPixels);
+            break;
         case AssetType::Model:
-            return ModelThumbnailGenerator::Generate(assetPath, size);
+            generated = ModelThumbnailGenerator::Generate(assetPath, m_ThumbnailSize, outPixels);
+            break;
         default:
-            // Return placeholder for unsupported types
-            return GetPlaceholderTexture();
+            // Unsupported types keep the caller's fallback icon
+            break;
+    }
+    
+    if (generated) {
+        SaveCachedThumbnail(metadata.guid, outPixels);
     }
+    return generated;
 }
 
-std::shared_ptr<Texture> ThumbnailGenerator::LoadCachedThumbnail(const GUID& guid) {
-    std::filesystem::path cachePath = m_CacheDirectory / (guid.ToString() + ".png");
+bool ThumbnailGenerator::LoadCachedThumbnail(const GUID& guid, const std::filesystem::path& sourcePath,
+                                             std::vector<uint8_t>& outPixels) {
+    std::filesystem::path cachePath = m_CacheDirectory / (guid.ToString() + ".thumb");
+    
+    // Stale once the source changes
+    std::error_code ec;
+    auto cacheTime = std::filesystem::last_write_time(cachePath, ec);
+    if (ec) {
+        return false;
+    }
+    auto sourceTime = std::filesystem::last_write_time(sourcePath, ec);
+    if (!ec && sourceTime > cacheTime) {
+        return false;
+    }
     
-    if (!std::filesystem::exists(cachePath)) {
-        return nullptr;
+    std::ifstream file(cachePath, std::ios::binary);
+    uint32_t header[2] = {};
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+        header[0] != kThumbnailCacheMagic || header[1] != static_cast<uint32_t>(m_ThumbnailSize)) {
+        return false;
     }
     
-    // Load cached thumbnail
-    auto texture = std::make_shared<Texture>();
-    // Load texture from file (simplified)
-    return texture;
+    outPixels.resize(static_cast<size_t>(m_ThumbnailSize) * static_cast<size_t>(m_ThumbnailSize) * 4);
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(outPixels.data()), static_cast<std::streamsize>(outPixels.size())));
 }
 
-void ThumbnailGenerator::SaveCachedThumbnail(const GUID& guid, std::shared_ptr<Texture> thumbnail) {
-    // Save thumbnail to cache directory
-    // Implementation would save texture as PNG
+void ThumbnailGenerator::SaveCachedThumbnail(const GUID& guid, const std::vector<uint8_t>& pixels) {
+    std::filesystem::path cachePath = m_CacheDirectory / (guid.ToString() + ".thumb");
+    std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        Log::Warn("Failed to write thumbnail cache: " + cachePath.string());
+        return;
+    }
+    
+    uint32_t header[2] = { kThumbnailCacheMagic, static_cast<uint32_t>(m_ThumbnailSize) };
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
 }
 
 // TextureThumbnailGenerator implementation
-std::shared_ptr<Texture> TextureThumbnailGenerator::Generate(const std::filesystem::path& path, int size) {
-    if (!std::filesystem::exists(path)) {
-        return nullptr;
+bool TextureThumbnailGenerator::Generate(const std::filesystem::path& path, int size, std::vector<uint8_t>& outPixels) {
+    if (size <= 0 || !std::filesystem::exists(path)) {
+        return false;
     }
     
     // Load image
+    FileView file = MappedFile::Open(path.string(), FileAccessHint::Sequential);
     int width, height, channels;
-    unsigned char* data = stbi_load(path.string().c_str(), &width, &height, &channels, 4);
+    unsigned char* data = file.IsValid()
+        ? stbi_load_from_memory(file.GetData(), static_cast<int>(file.GetSize()), &width, &height, &channels, 4)
+        : nullptr;
     
     if (!data) {
-        return nullptr;
+        return false;
     }
     
-    // For now, create a simple texture from the loaded data
-    // In production, would resize to thumbnail size
-    auto texture = std::make_shared<Texture>();
-    // Create texture from data (would need proper Texture::Create method)
+    // Fit inside the square, centered; each output texel averages its source footprint
+    float scale = std::min(static_cast<float>(size) / static_cast<float>(width),
+                           static_cast<float>(size) / static_cast<float>(height));
+    int fitWidth = std::clamp(static_cast<int>(width * scale + 0.5f), 1, size);
+    int fitHeight = std::clamp(static_cast<int>(height * scale + 0.5f), 1, size);
+    int offsetX = (size - fitWidth) / 2;
+    int offsetY = (size - fitHeight) / 2;
+    
+    outPixels.assign(static_cast<size_t>(size) * static_cast<size_t>(size) * 4, 0);
+    for (int y = 0; y < fitHeight; ++y) {
+        int sy0 = y * height / fitHeight;
+        int sy1 = std::max((y + 1) * height / fitHeight, sy0 + 1);
+        for (int x = 0; x < fitWidth; ++x) {
+            int sx0 = x * width / fitWidth;
+            int sx1 = std::max((x + 1) * width / fitWidth, sx0 + 1);
+            
+            uint32_t sum[4] = {};
+            for (int sy = sy0; sy < sy1; ++sy) {
+                const unsigned char* row = data + (static_cast<size_t>(sy) * width) * 4;
+                for (int sx = sx0; sx < sx1; ++sx) {
+                    for (int c = 0; c < 4; ++c) {
+                        sum[c] += row[static_cast<size_t>(sx) * 4 + c];
+                    }
+                }
+            }
+            
+            uint32_t count = static_cast<uint32_t>((sy1 - sy0) * (sx1 - sx0));
+            uint8_t* dst = outPixels.data() + (static_cast<size_t>(y + offsetY) * size + (x + offsetX)) * 4;
+            for (int c = 0; c < 4; ++c) {
+                dst[c] = static_cast<uint8_t>((sum[c] + count / 2) / count);
+            }
+        }
+    }
     
     stbi_image_free(data);
-    return texture;
+    return true;
 }
 
 // ModelThumbnailGenerator implementation
-std::shared_ptr<Texture> ModelThumbnailGenerator::Generate(const std::filesystem::path& path, int size) {
+bool ModelThumbnailGenerator::Generate(const std::filesystem::path& path, int size, std::vector<uint8_t>& outPixels) {
     // Placeholder - would load model and render to offscreen buffer
-    return nullptr;
+    return false;
 }
 
 } // namespace LGE
-
-
-
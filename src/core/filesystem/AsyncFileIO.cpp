@@ -0,0 +1,843 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+#include "LGE/core/filesystem/AsyncFileIO.h"
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/Log.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#ifdef _WIN32
+#include <windows.h>
+#include <malloc.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+namespace LGE {
+
+namespace {
+
+size_t AlignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+uint8_t* AlignedAlloc(size_t size, size_t alignment) {
+#ifdef _WIN32
+    return static_cast<uint8_t*>(_aligned_malloc(size, alignment));
+#else
+    void* memory = nullptr;
+    return posix_memalign(&memory, alignment, size) == 0 ? static_cast<uint8_t*>(memory) : nullptr;
+#endif
+}
+
+// Largest single read: Linux transfers at most 2 GiB less a page per call and
+// io_uring lengths are 32-bit. Page aligned, so direct reads stay aligned.
+constexpr size_t kMaxReadChunk = 0x7ffff000;
+
+void AlignedFree(uint8_t* memory) {
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+// Positional file access; handles are fds on POSIX and HANDLEs on Windows
+#ifdef _WIN32
+
+intptr_t OpenForRead(const std::string& path, bool direct, bool& outDirect, int& outError) {
+    DWORD flags = FILE_ATTRIBUTE_NORMAL | (direct ? FILE_FLAG_NO_BUFFERING : FILE_FLAG_SEQUENTIAL_SCAN);
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_EXISTING, flags, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        outError = GetLastError() == ERROR_FILE_NOT_FOUND || GetLastError() == ERROR_PATH_NOT_FOUND ? ENOENT : EIO;
+        return -1;
+    }
+    outDirect = direct;
+    return reinterpret_cast<intptr_t>(file);
+}
+
+void CloseFile(intptr_t file) {
+    CloseHandle(reinterpret_cast<HANDLE>(file));
+}
+
+bool QueryFileSize(intptr_t file, uint64_t& outSize) {
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(reinterpret_cast<HANDLE>(file), &size)) {
+        return false;
+    }
+    outSize = static_cast<uint64_t>(size.QuadPart);
+    return true;
+}
+
+int64_t ReadAt(intptr_t file, uint8_t* buffer, size_t length, uint64_t offset) {
+    OVERLAPPED overlapped = {};
+    overlapped.Offset = static_cast<DWORD>(offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    DWORD read = 0;
+    if (!::ReadFile(reinterpret_cast<HANDLE>(file), buffer, static_cast<DWORD>(std::min(length, kMaxReadChunk)), &read, &overlapped)) {
+        return GetLastError() == ERROR_HANDLE_EOF ? 0 : -EIO;
+    }
+    return static_cast<int64_t>(read);
+}
+
+#else
+
+intptr_t OpenForRead(const std::string& path, bool direct, bool& outDirect, int& outError) {
+    int flags = O_RDONLY | O_CLOEXEC;
+#ifdef O_DIRECT
+    if (direct) {
+        int fd = ::open(path.c_str(), flags | O_DIRECT);
+        if (fd >= 0) {
+            outDirect = true;
+            return fd;
+        }
+        // tmpfs and some network filesystems refuse O_DIRECT; read them buffered
+        if (errno != EINVAL) {
+            outError = errno;
+            return -1;
+        }
+    }
+#endif
+    outDirect = false;
+    int fd = ::open(path.c_str(), flags);
+    if (fd < 0) {
+        outError = errno;
+    }
+    return fd;
+}
+
+void CloseFile(intptr_t file) {
+    ::close(static_cast<int>(file));
+}
+
+bool QueryFileSize(intptr_t file, uint64_t& outSize) {
+    struct stat info;
+    if (fstat(static_cast<int>(file), &info) != 0) {
+        return false;
+    }
+    outSize = static_cast<uint64_t>(info.st_size);
+    return true;
+}
+
+int64_t ReadAt(intptr_t file, uint8_t* buffer, size_t length, uint64_t offset) {
+    ssize_t read = ::pread(static_cast<int>(file), buffer, std::min(length, kMaxReadChunk), static_cast<off_t>(offset));
+    return read < 0 ? -static_cast<int64_t>(errno) : static_cast<int64_t>(read);
+}
+
+#endif
+
+} // namespace
+
+// Submission and completion rings shared with the kernel, mapped once. Only the
+// ring thread touches them. An eventfd read is kept armed in the ring so a
+// Submit from any thread can wake the thread out of io_uring_enter.
+struct AsyncFileIO::Ring {
+#ifdef __linux__
+    int fd = -1;
+    int wakeFd = -1;
+    uint64_t wakeValue = 0;
+    bool fixedBuffers = false;
+    unsigned pendingSubmit = 0;
+    
+    void* sqMemory = nullptr;
+    size_t sqMemorySize = 0;
+    void* cqMemory = nullptr;
+    size_t cqMemorySize = 0;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqesSize = 0;
+    
+    unsigned* sqTail = nullptr;
+    unsigned sqMask = 0;
+    unsigned* sqArray = nullptr;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned cqMask = 0;
+    io_uring_cqe* cqes = nullptr;
+    
+    static constexpr uint64_t kWakeTag = 0;
+    
+    io_uring_sqe* NextSqe() {
+        unsigned tail = *sqTail;
+        unsigned index = tail & sqMask;
+        io_uring_sqe* sqe = &sqes[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqArray[index] = index;
+        __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+        ++pendingSubmit;
+        return sqe;
+    }
+#endif
+};
+
+AsyncFileIO::AsyncFileIO()
+    : m_Initialized(false)
+    , m_Stopping(false)
+    , m_NextId(1)
+    , m_InFlight(0)
+    , m_BufferMemory(nullptr)
+    , m_Ring(nullptr)
+{
+}
+
+AsyncFileIO::~AsyncFileIO() {
+    Shutdown();
+}
+
+AsyncFileIO& AsyncFileIO::Get() {
+    static AsyncFileIO service;
+    return service;
+}
+
+bool AsyncFileIO::Initialize(const AsyncIOConfig& config) {
+    std::lock_guard<std::mutex> initLock(m_InitMutex);
+    if (IsInitialized()) {
+        return true;
+    }
+    
+    m_Config = config;
+    m_Config.queueDepth = std::max(m_Config.queueDepth, 1u);
+    m_Config.bufferCount = std::max(m_Config.bufferCount, 1u);
+    m_Config.bufferSize = AlignUp(std::max<size_t>(m_Config.bufferSize, kDirectAlignment), kDirectAlignment);
+    m_Config.fallbackThreads = std::max(m_Config.fallbackThreads, 1u);
+    
+    m_BufferMemory = AlignedAlloc(m_Config.bufferSize * m_Config.bufferCount, kDirectAlignment);
+    if (!m_BufferMemory) {
+        Log::Error("AsyncFileIO: failed to allocate read buffers");
+        return false;
+    }
+    m_FreeBuffers.clear();
+    for (int i = static_cast<int>(m_Config.bufferCount) - 1; i >= 0; --i) {
+        m_FreeBuffers.push_back(i);
+    }
+    
+    m_Stopping = false;
+    m_Stats = AsyncIOStats();
+    if (m_Config.allowIoUring && CreateRing()) {
+        m_Threads.emplace_back(&AsyncFileIO::RingThread, this);
+    } else {
+        for (uint32_t i = 0; i < m_Config.fallbackThreads; ++i) {
+            m_Threads.emplace_back(&AsyncFileIO::WorkerThread, this);
+        }
+    }
+    
+    m_Initialized.store(true, std::memory_order_release);
+    Log::Info(std::string("AsyncFileIO initialized (") + GetBackendName() + ", queue depth " +
+              std::to_string(m_Config.queueDepth) + ", " + std::to_string(m_Config.bufferCount) + " x " +
+              std::to_string(m_Config.bufferSize / 1024) + " KB buffers)");
+    return true;
+}
+
+void AsyncFileIO::Shutdown() {
+    std::lock_guard<std::mutex> initLock(m_InitMutex);
+    if (!IsInitialized()) {
+        return;
+    }
+    
+    WaitIdle();
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    Wake();
+    m_QueueCV.notify_all();
+    for (std::thread& thread : m_Threads) {
+        thread.join();
+    }
+    m_Threads.clear();
+    
+    DestroyRing();
+    for (auto& [key, file] : m_OpenFiles) {
+        CloseFile(file.handle);
+    }
+    m_OpenFiles.clear();
+    AlignedFree(m_BufferMemory);
+    m_BufferMemory = nullptr;
+    m_FreeBuffers.clear();
+    m_Initialized.store(false, std::memory_order_release);
+}
+
+const char* AsyncFileIO::GetBackendName() const {
+    if (!IsInitialized()) {
+        return "none";
+    }
+    return m_Ring ? "io_uring" : "thread pool";
+}
+
+void AsyncFileIO::EnsureInitialized() {
+    if (!IsInitialized()) {
+        Initialize();
+    }
+}
+
+bool AsyncFileIO::IsLowerPrecedence(const QueuedRead& a, const QueuedRead& b) {
+    // Priority, then earliest deadline, then submission order
+    if (a.request.priority != b.request.priority) {
+        return a.request.priority < b.request.priority;
+    }
+    if (a.request.deadline != b.request.deadline) {
+        return a.request.deadline > b.request.deadline;
+    }
+    return a.id > b.id;
+}
+
+uint64_t AsyncFileIO::Submit(IOReadRequest request) {
+    EnsureInitialized();
+    uint64_t id = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        id = m_NextId++;
+        m_Queue.push_back(QueuedRead{ std::move(request), id, std::chrono::steady_clock::now() });
+        std::push_heap(m_Queue.begin(), m_Queue.end(), IsLowerPrecedence);
+        ++m_Stats.submitted;
+    }
+    Wake();
+    return id;
+}
+
+uint64_t AsyncFileIO::SubmitBatch(std::vector<IOReadRequest>& requests) {
+    EnsureInitialized();
+    if (requests.empty()) {
+        return 0;
+    }
+    
+    uint64_t firstId = 0;
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        firstId = m_NextId;
+        for (IOReadRequest& request : requests) {
+            m_Queue.push_back(QueuedRead{ std::move(request), m_NextId++, now });
+            std::push_heap(m_Queue.begin(), m_Queue.end(), IsLowerPrecedence);
+        }
+        m_Stats.submitted += requests.size();
+    }
+    requests.clear();
+    Wake();
+    return firstId;
+}
+
+void AsyncFileIO::WaitIdle() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_IdleCV.wait(lock, [this]() { return m_Stats.completed == m_Stats.submitted; });
+}
+
+AsyncIOStats AsyncFileIO::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    AsyncIOStats stats = m_Stats;
+    stats.queued = static_cast<uint32_t>(m_Queue.size());
+    stats.inFlight = m_InFlight;
+    return stats;
+}
+
+void AsyncFileIO::Wake() {
+#ifdef __linux__
+    if (m_Ring) {
+        uint64_t one = 1;
+        ssize_t written = ::write(m_Ring->wakeFd, &one, sizeof(one));
+        (void)written;
+        return;
+    }
+#endif
+    m_QueueCV.notify_all();
+}
+
+intptr_t AsyncFileIO::AcquireFile(const std::string& path, bool direct, std::string& outKey, bool& outDirect, int& outError) {
+    outKey = (direct ? "D|" : "B|") + path;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_OpenFiles.find(outKey);
+        if (it != m_OpenFiles.end()) {
+            ++it->second.users;
+            outDirect = it->second.direct;
+            return it->second.handle;
+        }
+    }
+    
+    // Open outside the lock; a racing open of the same file loses and closes
+    intptr_t handle = OpenForRead(path, direct, outDirect, outError);
+    if (handle < 0) {
+        return -1;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto [it, inserted] = m_OpenFiles.try_emplace(outKey, OpenFile{ handle, 0, outDirect });
+    if (!inserted) {
+        CloseFile(handle);
+        outDirect = it->second.direct;
+    }
+    ++it->second.users;
+    
+    // Keep a bounded set of descriptors; anything in use stays open
+    if (m_OpenFiles.size() > kMaxOpenFiles) {
+        for (auto file = m_OpenFiles.begin(); file != m_OpenFiles.end() && m_OpenFiles.size() > kMaxOpenFiles;) {
+            if (file->second.users == 0) {
+                CloseFile(file->second.handle);
+                file = m_OpenFiles.erase(file);
+            } else {
+                ++file;
+            }
+        }
+    }
+    return it->second.handle;
+}
+
+void AsyncFileIO::ReleaseFile(const std::string& key) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = m_OpenFiles.find(key);
+    if (it != m_OpenFiles.end() && it->second.users > 0) {
+        --it->second.users;
+    }
+}
+
+AsyncFileIO::ActiveRead* AsyncFileIO::PrepareRead(QueuedRead& read, bool& outNoBuffer) {
+    outNoBuffer = false;
+    const IOReadRequest& request = read.request;
+    
+    std::string key;
+    bool direct = false;
+    int error = 0;
+    intptr_t file = AcquireFile(request.path, request.direct, key, direct, error);
+    
+    uint64_t size = request.size;
+    if (file >= 0 && size == 0) {
+        uint64_t fileSize = 0;
+        if (QueryFileSize(file, fileSize)) {
+            size = fileSize > request.offset ? fileSize - request.offset : 0;
+        } else {
+            error = errno ? errno : EIO;
+        }
+    }
+    
+    auto active = new ActiveRead();
+    active->file = file;
+    active->fileKey = key;
+    active->requested = static_cast<size_t>(size);
+    active->fileOffset = request.offset;
+    active->length = static_cast<size_t>(size);
+    if (direct) {
+        active->fileOffset = request.offset & ~static_cast<uint64_t>(kDirectAlignment - 1);
+        active->head = static_cast<size_t>(request.offset - active->fileOffset);
+        active->length = AlignUp(active->head + active->requested, kDirectAlignment);
+    }
+    
+    if (file < 0 || error != 0 || active->length == 0) {
+        active->read = std::move(read);
+        CompleteRead(active, file < 0 || error != 0 ? -static_cast<int64_t>(error ? error : EIO) : 0);
+        return nullptr;
+    }
+    
+    if (active->length <= m_Config.bufferSize) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_FreeBuffers.empty()) {
+            auto it = m_OpenFiles.find(key);
+            if (it != m_OpenFiles.end() && it->second.users > 0) {
+                --it->second.users;
+            }
+            delete active;
+            outNoBuffer = true;
+            return nullptr;
+        }
+        active->bufferIndex = m_FreeBuffers.back();
+        m_FreeBuffers.pop_back();
+        active->buffer = m_BufferMemory + static_cast<size_t>(active->bufferIndex) * m_Config.bufferSize;
+    } else {
+        active->buffer = AlignedAlloc(active->length, kDirectAlignment);
+        if (!active->buffer) {
+            active->read = std::move(read);
+            CompleteRead(active, -ENOMEM);
+            return nullptr;
+        }
+    }
+    
+    active->read = std::move(read);
+    return active;
+}
+
+void AsyncFileIO::CompleteRead(ActiveRead* active, int64_t result) {
+    if (active->file >= 0) {
+        ReleaseFile(active->fileKey);
+    }
+    
+    auto now = std::chrono::steady_clock::now();
+    IOReadResult readResult;
+    readResult.id = active->read.id;
+    readResult.success = result >= 0;
+    readResult.error = result < 0 ? static_cast<int>(-result) : 0;
+    if (readResult.success) {
+        // Short reads end at EOF
+        size_t transferred = static_cast<size_t>(result);
+        readResult.size = transferred > active->head ? std::min(transferred - active->head, active->requested) : 0;
+        readResult.data = active->buffer ? active->buffer + active->head : nullptr;
+    }
+    readResult.missedDeadline = now > active->read.request.deadline;
+    readResult.latencyMs = std::chrono::duration<double, std::milli>(now - active->read.submitTime).count();
+    
+    if (active->read.request.context == IOCompletionContext::JobSystem && active->read.request.onComplete) {
+        JobSystem::Submit([this, active, readResult]() {
+            active->read.request.onComplete(readResult);
+            FinishRead(active, readResult);
+        });
+        return;
+    }
+    
+    if (active->read.request.onComplete) {
+        active->read.request.onComplete(readResult);
+    }
+    FinishRead(active, readResult);
+}
+
+void AsyncFileIO::FinishRead(ActiveRead* active, const IOReadResult& result) {
+    if (active->bufferIndex < 0 && active->buffer) {
+        AlignedFree(active->buffer);
+    }
+    
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (active->bufferIndex >= 0) {
+            m_FreeBuffers.push_back(active->bufferIndex);
+        }
+        --m_InFlight;
+        ++m_Stats.completed;
+        m_Stats.failed += result.success ? 0 : 1;
+        m_Stats.bytesRead += result.size;
+        m_Stats.deadlineMisses += result.missedDeadline ? 1 : 0;
+        wake = !m_Queue.empty();
+        if (m_Stats.completed == m_Stats.submitted) {
+            m_IdleCV.notify_all();
+        }
+    }
+    delete active;
+    
+    // A freed buffer or slot may unblock queued reads
+    if (wake) {
+        Wake();
+    }
+}
+
+void AsyncFileIO::WorkerThread() {
+    while (true) {
+        QueuedRead read;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_QueueCV.wait(lock, [this]() { return m_Stopping || !m_Queue.empty(); });
+            if (m_Queue.empty()) {
+                return;
+            }
+            std::pop_heap(m_Queue.begin(), m_Queue.end(), IsLowerPrecedence);
+            read = std::move(m_Queue.back());
+            m_Queue.pop_back();
+            ++m_InFlight;
+        }
+        
+        bool noBuffer = false;
+        ActiveRead* active = PrepareRead(read, noBuffer);
+        if (noBuffer) {
+            // Put it back and wait for a completion to return a buffer
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            --m_InFlight;
+            m_Queue.push_back(std::move(read));
+            std::push_heap(m_Queue.begin(), m_Queue.end(), IsLowerPrecedence);
+            m_QueueCV.wait(lock, [this]() { return m_Stopping || !m_FreeBuffers.empty(); });
+            continue;
+        }
+        if (!active) {
+            continue;
+        }
+        
+        size_t done = 0;
+        int64_t result = 0;
+        while (done < active->length) {
+            result = ReadAt(active->file, active->buffer + done, active->length - done, active->fileOffset + done);
+            if (result <= 0) {
+                break;
+            }
+            done += static_cast<size_t>(result);
+        }
+        CompleteRead(active, result < 0 ? result : static_cast<int64_t>(done));
+    }
+}
+
+#ifdef __linux__
+
+namespace {
+
+int RingSetup(unsigned entries, io_uring_params* params) {
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int RingEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+}
+
+int RingRegister(int fd, unsigned opcode, const void* arg, unsigned count) {
+    return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, count));
+}
+
+} // namespace
+
+bool AsyncFileIO::CreateRing() {
+    auto ring = new Ring();
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    
+    // One extra slot for the wake read; completions get the default 2x
+    unsigned entries = 1;
+    while (entries < m_Config.queueDepth + 1) {
+        entries <<= 1;
+    }
+    
+    const char* failure = nullptr;
+    ring->fd = RingSetup(entries, &params);
+    if (ring->fd < 0) {
+        failure = "io_uring_setup";
+    } else if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+        // IORING_OP_READ arrived together with this feature (5.6)
+        failure = "kernel too old";
+    }
+    
+    if (!failure) {
+        ring->sqMemorySize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        ring->cqMemorySize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap) {
+            ring->sqMemorySize = ring->cqMemorySize = std::max(ring->sqMemorySize, ring->cqMemorySize);
+        }
+        
+        ring->sqMemory = mmap(nullptr, ring->sqMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                              ring->fd, IORING_OFF_SQ_RING);
+        ring->cqMemory = singleMap ? ring->sqMemory
+                       : mmap(nullptr, ring->cqMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                              ring->fd, IORING_OFF_CQ_RING);
+        ring->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = mmap(nullptr, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          ring->fd, IORING_OFF_SQES);
+        
+        if (ring->sqMemory == MAP_FAILED || ring->cqMemory == MAP_FAILED || sqes == MAP_FAILED) {
+            failure = "mmap";
+            if (ring->sqMemory == MAP_FAILED) ring->sqMemory = nullptr;
+            if (ring->cqMemory == MAP_FAILED) ring->cqMemory = nullptr;
+            if (sqes != MAP_FAILED) munmap(sqes, ring->sqesSize);
+        } else {
+            uint8_t* sq = static_cast<uint8_t*>(ring->sqMemory);
+            uint8_t* cq = static_cast<uint8_t*>(ring->cqMemory);
+            ring->sqes = static_cast<io_uring_sqe*>(sqes);
+            ring->sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            ring->sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            ring->sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+            ring->cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            ring->cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            ring->cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+            ring->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        }
+    }
+    
+    if (!failure) {
+        ring->wakeFd = eventfd(0, EFD_CLOEXEC);
+        if (ring->wakeFd < 0) {
+            failure = "eventfd";
+        }
+    }
+    
+    m_Ring = ring;
+    if (failure) {
+        Log::Warn(std::string("AsyncFileIO: io_uring unavailable (") + failure + ": " + std::strerror(errno) +
+                  "), using the thread pool");
+        DestroyRing();
+        return false;
+    }
+    
+    // Pinned buffers skip the per-read page lookups; plain reads work without
+    std::vector<iovec> buffers(m_Config.bufferCount);
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        buffers[i].iov_base = m_BufferMemory + i * m_Config.bufferSize;
+        buffers[i].iov_len = m_Config.bufferSize;
+    }
+    ring->fixedBuffers = RingRegister(ring->fd, IORING_REGISTER_BUFFERS, buffers.data(),
+                                      static_cast<unsigned>(buffers.size())) == 0;
+    if (!ring->fixedBuffers) {
+        Log::Warn(std::string("AsyncFileIO: could not register buffers (") + std::strerror(errno) + ")");
+    }
+    
+    ArmRingWake();
+    return true;
+}
+
+void AsyncFileIO::DestroyRing() {
+    if (!m_Ring) {
+        return;
+    }
+    if (m_Ring->sqes) {
+        munmap(m_Ring->sqes, m_Ring->sqesSize);
+    }
+    if (m_Ring->cqMemory && m_Ring->cqMemory != m_Ring->sqMemory) {
+        munmap(m_Ring->cqMemory, m_Ring->cqMemorySize);
+    }
+    if (m_Ring->sqMemory) {
+        munmap(m_Ring->sqMemory, m_Ring->sqMemorySize);
+    }
+    if (m_Ring->wakeFd >= 0) {
+        ::close(m_Ring->wakeFd);
+    }
+    if (m_Ring->fd >= 0) {
+        ::close(m_Ring->fd);
+    }
+    delete m_Ring;
+    m_Ring = nullptr;
+}
+
+void AsyncFileIO::ArmRingWake() {
+    io_uring_sqe* sqe = m_Ring->NextSqe();
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = m_Ring->wakeFd;
+    sqe->addr = reinterpret_cast<uint64_t>(&m_Ring->wakeValue);
+    sqe->len = sizeof(m_Ring->wakeValue);
+    sqe->user_data = Ring::kWakeTag;
+}
+
+void AsyncFileIO::QueueRingRead(ActiveRead* active) {
+    io_uring_sqe* sqe = m_Ring->NextSqe();
+    if (m_Ring->fixedBuffers && active->bufferIndex >= 0) {
+        sqe->opcode = IORING_OP_READ_FIXED;
+        sqe->buf_index = static_cast<uint16_t>(active->bufferIndex);
+    } else {
+        sqe->opcode = IORING_OP_READ;
+    }
+    // Reads the remainder, one chunk at a time
+    sqe->fd = static_cast<int>(active->file);
+    sqe->addr = reinterpret_cast<uint64_t>(active->buffer + active->done);
+    sqe->len = static_cast<uint32_t>(std::min(active->length - active->done, kMaxReadChunk));
+    sqe->off = active->fileOffset + active->done;
+    sqe->user_data = reinterpret_cast<uint64_t>(active);
+}
+
+void AsyncFileIO::RingThread() {
+    while (true) {
+        // Fill the ring up to the queue depth while buffers last
+        while (true) {
+            QueuedRead read;
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                if (m_Stopping) {
+                    return;
+                }
+                if (m_Queue.empty() || m_InFlight >= m_Config.queueDepth) {
+                    break;
+                }
+                std::pop_heap(m_Queue.begin(), m_Queue.end(), IsLowerPrecedence);
+                read = std::move(m_Queue.back());
+                m_Queue.pop_back();
+                ++m_InFlight;
+            }
+            
+            bool noBuffer = false;
+            ActiveRead* active = PrepareRead(read, noBuffer);
+            if (active) {
+                QueueRingRead(active);
+            } else if (noBuffer) {
+                // Requeue; FinishRead wakes us once a buffer is back. Keep going if
+                // one came back in the meantime.
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                --m_InFlight;
+                m_Queue.push_back(std::move(read));
+                std::push_heap(m_Queue.begin(), m_Queue.end(), IsLowerPrecedence);
+                if (m_FreeBuffers.empty()) {
+                    break;
+                }
+            }
+        }
+        
+        // Submit and block for at least one completion (a read or a wake)
+        int submitted = RingEnter(m_Ring->fd, m_Ring->pendingSubmit, 1, IORING_ENTER_GETEVENTS);
+        if (submitted < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            Log::Error(std::string("AsyncFileIO: io_uring_enter failed: ") + std::strerror(errno));
+        }
+        if (submitted > 0) {
+            m_Ring->pendingSubmit -= std::min(m_Ring->pendingSubmit, static_cast<unsigned>(submitted));
+        }
+        
+        unsigned head = *m_Ring->cqHead;
+        unsigned tail = __atomic_load_n(m_Ring->cqTail, __ATOMIC_ACQUIRE);
+        bool rearmWake = false;
+        while (head != tail) {
+            const io_uring_cqe& cqe = m_Ring->cqes[head & m_Ring->cqMask];
+            uint64_t userData = cqe.user_data;
+            int result = cqe.res;
+            ++head;
+            __atomic_store_n(m_Ring->cqHead, head, __ATOMIC_RELEASE);
+            
+            if (userData == Ring::kWakeTag) {
+                rearmWake = true;
+                continue;
+            }
+            
+            // Resubmit short reads until EOF (a zero-byte read) or an error,
+            // as the fallback workers do
+            auto active = reinterpret_cast<ActiveRead*>(userData);
+            if (result > 0) {
+                active->done += static_cast<size_t>(result);
+                if (active->done < active->length) {
+                    QueueRingRead(active);
+                    continue;
+                }
+            }
+            CompleteRead(active, result < 0 ? result : static_cast<int64_t>(active->done));
+        }
+        if (rearmWake) {
+            ArmRingWake();
+        }
+    }
+}
+
+#else
+
+bool AsyncFileIO::CreateRing() {
+    return false;
+}
+
+void AsyncFileIO::DestroyRing() {
+}
+
+void AsyncFileIO::ArmRingWake() {
+}
+
+void AsyncFileIO::QueueRingRead(ActiveRead*) {
+}
+
+void AsyncFileIO::RingThread() {
+}
+
+#endif
+
+} // namespace LGE
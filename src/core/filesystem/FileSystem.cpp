@@ -31,11 +31,12 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/filesystem/FileSystem.h"
 #include "LGE/core/Log.h"
 #include <fstream>
-#include <sstream>
 #include <filesystem>
 #include <vector>
 #include <algorithm>
 #include <chrono>
+#include <mutex>
+#include <unordered_map>
 #ifdef _WIN32
 #include <windows.h>
 // Undefine Windows macros that conflict with our methods
@@ -57,43 +58,84 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 namespace LGE {
 
-std::string FileSystem::ReadFile(const std::string& filepath) {
-    // Try multiple paths: relative to current directory, relative to executable, and absolute
-    std::vector<std::string> pathsToTry;
-    
-    // First try the path as-is (relative to current working directory)
-    pathsToTry.push_back(filepath);
+namespace {
+
+// Requested path -> first search path that had it. Misses are not cached so
+// files created later are still found.
+struct SearchPathCache {
+    std::mutex mutex;
+    std::unordered_map<std::string, std::string> resolved;
+    std::vector<std::filesystem::path> roots;
+};
+
+SearchPathCache& GetSearchPathCache() {
+    static SearchPathCache cache;
+    return cache;
+}
+
+} // namespace
+
+std::string FileSystem::ResolveSearchPath(const std::string& filepath) {
+    SearchPathCache& cache = GetSearchPathCache();
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        auto it = cache.resolved.find(filepath);
+        if (it != cache.resolved.end()) {
+            return it->second;
+        }
+        if (cache.roots.empty()) {
+            // As-is (relative to the working directory), then relative to the
+            // project root above build/bin/<Config>/
+            cache.roots.push_back(std::filesystem::path());
+            cache.roots.push_back(GetProjectRoot());
+        }
+    }
     
-    // Try relative to executable directory (for when running from build/bin/Release/)
-    #ifdef _WIN32
-    char exePath[MAX_PATH];
-    GetModuleFileNameA(NULL, exePath, MAX_PATH);
-    std::filesystem::path exeDir = std::filesystem::path(exePath).parent_path();
-    // Go up from build/bin/Release/ to project root
-    std::filesystem::path projectRoot = exeDir.parent_path().parent_path().parent_path();
-    pathsToTry.push_back((projectRoot / filepath).string());
-    #else
-    // For Linux/Mac, try relative to executable
-    char exePath[1024];
-    ssize_t count = readlink("/proc/self/exe", exePath, 1024);
-    if (count != -1) {
-        std::filesystem::path exeDir = std::filesystem::path(std::string(exePath, count)).parent_path();
-        std::filesystem::path projectRoot = exeDir.parent_path().parent_path().parent_path();
-        pathsToTry.push_back((projectRoot / filepath).string());
+    for (const auto& root : cache.roots) {
+        std::string candidate = root.empty() ? filepath : (root / filepath).string();
+        std::error_code ec;
+        if (std::filesystem::is_regular_file(candidate, ec)) {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            cache.resolved[filepath] = candidate;
+            return candidate;
+        }
     }
-    #endif
     
-    for (const auto& path : pathsToTry) {
-        std::ifstream file(path);
-        if (file.is_open()) {
-            std::stringstream buffer;
-            buffer << file.rdbuf();
-            return buffer.str();
+    return std::string();
+}
+
+void FileSystem::ClearSearchPathCache() {
+    SearchPathCache& cache = GetSearchPathCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.resolved.clear();
+}
+
+FileView FileSystem::MapFile(const std::string& filepath, FileAccessHint hint) {
+    std::string path = ResolveSearchPath(filepath);
+    FileView view = path.empty() ? FileView() : MappedFile::Open(path, hint);
+    
+    if (!view.IsValid() && !path.empty()) {
+        // Cached location went away; probe the search paths again
+        {
+            SearchPathCache& cache = GetSearchPathCache();
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            cache.resolved.erase(filepath);
+        }
+        path = ResolveSearchPath(filepath);
+        if (!path.empty()) {
+            view = MappedFile::Open(path, hint);
         }
     }
     
-    Log::Error("Failed to open file: " + filepath);
-    return "";
+    if (!view.IsValid()) {
+        Log::Error("Failed to open file: " + filepath);
+    }
+    return view;
+}
+
+std::string FileSystem::ReadFile(const std::string& filepath) {
+    FileView view = MapFile(filepath);
+    return std::string(view.AsStringView());
 }
 
 bool FileSystem::WriteFile(const std::string& filepath, const std::string& content) {
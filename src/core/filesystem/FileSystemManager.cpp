@@ -28,7 +28,9 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/AssetScanner.h"
 #include "LGE/core/assets/DependencyGraph.h"
 #include "LGE/core/assets/DependencyScanner.h"
+#include "LGE/core/assets/AssetReferenceIndex.h"
 #include "LGE/core/filesystem/FileSystemWatcher.h"
+#include "LGE/core/filesystem/PathTable.h"
 #include "LGE/core/assets/AssetHotReloader.h"
 #include "LGE/core/assets/AssetSearchIndex.h"
 #include "LGE/core/assets/AssetCollection.h"
@@ -38,11 +40,97 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/assets/AsyncAssetLoader.h"
 #include "LGE/core/assets/AssetRegistryCache.h"
 #include "LGE/core/assets/AssetValidator.h"
+#include "LGE/core/JobSystem.h"
 #include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
+#include <atomic>
+#include <condition_variable>
 #include <filesystem>
+#include <mutex>
+#include <unordered_map>
 
 namespace LGE {
 
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+} // namespace
+
+const char* GetProjectOpenStageName(ProjectOpenStage stage) {
+    switch (stage) {
+        case ProjectOpenStage::Idle: return "Idle";
+        case ProjectOpenStage::LoadingState: return "Loading project state";
+        case ProjectOpenStage::Reconciling: return "Checking assets on disk";
+        case ProjectOpenStage::Applying: return "Updating changed assets";
+        case ProjectOpenStage::Rebuilding: return "Rebuilding dependencies and search";
+        case ProjectOpenStage::Ready: return "Ready";
+        case ProjectOpenStage::Failed: return "Failed";
+    }
+    return "Unknown";
+}
+
+// Everything a project open carries between stages. The worker job owns the
+// fields it fills until it clears jobRunning; the main thread owns the rest.
+struct FileSystemManager::OpenState {
+    struct FileStamp {
+        std::time_t lastModified = 0;
+        uint64_t fileSize = 0;
+        bool known = false;
+    };
+    
+    std::shared_ptr<Project> project;
+    std::filesystem::path projectRoot;
+    Clock::time_point start;
+    
+    std::mutex mutex;
+    std::condition_variable jobDone;
+    bool jobRunning = false;
+    bool jobSucceeded = false;
+    std::atomic<bool> cancelled{ false };
+    std::atomic<uint32_t> jobProgress{ 0 };
+    
+    // LoadingState: published to the manager by PublishState
+    std::unique_ptr<VirtualFileSystem> vfs;
+    std::unique_ptr<GUIDRegistry> guidRegistry;
+    std::unique_ptr<AssetRegistry> assetRegistry;
+    std::unique_ptr<DependencyGraph> dependencyGraph;
+    std::unique_ptr<AssetReferenceIndex> referenceIndex;
+    std::unique_ptr<DependencyScanner> dependencyScanner;
+    std::unique_ptr<AssetSearchIndex> searchIndex;
+    std::unique_ptr<AssetRegistryCache> registryCache;
+    std::vector<FileStamp> knownFiles;   // Registry snapshot, indexed by the virtual path's PathId
+    size_t knownCount = 0;
+    
+    // Reconciling
+    std::vector<std::filesystem::path> changedFiles;
+    std::vector<std::string> removedPaths;
+    
+    // Applying and Rebuilding
+    size_t cursor = 0;
+    std::vector<GUID> dirtyAssets;
+    
+    template <typename Work>
+    static void RunJob(const std::shared_ptr<OpenState>& state, Work work) {
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->jobRunning = true;
+            state->jobProgress = 0;
+        }
+        JobSystem::Submit([state, work]() {
+            bool succeeded = work(*state);
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->jobSucceeded = succeeded;
+            state->jobRunning = false;
+            state->jobDone.notify_all();
+        });
+    }
+};
+
 FileSystemManager::FileSystemManager()
     : m_IsInitialized(false)
 {
@@ -59,32 +147,122 @@ bool FileSystemManager::Initialize(std::shared_ptr<Project> project) {
     }
     
     // Shutdown previous initialization if any
-    if (m_IsInitialized) {
-        Shutdown();
+    Shutdown();
+    
+    OpenState state;
+    state.project = project;
+    state.projectRoot = std::filesystem::path(project->GetProjectPath());
+    state.start = Clock::now();
+    if (!LoadPersistentState(state)) {
+        return false;
+    }
+    PublishState(state);
+    m_OpenProgress.stage = ProjectOpenStage::Ready;
+    return true;
+}
+
+bool FileSystemManager::BeginOpen(std::shared_ptr<Project> project) {
+    if (!project || !project->IsLoaded()) {
+        Log::Error("Cannot initialize FileSystemManager with invalid project");
+        return false;
     }
     
-    m_Project = project;
-    std::filesystem::path projectRoot = std::filesystem::path(project->GetProjectPath());
+    Shutdown();
     
-    // Initialize Virtual File System
-    m_VFS = std::make_unique<VirtualFileSystem>();
-    m_VFS->Initialize(projectRoot);
+    m_Open = std::make_shared<OpenState>();
+    m_Open->project = project;
+    m_Open->projectRoot = std::filesystem::path(project->GetProjectPath());
+    m_Open->start = Clock::now();
+    m_OpenProgress = ProjectOpenProgress();
+    m_OpenProgress.stage = ProjectOpenStage::LoadingState;
     
-    // Initialize GUID Registry
-    m_GUIDRegistry = std::make_unique<GUIDRegistry>();
-    std::filesystem::path guidRegistryPath = projectRoot / "Intermediate" / "guid_registry.json";
-    m_GUIDRegistry->LoadFromFile(guidRegistryPath);
+    OpenState::RunJob(m_Open, [](OpenState& state) {
+        return LoadPersistentState(state);
+    });
+    return true;
+}
+
+bool FileSystemManager::LoadPersistentState(OpenState& state) {
+    LGE_PROFILE_SCOPE("FileSystemManager::LoadPersistentState");
+    const std::filesystem::path& projectRoot = state.projectRoot;
     
-    // Initialize Asset Registry
-    m_AssetRegistry = std::make_unique<AssetRegistry>();
-    std::filesystem::path assetCachePath = projectRoot / "Intermediate" / "AssetCache" / "asset_registry.json";
-    m_AssetRegistry->SetCacheFilePath(assetCachePath);
-    m_AssetRegistry->LoadFromCache();
+    // Initialize Virtual File System
+    state.vfs = std::make_unique<VirtualFileSystem>();
+    state.vfs->Initialize(projectRoot);
+    
+    state.guidRegistry = std::make_unique<GUIDRegistry>();
+    state.assetRegistry = std::make_unique<AssetRegistry>();
+    state.assetRegistry->SetCacheFilePath(projectRoot / "Intermediate" / "AssetCache" / "asset_registry.json");
+    state.dependencyGraph = std::make_unique<DependencyGraph>(state.assetRegistry.get());
+    state.referenceIndex = std::make_unique<AssetReferenceIndex>();
+    state.dependencyScanner = std::make_unique<DependencyScanner>(
+        state.assetRegistry.get(),
+        state.dependencyGraph.get(),
+        state.referenceIndex.get()
+    );
+    state.dependencyScanner->SetVirtualFileSystem(state.vfs.get());
+    state.searchIndex = std::make_unique<AssetSearchIndex>();
+    state.registryCache = std::make_unique<AssetRegistryCache>(projectRoot / "Intermediate" / "AssetCache" / "registry_cache.json");
+    
+    // The persisted files are independent of each other; parse them side by side
+    bool searchIndexLoaded = false;
+    bool referenceIndexLoaded = false;
+    JobSystem::ParallelFor(7, 1, [&](size_t begin, size_t end) {
+        for (size_t task = begin; task < end; ++task) {
+            switch (task) {
+                case 0: state.assetRegistry->LoadFromCache(); break;
+                case 1: {
+                    // Projects saved before the binary form only have guid_registry.json
+                    std::filesystem::path guidRegistryFile = projectRoot / "Intermediate" / "guid_registry.bin";
+                    if (!std::filesystem::exists(guidRegistryFile)) {
+                        guidRegistryFile.replace_extension(".json");
+                    }
+                    state.guidRegistry->LoadFromFile(guidRegistryFile);
+                    break;
+                }
+                case 2: searchIndexLoaded = state.searchIndex->LoadFromFile(projectRoot / "Intermediate" / "AssetCache" / "search_index.bin"); break;
+                case 3: state.dependencyGraph->LoadFromFile(projectRoot / "Intermediate" / "dependency_graph.json"); break;
+                case 4: state.registryCache->LoadCache(); break;
+                case 5: referenceIndexLoaded = state.referenceIndex->LoadFromFile(projectRoot / "Intermediate" / "AssetCache" / "reference_index.bin"); break;
+                case 6: state.dependencyScanner->LoadFileScans(projectRoot / "Intermediate" / "AssetCache" / "dependency_scans.bin"); break;
+            }
+        }
+    });
+    
+    // The persisted search index is used only when it still matches the registry
+    if (!searchIndexLoaded || state.searchIndex->GetEntryCount() != state.assetRegistry->GetAssetCount()) {
+        state.searchIndex->RebuildIndex(state.assetRegistry.get());
+    }
     
-    // Initialize Dependency Graph
-    m_DependencyGraph = std::make_unique<DependencyGraph>(m_AssetRegistry.get());
-    std::filesystem::path dependencyGraphPath = projectRoot / "Intermediate" / "dependency_graph.json";
-    m_DependencyGraph->LoadFromFile(dependencyGraphPath);
+    // Same for the reference index; the rebuild reuses the cached file scans
+    if (!referenceIndexLoaded || state.referenceIndex->GetIndexedCount() != state.assetRegistry->GetAssetCount()) {
+        state.dependencyScanner->IndexAll(*state.referenceIndex);
+    }
+    
+    // Snapshot what the registry believes is on disk for the reconcile walk
+    // (PathIds are dense, so a flat table beats a map with 100k+ nodes)
+    state.knownFiles.resize(PathTable::Get().GetCount() + 1);
+    state.assetRegistry->ForEachAsset([&](const AssetMetadata& metadata) {
+        PathId pathId = PathTable::Get().Find(metadata.virtualPath);
+        if (metadata.type != AssetType::Unknown && pathId < state.knownFiles.size()) {
+            state.knownFiles[pathId] = { metadata.lastModified, metadata.fileSize, true };
+            ++state.knownCount;
+        }
+    });
+    return true;
+}
+
+void FileSystemManager::PublishState(OpenState& state) {
+    m_Project = state.project;
+    m_VFS = std::move(state.vfs);
+    m_GUIDRegistry = std::move(state.guidRegistry);
+    m_AssetRegistry = std::move(state.assetRegistry);
+    m_DependencyGraph = std::move(state.dependencyGraph);
+    m_ReferenceIndex = std::move(state.referenceIndex);
+    m_DependencyScanner = std::move(state.dependencyScanner);
+    m_SearchIndex = std::move(state.searchIndex);
+    m_RegistryCache = std::move(state.registryCache);
+    std::filesystem::path projectRoot = state.projectRoot;
     
     // Initialize Asset Scanner
     std::filesystem::path assetsPath = projectRoot / "Assets";
@@ -95,16 +273,6 @@ bool FileSystemManager::Initialize(std::shared_ptr<Project> project) {
         assetsPath
     );
     
-    // Initialize Dependency Scanner
-    m_DependencyScanner = std::make_unique<DependencyScanner>(
-        m_AssetRegistry.get(),
-        m_DependencyGraph.get()
-    );
-    
-    // Initialize Asset Search Index
-    m_SearchIndex = std::make_unique<AssetSearchIndex>();
-    m_SearchIndex->RebuildIndex(m_AssetRegistry.get());
-    
     // Initialize Collection Manager
     m_CollectionManager = std::make_unique<CollectionManager>(
         m_AssetRegistry.get(),
@@ -132,11 +300,6 @@ bool FileSystemManager::Initialize(std::shared_ptr<Project> project) {
     // Initialize Async Asset Loader
     m_AsyncAssetLoader = std::make_unique<AsyncAssetLoader>(m_AssetLoader.get(), 4);
     
-    // Initialize Asset Registry Cache
-    std::filesystem::path cachePath = projectRoot / "Intermediate" / "AssetCache" / "registry_cache.json";
-    m_RegistryCache = std::make_unique<AssetRegistryCache>(cachePath);
-    m_RegistryCache->LoadCache();
-    
     // Initialize Asset Validator
     m_AssetValidator = std::make_unique<AssetValidator>(
         m_AssetRegistry.get(),
@@ -150,29 +313,249 @@ bool FileSystemManager::Initialize(std::shared_ptr<Project> project) {
     );
     
     m_IsInitialized = true;
-    Log::Info("FileSystemManager initialized for project: " + project->GetInfo().name);
+    Log::Info("FileSystemManager initialized for project: " + m_Project->GetInfo().name);
+}
+
+void FileSystemManager::Update(double budgetMs) {
+    if (!m_Open) {
+        return;
+    }
+    
+    LGE_PROFILE_SCOPE("FileSystemManager::Update");
+    OpenState& state = *m_Open;
+    Clock::time_point deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double, std::milli>(budgetMs));
+    m_OpenProgress.elapsedMs = MillisecondsSince(state.start);
+    
+    bool succeeded = false;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.jobRunning) {
+            m_OpenProgress.done = state.jobProgress.load(std::memory_order_relaxed);
+            return;
+        }
+        succeeded = state.jobSucceeded;
+    }
     
+    if (m_OpenProgress.stage == ProjectOpenStage::LoadingState) {
+        if (!succeeded) {
+            Log::Error("Failed to load project state for: " + state.project->GetInfo().name);
+            m_OpenProgress.stage = ProjectOpenStage::Failed;
+            m_Open.reset();
+            return;
+        }
+        PublishState(state);
+        m_OpenProgress.interactiveMs = MillisecondsSince(state.start);
+        
+        // Watch before walking: a change lands either in the walk or in the
+        // watcher's queue, never in between
+        EnableHotReloading(true);
+        StartReconcile();
+        return;
+    }
+    
+    if (m_OpenProgress.stage == ProjectOpenStage::Reconciling) {
+        m_OpenProgress.stage = ProjectOpenStage::Applying;
+        m_OpenProgress.changedFiles = static_cast<uint32_t>(state.changedFiles.size());
+        m_OpenProgress.removedFiles = static_cast<uint32_t>(state.removedPaths.size());
+        m_OpenProgress.done = 0;
+        m_OpenProgress.total = m_OpenProgress.changedFiles + m_OpenProgress.removedFiles;
+        state.cursor = 0;
+    }
+    
+    if (m_OpenProgress.stage == ProjectOpenStage::Applying) {
+        if (!ApplyReconcile(state, deadline)) {
+            return;
+        }
+        m_OpenProgress.stage = ProjectOpenStage::Rebuilding;
+        m_OpenProgress.done = 0;
+        m_OpenProgress.total = static_cast<uint32_t>(state.dirtyAssets.size());
+        state.cursor = 0;
+    }
+    
+    if (m_OpenProgress.stage == ProjectOpenStage::Rebuilding) {
+        if (!RebuildDirty(state, deadline)) {
+            return;
+        }
+        // Persist the reconciled state so the next open starts warm
+        if (!state.dirtyAssets.empty() || m_OpenProgress.removedFiles > 0) {
+            m_AssetRegistry->SaveToCache();
+            m_SearchIndex->SaveToFile(state.projectRoot / "Intermediate" / "AssetCache" / "search_index.bin");
+            m_ReferenceIndex->SaveToFile(state.projectRoot / "Intermediate" / "AssetCache" / "reference_index.bin");
+            m_DependencyScanner->SaveFileScans(state.projectRoot / "Intermediate" / "AssetCache" / "dependency_scans.bin");
+        }
+        m_OpenProgress.stage = ProjectOpenStage::Ready;
+        m_OpenProgress.elapsedMs = MillisecondsSince(state.start);
+        Log::Info("Project open: interactive after " + std::to_string(static_cast<int>(m_OpenProgress.interactiveMs)) +
+                  " ms, ready after " + std::to_string(static_cast<int>(m_OpenProgress.elapsedMs)) + " ms (" +
+                  std::to_string(m_OpenProgress.changedFiles) + " changed, " +
+                  std::to_string(m_OpenProgress.removedFiles) + " removed)");
+        m_Open.reset();
+    }
+}
+
+void FileSystemManager::StartReconcile() {
+    m_OpenProgress.stage = ProjectOpenStage::Reconciling;
+    m_OpenProgress.done = 0;
+    m_OpenProgress.total = static_cast<uint32_t>(m_Open->knownCount);
+    
+    const AssetScanner* scanner = m_AssetScanner.get();
+    std::filesystem::path assetsRoot = m_Open->projectRoot / "Assets";
+    OpenState::RunJob(m_Open, [scanner, assetsRoot](OpenState& state) {
+        LGE_PROFILE_SCOPE("FileSystemManager::Reconcile");
+        std::error_code ec;
+        if (!std::filesystem::is_directory(assetsRoot, ec)) {
+            Log::Warn("Assets root does not exist: " + assetsRoot.string());
+            return true;
+        }
+        
+        // Virtual paths are the root's plus the lexical remainder, which is what
+        // ProcessFile derives without resolving every file through relative()
+        std::string prefix = scanner->GetVirtualPath(assetsRoot);
+        if (!prefix.empty() && prefix.back() == '/') {
+            prefix.pop_back();
+        }
+        size_t rootLength = assetsRoot.generic_string().size();
+        
+        bool complete = true;
+        auto options = std::filesystem::directory_options::skip_permission_denied;
+        std::filesystem::recursive_directory_iterator it(assetsRoot, options, ec);
+        for (; !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+            if (state.cancelled.load(std::memory_order_relaxed)) {
+                return false;
+            }
+            const std::filesystem::directory_entry& entry = *it;
+            std::error_code entryError;
+            if (!entry.is_regular_file(entryError) || AssetScanner::ShouldIgnoreFile(entry.path()) ||
+                AssetScanner::DetectAssetType(entry.path()) == AssetType::Unknown) {
+                continue;
+            }
+            
+            std::string virtualPath = prefix + entry.path().generic_string().substr(rootLength);
+            std::time_t lastModified = AssetMetadata::ToFileStamp(entry.last_write_time(entryError));
+            uint64_t fileSize = entry.file_size(entryError);
+            PathId pathId = PathTable::Get().Find(virtualPath);
+            if (pathId >= state.knownFiles.size() || !state.knownFiles[pathId].known) {
+                state.changedFiles.push_back(entry.path());
+            } else {
+                OpenState::FileStamp& known = state.knownFiles[pathId];
+                // Any change counts: restored backups and VCS checkouts can move the time backwards
+                if (lastModified != known.lastModified || fileSize != known.fileSize) {
+                    state.changedFiles.push_back(entry.path());
+                }
+                known.known = false;
+            }
+            state.jobProgress.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (ec) {
+            // A partial walk can't tell deleted files from unvisited ones
+            Log::Warn("Asset reconcile stopped early (" + ec.message() + "); keeping unseen assets");
+            complete = false;
+        }
+        
+        if (complete) {
+            for (PathId pathId = 0; pathId < state.knownFiles.size(); ++pathId) {
+                if (state.knownFiles[pathId].known) {
+                    state.removedPaths.emplace_back(PathTable::Get().GetString(pathId));
+                }
+            }
+        }
+        state.knownFiles = std::vector<OpenState::FileStamp>();
+        return true;
+    });
+}
+
+bool FileSystemManager::ApplyReconcile(OpenState& state, Clock::time_point deadline) {
+    size_t total = state.changedFiles.size() + state.removedPaths.size();
+    while (state.cursor < total) {
+        if (state.cursor < state.changedFiles.size()) {
+            const std::filesystem::path& path = state.changedFiles[state.cursor];
+            if (m_AssetScanner->ProcessFile(path)) {
+                const AssetMetadata* metadata = m_AssetRegistry->GetAssetByPath(m_AssetScanner->GetVirtualPath(path));
+                if (metadata) {
+                    state.dirtyAssets.push_back(metadata->guid);
+                }
+            }
+        } else {
+            // Re-checked here: the watcher may have seen it come back since the walk
+            const std::string& virtualPath = state.removedPaths[state.cursor - state.changedFiles.size()];
+            const AssetMetadata* metadata = m_AssetRegistry->GetAssetByPath(virtualPath);
+            std::error_code ec;
+            if (metadata && !std::filesystem::exists(m_VFS->ResolveVirtualPath(virtualPath), ec)) {
+                GUID guid = metadata->guid;
+                m_SearchIndex->RemoveAsset(guid);
+                m_DependencyGraph->RemoveDependencies(guid);
+                m_ReferenceIndex->RemoveAsset(guid);
+                m_AssetRegistry->UnregisterAsset(guid);
+            }
+        }
+        
+        ++state.cursor;
+        m_OpenProgress.done = static_cast<uint32_t>(state.cursor);
+        if ((state.cursor & 31) == 0 && Clock::now() >= deadline) {
+            return state.cursor == total;
+        }
+    }
     return true;
 }
 
-void FileSystemManager::Shutdown() {
-    if (!m_IsInitialized) {
+bool FileSystemManager::RebuildDirty(OpenState& state, Clock::time_point deadline) {
+    while (state.cursor < state.dirtyAssets.size()) {
+        const GUID& guid = state.dirtyAssets[state.cursor];
+        m_SearchIndex->UpdateAsset(guid, m_AssetRegistry.get());
+        m_DependencyScanner->RescanAsset(guid);
+        
+        ++state.cursor;
+        m_OpenProgress.done = static_cast<uint32_t>(state.cursor);
+        if ((state.cursor & 15) == 0 && Clock::now() >= deadline) {
+            return state.cursor == state.dirtyAssets.size();
+        }
+    }
+    return true;
+}
+
+void FileSystemManager::WaitForOpenJob() {
+    if (!m_Open) {
         return;
     }
-    
-    // Save all persistent data
-    if (m_GUIDRegistry && m_Project) {
-        std::filesystem::path guidRegistryPath = std::filesystem::path(m_Project->GetProjectPath()) / "Intermediate" / "guid_registry.json";
-        m_GUIDRegistry->SaveToFile(guidRegistryPath);
+    m_Open->cancelled = true;
+    std::unique_lock<std::mutex> lock(m_Open->mutex);
+    m_Open->jobDone.wait(lock, [this]() { return !m_Open->jobRunning; });
+}
+
+void FileSystemManager::WaitForOpenJob(double timeoutMs) {
+    if (!m_Open) {
+        return;
+    }
+    OpenState& state = *m_Open;
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.jobDone.wait_for(lock, std::chrono::duration<double, std::milli>(timeoutMs), [&state]() { return !state.jobRunning; });
+}
+
+void FileSystemManager::SavePersistentState() {
+    std::filesystem::path projectRoot = std::filesystem::path(m_Project->GetProjectPath());
+    if (m_GUIDRegistry) {
+        m_GUIDRegistry->SaveToFile(projectRoot / "Intermediate" / "guid_registry.bin");
     }
     
     if (m_AssetRegistry) {
         m_AssetRegistry->SaveToCache();
     }
     
-    if (m_DependencyGraph && m_Project) {
-        std::filesystem::path dependencyGraphPath = std::filesystem::path(m_Project->GetProjectPath()) / "Intermediate" / "dependency_graph.json";
-        m_DependencyGraph->SaveToFile(dependencyGraphPath);
+    if (m_DependencyGraph) {
+        m_DependencyGraph->SaveToFile(projectRoot / "Intermediate" / "dependency_graph.json");
+    }
+    
+    if (m_ReferenceIndex) {
+        m_ReferenceIndex->SaveToFile(projectRoot / "Intermediate" / "AssetCache" / "reference_index.bin");
+    }
+    
+    if (m_DependencyScanner) {
+        m_DependencyScanner->SaveFileScans(projectRoot / "Intermediate" / "AssetCache" / "dependency_scans.bin");
+    }
+    
+    if (m_SearchIndex) {
+        m_SearchIndex->SaveToFile(projectRoot / "Intermediate" / "AssetCache" / "search_index.bin");
     }
     
     if (m_CollectionManager) {
@@ -186,6 +569,22 @@ void FileSystemManager::Shutdown() {
     if (m_RegistryCache) {
         m_RegistryCache->SaveCacheBlocking();
     }
+}
+
+void FileSystemManager::Shutdown() {
+    // An open still in flight is abandoned; its job has to let go of the state first
+    WaitForOpenJob();
+    m_Open.reset();
+    m_OpenProgress = ProjectOpenProgress();
+    
+    if (!m_IsInitialized) {
+        return;
+    }
+    
+    // Save all persistent data
+    if (m_Project) {
+        SavePersistentState();
+    }
     
     // Disable hot reloading
     if (m_HotReloader) {
@@ -209,6 +608,7 @@ void FileSystemManager::Shutdown() {
     m_CollectionManager.reset();
     m_SearchIndex.reset();
     m_DependencyScanner.reset();
+    m_ReferenceIndex.reset();
     m_DependencyGraph.reset();
     m_AssetScanner.reset();
     m_AssetRegistry.reset();
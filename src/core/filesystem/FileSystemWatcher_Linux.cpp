@@ -27,6 +27,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/Log.h"
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/eventfd.h>
 #include <limits.h>
 #include <algorithm>
 
@@ -34,6 +35,7 @@ namespace LGE {
 
 LinuxFileSystemWatcher::LinuxFileSystemWatcher()
     : m_InotifyFd(-1)
+    , m_WakeFd(-1)
     , m_ShouldStop(false)
 {
 }
@@ -60,6 +62,7 @@ bool LinuxFileSystemWatcher::StartWatching(const std::filesystem::path& director
         Log::Error("Failed to initialize inotify");
         return false;
     }
+    m_WakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
     
     // Add recursive watches
     AddWatchRecursive(directory, -1);
@@ -79,6 +82,11 @@ void LinuxFileSystemWatcher::StopWatching() {
     
     m_ShouldStop = true;
     m_IsWatching = false;
+    if (m_WakeFd >= 0) {
+        uint64_t one = 1;
+        ssize_t written = write(m_WakeFd, &one, sizeof(one));
+        (void)written;
+    }
     
     if (m_WatchThread.joinable()) {
         m_WatchThread.join();
@@ -94,6 +102,10 @@ void LinuxFileSystemWatcher::StopWatching() {
         close(m_InotifyFd);
         m_InotifyFd = -1;
     }
+    if (m_WakeFd >= 0) {
+        close(m_WakeFd);
+        m_WakeFd = -1;
+    }
     
     Log::Info("Stopped watching directory");
 }
@@ -129,12 +141,15 @@ void LinuxFileSystemWatcher::WatchThreadFunc() {
         fd_set readFds;
         FD_ZERO(&readFds);
         FD_SET(m_InotifyFd, &readFds);
+        if (m_WakeFd >= 0) {
+            FD_SET(m_WakeFd, &readFds);
+        }
         
         struct timeval timeout;
         timeout.tv_sec = 1;
         timeout.tv_usec = 0;
         
-        int result = select(m_InotifyFd + 1, &readFds, NULL, NULL, &timeout);
+        int result = select(std::max(m_InotifyFd, m_WakeFd) + 1, &readFds, NULL, NULL, &timeout);
         
         if (result > 0 && FD_ISSET(m_InotifyFd, &readFds)) {
             ssize_t length = read(m_InotifyFd, buffer, bufferSize);
@@ -0,0 +1,187 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+#include "LGE/core/filesystem/MappedFile.h"
+#include <algorithm>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace LGE {
+
+MappedFile::MappedFile()
+    : m_Data(nullptr)
+    , m_Size(0)
+    , m_IsMapped(false)
+{
+}
+
+MappedFile::~MappedFile() {
+    if (!m_IsMapped) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(m_Data);
+#else
+    munmap(const_cast<uint8_t*>(m_Data), m_Size);
+#endif
+}
+
+#ifdef _WIN32
+
+FileView MappedFile::Open(const std::string& path, FileAccessHint hint) {
+    DWORD flags = hint == FileAccessHint::Random ? FILE_FLAG_RANDOM_ACCESS : FILE_FLAG_SEQUENTIAL_SCAN;
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | flags, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return FileView();
+    }
+    
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return FileView();
+    }
+    
+    std::shared_ptr<MappedFile> mapped(new MappedFile());
+    mapped->m_Size = static_cast<size_t>(fileSize.QuadPart);
+    
+    if (mapped->m_Size >= kMapThreshold) {
+        // The view keeps the section alive once both handles are closed
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping) {
+            void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (data) {
+                mapped->m_Data = static_cast<const uint8_t*>(data);
+                mapped->m_IsMapped = true;
+            }
+        }
+    }
+    
+    if (!mapped->m_IsMapped && mapped->m_Size > 0) {
+        mapped->m_Buffer.resize(mapped->m_Size);
+        size_t offset = 0;
+        while (offset < mapped->m_Size) {
+            DWORD chunk = static_cast<DWORD>(std::min<size_t>(mapped->m_Size - offset, 1u << 30));
+            DWORD read = 0;
+            if (!::ReadFile(file, mapped->m_Buffer.data() + offset, chunk, &read, nullptr) || read == 0) {
+                CloseHandle(file);
+                return FileView();
+            }
+            offset += read;
+        }
+        mapped->m_Data = mapped->m_Buffer.data();
+    }
+    
+    CloseHandle(file);
+    const uint8_t* data = mapped->m_Data;
+    size_t size = mapped->m_Size;
+    return FileView(std::move(mapped), data, size);
+}
+
+#else
+
+FileView MappedFile::Open(const std::string& path, FileAccessHint hint) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return FileView();
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        ::close(fd);
+        return FileView();
+    }
+    
+    std::shared_ptr<MappedFile> mapped(new MappedFile());
+    mapped->m_Size = static_cast<size_t>(info.st_size);
+    
+    if (mapped->m_Size >= kMapThreshold) {
+        int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+        // Decoders touch every page anyway; fault them in with one syscall
+        if (hint != FileAccessHint::Random) {
+            flags |= MAP_POPULATE;
+        }
+#endif
+        void* data = mmap(nullptr, mapped->m_Size, PROT_READ, flags, fd, 0);
+        if (data != MAP_FAILED) {
+            int advice = hint == FileAccessHint::Random ? MADV_RANDOM
+                       : hint == FileAccessHint::WillNeed ? MADV_WILLNEED : MADV_SEQUENTIAL;
+            madvise(data, mapped->m_Size, advice);
+            mapped->m_Data = static_cast<const uint8_t*>(data);
+            mapped->m_IsMapped = true;
+        }
+    }
+    
+    if (!mapped->m_IsMapped && mapped->m_Size > 0) {
+        mapped->m_Buffer.resize(mapped->m_Size);
+        size_t offset = 0;
+        while (offset < mapped->m_Size) {
+            ssize_t read = ::pread(fd, mapped->m_Buffer.data() + offset, mapped->m_Size - offset, static_cast<off_t>(offset));
+            if (read <= 0) {
+                ::close(fd);
+                return FileView();
+            }
+            offset += static_cast<size_t>(read);
+        }
+        mapped->m_Data = mapped->m_Buffer.data();
+    }
+    
+    // The mapping outlives the descriptor
+    ::close(fd);
+    const uint8_t* data = mapped->m_Data;
+    size_t size = mapped->m_Size;
+    return FileView(std::move(mapped), data, size);
+}
+
+#endif
+
+FileView::FileView()
+    : m_Data(nullptr)
+    , m_Size(0)
+{
+}
+
+FileView::FileView(std::shared_ptr<const MappedFile> file, const uint8_t* data, size_t size)
+    : m_File(std::move(file))
+    , m_Data(data)
+    , m_Size(size)
+{
+}
+
+FileView FileView::SubView(size_t offset, size_t length) const {
+    if (!m_File) {
+        return FileView();
+    }
+    offset = std::min(offset, m_Size);
+    length = std::min(length, m_Size - offset);
+    return FileView(m_File, m_Data + offset, length);
+}
+
+} // namespace LGE
@@ -0,0 +1,287 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+#include "LGE/core/filesystem/PackageArchive.h"
+#include "LGE/core/Log.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+
+namespace LGE {
+
+namespace {
+
+constexpr char kArchiveMagic[8] = { 'L', 'G', 'E', 'P', 'A', 'K', '0', '1' };
+
+struct ArchiveHeader {
+    char magic[8];
+    uint32_t entryCount;
+    uint32_t reserved;
+    uint64_t tableOffset;
+};
+
+template<typename T>
+bool ReadValue(const FileView& data, uint64_t& offset, T& value) {
+    if (offset > data.GetSize() || data.GetSize() - offset < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, data.GetData() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+template<typename T>
+void WriteValue(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+} // namespace
+
+PackageArchive::PackageArchive() {
+}
+
+std::string PackageArchive::NormalizeEntryPath(std::string_view path) {
+    std::string normalized(path);
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+    
+    size_t start = normalized.find_first_not_of('/');
+    if (start == std::string::npos) {
+        return std::string();
+    }
+    size_t end = normalized.find_last_not_of('/');
+    return normalized.substr(start, end - start + 1);
+}
+
+bool PackageArchive::Open(const std::filesystem::path& archivePath) {
+    m_Entries.clear();
+    m_Directories.clear();
+    m_Path = archivePath;
+    
+    m_Data = MappedFile::Open(archivePath.string(), FileAccessHint::Random);
+    if (!m_Data.IsValid()) {
+        Log::Error("Failed to open package: " + archivePath.string());
+        return false;
+    }
+    
+    uint64_t fileSize = m_Data.GetSize();
+    uint64_t offset = 0;
+    ArchiveHeader header;
+    if (!ReadValue(m_Data, offset, header) || std::memcmp(header.magic, kArchiveMagic, sizeof(kArchiveMagic)) != 0 ||
+        header.tableOffset > fileSize) {
+        Log::Error("Not a valid package: " + archivePath.string());
+        m_Data = FileView();
+        return false;
+    }
+    
+    offset = header.tableOffset;
+    m_Entries.reserve(header.entryCount);
+    m_Directories[std::string()];
+    
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+        uint32_t pathLength = 0;
+        Entry entry;
+        std::string path;
+        bool valid = ReadValue(m_Data, offset, pathLength) && pathLength > 0 && pathLength <= fileSize - offset;
+        if (valid) {
+            path.assign(reinterpret_cast<const char*>(m_Data.GetData() + offset), pathLength);
+            offset += pathLength;
+            valid = ReadValue(m_Data, offset, entry.offset) && ReadValue(m_Data, offset, entry.size) &&
+                    entry.offset <= header.tableOffset && entry.size <= header.tableOffset - entry.offset;
+        }
+        if (!valid) {
+            Log::Error("Corrupt package table in " + archivePath.string());
+            m_Entries.clear();
+            m_Directories.clear();
+            m_Data = FileView();
+            return false;
+        }
+        
+        // Register the file with its parent and every missing ancestor folder
+        std::string child = path;
+        size_t slash = path.rfind('/');
+        while (true) {
+            std::string parent = slash == std::string::npos ? std::string() : path.substr(0, slash);
+            std::string name = slash == std::string::npos ? child : child.substr(slash + 1);
+            auto [it, inserted] = m_Directories.try_emplace(parent);
+            it->second.push_back(name);
+            if (!inserted || parent.empty()) {
+                break;
+            }
+            child = parent;
+            slash = parent.rfind('/');
+        }
+        
+        m_Entries[std::move(path)] = entry;
+    }
+    
+    return true;
+}
+
+bool PackageArchive::Build(const std::filesystem::path& sourceDirectory, const std::filesystem::path& outputPath) {
+    std::error_code ec;
+    if (!std::filesystem::is_directory(sourceDirectory, ec)) {
+        Log::Error("Package source is not a directory: " + sourceDirectory.string());
+        return false;
+    }
+    if (outputPath.has_parent_path()) {
+        std::filesystem::create_directories(outputPath.parent_path(), ec);
+    }
+    
+    std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        Log::Error("Failed to create package: " + outputPath.string());
+        return false;
+    }
+    
+    ArchiveHeader header;
+    std::memcpy(header.magic, kArchiveMagic, sizeof(kArchiveMagic));
+    header.entryCount = 0;
+    header.reserved = 0;
+    header.tableOffset = 0;
+    WriteValue(out, header);
+    
+    struct PackedFile {
+        std::string path;
+        uint64_t offset;
+        uint64_t size;
+    };
+    std::vector<PackedFile> files;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(sourceDirectory, ec)) {
+        if (entry.is_regular_file()) {
+            files.push_back({ std::filesystem::relative(entry.path(), sourceDirectory).generic_string(), 0, 0 });
+        }
+    }
+    
+    // All sources are read in one batch and appended in completion order; the
+    // table records where each landed. Completions run on the I/O thread and
+    // only copy into the output stream.
+    std::mutex writeMutex;
+    uint64_t offset = sizeof(ArchiveHeader);
+    bool failed = false;
+    std::vector<IOReadRequest> requests;
+    requests.reserve(files.size());
+    for (PackedFile& file : files) {
+        IOReadRequest request;
+        request.path = (sourceDirectory / file.path).string();
+        request.priority = IOPriority::Low;
+        request.context = IOCompletionContext::IOThread;
+        request.onComplete = [&out, &writeMutex, &offset, &failed, &file](const IOReadResult& result) {
+            std::lock_guard<std::mutex> lock(writeMutex);
+            if (!result.success) {
+                Log::Error("Failed to read file for package: " + file.path + " (" + std::strerror(result.error) + ")");
+                failed = true;
+                return;
+            }
+            out.write(reinterpret_cast<const char*>(result.data), static_cast<std::streamsize>(result.size));
+            file.offset = offset;
+            file.size = result.size;
+            offset += result.size;
+        };
+        requests.push_back(std::move(request));
+    }
+    AsyncFileIO& io = AsyncFileIO::Get();
+    io.SubmitBatch(requests);
+    io.WaitIdle();
+    if (failed) {
+        return false;
+    }
+    
+    // Sorted so identical sources produce identical archives
+    std::sort(files.begin(), files.end(), [](const PackedFile& a, const PackedFile& b) { return a.path < b.path; });
+    for (const PackedFile& file : files) {
+        WriteValue(out, static_cast<uint32_t>(file.path.size()));
+        out.write(file.path.data(), static_cast<std::streamsize>(file.path.size()));
+        WriteValue(out, file.offset);
+        WriteValue(out, file.size);
+    }
+    
+    header.entryCount = static_cast<uint32_t>(files.size());
+    header.tableOffset = offset;
+    out.seekp(0, std::ios::beg);
+    WriteValue(out, header);
+    
+    if (!out.good()) {
+        Log::Error("Failed to write package: " + outputPath.string());
+        return false;
+    }
+    
+    Log::Info("Package built: " + outputPath.string() + " with " + std::to_string(files.size()) + " files");
+    return true;
+}
+
+uint64_t PackageArchive::SubmitRead(std::string_view path, IOReadRequest request) const {
+    auto it = m_Entries.find(NormalizeEntryPath(path));
+    if (it == m_Entries.end()) {
+        return 0;
+    }
+    
+    if (it->second.size == 0) {
+        // Size 0 would mean "to end of file" to AsyncFileIO
+        if (request.onComplete) {
+            IOReadResult result;
+            result.success = true;
+            request.onComplete(result);
+        }
+        return 0;
+    }
+    
+    request.path = m_Path.string();
+    request.offset = it->second.offset;
+    request.size = it->second.size;
+    request.direct = true;
+    return AsyncFileIO::Get().Submit(std::move(request));
+}
+
+bool PackageArchive::HasFile(std::string_view path) const {
+    return m_Entries.find(NormalizeEntryPath(path)) != m_Entries.end();
+}
+
+bool PackageArchive::HasDirectory(std::string_view path) const {
+    return m_Directories.find(NormalizeEntryPath(path)) != m_Directories.end();
+}
+
+bool PackageArchive::ReadFile(std::string_view path, std::vector<uint8_t>& outData) const {
+    FileView view = GetFileView(path);
+    if (!view.IsValid()) {
+        return false;
+    }
+    outData.assign(view.GetData(), view.GetData() + view.GetSize());
+    return true;
+}
+
+FileView PackageArchive::GetFileView(std::string_view path) const {
+    auto it = m_Entries.find(NormalizeEntryPath(path));
+    if (it == m_Entries.end()) {
+        return FileView();
+    }
+    return m_Data.SubView(static_cast<size_t>(it->second.offset), static_cast<size_t>(it->second.size));
+}
+
+void PackageArchive::ListDirectory(std::string_view path, std::vector<std::string>& outNames) const {
+    auto it = m_Directories.find(NormalizeEntryPath(path));
+    if (it != m_Directories.end()) {
+        outNames.insert(outNames.end(), it->second.begin(), it->second.end());
+    }
+}
+
+} // namespace LGE
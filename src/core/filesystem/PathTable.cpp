@@ -0,0 +1,160 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/core/filesystem/PathTable.h"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace LGE {
+
+PathTable::PathTable()
+    : m_ChunkUsed(kChunkSize)
+    , m_ArenaBytes(0)
+    , m_Strings(1)
+    , m_Slots(1024)
+{
+}
+
+PathTable& PathTable::Get() {
+    static PathTable table;
+    return table;
+}
+
+uint32_t PathTable::Hash(std::string_view path) {
+    // FNV-1a with a final avalanche so the low bits used for slots are well mixed
+    uint64_t hash = 1469598103934665603ull;
+    for (char c : path) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return static_cast<uint32_t>(hash);
+}
+
+PathId PathTable::FindLocked(std::string_view path, uint32_t hash, size_t& outSlot) const {
+    size_t mask = m_Slots.size() - 1;
+    size_t slot = hash & mask;
+    while (true) {
+        const Slot& entry = m_Slots[slot];
+        if (entry.id == kInvalidPathId) {
+            outSlot = slot;
+            return kInvalidPathId;
+        }
+        if (entry.hash == hash && m_Strings[entry.id] == path) {
+            outSlot = slot;
+            return entry.id;
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+
+PathId PathTable::Find(std::string_view path) const {
+    uint32_t hash = Hash(path);
+    std::shared_lock<std::shared_mutex> lock(m_Mutex);
+    size_t slot = 0;
+    return FindLocked(path, hash, slot);
+}
+
+PathId PathTable::Intern(std::string_view path) {
+    uint32_t hash = Hash(path);
+    size_t slot = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_Mutex);
+        PathId existing = FindLocked(path, hash, slot);
+        if (existing != kInvalidPathId) {
+            return existing;
+        }
+    }
+    
+    std::unique_lock<std::shared_mutex> lock(m_Mutex);
+    PathId existing = FindLocked(path, hash, slot);   // Another thread may have added it
+    if (existing != kInvalidPathId) {
+        return existing;
+    }
+    
+    // Copy into the arena; long strings get a chunk of their own
+    size_t bytes = path.size() + 1;
+    char* storage = nullptr;
+    if (bytes > kChunkSize / 4) {
+        m_Chunks.insert(m_Chunks.begin(), std::make_unique<char[]>(bytes));
+        storage = m_Chunks.front().get();
+        m_ArenaBytes += bytes;
+    } else {
+        if (m_ChunkUsed + bytes > kChunkSize) {
+            m_Chunks.push_back(std::make_unique<char[]>(kChunkSize));
+            m_ChunkUsed = 0;
+            m_ArenaBytes += kChunkSize;
+        }
+        storage = m_Chunks.back().get() + m_ChunkUsed;
+        m_ChunkUsed += bytes;
+    }
+    std::memcpy(storage, path.data(), path.size());
+    storage[path.size()] = '\0';
+    
+    PathId id = static_cast<PathId>(m_Strings.size());
+    m_Strings.emplace_back(storage, path.size());
+    m_Slots[slot] = { id, hash };
+    
+    // Keep the load factor under one half
+    if (m_Strings.size() * 2 > m_Slots.size()) {
+        Grow();
+    }
+    return id;
+}
+
+void PathTable::Grow() {
+    std::vector<Slot> slots(m_Slots.size() * 2);
+    size_t mask = slots.size() - 1;
+    for (const Slot& entry : m_Slots) {
+        if (entry.id == kInvalidPathId) {
+            continue;
+        }
+        size_t slot = entry.hash & mask;
+        while (slots[slot].id != kInvalidPathId) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = entry;
+    }
+    m_Slots.swap(slots);
+}
+
+std::string_view PathTable::GetString(PathId id) const {
+    std::shared_lock<std::shared_mutex> lock(m_Mutex);
+    return id < m_Strings.size() ? m_Strings[id] : std::string_view();
+}
+
+size_t PathTable::GetCount() const {
+    std::shared_lock<std::shared_mutex> lock(m_Mutex);
+    return m_Strings.size() - 1;
+}
+
+size_t PathTable::GetMemoryUsage() const {
+    std::shared_lock<std::shared_mutex> lock(m_Mutex);
+    return m_ArenaBytes + m_Strings.capacity() * sizeof(std::string_view) +
+           m_Slots.capacity() * sizeof(Slot);
+}
+
+} // namespace LGE
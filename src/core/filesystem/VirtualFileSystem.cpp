@@ -23,6 +23,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #include "LGE/core/filesystem/VirtualFileSystem.h"
 #include "LGE/core/filesystem/FileSystem.h"
+#include "LGE/core/filesystem/PackageArchive.h"
 #include "LGE/core/Log.h"
 #include <algorithm>
 #include <fstream>
@@ -30,7 +31,38 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 namespace LGE {
 
+namespace {
+
+bool IsSeparator(char c) {
+    return c == '/' || c == '\\';
+}
+
+// Appends path with backslashes turned into '/' and without leading separators
+void AppendRemainder(std::string& out, std::string_view remainder) {
+    size_t start = 0;
+    while (start < remainder.size() && IsSeparator(remainder[start])) {
+        ++start;
+    }
+    if (start == remainder.size()) {
+        return;
+    }
+    if (!out.empty() && !IsSeparator(out.back())) {
+        out += '/';
+    }
+    size_t offset = out.size();
+    out.append(remainder.data() + start, remainder.size() - start);
+    std::replace(out.begin() + offset, out.end(), '\\', '/');
+    
+    // Trailing separators are dropped, as NormalizeVirtualPath does
+    while (out.size() > offset && out.back() == '/') {
+        out.pop_back();
+    }
+}
+
+} // namespace
+
 VirtualFileSystem::VirtualFileSystem() {
+    RebuildMountTrie();
 }
 
 VirtualFileSystem::~VirtualFileSystem() {
@@ -39,6 +71,7 @@ VirtualFileSystem::~VirtualFileSystem() {
 
 void VirtualFileSystem::Initialize(const std::filesystem::path& root) {
     m_ProjectRoot = root;
+    m_ProjectRootString = root.generic_string();
     Clear();
     
     // Auto-mount common directories
@@ -51,29 +84,179 @@ void VirtualFileSystem::Initialize(const std::filesystem::path& root) {
 }
 
 std::filesystem::path VirtualFileSystem::ResolveVirtualPath(const std::string& virtualPath) {
-    std::string normalized = NormalizeVirtualPath(virtualPath);
+    std::string physical;
+    ResolveVirtualPath(std::string_view(virtualPath), physical);
+    return std::filesystem::path(physical);
+}
+
+void VirtualFileSystem::ResolveVirtualPath(std::string_view virtualPath, std::string& outPhysical) const {
+    // Replace the mounted prefix with its physical path; unmounted paths are
+    // relative to the project root
+    size_t remainder = 0;
+    const MountNode* node = MatchMountNode(virtualPath, remainder);
+    if (!node) {
+        outPhysical = m_ProjectRootString;
+        AppendRemainder(outPhysical, virtualPath);
+        return;
+    }
     
-    // Find matching mount point
-    for (const auto& mount : m_MountPoints) {
-        if (normalized.find(mount.virtualPath) == 0) {
-            // Replace virtual path with physical path
-            std::string remaining = normalized.substr(mount.virtualPath.length());
-            if (remaining.empty() || remaining[0] == '/') {
-                // Remove leading slash if present
-                if (!remaining.empty() && remaining[0] == '/') {
-                    remaining = remaining.substr(1);
+    size_t mount = node->mounts[0];
+    if (node->mounts.size() > 1) {
+        // Packaged entries have no file on disk: point at the copy-up target instead
+        int layer = FindEntryLayer(*node, virtualPath, remainder);
+        if (layer < 0 || m_MountPoints[static_cast<size_t>(layer)].archive) {
+            int writable = FindWritableLayer(*node);
+            if (writable >= 0) {
+                layer = writable;
+            }
+        }
+        if (layer >= 0) {
+            mount = static_cast<size_t>(layer);
+        }
+    }
+    outPhysical = m_MountPhysicalStrings[mount];
+    AppendRemainder(outPhysical, virtualPath.substr(remainder));
+}
+
+const VirtualFileSystem::MountPoint* VirtualFileSystem::MatchMount(std::string_view virtualPath, size_t& outRemainder) const {
+    const MountNode* node = MatchMountNode(virtualPath, outRemainder);
+    return node ? &m_MountPoints[node->mounts[0]] : nullptr;
+}
+
+const VirtualFileSystem::MountNode* VirtualFileSystem::MatchMountNode(std::string_view virtualPath, size_t& outRemainder) const {
+    uint32_t node = 0;
+    const MountNode* best = m_MountTrie[0].mounts.empty() ? nullptr : &m_MountTrie[0];
+    outRemainder = 0;
+    
+    size_t start = 0;
+    while (start < virtualPath.size()) {
+        size_t end = start;
+        while (end < virtualPath.size() && !IsSeparator(virtualPath[end])) {
+            ++end;
+        }
+        if (end > start) {
+            std::string_view segment = virtualPath.substr(start, end - start);
+            uint32_t next = 0;
+            for (uint32_t child : m_MountTrie[node].children) {
+                if (m_MountTrie[child].segment == segment) {
+                    next = child;
+                    break;
                 }
-                return mount.physicalPath / remaining;
+            }
+            if (next == 0) {
+                break;
+            }
+            node = next;
+            if (!m_MountTrie[node].mounts.empty()) {
+                best = &m_MountTrie[node];
+                outRemainder = end;
             }
         }
+        start = end + 1;
     }
     
-    // If no mount point matches, return relative to project root
-    std::string remaining = normalized;
-    if (!remaining.empty() && remaining[0] == '/') {
-        remaining = remaining.substr(1);
+    return best;
+}
+
+int VirtualFileSystem::FindEntryLayer(const MountNode& node, std::string_view virtualPath, size_t remainder) const {
+    std::string key = NormalizeVirtualPath(std::string(virtualPath));
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_ResolveMutex);
+        auto it = m_ResolveCache.find(key);
+        if (it != m_ResolveCache.end()) {
+            return it->second;
+        }
+        generation = m_ResolveGeneration;
     }
-    return m_ProjectRoot / remaining;
+    
+    // Probe top-down outside the lock; the disk checks dominate
+    std::string_view relative = virtualPath.substr(remainder);
+    int found = -1;
+    for (uint32_t mount : node.mounts) {
+        if (LayerContains(mount, relative)) {
+            found = static_cast<int>(mount);
+            break;
+        }
+    }
+    
+    std::lock_guard<std::mutex> lock(m_ResolveMutex);
+    if (generation == m_ResolveGeneration) {
+        m_ResolveCache.emplace(std::move(key), found);
+    }
+    return found;
+}
+
+int VirtualFileSystem::FindWritableLayer(const MountNode& node) const {
+    for (uint32_t mount : node.mounts) {
+        if (!m_MountPoints[mount].readOnly && !m_MountPoints[mount].archive) {
+            return static_cast<int>(mount);
+        }
+    }
+    return -1;
+}
+
+bool VirtualFileSystem::LayerContains(size_t mountIndex, std::string_view relativePath) const {
+    const MountPoint& mount = m_MountPoints[mountIndex];
+    if (mount.archive) {
+        return mount.archive->HasFile(relativePath) || mount.archive->HasDirectory(relativePath);
+    }
+    
+    std::string physical = m_MountPhysicalStrings[mountIndex];
+    AppendRemainder(physical, relativePath);
+    std::error_code ec;
+    return std::filesystem::exists(physical, ec);
+}
+
+void VirtualFileSystem::RebuildMountTrie() {
+    m_MountTrie.assign(1, MountNode());
+    m_MountPhysicalStrings.clear();
+    
+    for (size_t i = 0; i < m_MountPoints.size(); ++i) {
+        const std::string& virtualPath = m_MountPoints[i].virtualPath;
+        m_MountPhysicalStrings.push_back(m_MountPoints[i].physicalPath.generic_string());
+        
+        uint32_t node = 0;
+        size_t start = 0;
+        while (start < virtualPath.size()) {
+            size_t end = virtualPath.find('/', start);
+            if (end == std::string::npos) {
+                end = virtualPath.size();
+            }
+            if (end > start) {
+                std::string segment = virtualPath.substr(start, end - start);
+                uint32_t next = 0;
+                for (uint32_t child : m_MountTrie[node].children) {
+                    if (m_MountTrie[child].segment == segment) {
+                        next = child;
+                        break;
+                    }
+                }
+                if (next == 0) {
+                    next = static_cast<uint32_t>(m_MountTrie.size());
+                    MountNode child;
+                    child.segment = segment;
+                    m_MountTrie.push_back(std::move(child));
+                    m_MountTrie[node].children.push_back(next);
+                }
+                node = next;
+            }
+            start = end + 1;
+        }
+        m_MountTrie[node].mounts.push_back(static_cast<uint32_t>(i));
+    }
+    
+    // Top layer first: higher priority, then the later mount
+    for (MountNode& node : m_MountTrie) {
+        std::sort(node.mounts.begin(), node.mounts.end(), [this](uint32_t a, uint32_t b) {
+            if (m_MountPoints[a].priority != m_MountPoints[b].priority) {
+                return m_MountPoints[a].priority > m_MountPoints[b].priority;
+            }
+            return a > b;
+        });
+    }
+    
+    InvalidateResolutionCache();
 }
 
 std::string VirtualFileSystem::GetVirtualPath(const std::filesystem::path& physicalPath) {
@@ -81,6 +264,9 @@ std::string VirtualFileSystem::GetVirtualPath(const std::filesystem::path& physi
     
     // Try to find matching mount point
     for (const auto& mount : m_MountPoints) {
+        if (mount.archive) {
+            continue;
+        }
         std::filesystem::path mountPath = std::filesystem::absolute(mount.physicalPath);
         
         // Check if physical path is within this mount point
@@ -112,22 +298,47 @@ bool VirtualFileSystem::Mount(const std::string& virtualPath, const std::filesys
     std::string normalized = NormalizeVirtualPath(virtualPath);
     
     // Check if already mounted
-    if (FindMountPoint(normalized)) {
+    bool alreadyMounted = std::any_of(m_MountPoints.begin(), m_MountPoints.end(),
+        [&normalized](const MountPoint& mp) { return mp.virtualPath == normalized; });
+    if (alreadyMounted) {
         Log::Warn("Virtual path already mounted: " + normalized);
         return false;
     }
     
-    // Verify physical path exists
-    if (!std::filesystem::exists(physicalPath)) {
-        Log::Warn("Physical path does not exist, creating: " + physicalPath.string());
-        if (!std::filesystem::create_directories(physicalPath)) {
-            Log::Error("Failed to create physical path: " + physicalPath.string());
+    return MountLayer(normalized, physicalPath, 0, readOnly);
+}
+
+bool VirtualFileSystem::MountLayer(const std::string& virtualPath, const std::filesystem::path& source, int priority, bool readOnly) {
+    std::string normalized = NormalizeVirtualPath(virtualPath);
+    std::filesystem::path absolute = std::filesystem::absolute(source);
+    
+    bool alreadyMounted = std::any_of(m_MountPoints.begin(), m_MountPoints.end(),
+        [&](const MountPoint& mp) { return mp.virtualPath == normalized && mp.physicalPath == absolute; });
+    if (alreadyMounted) {
+        Log::Warn("Layer already mounted: " + normalized + " -> " + source.string());
+        return false;
+    }
+    
+    MountPoint mount(normalized, absolute, readOnly, priority);
+    if (source.extension() == ".lpak") {
+        auto archive = std::make_shared<PackageArchive>();
+        if (!archive->Open(absolute)) {
+            return false;
+        }
+        mount.archive = archive;
+        mount.readOnly = true;
+    } else if (!std::filesystem::exists(source)) {
+        // Verify physical path exists
+        Log::Warn("Physical path does not exist, creating: " + source.string());
+        if (!std::filesystem::create_directories(source)) {
+            Log::Error("Failed to create physical path: " + source.string());
             return false;
         }
     }
     
-    m_MountPoints.emplace_back(normalized, std::filesystem::absolute(physicalPath), readOnly);
-    Log::Info("Mounted: " + normalized + " -> " + physicalPath.string());
+    m_MountPoints.push_back(std::move(mount));
+    RebuildMountTrie();
+    Log::Info("Mounted: " + normalized + " -> " + source.string());
     return true;
 }
 
@@ -139,6 +350,7 @@ bool VirtualFileSystem::Unmount(const std::string& virtualPath) {
     
     if (it != m_MountPoints.end()) {
         m_MountPoints.erase(it, m_MountPoints.end());
+        RebuildMountTrie();
         Log::Info("Unmounted: " + normalized);
         return true;
     }
@@ -146,44 +358,88 @@ bool VirtualFileSystem::Unmount(const std::string& virtualPath) {
     return false;
 }
 
+bool VirtualFileSystem::UnmountLayer(const std::string& virtualPath, const std::filesystem::path& source) {
+    std::string normalized = NormalizeVirtualPath(virtualPath);
+    std::filesystem::path absolute = std::filesystem::absolute(source);
+    
+    auto it = std::remove_if(m_MountPoints.begin(), m_MountPoints.end(),
+        [&](const MountPoint& mp) { return mp.virtualPath == normalized && mp.physicalPath == absolute; });
+    
+    if (it != m_MountPoints.end()) {
+        m_MountPoints.erase(it, m_MountPoints.end());
+        RebuildMountTrie();
+        Log::Info("Unmounted: " + normalized + " -> " + source.string());
+        return true;
+    }
+    
+    return false;
+}
+
 bool VirtualFileSystem::FileExists(const std::string& virtualPath) {
+    size_t remainder = 0;
+    const MountNode* node = MatchMountNode(virtualPath, remainder);
+    if (node && node->mounts.size() > 1) {
+        int layer = FindEntryLayer(*node, virtualPath, remainder);
+        if (layer < 0) {
+            return false;
+        }
+        const MountPoint& mount = m_MountPoints[static_cast<size_t>(layer)];
+        if (mount.archive) {
+            return mount.archive->HasFile(std::string_view(virtualPath).substr(remainder));
+        }
+    }
+    
     std::filesystem::path physical = ResolveVirtualPath(virtualPath);
     return std::filesystem::exists(physical) && std::filesystem::is_regular_file(physical);
 }
 
 std::vector<uint8_t> VirtualFileSystem::ReadFile(const std::string& virtualPath) {
-    std::filesystem::path physical = ResolveVirtualPath(virtualPath);
-    
-    if (!std::filesystem::exists(physical)) {
-        Log::Error("File not found: " + virtualPath + " (resolved to: " + physical.string() + ")");
-        return {};
+    FileView view = MapFile(virtualPath);
+    return std::vector<uint8_t>(view.GetData(), view.GetData() + view.GetSize());
+}
+
+FileView VirtualFileSystem::MapFile(const std::string& virtualPath, FileAccessHint hint) {
+    size_t remainder = 0;
+    const MountNode* node = MatchMountNode(virtualPath, remainder);
+    if (node && node->mounts.size() > 1) {
+        int layer = FindEntryLayer(*node, virtualPath, remainder);
+        const MountPoint* mount = layer >= 0 ? &m_MountPoints[static_cast<size_t>(layer)] : nullptr;
+        if (mount && mount->archive) {
+            FileView view = mount->archive->GetFileView(std::string_view(virtualPath).substr(remainder));
+            if (!view.IsValid()) {
+                Log::Error("File not found: " + virtualPath + " (in package: " + mount->physicalPath.string() + ")");
+            }
+            return view;
+        }
     }
     
-    std::ifstream file(physical, std::ios::binary | std::ios::ate);
-    if (!file.is_open()) {
-        Log::Error("Failed to open file: " + physical.string());
-        return {};
+    std::filesystem::path physical = ResolveVirtualPath(virtualPath);
+    FileView view = MappedFile::Open(physical.string(), hint);
+    if (!view.IsValid()) {
+        Log::Error("File not found: " + virtualPath + " (resolved to: " + physical.string() + ")");
     }
-    
-    size_t size = file.tellg();
-    file.seekg(0, std::ios::beg);
-    
-    std::vector<uint8_t> data(size);
-    file.read(reinterpret_cast<char*>(data.data()), size);
-    
-    return data;
+    return view;
 }
 
 bool VirtualFileSystem::WriteFile(const std::string& virtualPath, const std::vector<uint8_t>& data) {
-    std::filesystem::path physical = ResolveVirtualPath(virtualPath);
-    
-    // Check if mount point is read-only
     std::string normalized = NormalizeVirtualPath(virtualPath);
-    const MountPoint* mount = FindMountPoint(normalized);
-    if (mount && mount->readOnly) {
-        Log::Error("Cannot write to read-only mount point: " + normalized);
-        return false;
+    
+    // Writes land in the top writable layer, whichever layer the path resolves to
+    size_t remainder = 0;
+    const MountNode* node = MatchMountNode(normalized, remainder);
+    std::string physicalString;
+    if (node) {
+        int writable = FindWritableLayer(*node);
+        if (writable < 0) {
+            Log::Error("Cannot write to read-only mount point: " + normalized);
+            return false;
+        }
+        physicalString = m_MountPhysicalStrings[static_cast<size_t>(writable)];
+        AppendRemainder(physicalString, std::string_view(normalized).substr(remainder));
+    } else {
+        ResolveVirtualPath(std::string_view(normalized), physicalString);
     }
+    std::filesystem::path physical(physicalString);
     
     // Create parent directory if needed
     std::filesystem::create_directories(physical.parent_path());
@@ -195,54 +451,150 @@ bool VirtualFileSystem::WriteFile(const std::string& virtualPath, const std::vec
     }
     
     file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    if (node && node->mounts.size() > 1) {
+        InvalidateVirtualPath(normalized);
+    }
     return file.good();
 }
 
 bool VirtualFileSystem::DirectoryExists(const std::string& virtualPath) {
+    size_t remainder = 0;
+    const MountNode* node = MatchMountNode(virtualPath, remainder);
+    if (node && node->mounts.size() > 1) {
+        int layer = FindEntryLayer(*node, virtualPath, remainder);
+        if (layer < 0) {
+            return false;
+        }
+        const MountPoint& mount = m_MountPoints[static_cast<size_t>(layer)];
+        if (mount.archive) {
+            return mount.archive->HasDirectory(std::string_view(virtualPath).substr(remainder));
+        }
+    }
+    
     std::filesystem::path physical = ResolveVirtualPath(virtualPath);
     return std::filesystem::exists(physical) && std::filesystem::is_directory(physical);
 }
 
 bool VirtualFileSystem::CreateDirectory(const std::string& virtualPath) {
-    std::filesystem::path physical = ResolveVirtualPath(virtualPath);
-    
-    // Check if mount point is read-only
     std::string normalized = NormalizeVirtualPath(virtualPath);
-    const MountPoint* mount = FindMountPoint(normalized);
-    if (mount && mount->readOnly) {
-        Log::Error("Cannot create directory in read-only mount point: " + normalized);
-        return false;
+    
+    size_t remainder = 0;
+    const MountNode* node = MatchMountNode(normalized, remainder);
+    std::string physical;
+    if (node) {
+        int writable = FindWritableLayer(*node);
+        if (writable < 0) {
+            Log::Error("Cannot create directory in read-only mount point: " + normalized);
+            return false;
+        }
+        physical = m_MountPhysicalStrings[static_cast<size_t>(writable)];
+        AppendRemainder(physical, std::string_view(normalized).substr(remainder));
+    } else {
+        ResolveVirtualPath(std::string_view(normalized), physical);
     }
     
-    return std::filesystem::create_directories(physical);
-}
-
-void VirtualFileSystem::Clear() {
-    m_MountPoints.clear();
+    bool created = std::filesystem::create_directories(physical);
+    if (node && node->mounts.size() > 1) {
+        InvalidateVirtualPath(normalized);
+    }
+    return created;
 }
 
-VirtualFileSystem::MountPoint* VirtualFileSystem::FindMountPoint(const std::string& virtualPath) {
+std::vector<std::string> VirtualFileSystem::ListDirectory(const std::string& virtualPath) {
+    std::vector<std::string> names;
     std::string normalized = NormalizeVirtualPath(virtualPath);
     
-    for (auto& mount : m_MountPoints) {
-        if (normalized.find(mount.virtualPath) == 0) {
-            return &mount;
+    auto listPhysical = [&names](const std::string& directory) {
+        std::error_code ec;
+        std::filesystem::directory_iterator it(directory, ec);
+        for (; !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+            names.push_back(it->path().filename().string());
+        }
+    };
+    
+    size_t remainder = 0;
+    const MountNode* node = MatchMountNode(normalized, remainder);
+    if (!node) {
+        std::string physical;
+        ResolveVirtualPath(std::string_view(normalized), physical);
+        listPhysical(physical);
+    } else {
+        std::string_view relative = std::string_view(normalized).substr(remainder);
+        for (uint32_t mount : node->mounts) {
+            if (m_MountPoints[mount].archive) {
+                m_MountPoints[mount].archive->ListDirectory(relative, names);
+            } else {
+                std::string physical = m_MountPhysicalStrings[mount];
+                AppendRemainder(physical, relative);
+                listPhysical(physical);
+            }
         }
     }
     
-    return nullptr;
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+    return names;
 }
 
-const VirtualFileSystem::MountPoint* VirtualFileSystem::FindMountPoint(const std::string& virtualPath) const {
-    std::string normalized = NormalizeVirtualPath(virtualPath);
+void VirtualFileSystem::InvalidatePhysicalPath(const std::filesystem::path& physicalPath) {
+    {
+        std::lock_guard<std::mutex> lock(m_ResolveMutex);
+        if (m_ResolveCache.empty()) {
+            return;
+        }
+    }
+    InvalidateVirtualPath(GetVirtualPath(physicalPath));
+}
+
+void VirtualFileSystem::InvalidateResolutionCache() {
+    std::lock_guard<std::mutex> lock(m_ResolveMutex);
+    m_ResolveCache.clear();
+    ++m_ResolveGeneration;
+}
+
+void VirtualFileSystem::InvalidateVirtualPath(const std::string& normalizedPath) {
+    std::lock_guard<std::mutex> lock(m_ResolveMutex);
+    ++m_ResolveGeneration;
+    if (m_ResolveCache.empty()) {
+        return;
+    }
     
-    for (const auto& mount : m_MountPoints) {
-        if (normalized.find(mount.virtualPath) == 0) {
-            return &mount;
+    // Ancestors may have gained or lost their only entry in a layer
+    std::string key = normalizedPath;
+    while (!key.empty()) {
+        m_ResolveCache.erase(key);
+        size_t slash = key.rfind('/');
+        if (slash == 0 && key.size() > 1) {
+            key = "/";
+        } else {
+            key.resize(slash == std::string::npos ? 0 : slash);
         }
     }
     
-    return nullptr;
+    // Descendants, for folder removals and renames
+    std::string prefix = normalizedPath + "/";
+    for (auto it = m_ResolveCache.begin(); it != m_ResolveCache.end();) {
+        if (it->first.compare(0, prefix.size(), prefix) == 0) {
+            it = m_ResolveCache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void VirtualFileSystem::Clear() {
+    m_MountPoints.clear();
+    RebuildMountTrie();
+}
+
+VirtualFileSystem::MountPoint* VirtualFileSystem::FindMountPoint(const std::string& virtualPath) {
+    size_t remainder = 0;
+    return const_cast<MountPoint*>(MatchMount(virtualPath, remainder));
+}
+
+const VirtualFileSystem::MountPoint* VirtualFileSystem::FindMountPoint(const std::string& virtualPath) const {
+    size_t remainder = 0;
+    return MatchMount(virtualPath, remainder);
 }
 
 std::string VirtualFileSystem::NormalizeVirtualPath(const std::string& path) const {
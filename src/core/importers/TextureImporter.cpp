@@ -24,11 +24,11 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/importers/TextureImporter.h"
 #include "LGE/core/Log.h"
 #include "LGE/core/filesystem/FileSystem.h"
-#include "LGE/rendering/Texture.h"
+#include "LGE/core/Profiling.h"
 #include <algorithm>
 
-// stb_image is already implemented in Texture.cpp, just include the header
-#include "../../third_party/stb_image.h"
+// stb_image is implemented in rendering/StbImage.cpp, just include the header
+#include "../../../third_party/stb_image.h"
 
 namespace LGE {
 
@@ -64,17 +64,19 @@ bool TextureImporter::Import(
     const ImportSettings& settings,
     AssetMetadata& outMetadata
 ) {
+    LGE_PROFILE_SCOPE("TextureImporter::Import");
     if (!std::filesystem::exists(sourcePath)) {
         Log::Error("Source file does not exist: " + sourcePath.string());
         return false;
     }
     
     // Load image
+    FileView file = MappedFile::Open(sourcePath.string(), FileAccessHint::Sequential);
     int width, height, channels;
-    unsigned char* data = stbi_load(
-        sourcePath.string().c_str(),
+    unsigned char* data = file.IsValid() ? stbi_load_from_memory(
+        file.GetData(), static_cast<int>(file.GetSize()),
         &width, &height, &channels, 4
-    );
+    ) : nullptr;
     
     if (!data) {
         Log::Error("Failed to load image: " + sourcePath.string());
@@ -118,10 +120,7 @@ bool TextureImporter::Import(
     outMetadata.importSettings = settings.ToJson();
     outMetadata.fileSize = std::filesystem::file_size(ltexPath);
     
-    auto lastWriteTime = std::filesystem::last_write_time(ltexPath);
-    auto sctp = std::chrono::time_point_cast<std::chrono::system_clock::duration>(
-        lastWriteTime - std::filesystem::file_time_type::clock::now() + std::chrono::system_clock::now());
-    outMetadata.lastModified = std::chrono::system_clock::to_time_t(sctp);
+    outMetadata.lastModified = AssetMetadata::ToFileStamp(std::filesystem::last_write_time(ltexPath));
     outMetadata.importDate = std::time(nullptr);
     
     stbi_image_free(data);
@@ -143,7 +142,7 @@ bool TextureImporter::Reimport(const GUID& guid, const ImportSettings& settings)
     }
     
     // Find source file (stored in .meta file or use current path)
-    std::filesystem::path destPath = m_VFS ? m_VFS->ResolveVirtualPath(metadata->virtualPath) : metadata->virtualPath;
+    std::filesystem::path destPath = m_VFS ? m_VFS->ResolveVirtualPath(metadata->virtualPath) : std::filesystem::path(metadata->virtualPath);
     
     // For reimport, we need the original source file
     // In a full implementation, this would be stored in the .meta file
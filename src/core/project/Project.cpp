@@ -24,8 +24,6 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/project/Project.h"
 #include "LGE/core/filesystem/FileSystem.h"
 #include "LGE/core/Log.h"
-#include "LGE/core/scene/World.h"
-#include "LGE/core/scene/SceneManager.h"
 #include <nlohmann/json.hpp>
 #include <chrono>
 #include <sstream>
@@ -33,6 +31,17 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 namespace LGE {
 
+namespace {
+    Project::DefaultSceneWriter& DefaultSceneWriterSlot() {
+        static Project::DefaultSceneWriter writer;
+        return writer;
+    }
+}
+
+void Project::SetDefaultSceneWriter(DefaultSceneWriter writer) {
+    DefaultSceneWriterSlot() = std::move(writer);
+}
+
 Project::Project()
     : m_IsLoaded(false)
     , m_DefaultSceneGUID(GUID::Invalid())
@@ -425,19 +434,21 @@ void Project::CreateDefaultConfigFiles() {
 }
 
 bool Project::CreateDefaultScene() {
-    // Create a default SampleScene
-    auto world = std::make_shared<World>("SampleScene");
-    
-    // Create a default GameObject in the scene
-    auto defaultObject = world->CreateGameObject("Main Camera");
+    const DefaultSceneWriter& writer = DefaultSceneWriterSlot();
+    if (!writer) {
+        // Headless builds have no scene system; the project simply starts empty
+        Log::Info("No default scene writer installed, skipping SampleScene");
+        return true;
+    }
     
     // Save the scene to the scenes folder
     std::string scenesPath = GetScenesPath();
     std::string scenePath = FileSystem::JoinPath(scenesPath, "SampleScene.lscene");
     
-    if (world->SaveToFile(scenePath)) {
+    GUID sceneGUID = GUID::Invalid();
+    if (writer(scenePath, sceneGUID)) {
         // Store the GUID of the created scene
-        m_DefaultSceneGUID = world->GetGUID();
+        m_DefaultSceneGUID = sceneGUID;
         m_DefaultScenePath = "SampleScene.lscene";
         Log::Info("Created default scene: " + scenePath + " (GUID: " + m_DefaultSceneGUID.ToString() + ")");
         return true;
@@ -69,18 +69,29 @@ GameObject::~GameObject() {
     }
     m_Components.clear();
     
-    // Remove from parent
+    // Remove from parent (the world may already be gone, so don't notify it)
+    m_World = nullptr;
     RemoveParent();
     
     // Clear children
     m_Children.clear();
 }
 
+void GameObject::SetName(const std::string& name) {
+    m_Name = name;
+    if (m_World) {
+        m_World->MarkHierarchyChanged();
+    }
+}
+
 void GameObject::SetActive(bool active) {
     if (m_IsActive == active) return;
     
     m_IsActive = active;
     NotifyComponentsActiveChanged(active);
+    if (m_World) {
+        m_World->MarkHierarchyChanged();
+    }
     
     // Recursively affect children
     for (auto& child : m_Children) {
@@ -129,6 +140,9 @@ void GameObject::SetParent(std::shared_ptr<GameObject> parent) {
     
     // Set new parent
     m_Parent = parent;
+    if (m_World) {
+        m_World->MarkHierarchyChanged();
+    }
     
     if (parent) {
         parent->m_Children.push_back(shared_from_this());
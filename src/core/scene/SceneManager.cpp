@@ -25,6 +25,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/scene/World.h"
 #include "LGE/core/filesystem/FileSystem.h"
 #include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
 #include <fstream>
 #include <sstream>
 #include <chrono>
@@ -45,6 +46,7 @@ SceneManager::~SceneManager() {
 }
 
 bool SceneManager::LoadScene(const std::string& scenePath) {
+    LGE_PROFILE_SCOPE("SceneManager::LoadScene");
     if (scenePath.empty()) {
         Log::Error("SceneManager::LoadScene: Scene path is empty");
         return false;
@@ -25,6 +25,8 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/scene/GameObject.h"
 #include "LGE/core/scene/Component.h"
 #include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
+#include "LGE/core/filesystem/MappedFile.h"
 #include <nlohmann/json.hpp>
 #include <algorithm>
 #include <sstream>
@@ -37,6 +39,7 @@ namespace LGE {
 World::World(const std::string& name)
     : m_GUID(GUID::Generate())
     , m_Name(name)
+    , m_HierarchyVersion(0)
     , m_IsPlaying(false)
     , m_TimeScale(1.0f)
     , m_FixedDeltaTime(0.02f)  // 50 FPS
@@ -66,6 +69,7 @@ void World::AddGameObject(std::shared_ptr<GameObject> gameObject) {
     
     // Add to map
     m_GameObjectMap[gameObject->GetGUID()] = gameObject;
+    MarkHierarchyChanged();
     
     // Awake and Start if world is playing
     if (m_IsPlaying) {
@@ -88,6 +92,7 @@ void World::RemoveGameObject(std::shared_ptr<GameObject> gameObject) {
     
     // Remove from map
     m_GameObjectMap.erase(gameObject->GetGUID());
+    MarkHierarchyChanged();
 }
 
 void World::RemoveGameObject(const GUID& guid) {
@@ -172,6 +177,7 @@ std::vector<std::shared_ptr<GameObject>> World::GetAllGameObjects() const {
 }
 
 void World::Update(float deltaTime) {
+    LGE_PROFILE_SCOPE("World::Update");
     if (!m_IsPlaying) return;
     
     float scaledDeltaTime = deltaTime * m_TimeScale;
@@ -221,6 +227,7 @@ void World::LateUpdate(float deltaTime) {
 }
 
 void World::FixedUpdate() {
+    LGE_PROFILE_SCOPE("World::FixedUpdate");
     if (!m_IsPlaying) return;
     
     for (auto& gameObject : m_RootGameObjects) {
@@ -280,6 +287,7 @@ void World::Clear() {
     
     m_RootGameObjects.clear();
     m_GameObjectMap.clear();
+    MarkHierarchyChanged();
 }
 
 void World::UpdateGameObjectMap() {
@@ -337,9 +345,9 @@ bool World::SaveToFile(const std::string& path) const {
     }
 }
 
-std::shared_ptr<World> World::Deserialize(const std::string& json) {
+std::shared_ptr<World> World::Deserialize(std::string_view json) {
     try {
-        auto j = nlohmann::json::parse(json);
+        auto j = nlohmann::json::parse(json.begin(), json.end());
         
         auto world = std::make_shared<World>("DeserializedWorld");
         
@@ -387,16 +395,15 @@ std::shared_ptr<World> World::Deserialize(const std::string& json) {
 }
 
 std::shared_ptr<World> World::LoadFromFile(const std::string& path) {
+    LGE_PROFILE_SCOPE("World::LoadFromFile");
     try {
-        std::ifstream file(path);
-        if (!file.is_open()) {
+        // Parse in place from the mapping
+        FileView file = MappedFile::Open(path, FileAccessHint::Sequential);
+        if (!file.IsValid()) {
             return nullptr;
         }
         
-        std::string json((std::istreambuf_iterator<char>(file)),
-                          std::istreambuf_iterator<char>());
-        
-        return Deserialize(json);
+        return Deserialize(file.AsStringView());
     } catch (...) {
         return nullptr;
     }
@@ -32,6 +32,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include <GLFW/glfw3.h>
 #include "LGE/core/Application.h"
 #include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
 #include "LGE/core/filesystem/FileSystem.h"
 #include "LGE/core/Window.h"
 #include "LGE/rendering/Shader.h"
@@ -44,10 +45,12 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/rendering/Material.h"
 #include "LGE/rendering/GridRenderer.h"
 #include "LGE/ui/UI.h"
+#include "LGE/ui/EditorIcons.h"
 #include "LGE/ui/SceneViewport.h"
 #include "LGE/ui/Hierarchy.h"
 #include "LGE/ui/Inspector.h"
 #include "LGE/ui/ContentBrowser.h"
+#include "LGE/ui/ContentBrowserModel.h"
 #include "LGE/ui/Toolbar.h"
 #include "LGE/ui/MainMenuBar.h"
 #include "LGE/ui/Details.h"
@@ -60,6 +63,12 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/SplashScreen.h"
 #include "LGE/core/LayerStack.h"
 #include "LGE/rendering/TextureManager.h"
+#include "LGE/rendering/TextureStreamer.h"
+#include "LGE/rendering/RenderTargetPool.h"
+#include "LGE/rendering/FrameGraph.h"
+#include "LGE/rendering/FrameGraphGLBackend.h"
+#include "LGE/rendering/GPUProfiler.h"
+#include "LGE/rendering/GPUTimerGLBackend.h"
 #include "LGE/core/Input.h"
 #include "LGE/core/scene/GameObject.h"
 #include "LGE/core/scene/World.h"
@@ -71,8 +80,10 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/scene/components/SkyLightComponent.h"
 #include "LGE/rendering/Mesh.h"
 #include "LGE/rendering/LightSystem.h"
+#include "LGE/rendering/SkyLightEnvironment.h"
 #include "LGE/core/project/Project.h"
 #include "LGE/core/filesystem/FileSystemManager.h"
+#include "LGE/core/assets/AssetScanner.h"
 #include "imgui.h"
 #include "imgui_internal.h"
 #include <memory>
@@ -108,6 +119,9 @@ public:
             return false;
         }
         
+        // Sky light IBL (baked in the background, cached per project once one is open)
+        m_SkyLightEnvironment = std::make_unique<LGE::SkyLightEnvironment>();
+        
         // Load grid shader
         std::string gridVertSource = LGE::FileSystem::ReadFile("assets/shaders/grid.vert");
         std::string gridFragSource = LGE::FileSystem::ReadFile("assets/shaders/grid.frag");
@@ -207,6 +221,17 @@ public:
         // Grid is now handled by GridRenderer (created above)
 
 
+        // New projects get a SampleScene with a default camera object
+        LGE::Project::SetDefaultSceneWriter([](const std::string& scenePath, LGE::GUID& outSceneGUID) {
+            auto world = std::make_shared<LGE::World>("SampleScene");
+            world->CreateGameObject("Main Camera");
+            if (!world->SaveToFile(scenePath)) {
+                return false;
+            }
+            outSceneGUID = world->GetGUID();
+            return true;
+        });
+
         // Setup UI panels
         // Initialize FileSystemManager first (will be initialized when project opens)
         m_FileSystemManager = std::make_unique<LGE::FileSystemManager>();
@@ -220,23 +245,29 @@ public:
             LGE::Log::Info("Project opened: " + (project ? project->GetInfo().name : "null"));
             LGE::Log::Info("Project loaded: " + std::string(project && project->IsLoaded() ? "yes" : "no"));
             
-            // Initialize FileSystemManager with the project
+            // The previous project's registry goes away with BeginOpen
+            if (m_ContentBrowser) {
+                m_ContentBrowser->SetModel(nullptr);
+                m_ContentBrowser->SetAssetRegistry(nullptr);
+            }
+            m_ContentBrowserModel.reset();
+            
+            // Open the project's file systems in the background; OnUpdate drives the
+            // remaining stages (watcher, reconcile, dirty rebuild) a slice per frame
             if (m_FileSystemManager && m_Project && m_Project->IsLoaded()) {
-                if (m_FileSystemManager->Initialize(m_Project)) {
-                    // Perform initial asset scan
-                    m_FileSystemManager->ScanAssets();
-                    
-                    // Enable hot reloading
-                    m_FileSystemManager->EnableHotReloading(true);
-                    
-                    LGE::Log::Info("File system initialized for project: " + m_Project->GetInfo().name);
-                } else {
+                if (!m_FileSystemManager->BeginOpen(m_Project)) {
                     LGE::Log::Error("Failed to initialize FileSystemManager");
                 }
             } else {
                 LGE::Log::Error("Cannot initialize FileSystemManager - project not loaded or manager not available");
             }
             
+            // Cache baked sky light IBL alongside other intermediate data
+            if (m_SkyLightEnvironment && m_Project) {
+                m_SkyLightEnvironment->SetCacheDirectory(LGE::FileSystem::JoinPath(m_Project->GetIntermediatePath(), "IBLCache"));
+                m_SkyLightEnvironment->SetAssetRoot(m_Project->GetProjectPath());
+            }
+            
             // Initialize ContentBrowser with project
             if (m_ContentBrowser && m_Project) {
                 m_ContentBrowser->SetProjectRoot(m_Project->GetAssetsPath());
@@ -323,12 +354,24 @@ public:
             }
         });
         m_Profiler = std::make_unique<LGE::Profiler>();
+        
+        // Viewport targets are borrowed from a shared pool so resizes reuse recent sizes
+        m_RenderTargetPool = std::make_unique<LGE::RenderTargetPool>();
+        m_Profiler->SetRenderTargetStats(&m_RenderTargetPool->GetStats());
+        
+        // GPU pass timings, read back a few frames late onto the profiler's GPU lane
+        m_GPUProfiler = std::make_unique<LGE::GPUProfiler>(std::make_unique<LGE::GPUTimerGLBackend>());
+        LGE::GPUProfiler::SetActive(m_GPUProfiler.get());
+        if (m_GPUProfiler->IsSupported()) {
+            m_Profiler->SetGPUStats(&m_GPUProfiler->GetStats());
+        }
         m_SceneViewport = std::make_unique<LGE::SceneViewport>();
+        m_SceneViewport->SetRenderTargetPool(m_RenderTargetPool.get());
         m_Details = std::make_unique<LGE::Details>();
         m_Console = std::make_unique<LGE::Console>();
         
         // Register Console callback to receive log messages
-        LGE::Log::RegisterCallback([this](LGE::LogLevel level, const std::string& message) {
+        m_LogCallbackId = LGE::Log::RegisterCallback([this](LGE::LogLevel level, const std::string& message) {
             if (m_Console) {
                 m_Console->AddLog(level, message);
             }
@@ -338,6 +381,13 @@ public:
         m_TextureImporter = std::make_unique<LGE::TextureImporter>();
         m_TextureManager = std::make_unique<LGE::TextureManager>();
         
+        // Stream LDR textures in the background instead of blocking on GetOrLoad
+        m_TextureStreamer = std::make_unique<LGE::TextureStreamer>();
+        if (m_TextureStreamer->Initialize()) {
+            m_TextureManager->SetStreamer(m_TextureStreamer.get());
+            m_Profiler->SetTextureStreamingStats(&m_TextureStreamer->GetStats());
+        }
+        
         // Connect texture manager to importer
         m_TextureImporter->SetTextureManager(m_TextureManager.get());
         
@@ -583,10 +633,10 @@ public:
         
         // Load HDR skybox texture (supports both .hdr and .exr)
         if (!m_Skybox->LoadHDR("assets/EXR Sky/kloofendal_48d_partly_cloudy_puresky_4k.exr")) {
-            // Fallback to gradient if HDR fails to load
+            // Fall back to the procedural atmosphere (gradient until its first bake lands)
             m_Skybox->SetTopColor(LGE::Math::Vector3(0.5f, 0.7f, 1.0f));      // Light blue
             m_Skybox->SetBottomColor(LGE::Math::Vector3(0.8f, 0.9f, 1.0f));   // Light gray-blue
-            LGE::Log::Warn("Failed to load HDR skybox, using gradient fallback");
+            LGE::Log::Warn("Failed to load HDR skybox, using procedural atmosphere");
         }
 
         // Setup sphere mesh for PBR test balls
@@ -636,6 +686,31 @@ public:
         
         // Only update editor systems if project is loaded
         if (!m_ShowProjectBrowser && m_Project && m_Project->IsLoaded()) {
+            // Project open pipeline
+            if (m_FileSystemManager && m_FileSystemManager->IsOpening()) {
+                m_FileSystemManager->Update();
+                
+                // Registry and search index are usable from the frame they are published
+                if (!m_ContentBrowserModel && m_FileSystemManager->IsInitialized() && m_ContentBrowser) {
+                    LGE::AssetRegistry* registry = m_FileSystemManager->GetAssetRegistry();
+                    std::string virtualRoot = m_FileSystemManager->GetAssetScanner()->GetVirtualPath(m_Project->GetAssetsPath());
+                    if (virtualRoot.size() > 1 && virtualRoot.back() == '/') {
+                        virtualRoot.pop_back();
+                    }
+                    m_ContentBrowser->SetAssetRegistry(registry, virtualRoot.empty() ? "/" : virtualRoot);
+                    
+                    m_ContentBrowserModel = std::make_unique<LGE::ContentBrowserModel>(registry, m_FileSystemManager->GetVFS());
+                    m_ContentBrowserModel->SetSearchIndex(m_FileSystemManager->GetSearchIndex());
+                    m_ContentBrowser->SetModel(m_ContentBrowserModel.get());
+                }
+                if (m_Toolbar) {
+                    const LGE::ProjectOpenProgress& progress = m_FileSystemManager->GetOpenProgress();
+                    float fraction = progress.total > 0 ? static_cast<float>(progress.done) / progress.total : 0.0f;
+                    m_Toolbar->SetStatus(m_FileSystemManager->IsOpening() ? LGE::GetProjectOpenStageName(progress.stage) : "",
+                                         fraction > 1.0f ? 1.0f : fraction);
+                }
+            }
+            
             // Update camera controller
             if (m_CameraController) {
                 m_CameraController->OnUpdate(deltaTime);
@@ -667,6 +742,7 @@ public:
                 break;
             case LGE::SceneEvent::Unloaded:
                 // Clear UI references
+                m_UIWorld = nullptr;
                 if (m_Hierarchy) {
                     m_Hierarchy->SetGameObjects({});
                 }
@@ -692,6 +768,13 @@ public:
         auto activeWorld = m_SceneManager->GetActiveWorld();
         if (!activeWorld) return;
         
+        // Runs every frame; only re-gather objects when the hierarchy changed
+        if (activeWorld.get() == m_UIWorld && activeWorld->GetHierarchyVersion() == m_UIWorldVersion) {
+            return;
+        }
+        m_UIWorld = activeWorld.get();
+        m_UIWorldVersion = activeWorld->GetHierarchyVersion();
+        
         auto worldObjects = activeWorld->GetAllGameObjects();
         
         if (m_SceneViewport) {
@@ -703,6 +786,16 @@ public:
     }
 
     void OnRender() override {
+        // Read back finished GPU timings and open this frame's query pool
+        if (m_GPUProfiler) {
+            m_GPUProfiler->BeginFrame();
+        }
+        
+        // Apply finished decodes and this frame's mip uploads/evictions
+        if (m_TextureStreamer) {
+            m_TextureStreamer->Update();
+        }
+        
         // Only show editor UI (menu bar, toolbar, etc.) if project is loaded
         if (!m_ShowProjectBrowser && m_Project && m_Project->IsLoaded()) {
             // Render main menu bar
@@ -902,9 +995,88 @@ public:
         
         // Render scene to framebuffer (everything should render here)
         // Only render if project is loaded and viewport is valid (and not showing project browser)
-        if (!m_ShowProjectBrowser && m_Project && m_Project->IsLoaded() && m_SceneViewport && m_SceneViewport->GetWidth() > 0 && m_SceneViewport->GetHeight() > 0) {
-            // Begin rendering to framebuffer
-            m_SceneViewport->BeginRender();
+        if (!m_ShowProjectBrowser && m_Project && m_Project->IsLoaded() && m_SceneViewport && m_SceneViewport->GetWidth() > 0 && m_SceneViewport->GetHeight() > 0 &&
+            m_RenderTargetPool && m_SceneViewport->PrepareRender()) {
+            RenderViewport();
+        }
+        
+        // Return this frame's transient targets and retire idle ones
+        if (m_RenderTargetPool) {
+            m_RenderTargetPool->EndFrame();
+        }
+        
+        if (m_GPUProfiler) {
+            m_GPUProfiler->EndFrame();
+        }
+    }
+    
+    // Builds this frame's viewport graph: shadows -> scene -> exposure -> tone map.
+    // Passes that feed nothing visible (e.g. shadows without a caster) are culled.
+    void RenderViewport() {
+        LGE_PROFILE_SCOPE("RenderViewport");
+        auto activeWorld = m_SceneManager ? m_SceneManager->GetActiveWorld() : nullptr;
+        
+        // Update lights from active world
+        // CRITICAL: This must be called every frame to pick up inspector changes
+        bool hasShadowCaster = false;
+        if (m_LightSystem && activeWorld && m_Camera) {
+            // BeginFrame clears and collects lights from the world
+            m_LightSystem->BeginFrame(*activeWorld);
+            // UploadToGPU sends the collected lights to the GPU buffer
+            // This ensures any changes made in the inspector are immediately visible
+            m_LightSystem->UploadToGPU();
+            hasShadowCaster = m_LightSystem->PrepareDirectionalShadow(m_Camera.get());
+            
+            // The procedural sky follows the first directional light (lights shine along Direction)
+            if (m_Skybox) {
+                for (const auto& light : m_LightSystem->GetLightBuffer()) {
+                    if (light.Type == static_cast<int>(LGE::LightType::Directional)) {
+                        m_Skybox->SetSunDirection(LGE::Math::Vector3(-light.Direction.x, -light.Direction.y, -light.Direction.z));
+                        break;
+                    }
+                }
+                m_Skybox->Update();
+            }
+            
+            // Pick up sky light changes and upload finished IBL bakes
+            if (m_SkyLightEnvironment) {
+                m_SkyLightEnvironment->SetProceduralSky(m_Skybox && m_Skybox->UsesAtmosphere() ? m_Skybox->GetAtmosphereLUTs() : nullptr);
+                m_SkyLightEnvironment->Update(*activeWorld);
+            }
+        }
+        
+        m_FrameGraph.Reset();
+        
+        // Declared unconditionally; the graph culls it when the scene pass does not sample it
+        LGE::FrameGraphHandle shadowMap = LGE::FrameGraph::InvalidHandle;
+        if (m_LightSystem && activeWorld) {
+            const LGE::DirectionalLightShadow* shadow = m_LightSystem->GetDirectionalShadow();
+            LGE::RenderTargetDesc shadowDesc;
+            shadowDesc.width = LGE::LightSystem::GetShadowMapSize();
+            shadowDesc.height = LGE::LightSystem::GetShadowMapSize();
+            shadowDesc.format = LGE::RenderTargetFormat::Depth32F;
+            shadowMap = m_FrameGraph.ImportTexture("DirectionalShadowMap", shadowDesc,
+                                                   shadow ? shadow->ShadowMapTextureID : 0,
+                                                   shadow ? shadow->ShadowMapFBO : 0);
+            
+            LGE::FrameGraphBuilder shadowPass = m_FrameGraph.AddPass("DirectionalShadow", [this, activeWorld](const LGE::FrameGraphResources&) {
+                m_LightSystem->RenderDirectionalShadow(*activeWorld);
+            });
+            shadowMap = shadowPass.Write(shadowMap, LGE::FrameGraphAccess::DepthStencil);
+        }
+        
+        LGE::RenderTargetDesc colorDesc = m_SceneViewport->GetSceneColorDesc();
+        LGE::RenderTargetDesc depthDesc = colorDesc;
+        depthDesc.format = LGE::RenderTargetFormat::Depth24Stencil8;
+        LGE::FrameGraphHandle sceneColor = m_FrameGraph.CreateTexture("SceneColor", colorDesc);
+        LGE::FrameGraphHandle sceneDepth = m_FrameGraph.CreateTexture("SceneDepth", depthDesc);
+        
+        LGE::FrameGraphBuilder scenePass = m_FrameGraph.AddPass("Scene", [this](const LGE::FrameGraphResources&) {
+            LGE_GPU_SCOPE("Scene");
+            glEnable(GL_DEPTH_TEST);
+            glDepthFunc(GL_LESS);
+            glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
             
             // Render skybox first (so it's behind everything) with cloud movement
             if (m_Skybox) {
@@ -917,43 +1089,32 @@ public:
             }
             
             // Render grid using GridRenderer (before other objects so it's behind them)
-            if (m_SceneViewport && m_SceneViewport->IsGridVisible() && m_GridRenderer && m_GridRenderer->GetShader()) {
+            if (m_SceneViewport->IsGridVisible() && m_GridRenderer && m_GridRenderer->GetShader()) {
                 m_GridRenderer->Draw(m_Camera->GetViewProjectionMatrix());
             }
             
-            
-            // Update lights from active world
-            // CRITICAL: This must be called every frame to pick up inspector changes
-            if (m_LightSystem && m_SceneManager && m_Camera) {
-                auto activeWorld = m_SceneManager->GetActiveWorld();
-                if (activeWorld) {
-                    // BeginFrame clears and collects lights from the world
-                    m_LightSystem->BeginFrame(*activeWorld);
-                    // UploadToGPU sends the collected lights to the GPU buffer
-                    // This ensures any changes made in the inspector are immediately visible
-                    m_LightSystem->UploadToGPU();
-                    
-                    // Render shadow maps before main rendering (only if viewport is valid)
-                    if (m_SceneViewport && m_SceneViewport->GetWidth() > 0 && m_SceneViewport->GetHeight() > 0) {
-                        m_LightSystem->RenderShadowMaps(*activeWorld, m_Camera.get());
-                    }
-                }
-            }
-            
-            // Render GameObjects
             RenderGameObjects();
             
             // Render light gizmos (editor-only visual helpers)
             RenderLightGizmos();
-            
-            // ImGuizmo is rendered in OnUIRender, not here
-            
-            // End rendering to framebuffer (restores viewport)
-            m_SceneViewport->EndRender();
+        });
+        if (hasShadowCaster) {
+            scenePass.Read(shadowMap, LGE::FrameGraphAccess::Sampled);
+        }
+        sceneColor = scenePass.Write(sceneColor, LGE::FrameGraphAccess::RenderTarget);
+        sceneDepth = scenePass.Write(sceneDepth, LGE::FrameGraphAccess::DepthStencil);
+        
+        m_SceneViewport->AddPostProcessPasses(m_FrameGraph, sceneColor);
+        
+        if (!m_FrameGraph.Compile(&m_RenderTargetPool->GetAllocator())) {
+            return;
         }
+        LGE::FrameGraphGLBackend backend(*m_RenderTargetPool);
+        m_FrameGraph.Execute(backend);
     }
     
     void RenderGameObjects() {
+        LGE_PROFILE_SCOPE("RenderGameObjects");
         if (!m_SceneManager || !m_Camera) {
             return;
         }
@@ -1010,6 +1171,21 @@ public:
                 continue;
             }
             
+            // Mip feedback for streamed textures from the object's approximate on-screen size
+            if (m_TextureManager && m_TextureManager->GetStreamer() && !material->GetTextures().empty() && m_SceneViewport) {
+                LGE::Math::Vector3 scale = transform->GetWorldScale();
+                float radius = std::max(scale.x, std::max(scale.y, scale.z));
+                LGE::Math::Vector3 toObject = transform->GetWorldPosition() - m_Camera->GetPosition();
+                float distance = std::max(std::sqrt(toObject.x * toObject.x + toObject.y * toObject.y + toObject.z * toObject.z), 0.01f);
+                float tanHalfFov = std::tan(m_Camera->GetFOV() * 0.5f * 3.14159f / 180.0f);
+                float screenPixels = m_SceneViewport->GetHeight() * radius / (distance * tanHalfFov);
+                for (const auto& [name, texture] : material->GetTextures()) {
+                    if (texture) {
+                        m_TextureManager->ReportScreenSize(*texture, screenPixels);
+                    }
+                }
+            }
+            
             // Calculate model matrix from transform
             LGE::Math::Matrix4 modelMatrix = transform->GetWorldMatrix();
             
@@ -1054,6 +1230,11 @@ public:
                 }
             }
             
+            // Sky light ambient (SH irradiance + prefiltered specular)
+            if (m_SkyLightEnvironment) {
+                m_SkyLightEnvironment->Apply(*material->GetShader());
+            }
+            
             // Set use vertex color to 1.0 to use vertex colors from the mesh
             material->GetShader()->SetUniform1f("u_UseVertexColor", 1.0f);
             
@@ -1104,6 +1285,7 @@ public:
     }
     
     void RenderLightGizmos() {
+        LGE_PROFILE_SCOPE("RenderLightGizmos");
         if (!m_SceneManager || !m_Camera) return;
         
         auto activeWorld = m_SceneManager->GetActiveWorld();
@@ -1713,19 +1895,30 @@ public:
     }
 
     void Shutdown() override {
+        // The console callback runs on the logging thread; detach it before the panels go away
+        LGE::Log::Flush();
+        LGE::Log::UnregisterCallback(m_LogCallbackId);
         
         m_SceneManager.reset();
         m_ContentBrowser.reset();
+        m_ContentBrowserModel.reset();
         m_Inspector.reset();
         m_Hierarchy.reset();
         m_Profiler.reset();
+        m_GPUProfiler.reset();
         m_Preferences.reset();
         m_ProjectSettings.reset();
         m_TextureImporter.reset();
         m_TextureManager.reset();
+        if (m_TextureStreamer) {
+            m_TextureStreamer->Shutdown();
+            m_TextureStreamer.reset();
+        }
         m_Toolbar.reset();
         m_MainMenuBar.reset();
         m_SceneViewport.reset();
+        m_RenderTargetPool.reset();
+        LGE::EditorIcons::Release();
         m_LightSystem.reset();
         m_GridRenderer.reset();
         m_LitMaterial.reset();
@@ -1747,6 +1940,8 @@ private:
     std::unique_ptr<LGE::Camera> m_Camera;
     std::unique_ptr<LGE::CameraController> m_CameraController;
     std::unique_ptr<LGE::Skybox> m_Skybox;
+    std::unique_ptr<LGE::RenderTargetPool> m_RenderTargetPool;
+    LGE::FrameGraph m_FrameGraph;
     std::unique_ptr<LGE::SceneViewport> m_SceneViewport;
     std::unique_ptr<LGE::Details> m_Details;
     std::unique_ptr<LGE::Hierarchy> m_Hierarchy;
@@ -1754,17 +1949,26 @@ private:
     std::unique_ptr<LGE::SceneManager> m_SceneManager;
     std::unique_ptr<LGE::ContentBrowser> m_ContentBrowser;
     std::unique_ptr<LGE::Profiler> m_Profiler;
+    std::unique_ptr<LGE::GPUProfiler> m_GPUProfiler;
+    uint32_t m_LogCallbackId = 0;
+    
+    // World the panels were last filled from, see UpdateUIFromWorld
+    LGE::World* m_UIWorld = nullptr;
+    uint64_t m_UIWorldVersion = 0;
     std::unique_ptr<LGE::Console> m_Console;
     std::unique_ptr<LGE::Preferences> m_Preferences;
     std::unique_ptr<LGE::ProjectSettings> m_ProjectSettings;
     std::unique_ptr<LGE::TextureImporter> m_TextureImporter;
     std::unique_ptr<LGE::TextureManager> m_TextureManager;
+    std::unique_ptr<LGE::TextureStreamer> m_TextureStreamer;
     std::unique_ptr<LGE::Toolbar> m_Toolbar;
     std::unique_ptr<LGE::MainMenuBar> m_MainMenuBar;
     std::unique_ptr<LGE::ProjectBrowser> m_ProjectBrowser;
     std::shared_ptr<LGE::Project> m_Project;
     std::unique_ptr<LGE::FileSystemManager> m_FileSystemManager;
+    std::unique_ptr<LGE::ContentBrowserModel> m_ContentBrowserModel;   // Search over the published registry
     std::unique_ptr<LGE::LightSystem> m_LightSystem;
+    std::unique_ptr<LGE::SkyLightEnvironment> m_SkyLightEnvironment;
     bool m_ShowProjectBrowser;
     
     // Animation time
@@ -0,0 +1,262 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/AtlasPacker.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace LGE {
+
+namespace {
+
+bool Contains(const AtlasRect& outer, const AtlasRect& inner) {
+    return inner.x >= outer.x && inner.y >= outer.y &&
+           inner.x + inner.width <= outer.x + outer.width &&
+           inner.y + inner.height <= outer.y + outer.height;
+}
+
+int NextPowerOfTwo(int value) {
+    int result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+} // namespace
+
+AtlasPacker::AtlasPacker()
+    : m_Width(0)
+    , m_Height(0)
+    , m_Padding(0)
+    , m_UsedArea(0)
+{
+}
+
+AtlasPacker::AtlasPacker(int width, int height, int padding)
+    : AtlasPacker()
+{
+    Reset(width, height, padding);
+}
+
+void AtlasPacker::Reset(int width, int height, int padding) {
+    m_Width = std::max(width, 0);
+    m_Height = std::max(height, 0);
+    m_Padding = std::max(padding, 0);
+    m_UsedArea = 0;
+    m_FreeRects.clear();
+    if (m_Width > 0 && m_Height > 0) {
+        m_FreeRects.push_back({ 0, 0, m_Width, m_Height });
+    }
+}
+
+bool AtlasPacker::Insert(int width, int height, AtlasRect& outRect) {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+    
+    AtlasRect placed;
+    if (!FindPosition(width + m_Padding * 2, height + m_Padding * 2, placed)) {
+        return false;
+    }
+    
+    Place(placed);
+    outRect = { placed.x + m_Padding, placed.y + m_Padding, width, height };
+    return true;
+}
+
+bool AtlasPacker::InsertBatch(const std::vector<AtlasRect>& sizes, std::vector<AtlasRect>& outRects) {
+    // Largest side first keeps the big rects from being squeezed out by
+    // slivers left behind by small ones
+    std::vector<size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::stable_sort(order.begin(), order.end(), [&sizes](size_t a, size_t b) {
+        int sideA = std::max(sizes[a].width, sizes[a].height);
+        int sideB = std::max(sizes[b].width, sizes[b].height);
+        if (sideA != sideB) {
+            return sideA > sideB;
+        }
+        return sizes[a].width * sizes[a].height > sizes[b].width * sizes[b].height;
+    });
+    
+    std::vector<AtlasRect> packed(sizes.size());
+    for (size_t index : order) {
+        if (!Insert(sizes[index].width, sizes[index].height, packed[index])) {
+            return false;
+        }
+    }
+    
+    outRects = std::move(packed);
+    return true;
+}
+
+bool AtlasPacker::ChooseSize(const std::vector<AtlasRect>& sizes, int padding, int maxSize,
+                             int& outWidth, int& outHeight) {
+    uint64_t area = 0;
+    int widest = 1;
+    int tallest = 1;
+    for (const auto& size : sizes) {
+        int w = size.width + padding * 2;
+        int h = size.height + padding * 2;
+        area += static_cast<uint64_t>(w) * static_cast<uint64_t>(h);
+        widest = std::max(widest, w);
+        tallest = std::max(tallest, h);
+    }
+    
+    int width = NextPowerOfTwo(widest);
+    int height = NextPowerOfTwo(tallest);
+    while (static_cast<uint64_t>(width) * static_cast<uint64_t>(height) < area) {
+        if (width <= height) {
+            width <<= 1;
+        } else {
+            height <<= 1;
+        }
+    }
+    
+    // Grow the shorter side until everything fits
+    AtlasPacker packer;
+    std::vector<AtlasRect> rects;
+    while (width <= maxSize && height <= maxSize) {
+        packer.Reset(width, height, padding);
+        if (packer.InsertBatch(sizes, rects)) {
+            outWidth = width;
+            outHeight = height;
+            return true;
+        }
+        if (width <= height) {
+            width <<= 1;
+        } else {
+            height <<= 1;
+        }
+    }
+    return false;
+}
+
+AtlasUV AtlasPacker::ToUV(const AtlasRect& rect, int atlasWidth, int atlasHeight) {
+    AtlasUV uv;
+    if (atlasWidth <= 0 || atlasHeight <= 0) {
+        return uv;
+    }
+    float invWidth = 1.0f / static_cast<float>(atlasWidth);
+    float invHeight = 1.0f / static_cast<float>(atlasHeight);
+    uv.u0 = static_cast<float>(rect.x) * invWidth;
+    uv.v0 = static_cast<float>(rect.y) * invHeight;
+    uv.u1 = static_cast<float>(rect.x + rect.width) * invWidth;
+    uv.v1 = static_cast<float>(rect.y + rect.height) * invHeight;
+    return uv;
+}
+
+float AtlasPacker::GetOccupancy() const {
+    uint64_t total = static_cast<uint64_t>(m_Width) * static_cast<uint64_t>(m_Height);
+    return total > 0 ? static_cast<float>(static_cast<double>(m_UsedArea) / static_cast<double>(total)) : 0.0f;
+}
+
+bool AtlasPacker::FindPosition(int width, int height, AtlasRect& outRect) const {
+    int bestShortSide = std::numeric_limits<int>::max();
+    int bestLongSide = std::numeric_limits<int>::max();
+    bool found = false;
+    
+    for (const auto& freeRect : m_FreeRects) {
+        if (freeRect.width < width || freeRect.height < height) {
+            continue;
+        }
+        int leftoverX = freeRect.width - width;
+        int leftoverY = freeRect.height - height;
+        int shortSide = std::min(leftoverX, leftoverY);
+        int longSide = std::max(leftoverX, leftoverY);
+        if (shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide)) {
+            outRect = { freeRect.x, freeRect.y, width, height };
+            bestShortSide = shortSide;
+            bestLongSide = longSide;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void AtlasPacker::Place(const AtlasRect& rect) {
+    m_NewFreeRects.clear();
+    for (size_t i = 0; i < m_FreeRects.size();) {
+        if (SplitFreeRect(m_FreeRects[i], rect)) {
+            m_FreeRects[i] = m_FreeRects.back();
+            m_FreeRects.pop_back();
+        } else {
+            ++i;
+        }
+    }
+    PruneFreeRects();
+    m_FreeRects.insert(m_FreeRects.end(), m_NewFreeRects.begin(), m_NewFreeRects.end());
+    
+    m_UsedArea += static_cast<uint64_t>(rect.width) * static_cast<uint64_t>(rect.height);
+}
+
+bool AtlasPacker::SplitFreeRect(const AtlasRect& freeRect, const AtlasRect& used) {
+    if (used.x >= freeRect.x + freeRect.width || used.x + used.width <= freeRect.x ||
+        used.y >= freeRect.y + freeRect.height || used.y + used.height <= freeRect.y) {
+        return false;
+    }
+    
+    // Up to four maximal rects remain around the used area
+    if (used.x > freeRect.x) {
+        m_NewFreeRects.push_back({ freeRect.x, freeRect.y, used.x - freeRect.x, freeRect.height });
+    }
+    if (used.x + used.width < freeRect.x + freeRect.width) {
+        int x = used.x + used.width;
+        m_NewFreeRects.push_back({ x, freeRect.y, freeRect.x + freeRect.width - x, freeRect.height });
+    }
+    if (used.y > freeRect.y) {
+        m_NewFreeRects.push_back({ freeRect.x, freeRect.y, freeRect.width, used.y - freeRect.y });
+    }
+    if (used.y + used.height < freeRect.y + freeRect.height) {
+        int y = used.y + used.height;
+        m_NewFreeRects.push_back({ freeRect.x, y, freeRect.width, freeRect.y + freeRect.height - y });
+    }
+    return true;
+}
+
+void AtlasPacker::PruneFreeRects() {
+    // Surviving free rects were already maximal and cannot sit inside a piece
+    // of a rect that was split, so only the new pieces need checking
+    size_t kept = 0;
+    for (size_t i = 0; i < m_NewFreeRects.size(); ++i) {
+        const AtlasRect& candidate = m_NewFreeRects[i];
+        bool redundant = false;
+        for (size_t j = 0; j < m_NewFreeRects.size() && !redundant; ++j) {
+            if (j == i || !Contains(m_NewFreeRects[j], candidate)) {
+                continue;
+            }
+            // Identical pieces: keep the first one
+            redundant = !Contains(candidate, m_NewFreeRects[j]) || j < i;
+        }
+        for (size_t j = 0; j < m_FreeRects.size() && !redundant; ++j) {
+            redundant = Contains(m_FreeRects[j], candidate);
+        }
+        if (!redundant) {
+            m_NewFreeRects[kept++] = candidate;
+        }
+    }
+    m_NewFreeRects.resize(kept);
+}
+
+} // namespace LGE
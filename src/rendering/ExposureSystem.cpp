@@ -21,6 +21,9 @@ For more information, visit: https://nexelgames.com/luma-engine
 */
 
 #include "LGE/rendering/ExposureSystem.h"
+#include "LGE/rendering/Shader.h"
+#include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
 #include <glad/glad.h>
 #include <algorithm>
 #include <cmath>
@@ -36,86 +39,160 @@ ExposureSystem::ExposureSystem()
     , m_MinExposure(0.1f)
     , m_MaxExposure(10.0f)
     , m_LastLuminance(0.18f)
+    , m_LastHistogram{}
+    , m_WriteSlot(0)
+    , m_ReadSlot(0)
+    , m_FrameIndex(0)
+    , m_ReadbackLatency(0)
+    , m_HistogramInitialized(false)
+    , m_HistogramFailed(false)
 {
 }
 
+ExposureSystem::~ExposureSystem() {
+    ReleaseHistogram();
+}
+
 void ExposureSystem::Update(float deltaTime, uint32_t hdrTextureID, uint32_t width, uint32_t height) {
-    if (m_AutoExposure) {
-        // Only calculate luminance every few frames to avoid performance issues
-        // For now, disable auto exposure calculation as it's too slow with glReadPixels
-        // TODO: Implement GPU-based luminance calculation using compute shader or mipmap downsampling
-        // For now, just use manual exposure
-        m_CurrentExposure = EV100ToExposure(m_ManualEV100);
-        
-        // Uncomment below when GPU-based luminance is implemented:
-        /*
-        // Calculate average luminance from HDR texture
-        float avgLuminance = CalculateAverageLuminance(hdrTextureID, width, height);
-        
-        // Clamp luminance to avoid extreme values
-        avgLuminance = std::max(0.01f, std::min(avgLuminance, 10.0f));
-        
-        // Calculate target exposure based on target luminance
-        // Exposure = targetLuminance / currentLuminance
-        float targetExposure = m_TargetLuminance / avgLuminance;
-        
-        // Clamp to min/max range
-        targetExposure = std::max(m_MinExposure, std::min(m_MaxExposure, targetExposure));
-        
-        // Smoothly adapt exposure
-        float adaptationFactor = 1.0f - std::exp(-deltaTime * m_AdaptationSpeed);
-        m_CurrentExposure = m_CurrentExposure + (targetExposure - m_CurrentExposure) * adaptationFactor;
-        
-        m_LastLuminance = avgLuminance;
-        */
-    } else {
+    LGE_PROFILE_SCOPE("ExposureSystem::Update");
+    if (!m_AutoExposure || !InitializeHistogram()) {
         // Manual exposure: convert EV100 to exposure
         m_CurrentExposure = EV100ToExposure(m_ManualEV100);
+        return;
+    }
+    
+    m_FrameIndex++;
+    
+    // Results from earlier frames first, then queue this frame's histogram
+    if (ReadBackHistogram()) {
+        m_LastLuminance = LuminanceHistogram::ComputeAverageLuminance(m_LastHistogram, m_HistogramSettings);
     }
+    DispatchHistogram(hdrTextureID, width, height);
+    
+    // Exposure = targetLuminance / currentLuminance, clamped to min/max range
+    float targetExposure = LuminanceHistogram::ComputeTargetExposure(m_LastLuminance, m_TargetLuminance, m_MinExposure, m_MaxExposure);
+    
+    // Smoothly adapt exposure
+    float adaptationFactor = 1.0f - std::exp(-deltaTime * m_AdaptationSpeed);
+    m_CurrentExposure = m_CurrentExposure + (targetExposure - m_CurrentExposure) * adaptationFactor;
 }
 
-float ExposureSystem::CalculateAverageLuminance(uint32_t hdrTextureID, uint32_t width, uint32_t height) {
-    // Simple approach: sample a small region of the texture
-    // For a full implementation, you'd want to use a compute shader with mipmap downsampling
-    
-    // For now, use a simple CPU-based sampling (this is slow, but works)
-    // In production, use a compute shader or GPU-based histogram
+bool ExposureSystem::InitializeHistogram() {
+    if (m_HistogramInitialized) {
+        return true;
+    }
+    if (m_HistogramFailed) {
+        return false;
+    }
     
-    // Sample a 16x16 grid
-    const int sampleSize = 16;
-    float totalLuminance = 0.0f;
-    int sampleCount = 0;
+    m_HistogramShader = Shader::CreateFromFiles("assets/shaders/PostProcess/LuminanceHistogram.comp");
+    if (!m_HistogramShader) {
+        Log::Error("ExposureSystem: histogram shader unavailable, falling back to manual exposure");
+        m_HistogramFailed = true;
+        return false;
+    }
     
-    // Create a temporary framebuffer to read from
-    GLuint readFBO;
-    glGenFramebuffers(1, &readFBO);
-    glBindFramebuffer(GL_READ_FRAMEBUFFER, readFBO);
-    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, hdrTextureID, 0);
+    const GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    const GLsizeiptr size = sizeof(uint32_t) * LuminanceHistogram::BinCount;
+    for (HistogramSlot& slot : m_HistogramSlots) {
+        glGenBuffers(1, &slot.buffer);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, slot.buffer);
+        glBufferStorage(GL_SHADER_STORAGE_BUFFER, size, nullptr, flags);
+        slot.mapped = static_cast<const uint32_t*>(glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, size, flags));
+        if (!slot.mapped) {
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+            Log::Error("ExposureSystem: failed to map histogram buffer");
+            ReleaseHistogram();
+            m_HistogramFailed = true;
+            return false;
+        }
+    }
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
     
-    // Sample pixels
-    float pixels[sampleSize * sampleSize * 3];
-    for (int y = 0; y < sampleSize; ++y) {
-        for (int x = 0; x < sampleSize; ++x) {
-            int pixelX = (x * width) / sampleSize;
-            int pixelY = (y * height) / sampleSize;
-            
-            glReadPixels(pixelX, pixelY, 1, 1, GL_RGB, GL_FLOAT, &pixels[(y * sampleSize + x) * 3]);
-            
-            // Calculate luminance (relative luminance formula)
-            float r = pixels[(y * sampleSize + x) * 3 + 0];
-            float g = pixels[(y * sampleSize + x) * 3 + 1];
-            float b = pixels[(y * sampleSize + x) * 3 + 2];
-            
-            float luminance = 0.2126f * r + 0.7152f * g + 0.0722f * b;
-            totalLuminance += luminance;
-            sampleCount++;
+    m_HistogramInitialized = true;
+    return true;
+}
+
+void ExposureSystem::ReleaseHistogram() {
+    for (HistogramSlot& slot : m_HistogramSlots) {
+        if (slot.fence) {
+            glDeleteSync(static_cast<GLsync>(slot.fence));
+            slot.fence = nullptr;
+        }
+        if (slot.buffer != 0) {
+            if (slot.mapped) {
+                glBindBuffer(GL_SHADER_STORAGE_BUFFER, slot.buffer);
+                glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+                glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+                slot.mapped = nullptr;
+            }
+            glDeleteBuffers(1, &slot.buffer);
+            slot.buffer = 0;
         }
     }
+    m_HistogramShader.reset();
+    m_HistogramInitialized = false;
+}
+
+void ExposureSystem::DispatchHistogram(uint32_t hdrTextureID, uint32_t width, uint32_t height) {
+    if (hdrTextureID == 0 || width == 0 || height == 0) {
+        return;
+    }
+    
+    // All slots still in flight: skip this frame rather than stall
+    HistogramSlot& slot = m_HistogramSlots[m_WriteSlot];
+    if (slot.fence) {
+        return;
+    }
+    
+    const uint32_t zero = 0;
+    glClearNamedBufferData(slot.buffer, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, slot.buffer);
+    
+    m_HistogramShader->Bind();
+    m_HistogramShader->SetTexture("u_HDRTexture", hdrTextureID, 0);
+    m_HistogramShader->SetUniform1f("u_MinLog2Luminance", m_HistogramSettings.minLog2Luminance);
+    m_HistogramShader->SetUniform1f("u_InverseLog2Range",
+        1.0f / (m_HistogramSettings.maxLog2Luminance - m_HistogramSettings.minLog2Luminance));
+    glUniform2i(glGetUniformLocation(m_HistogramShader->GetRendererID(), "u_InputSize"),
+                static_cast<GLint>(width), static_cast<GLint>(height));
+    m_HistogramShader->Dispatch((width + 15) / 16, (height + 15) / 16, 1);
+    m_HistogramShader->Unbind();
     
-    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
-    glDeleteFramebuffers(1, &readFBO);
+    // Make the shader writes visible through the persistent mapping once the fence signals
+    glMemoryBarrier(GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT);
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.frame = m_FrameIndex;
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
     
-    return sampleCount > 0 ? (totalLuminance / sampleCount) : m_TargetLuminance;
+    m_WriteSlot = (m_WriteSlot + 1) % HISTOGRAM_READBACK_SLOTS;
+}
+
+bool ExposureSystem::ReadBackHistogram() {
+    bool received = false;
+    
+    // Poll with a zero timeout; an unfinished slot is simply checked again next frame
+    for (uint32_t i = 0; i < HISTOGRAM_READBACK_SLOTS; ++i) {
+        HistogramSlot& slot = m_HistogramSlots[m_ReadSlot];
+        if (!slot.fence) {
+            break;
+        }
+        
+        GLenum status = glClientWaitSync(static_cast<GLsync>(slot.fence), 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+            break;
+        }
+        
+        std::copy(slot.mapped, slot.mapped + LuminanceHistogram::BinCount, m_LastHistogram.begin());
+        glDeleteSync(static_cast<GLsync>(slot.fence));
+        slot.fence = nullptr;
+        m_ReadbackLatency = static_cast<uint32_t>(m_FrameIndex - slot.frame);
+        m_ReadSlot = (m_ReadSlot + 1) % HISTOGRAM_READBACK_SLOTS;
+        received = true;
+    }
+    
+    return received;
 }
 
 void ExposureSystem::SetManualExposure(float ev100) {
@@ -130,4 +207,3 @@ float ExposureSystem::EV100ToExposure(float ev100) {
 }
 
 } // namespace LGE
-
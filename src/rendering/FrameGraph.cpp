@@ -0,0 +1,413 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/FrameGraph.h"
+#include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
+#include <functional>
+#include <queue>
+
+namespace LGE {
+
+namespace {
+
+// Barrier needed when a storage write is consumed through the given access.
+// Attachment writes and sampled reads are ordered by GL itself.
+uint32_t BarrierFor(FrameGraphAccess producer, FrameGraphAccess consumer) {
+    if (producer != FrameGraphAccess::Storage) {
+        return FrameGraphBarrier::None;
+    }
+    switch (consumer) {
+        case FrameGraphAccess::Sampled:      return FrameGraphBarrier::TextureFetch;
+        case FrameGraphAccess::Storage:      return FrameGraphBarrier::ImageAccess;
+        case FrameGraphAccess::RenderTarget:
+        case FrameGraphAccess::DepthStencil: return FrameGraphBarrier::Framebuffer;
+    }
+    return FrameGraphBarrier::None;
+}
+
+} // namespace
+
+uint32_t FrameGraphResources::GetTexture(FrameGraphHandle handle) const {
+    if (!m_Graph.IsValidHandle(handle)) {
+        return 0;
+    }
+    return m_Graph.m_Resources[m_Graph.m_Nodes[handle].resource].texture;
+}
+
+const RenderTargetDesc& FrameGraphResources::GetDesc(FrameGraphHandle handle) const {
+    return m_Graph.m_Resources[m_Graph.m_Nodes[handle].resource].desc;
+}
+
+FrameGraphHandle FrameGraphBuilder::Read(FrameGraphHandle handle, FrameGraphAccess access) {
+    if (!m_Graph.IsValidHandle(handle)) {
+        Log::Error("FrameGraph: pass '" + m_Graph.m_Passes[m_Pass].name + "' reads an invalid resource");
+        return FrameGraph::InvalidHandle;
+    }
+    m_Graph.m_Nodes[handle].readers.push_back(m_Pass);
+    m_Graph.m_Passes[m_Pass].reads.push_back({handle, access});
+    m_Graph.m_Compiled = false;
+    return handle;
+}
+
+FrameGraphHandle FrameGraphBuilder::Write(FrameGraphHandle handle, FrameGraphAccess access) {
+    if (!m_Graph.IsValidHandle(handle)) {
+        Log::Error("FrameGraph: pass '" + m_Graph.m_Passes[m_Pass].name + "' writes an invalid resource");
+        return FrameGraph::InvalidHandle;
+    }
+    
+    uint32_t resource = m_Graph.m_Nodes[handle].resource;
+    if (m_Graph.m_Resources[resource].latest != handle) {
+        Log::Error("FrameGraph: pass '" + m_Graph.m_Passes[m_Pass].name + "' writes a stale version of '" +
+                   m_Graph.m_Resources[resource].name + "'");
+        return FrameGraph::InvalidHandle;
+    }
+    
+    FrameGraphHandle node = m_Graph.AddNode(resource, handle);
+    m_Graph.m_Nodes[node].producer = m_Pass;
+    m_Graph.m_Nodes[node].producerAccess = access;
+    m_Graph.m_Passes[m_Pass].writes.push_back({node, access});
+    return node;
+}
+
+void FrameGraphBuilder::SetSideEffect() {
+    m_Graph.m_Passes[m_Pass].sideEffect = true;
+    m_Graph.m_Compiled = false;
+}
+
+FrameGraph::FrameGraph()
+    : m_Compiled(false) {
+}
+
+void FrameGraph::Reset() {
+    m_Resources.clear();
+    m_Nodes.clear();
+    m_Passes.clear();
+    m_Order.clear();
+    m_Compiled = false;
+}
+
+FrameGraphHandle FrameGraph::AddNode(uint32_t resource, FrameGraphHandle previous) {
+    FrameGraphHandle handle = static_cast<FrameGraphHandle>(m_Nodes.size());
+    Node node;
+    node.resource = resource;
+    node.previous = previous;
+    m_Nodes.push_back(std::move(node));
+    m_Resources[resource].latest = handle;
+    m_Compiled = false;
+    return handle;
+}
+
+FrameGraphHandle FrameGraph::CreateTexture(const std::string& name, const RenderTargetDesc& desc) {
+    Resource resource;
+    resource.name = name;
+    resource.desc = desc;
+    m_Resources.push_back(std::move(resource));
+    return AddNode(static_cast<uint32_t>(m_Resources.size() - 1), InvalidHandle);
+}
+
+FrameGraphHandle FrameGraph::ImportTexture(const std::string& name, const RenderTargetDesc& desc,
+                                           uint32_t texture, uint32_t framebuffer) {
+    Resource resource;
+    resource.name = name;
+    resource.desc = desc;
+    resource.imported = true;
+    resource.texture = texture;
+    resource.framebuffer = framebuffer;
+    m_Resources.push_back(std::move(resource));
+    return AddNode(static_cast<uint32_t>(m_Resources.size() - 1), InvalidHandle);
+}
+
+FrameGraphBuilder FrameGraph::AddPass(const std::string& name, ExecuteFn execute) {
+    Pass pass;
+    pass.name = name;
+    pass.profileName = Profiling::InternName(name);
+    pass.execute = std::move(execute);
+    m_Passes.push_back(std::move(pass));
+    m_Compiled = false;
+    return FrameGraphBuilder(*this, static_cast<uint32_t>(m_Passes.size() - 1));
+}
+
+void FrameGraph::MarkOutput(FrameGraphHandle handle) {
+    if (!IsValidHandle(handle)) {
+        Log::Error("FrameGraph: cannot mark an invalid resource as output");
+        return;
+    }
+    m_Nodes[handle].output = true;
+    m_Compiled = false;
+}
+
+void FrameGraph::CullPasses() {
+    std::vector<uint32_t> stack;
+    for (auto& pass : m_Passes) {
+        pass.culled = true;
+        pass.barriers = FrameGraphBarrier::None;
+    }
+    
+    auto keep = [&](uint32_t pass) {
+        if (pass != InvalidPass && m_Passes[pass].culled) {
+            m_Passes[pass].culled = false;
+            stack.push_back(pass);
+        }
+    };
+    
+    for (uint32_t i = 0; i < m_Passes.size(); ++i) {
+        if (m_Passes[i].sideEffect) {
+            keep(i);
+        }
+    }
+    for (const auto& node : m_Nodes) {
+        if (node.output) {
+            keep(node.producer);
+        }
+    }
+    
+    // Walk back from the roots through everything they consume
+    while (!stack.empty()) {
+        uint32_t pass = stack.back();
+        stack.pop_back();
+        for (const Access& read : m_Passes[pass].reads) {
+            keep(m_Nodes[read.node].producer);
+        }
+        for (const Access& write : m_Passes[pass].writes) {
+            FrameGraphHandle previous = m_Nodes[write.node].previous;
+            if (previous != InvalidHandle) {
+                keep(m_Nodes[previous].producer);
+            }
+        }
+    }
+}
+
+bool FrameGraph::SortPasses() {
+    const uint32_t passCount = static_cast<uint32_t>(m_Passes.size());
+    std::vector<std::vector<uint32_t>> successors(passCount);
+    std::vector<uint32_t> inDegree(passCount, 0);
+    
+    auto addEdge = [&](uint32_t from, uint32_t to) {
+        if (from == InvalidPass || from == to || m_Passes[from].culled) {
+            return;
+        }
+        successors[from].push_back(to);
+        ++inDegree[to];
+    };
+    
+    uint32_t aliveCount = 0;
+    for (uint32_t i = 0; i < passCount; ++i) {
+        const Pass& pass = m_Passes[i];
+        if (pass.culled) {
+            continue;
+        }
+        ++aliveCount;
+        for (const Access& read : pass.reads) {
+            addEdge(m_Nodes[read.node].producer, i);
+        }
+        for (const Access& write : pass.writes) {
+            FrameGraphHandle previous = m_Nodes[write.node].previous;
+            if (previous == InvalidHandle) {
+                continue;
+            }
+            // After the last writer, and after everyone still reading the old contents
+            addEdge(m_Nodes[previous].producer, i);
+            for (uint32_t reader : m_Nodes[previous].readers) {
+                addEdge(reader, i);
+            }
+        }
+    }
+    
+    // Kahn's algorithm; ties go to declaration order so the result is stable
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> ready;
+    for (uint32_t i = 0; i < passCount; ++i) {
+        if (!m_Passes[i].culled && inDegree[i] == 0) {
+            ready.push(i);
+        }
+    }
+    
+    m_Order.clear();
+    m_Order.reserve(aliveCount);
+    while (!ready.empty()) {
+        uint32_t pass = ready.top();
+        ready.pop();
+        m_Order.push_back(pass);
+        for (uint32_t next : successors[pass]) {
+            if (--inDegree[next] == 0) {
+                ready.push(next);
+            }
+        }
+    }
+    
+    if (m_Order.size() != aliveCount) {
+        Log::Error("FrameGraph: passes form a dependency cycle");
+        m_Order.clear();
+        return false;
+    }
+    return true;
+}
+
+void FrameGraph::ComputeLifetimes() {
+    for (auto& resource : m_Resources) {
+        resource.firstPass = InvalidPass;
+        resource.lastPass = InvalidPass;
+        resource.target = RenderTargetAllocator::InvalidHandle;
+    }
+    
+    auto touch = [&](FrameGraphHandle node, uint32_t position) {
+        Resource& resource = m_Resources[m_Nodes[node].resource];
+        if (resource.firstPass == InvalidPass) {
+            resource.firstPass = position;
+        }
+        resource.lastPass = position;
+    };
+    
+    for (uint32_t position = 0; position < m_Order.size(); ++position) {
+        const Pass& pass = m_Passes[m_Order[position]];
+        for (const Access& read : pass.reads) {
+            touch(read.node, position);
+        }
+        for (const Access& write : pass.writes) {
+            touch(write.node, position);
+        }
+    }
+}
+
+void FrameGraph::PlaceBarriers() {
+    for (uint32_t index : m_Order) {
+        Pass& pass = m_Passes[index];
+        for (const Access& read : pass.reads) {
+            pass.barriers |= BarrierFor(m_Nodes[read.node].producerAccess, read.access);
+        }
+        for (const Access& write : pass.writes) {
+            FrameGraphHandle previous = m_Nodes[write.node].previous;
+            if (previous != InvalidHandle && m_Nodes[previous].producer != InvalidPass) {
+                pass.barriers |= BarrierFor(m_Nodes[previous].producerAccess, write.access);
+            }
+        }
+    }
+}
+
+bool FrameGraph::Compile(RenderTargetAllocator* allocator) {
+    LGE_PROFILE_SCOPE("FrameGraph::Compile");
+    m_Compiled = false;
+    
+    CullPasses();
+    if (!SortPasses()) {
+        return false;
+    }
+    ComputeLifetimes();
+    PlaceBarriers();
+    
+    if (allocator) {
+        std::vector<uint32_t> transients(m_Resources.size(), RenderTargetAllocator::InvalidHandle);
+        for (uint32_t i = 0; i < m_Resources.size(); ++i) {
+            const Resource& resource = m_Resources[i];
+            if (!resource.imported && resource.firstPass != InvalidPass) {
+                transients[i] = allocator->DeclareTransient(resource.desc, resource.firstPass, resource.lastPass);
+            }
+        }
+        allocator->CompileTransients();
+        for (uint32_t i = 0; i < m_Resources.size(); ++i) {
+            if (transients[i] != RenderTargetAllocator::InvalidHandle) {
+                m_Resources[i].target = allocator->GetTransientTarget(transients[i]);
+            }
+        }
+    }
+    
+    m_Compiled = true;
+    return true;
+}
+
+void FrameGraph::Execute(FrameGraphBackend& backend) {
+    if (!m_Compiled) {
+        Log::Error("FrameGraph: Execute called before a successful Compile");
+        return;
+    }
+    
+    for (auto& resource : m_Resources) {
+        if (!resource.imported) {
+            resource.texture = resource.target != RenderTargetAllocator::InvalidHandle
+                ? backend.GetTexture(resource.target) : 0;
+        }
+    }
+    
+    for (uint32_t index : m_Order) {
+        const Pass& pass = m_Passes[index];
+        if (pass.barriers != FrameGraphBarrier::None) {
+            backend.Barrier(pass.barriers);
+        }
+        
+        const Resource* color = nullptr;
+        const Resource* depth = nullptr;
+        for (const Access& write : pass.writes) {
+            if (write.access == FrameGraphAccess::RenderTarget) {
+                color = &m_Resources[m_Nodes[write.node].resource];
+            } else if (write.access == FrameGraphAccess::DepthStencil) {
+                depth = &m_Resources[m_Nodes[write.node].resource];
+            }
+        }
+        
+        uint32_t framebuffer = 0;
+        const Resource* attachment = color ? color : depth;
+        if (attachment) {
+            if (attachment->imported) {
+                framebuffer = attachment->framebuffer;
+            } else {
+                framebuffer = backend.GetFramebuffer(
+                    color ? color->target : RenderTargetAllocator::InvalidHandle,
+                    depth ? depth->target : RenderTargetAllocator::InvalidHandle);
+            }
+            backend.BeginPass(framebuffer, attachment->desc.width, attachment->desc.height);
+        }
+        
+        if (pass.execute) {
+            LGE_PROFILE_SCOPE(pass.profileName);
+            pass.execute(FrameGraphResources(*this, framebuffer));
+        }
+    }
+    
+    backend.EndPasses();
+}
+
+bool FrameGraph::GetLifetime(FrameGraphHandle handle, uint32_t& outFirst, uint32_t& outLast) const {
+    if (!IsValidHandle(handle)) {
+        return false;
+    }
+    const Resource& resource = m_Resources[m_Nodes[handle].resource];
+    if (resource.firstPass == InvalidPass) {
+        return false;
+    }
+    outFirst = resource.firstPass;
+    outLast = resource.lastPass;
+    return true;
+}
+
+uint32_t FrameGraph::GetTarget(FrameGraphHandle handle) const {
+    if (!IsValidHandle(handle)) {
+        return RenderTargetAllocator::InvalidHandle;
+    }
+    return m_Resources[m_Nodes[handle].resource].target;
+}
+
+const std::string& FrameGraph::GetResourceName(FrameGraphHandle handle) const {
+    return m_Resources[m_Nodes[handle].resource].name;
+}
+
+} // namespace LGE
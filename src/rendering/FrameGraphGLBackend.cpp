@@ -0,0 +1,80 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/FrameGraphGLBackend.h"
+#include "LGE/rendering/RenderTargetPool.h"
+#include <glad/glad.h>
+
+namespace LGE {
+
+FrameGraphGLBackend::FrameGraphGLBackend(RenderTargetPool& pool)
+    : m_Pool(pool)
+    , m_StateSaved(false)
+    , m_SavedFramebuffer(0)
+    , m_SavedViewport{0, 0, 0, 0} {
+}
+
+uint32_t FrameGraphGLBackend::GetTexture(uint32_t target) {
+    return m_Pool.GetTexture(target);
+}
+
+uint32_t FrameGraphGLBackend::GetFramebuffer(uint32_t colorTarget, uint32_t depthTarget) {
+    return m_Pool.GetFramebuffer(colorTarget, depthTarget);
+}
+
+void FrameGraphGLBackend::BeginPass(uint32_t framebuffer, uint32_t width, uint32_t height) {
+    if (!m_StateSaved) {
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &m_SavedFramebuffer);
+        glGetIntegerv(GL_VIEWPORT, m_SavedViewport);
+        m_StateSaved = true;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height));
+}
+
+void FrameGraphGLBackend::Barrier(uint32_t barriers) {
+    GLbitfield bits = 0;
+    if (barriers & FrameGraphBarrier::TextureFetch) {
+        bits |= GL_TEXTURE_FETCH_BARRIER_BIT;
+    }
+    if (barriers & FrameGraphBarrier::ImageAccess) {
+        bits |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+    }
+    if (barriers & FrameGraphBarrier::Framebuffer) {
+        bits |= GL_FRAMEBUFFER_BARRIER_BIT;
+    }
+    if (bits != 0) {
+        glMemoryBarrier(bits);
+    }
+}
+
+void FrameGraphGLBackend::EndPasses() {
+    if (!m_StateSaved) {
+        return;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(m_SavedFramebuffer));
+    glViewport(m_SavedViewport[0], m_SavedViewport[1], m_SavedViewport[2], m_SavedViewport[3]);
+    m_StateSaved = false;
+}
+
+} // namespace LGE
@@ -29,17 +29,21 @@ For more information, visit: https://nexelgames.com/luma-engine
 */
 
 #include "LGE/rendering/Framebuffer.h"
+#include "LGE/rendering/RenderTargetPool.h"
 #include <glad/glad.h>
 
 namespace LGE {
 
-Framebuffer::Framebuffer(uint32_t width, uint32_t height, EFramebufferFormat format)
+Framebuffer::Framebuffer(uint32_t width, uint32_t height, EFramebufferFormat format, RenderTargetPool* pool)
     : m_RendererID(0)
     , m_ColorAttachment(0)
     , m_DepthAttachment(0)
     , m_Width(width)
     , m_Height(height)
     , m_Format(format)
+    , m_Pool(pool)
+    , m_ColorTarget(RenderTargetPool::InvalidHandle)
+    , m_DepthTarget(RenderTargetPool::InvalidHandle)
 {
     Invalidate();
 }
@@ -52,6 +56,11 @@ void Framebuffer::Invalidate() {
     if (m_RendererID) {
         Release();
     }
+    
+    if (m_Pool) {
+        InvalidateFromPool();
+        return;
+    }
 
     glGenFramebuffers(1, &m_RendererID);
     glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
@@ -87,7 +96,35 @@ void Framebuffer::Invalidate() {
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
+void Framebuffer::InvalidateFromPool() {
+    RenderTargetDesc colorDesc;
+    colorDesc.width = m_Width;
+    colorDesc.height = m_Height;
+    colorDesc.format = m_Format == EFramebufferFormat::HDR ? RenderTargetFormat::RGBA16F : RenderTargetFormat::RGBA8;
+    
+    RenderTargetDesc depthDesc = colorDesc;
+    depthDesc.format = RenderTargetFormat::Depth24Stencil8;
+    
+    // Sizes seen recently (e.g. toggling a docked panel) come back without new allocations
+    m_ColorTarget = m_Pool->Acquire(colorDesc);
+    m_DepthTarget = m_Pool->Acquire(depthDesc);
+    m_ColorAttachment = m_Pool->GetTexture(m_ColorTarget);
+    m_DepthAttachment = m_Pool->GetTexture(m_DepthTarget);
+    m_RendererID = m_Pool->GetFramebuffer(m_ColorTarget, m_DepthTarget);
+}
+
 void Framebuffer::Release() {
+    if (m_Pool) {
+        m_Pool->Release(m_ColorTarget);
+        m_Pool->Release(m_DepthTarget);
+        m_ColorTarget = RenderTargetPool::InvalidHandle;
+        m_DepthTarget = RenderTargetPool::InvalidHandle;
+        m_ColorAttachment = 0;
+        m_DepthAttachment = 0;
+        m_RendererID = 0;
+        return;
+    }
+    
     if (m_ColorAttachment) {
         glDeleteTextures(1, &m_ColorAttachment);
         m_ColorAttachment = 0;
@@ -0,0 +1,223 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/GPUProfiler.h"
+#include "LGE/core/Log.h"
+#include <algorithm>
+#include <cmath>
+
+namespace LGE {
+
+GPUProfiler* GPUProfiler::s_Active = nullptr;
+
+GPUProfiler::GPUProfiler(std::unique_ptr<GPUTimerBackend> backend)
+    : m_Backend(std::move(backend))
+    , m_FrameNumber(0)
+    , m_Current(0)
+    , m_Depth(0)
+    , m_Track(0)
+    , m_Supported(false)
+    , m_InFrame(false)
+{
+    m_Supported = m_Backend && m_Backend->IsSupported();
+    if (!m_Supported) {
+        Log::Warn("GPUProfiler: Timestamp queries not supported, GPU zones disabled");
+        return;
+    }
+    
+    m_Pools.resize(kFramesInFlight);
+    for (FramePool& pool : m_Pools) {
+        CreatePool(pool);
+    }
+    m_Stats.framesInFlight = kFramesInFlight;
+    m_Resolved.reserve(kMaxZonesPerFrame);
+    m_Track = Profiling::CreateTrack("GPU");
+}
+
+GPUProfiler::~GPUProfiler() {
+    if (s_Active == this) {
+        s_Active = nullptr;
+    }
+    
+    if (m_Supported) {
+        for (FramePool& pool : m_Pools) {
+            m_Backend->DestroyQueries(static_cast<uint32_t>(pool.queries.size()), pool.queries.data());
+        }
+    }
+}
+
+void GPUProfiler::CreatePool(FramePool& pool) {
+    pool.queries.resize(kMaxZonesPerFrame * 2);
+    m_Backend->CreateQueries(static_cast<uint32_t>(pool.queries.size()), pool.queries.data());
+    pool.zones.reserve(kMaxZonesPerFrame);
+}
+
+void GPUProfiler::BeginFrame() {
+    if (!m_Supported) {
+        return;
+    }
+    if (m_InFrame) {
+        EndFrame();
+    }
+    
+    // Oldest pool first; the GPU finishes frames in order, so stop at the first busy one
+    const uint32_t poolCount = static_cast<uint32_t>(m_Pools.size());
+    for (uint32_t i = 1; i <= poolCount; ++i) {
+        FramePool& pool = m_Pools[(m_Current + i) % poolCount];
+        if (pool.pending && !TryResolve(pool)) {
+            break;
+        }
+    }
+    
+    // The GPU is further behind than the ring: insert a fresh pool ahead of the
+    // oldest frame, or once at the limit, give that frame up rather than wait
+    uint32_t next = (m_Current + 1) % poolCount;
+    if (m_Pools[next].pending) {
+        if (poolCount < kMaxFramesInFlight) {
+            m_Pools.insert(m_Pools.begin() + next, FramePool());
+            CreatePool(m_Pools[next]);
+            m_Stats.framesInFlight = poolCount + 1;
+        } else {
+            m_Pools[next].pending = false;
+            m_Stats.droppedFrames++;
+        }
+    }
+    m_Current = next;
+    FramePool& pool = m_Pools[m_Current];
+    
+    pool.zones.clear();
+    pool.frameNumber = ++m_FrameNumber;
+    pool.gpuReference = m_Backend->GetGPUTime();
+    pool.cpuReference = Profiling::Now();
+    m_Depth = 0;
+    m_InFrame = true;
+}
+
+void GPUProfiler::EndFrame() {
+    if (!m_InFrame) {
+        return;
+    }
+    
+    m_InFrame = false;
+    FramePool& pool = m_Pools[m_Current];
+    pool.pending = !pool.zones.empty();
+    if (pool.pending) {
+        m_Stats.framesSinceResolve++;
+    }
+}
+
+uint32_t GPUProfiler::BeginZone(const char* name) {
+    if (!m_InFrame) {
+        return InvalidZone;
+    }
+    
+    FramePool& pool = m_Pools[m_Current];
+    if (pool.zones.size() >= kMaxZonesPerFrame) {
+        m_Stats.overflowZones++;
+        return InvalidZone;
+    }
+    
+    uint32_t zone = static_cast<uint32_t>(pool.zones.size());
+    Zone entry;
+    entry.name = name;
+    entry.depth = m_Depth++;
+    pool.zones.push_back(entry);
+    
+    pool.lastQuery = pool.queries[zone * 2];
+    m_Backend->WriteTimestamp(pool.lastQuery);
+    return zone;
+}
+
+void GPUProfiler::EndZone(uint32_t zone) {
+    if (zone == InvalidZone || !m_InFrame) {
+        return;
+    }
+    
+    FramePool& pool = m_Pools[m_Current];
+    if (zone >= pool.zones.size() || pool.zones[zone].closed) {
+        return;
+    }
+    
+    pool.lastQuery = pool.queries[zone * 2 + 1];
+    m_Backend->WriteTimestamp(pool.lastQuery);
+    pool.zones[zone].closed = true;
+    m_Depth = m_Depth > 0 ? m_Depth - 1 : 0;
+}
+
+bool GPUProfiler::TryResolve(FramePool& pool) {
+    // The last timestamp completes last, so this is usually the only query polled
+    if (!m_Backend->IsResultAvailable(pool.lastQuery)) {
+        return false;
+    }
+    for (size_t i = 0; i < pool.zones.size(); ++i) {
+        if (pool.zones[i].closed &&
+            (!m_Backend->IsResultAvailable(pool.queries[i * 2]) || !m_Backend->IsResultAvailable(pool.queries[i * 2 + 1]))) {
+            return false;
+        }
+    }
+    
+    // GPU nanoseconds -> CPU ticks, anchored at the pair sampled in BeginFrame
+    const double ticksPerNanosecond = Profiling::GetTicksPerSecond() / 1000000000.0;
+    auto toTicks = [&pool, ticksPerNanosecond](uint64_t gpuTime) {
+        int64_t offset = static_cast<int64_t>(gpuTime - pool.gpuReference);
+        return pool.cpuReference + static_cast<uint64_t>(std::llround(offset * ticksPerNanosecond));
+    };
+    
+    m_Resolved.clear();
+    uint64_t frameNanoseconds = 0;
+    for (size_t i = 0; i < pool.zones.size(); ++i) {
+        const Zone& zone = pool.zones[i];
+        if (!zone.closed) {
+            continue; // Never ended this frame; its end timestamp is stale
+        }
+        
+        uint64_t begin = m_Backend->GetResult(pool.queries[i * 2]);
+        uint64_t end = std::max(begin, m_Backend->GetResult(pool.queries[i * 2 + 1]));
+        if (zone.depth == 0) {
+            frameNanoseconds += end - begin;
+        }
+        
+        ProfileZone resolved;
+        resolved.name = zone.name;
+        resolved.begin = toTicks(begin);
+        resolved.end = toTicks(end);
+        resolved.threadIndex = m_Track;
+        resolved.depth = zone.depth;
+        m_Resolved.push_back(resolved);
+    }
+    
+    // Timeline lanes are stored in order of completion
+    std::stable_sort(m_Resolved.begin(), m_Resolved.end(), [](const ProfileZone& a, const ProfileZone& b) {
+        return a.end < b.end;
+    });
+    Profiling::RecordTrackZones(m_Track, m_Resolved.data(), m_Resolved.size());
+    
+    m_Stats.frameMs = frameNanoseconds / 1000000.0f;
+    m_Stats.latencyFrames = static_cast<uint32_t>(m_FrameNumber + 1 - pool.frameNumber);
+    m_Stats.resolvedFrames++;
+    m_Stats.framesSinceResolve = 0;
+    pool.pending = false;
+    return true;
+}
+
+} // namespace LGE
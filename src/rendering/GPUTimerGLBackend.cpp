@@ -0,0 +1,63 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/GPUTimerGLBackend.h"
+#include <glad/glad.h>
+
+namespace LGE {
+
+bool GPUTimerGLBackend::IsSupported() const {
+    return GLAD_GL_VERSION_3_3 && glQueryCounter && glGetQueryObjectui64v && glGetInteger64v;
+}
+
+void GPUTimerGLBackend::CreateQueries(uint32_t count, uint32_t* outQueries) {
+    glGenQueries(static_cast<GLsizei>(count), outQueries);
+}
+
+void GPUTimerGLBackend::DestroyQueries(uint32_t count, const uint32_t* queries) {
+    glDeleteQueries(static_cast<GLsizei>(count), queries);
+}
+
+void GPUTimerGLBackend::WriteTimestamp(uint32_t query) {
+    glQueryCounter(query, GL_TIMESTAMP);
+}
+
+bool GPUTimerGLBackend::IsResultAvailable(uint32_t query) {
+    GLint available = 0;
+    glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    return available != 0;
+}
+
+uint64_t GPUTimerGLBackend::GetResult(uint32_t query) {
+    GLuint64 result = 0;
+    glGetQueryObjectui64v(query, GL_QUERY_RESULT, &result);
+    return static_cast<uint64_t>(result);
+}
+
+uint64_t GPUTimerGLBackend::GetGPUTime() {
+    GLint64 time = 0;
+    glGetInteger64v(GL_TIMESTAMP, &time);
+    return static_cast<uint64_t>(time);
+}
+
+} // namespace LGE
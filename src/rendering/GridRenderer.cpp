@@ -30,6 +30,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/rendering/Shader.h"
 #include "LGE/math/Vector.h"
 #include "LGE/math/Matrix.h"
+#include "LGE/rendering/GPUProfiler.h"
 #include <glad/glad.h>
 #include <vector>
 #include <cstring>
@@ -96,6 +97,7 @@ void GridRenderer::GenerateGridVertices(int halfSize, float spacing) {
 }
 
 void GridRenderer::Draw(const Math::Matrix4& viewProj) {
+    LGE_GPU_SCOPE("Grid");
     if (!m_Shader) {
         return;
     }
@@ -0,0 +1,479 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/HDRDecoder.h"
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/filesystem/MappedFile.h"
+#include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LGE_HDR_SSE2 1
+#include <emmintrin.h>
+#else
+#define LGE_HDR_SSE2 0
+#endif
+
+// tinyexr decompresses ZIP blocks through the zlib inflater that ships with
+// stb_image (implemented in StbImage.cpp). Blocks are decoded on tinyexr's own
+// worker threads.
+#define TINYEXR_USE_MINIZ 0
+#define TINYEXR_USE_STB_ZLIB 1
+#define TINYEXR_USE_THREAD 1
+#define TINYEXR_IMPLEMENTATION
+#include "../../third_party/tinyexr.h"
+
+// tinyexr references the stb_image_write deflater from its EXR writer. We only
+// ever read EXRs, so report compression as unavailable instead of vendoring it.
+extern "C" unsigned char* stbi_zlib_compress(unsigned char* data, int dataLen, int* outLen, int quality) {
+    (void)data;
+    (void)dataLen;
+    (void)quality;
+    if (outLen) {
+        *outLen = 0;
+    }
+    return nullptr;
+}
+
+namespace LGE {
+
+namespace {
+
+// Rows handed to a single job; keeps per-job overhead small for 1K images
+constexpr size_t kRowsPerJob = 16;
+
+void SetError(std::string* error, const std::string& message) {
+    if (error) {
+        *error = message;
+    }
+}
+
+// Read one '\n' terminated header line starting at offset; advances offset
+bool ReadHeaderLine(const uint8_t* data, size_t size, size_t& offset, std::string& line) {
+    if (offset >= size) {
+        return false;
+    }
+    
+    const uint8_t* start = data + offset;
+    const void* newline = std::memchr(start, '\n', size - offset);
+    size_t length = newline ? static_cast<const uint8_t*>(newline) - start : size - offset;
+    
+    line.assign(reinterpret_cast<const char*>(start), length);
+    if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+    }
+    
+    offset += length + (newline ? 1 : 0);
+    return true;
+}
+
+bool IsRLEScanline(const uint8_t* data, size_t size, size_t offset, int width) {
+    if (width < 8 || width > 0x7FFF || offset + 4 > size) {
+        return false;
+    }
+    
+    const uint8_t* p = data + offset;
+    return p[0] == 2 && p[1] == 2 && (p[2] & 0x80) == 0;
+}
+
+// Walk a scanline without decoding it and return the offset of the next one.
+// This is the only sequential part of Radiance decoding.
+bool SkipScanline(const uint8_t* data, size_t size, size_t& offset, int width) {
+    if (!IsRLEScanline(data, size, offset, width)) {
+        size_t flatSize = static_cast<size_t>(width) * 4;
+        if (offset + flatSize > size) {
+            return false;
+        }
+        offset += flatSize;
+        return true;
+    }
+    
+    if (((data[offset + 2] << 8) | data[offset + 3]) != width) {
+        return false;
+    }
+    
+    size_t pos = offset + 4;
+    for (int channel = 0; channel < 4; ++channel) {
+        int pixelCount = 0;
+        while (pixelCount < width) {
+            if (pos >= size) {
+                return false;
+            }
+            
+            uint8_t count = data[pos++];
+            if (count > 128) {
+                pixelCount += count - 128;
+                pos += 1;
+            } else {
+                if (count == 0) {
+                    return false;
+                }
+                pixelCount += count;
+                pos += count;
+            }
+        }
+        
+        if (pixelCount != width) {
+            return false;
+        }
+    }
+    
+    if (pos > size) {
+        return false;
+    }
+    
+    offset = pos;
+    return true;
+}
+
+// Expand one scanline into interleaved RGBE. Bounds were validated by SkipScanline.
+void DecodeScanline(const uint8_t* data, size_t offset, int width, bool isRLE, uint8_t* outRGBE) {
+    if (!isRLE) {
+        std::memcpy(outRGBE, data + offset, static_cast<size_t>(width) * 4);
+        return;
+    }
+    
+    const uint8_t* p = data + offset + 4;
+    for (int channel = 0; channel < 4; ++channel) {
+        uint8_t* dst = outRGBE + channel;
+        int pixelCount = 0;
+        
+        while (pixelCount < width) {
+            uint8_t count = *p++;
+            if (count > 128) {
+                int run = count - 128;
+                uint8_t value = *p++;
+                for (int i = 0; i < run; ++i) {
+                    dst[(pixelCount + i) * 4] = value;
+                }
+                pixelCount += run;
+            } else {
+                for (int i = 0; i < count; ++i) {
+                    dst[(pixelCount + i) * 4] = p[i];
+                }
+                p += count;
+                pixelCount += count;
+            }
+        }
+    }
+}
+
+inline void RGBEToFloatScalar(const uint8_t* rgbe, float* rgb) {
+    if (rgbe[3] == 0) {
+        rgb[0] = rgb[1] = rgb[2] = 0.0f;
+        return;
+    }
+    
+    float scale = std::ldexp(1.0f, static_cast<int>(rgbe[3]) - (128 + 8));
+    rgb[0] = (rgbe[0] + 0.5f) * scale;
+    rgb[1] = (rgbe[1] + 0.5f) * scale;
+    rgb[2] = (rgbe[2] + 0.5f) * scale;
+}
+
+inline uint16_t FloatToHalfScalar(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t absBits = bits & 0x7FFFFFFFu;
+    
+    if (absBits >= 0x7F800000u) {
+        // Inf or NaN (keep NaN quiet)
+        return static_cast<uint16_t>(sign | 0x7C00u | (absBits > 0x7F800000u ? 0x200u : 0u));
+    }
+    if (absBits >= 0x47800000u) {
+        // Too large for half
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+    if (absBits < 0x38800000u) {
+        // Subnormal half: let the FPU do the rounding
+        float absValue;
+        std::memcpy(&absValue, &absBits, sizeof(absValue));
+        float magic = absValue + 0.5f;
+        uint32_t magicBits;
+        std::memcpy(&magicBits, &magic, sizeof(magicBits));
+        return static_cast<uint16_t>(sign | (magicBits - 0x3F000000u));
+    }
+    
+    // Normal half, round to nearest even
+    uint32_t mantissaOdd = (absBits >> 13) & 1u;
+    absBits += 0xC8000FFFu + mantissaOdd; // rebias exponent (-112 << 23) and round
+    return static_cast<uint16_t>(sign | (absBits >> 13));
+}
+
+} // namespace
+
+bool HDRDecoder::Load(const std::string& filepath, HDRImage& outImage) {
+    LGE_PROFILE_SCOPE("HDRDecoder::Load");
+    std::string ext = filepath.substr(filepath.find_last_of(".") + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    
+    if (ext == "exr") {
+        return LoadEXR(filepath, outImage);
+    } else if (ext == "hdr") {
+        return LoadRadiance(filepath, outImage);
+    }
+    
+    Log::Error("Unsupported HDR format: " + filepath + " (expected .hdr or .exr)");
+    return false;
+}
+
+bool HDRDecoder::LoadRadiance(const std::string& filepath, HDRImage& outImage) {
+    FileView file = MappedFile::Open(filepath, FileAccessHint::Sequential);
+    if (!file.IsValid() || file.Empty()) {
+        Log::Error("Failed to open HDR file: " + filepath);
+        return false;
+    }
+    
+    std::string error;
+    if (!DecodeRadiance(file.GetData(), file.GetSize(), outImage, &error)) {
+        Log::Error("Failed to decode HDR file: " + filepath + " - " + error);
+        return false;
+    }
+    
+    return true;
+}
+
+bool HDRDecoder::DecodeRadiance(const uint8_t* data, size_t size, HDRImage& outImage, std::string* error) {
+    size_t offset = 0;
+    std::string line;
+    
+    if (!ReadHeaderLine(data, size, offset, line) || (line != "#?RADIANCE" && line != "#?RGBE")) {
+        SetError(error, "Invalid HDR file format");
+        return false;
+    }
+    
+    // Header variables end with an empty line; the resolution string follows
+    while (ReadHeaderLine(data, size, offset, line)) {
+        if (line.empty()) {
+            break;
+        }
+        if (line.rfind("FORMAT=", 0) == 0) {
+            if (line != "FORMAT=32-bit_rle_rgbe") {
+                SetError(error, "Unsupported pixel format: " + line.substr(7));
+                return false;
+            }
+        }
+    }
+    
+    if (!ReadHeaderLine(data, size, offset, line)) {
+        SetError(error, "Missing resolution string");
+        return false;
+    }
+    
+    // "-Y height +X width" (rows are stored in file order)
+    int width = 0;
+    int height = 0;
+    {
+        std::istringstream iss(line);
+        std::string token;
+        while (iss >> token) {
+            if (token == "+X" || token == "-X" || token == "X") {
+                iss >> width;
+            } else if (token == "-Y" || token == "+Y" || token == "Y") {
+                iss >> height;
+            }
+        }
+    }
+    
+    if (width <= 0 || height <= 0) {
+        SetError(error, "Failed to parse HDR resolution");
+        return false;
+    }
+    
+    // Pass 1: locate every scanline (cheap pointer walk, no writes)
+    std::vector<size_t> scanlineOffsets(static_cast<size_t>(height));
+    for (int y = 0; y < height; ++y) {
+        scanlineOffsets[y] = offset;
+        if (!SkipScanline(data, size, offset, width)) {
+            SetError(error, "Failed to read HDR scanline " + std::to_string(y) + " of " + std::to_string(height));
+            return false;
+        }
+    }
+    
+    // Pass 2: decode and convert rows in parallel
+    outImage.width = width;
+    outImage.height = height;
+    outImage.pixels.resize(static_cast<size_t>(width) * height * 3);
+    float* pixels = outImage.pixels.data();
+    
+    JobSystem::ParallelFor(static_cast<size_t>(height), kRowsPerJob, [&](size_t begin, size_t end) {
+        std::vector<uint8_t> rgbe(static_cast<size_t>(width) * 4);
+        for (size_t y = begin; y < end; ++y) {
+            bool isRLE = IsRLEScanline(data, size, scanlineOffsets[y], width);
+            DecodeScanline(data, scanlineOffsets[y], width, isRLE, rgbe.data());
+            RGBEToFloat(rgbe.data(), pixels + y * width * 3, static_cast<size_t>(width));
+        }
+    });
+    
+    return true;
+}
+
+bool HDRDecoder::LoadEXR(const std::string& filepath, HDRImage& outImage) {
+    FileView file = MappedFile::Open(filepath, FileAccessHint::Sequential);
+    if (!file.IsValid() || file.Empty()) {
+        Log::Error("Failed to open EXR file: " + filepath);
+        return false;
+    }
+    
+    std::string error;
+    if (!DecodeEXR(file.GetData(), file.GetSize(), outImage, &error)) {
+        Log::Error("Failed to load EXR file: " + filepath + " - " + error);
+        return false;
+    }
+    
+    return true;
+}
+
+bool HDRDecoder::DecodeEXR(const uint8_t* data, size_t size, HDRImage& outImage, std::string* error) {
+    float* rgba = nullptr; // width * height * RGBA
+    int width = 0;
+    int height = 0;
+    const char* err = nullptr;
+    
+    int ret = ::LoadEXRFromMemory(&rgba, &width, &height, data, size, &err);
+    if (ret != TINYEXR_SUCCESS || !rgba) {
+        SetError(error, err ? std::string(err) : "tinyexr error " + std::to_string(ret));
+        if (err) {
+            ::FreeEXRErrorMessage(err);
+        }
+        if (rgba) {
+            free(rgba);
+        }
+        return false;
+    }
+    
+    outImage.width = width;
+    outImage.height = height;
+    outImage.pixels.resize(static_cast<size_t>(width) * height * 3);
+    float* pixels = outImage.pixels.data();
+    
+    // Drop the alpha channel
+    JobSystem::ParallelFor(static_cast<size_t>(height), kRowsPerJob * 4, [&](size_t begin, size_t end) {
+        for (size_t i = begin * width; i < end * width; ++i) {
+            pixels[i * 3] = rgba[i * 4];
+            pixels[i * 3 + 1] = rgba[i * 4 + 1];
+            pixels[i * 3 + 2] = rgba[i * 4 + 2];
+        }
+    });
+    
+    free(rgba);
+    return true;
+}
+
+void HDRDecoder::RGBEToFloat(const uint8_t* rgbe, float* rgb, size_t pixelCount) {
+    size_t i = 0;
+    
+#if LGE_HDR_SSE2
+    // Four pixels per iteration. Each pixel is stored as a 4-wide vector whose
+    // last lane spills into the next pixel's red channel and is overwritten by
+    // the following store, so one extra pixel must remain for the scalar tail.
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i expBias = _mm_set1_epi32(128 + 8 - 127);
+    const __m128 half = _mm_set1_ps(0.5f);
+    
+    for (; i + 5 <= pixelCount; i += 4) {
+        __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgbe + i * 4));
+        
+        // scale = 2^(e - 136) built directly in the exponent field; e < 10 flushes to 0
+        __m128i exponent = _mm_sub_epi32(_mm_srli_epi32(packed, 24), expBias);
+        exponent = _mm_and_si128(exponent, _mm_cmpgt_epi32(exponent, zero));
+        __m128 scale = _mm_castsi128_ps(_mm_slli_epi32(exponent, 23));
+        
+        __m128i lo = _mm_unpacklo_epi8(packed, zero);
+        __m128i hi = _mm_unpackhi_epi8(packed, zero);
+        __m128 p0 = _mm_add_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), half);
+        __m128 p1 = _mm_add_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), half);
+        __m128 p2 = _mm_add_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), half);
+        __m128 p3 = _mm_add_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), half);
+        
+        float* out = rgb + i * 3;
+        _mm_storeu_ps(out + 0, _mm_mul_ps(p0, _mm_shuffle_ps(scale, scale, _MM_SHUFFLE(0, 0, 0, 0))));
+        _mm_storeu_ps(out + 3, _mm_mul_ps(p1, _mm_shuffle_ps(scale, scale, _MM_SHUFFLE(1, 1, 1, 1))));
+        _mm_storeu_ps(out + 6, _mm_mul_ps(p2, _mm_shuffle_ps(scale, scale, _MM_SHUFFLE(2, 2, 2, 2))));
+        _mm_storeu_ps(out + 9, _mm_mul_ps(p3, _mm_shuffle_ps(scale, scale, _MM_SHUFFLE(3, 3, 3, 3))));
+    }
+#endif
+    
+    for (; i < pixelCount; ++i) {
+        RGBEToFloatScalar(rgbe + i * 4, rgb + i * 3);
+    }
+}
+
+void HDRDecoder::FloatToHalf(const float* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+    
+#if LGE_HDR_SSE2
+    // Branch-free float -> half with round-to-nearest-even (F16C is not baseline)
+    const __m128i signMask = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    const __m128i halfMaxAsFloat = _mm_set1_epi32((127 + 16) << 23);
+    const __m128i nanBit = _mm_set1_epi32(0x200);
+    const __m128i infAsHalf = _mm_set1_epi32(0x7C00);
+    const __m128i minNormal = _mm_set1_epi32((127 - 14) << 23);
+    const __m128i subnormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+    const __m128i normalBias = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+    
+    for (; i + 8 <= count; i += 8) {
+        __m128i packed[2];
+        for (int k = 0; k < 2; ++k) {
+            __m128 value = _mm_loadu_ps(src + i + k * 4);
+            __m128 sign = _mm_and_ps(value, _mm_castsi128_ps(signMask));
+            __m128 absValue = _mm_xor_ps(value, sign);
+            __m128i absBits = _mm_castps_si128(absValue);
+            
+            __m128i isNaN = _mm_castps_si128(_mm_cmpunord_ps(absValue, absValue));
+            __m128i isRegular = _mm_cmpgt_epi32(halfMaxAsFloat, absBits);
+            __m128i infOrNaN = _mm_or_si128(_mm_and_si128(isNaN, nanBit), infAsHalf);
+            __m128i isSubnormal = _mm_cmpgt_epi32(minNormal, absBits);
+            
+            __m128 subnormalFloat = _mm_add_ps(absValue, _mm_castsi128_ps(subnormalMagic));
+            __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(subnormalFloat), subnormalMagic);
+            
+            __m128i mantissaOdd = _mm_srai_epi32(_mm_slli_epi32(absBits, 31 - 13), 31);
+            __m128i rounded = _mm_sub_epi32(_mm_add_epi32(absBits, normalBias), mantissaOdd);
+            __m128i normal = _mm_srli_epi32(rounded, 13);
+            
+            __m128i finite = _mm_or_si128(_mm_and_si128(isSubnormal, subnormal), _mm_andnot_si128(isSubnormal, normal));
+            __m128i joined = _mm_or_si128(_mm_and_si128(isRegular, finite), _mm_andnot_si128(isRegular, infOrNaN));
+            __m128i result = _mm_or_si128(joined, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+            
+            // Sign-extend the low 16 bits so the signed saturating pack keeps them intact
+            packed[k] = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+        }
+        
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(packed[0], packed[1]));
+    }
+#endif
+    
+    for (; i < count; ++i) {
+        dst[i] = FloatToHalfScalar(src[i]);
+    }
+}
+
+} // namespace LGE
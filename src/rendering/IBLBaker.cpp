@@ -0,0 +1,615 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/IBLBaker.h"
+#include "LGE/rendering/HDRDecoder.h"
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/Hash.h"
+#include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LGE_IBL_SSE2 1
+#include <emmintrin.h>
+#else
+#define LGE_IBL_SSE2 0
+#endif
+
+namespace LGE {
+
+namespace {
+
+constexpr float kPi = 3.14159265358979f;
+constexpr uint32_t kCacheMagic = 0x4C42494C; // "LIBL"
+constexpr uint32_t kCacheVersion = 1;
+constexpr size_t kSHRowsPerJob = 8;
+constexpr size_t kCubeRowsPerJob = 4;
+
+struct Vec3 {
+    float x, y, z;
+};
+
+inline Vec3 Normalize(const Vec3& v) {
+    float len = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+    return len > 0.0f ? Vec3{v.x / len, v.y / len, v.z / len} : Vec3{0.0f, 1.0f, 0.0f};
+}
+
+inline Vec3 Cross(const Vec3& a, const Vec3& b) {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+// Real SH basis, bands 0-2. Must match EvaluateSH9 in Basic.frag.
+inline void EvaluateSHBasis(float x, float y, float z, float basis[9]) {
+    basis[0] = 0.282095f;
+    basis[1] = 0.488603f * y;
+    basis[2] = 0.488603f * z;
+    basis[3] = 0.488603f * x;
+    basis[4] = 1.092548f * x * y;
+    basis[5] = 1.092548f * y * z;
+    basis[6] = 0.315392f * (3.0f * z * z - 1.0f);
+    basis[7] = 1.092548f * x * z;
+    basis[8] = 0.546274f * (x * x - y * y);
+}
+
+// Clamped cosine lobe convolution per band (Ramamoorthi & Hanrahan)
+constexpr float kCosineLobe[9] = {
+    kPi,
+    2.0f * kPi / 3.0f, 2.0f * kPi / 3.0f, 2.0f * kPi / 3.0f,
+    kPi / 4.0f, kPi / 4.0f, kPi / 4.0f, kPi / 4.0f, kPi / 4.0f
+};
+
+// Same mapping as Skybox.frag: u = atan(z, x) / 2PI + 0.5, v = acos(y) / PI
+inline void DirectionToUV(const Vec3& dir, float& u, float& v) {
+    u = std::atan2(dir.z, dir.x) / (2.0f * kPi) + 0.5f;
+    v = std::acos(std::max(-1.0f, std::min(1.0f, dir.y))) / kPi;
+}
+
+// OpenGL cube face orientation, s/t in [-1, 1]
+inline Vec3 CubeTexelDirection(uint32_t face, float s, float t) {
+    switch (face) {
+        case 0: return Normalize({ 1.0f, -t, -s});
+        case 1: return Normalize({-1.0f, -t,  s});
+        case 2: return Normalize({ s,  1.0f,  t});
+        case 3: return Normalize({ s, -1.0f, -t});
+        case 4: return Normalize({ s, -t,  1.0f});
+        default: return Normalize({-s, -t, -1.0f});
+    }
+}
+
+struct EquirectLevel {
+    int width = 0;
+    int height = 0;
+    std::vector<float> storage;
+    const float* pixels = nullptr;
+};
+
+// Box-filtered mip pyramid of the source, used to pick a source footprint
+// that matches each sample's solid angle
+std::vector<EquirectLevel> BuildPyramid(const HDRImage& image) {
+    std::vector<EquirectLevel> levels(1);
+    levels[0].width = image.width;
+    levels[0].height = image.height;
+    levels[0].pixels = image.pixels.data();
+    
+    while (levels.back().width > 8 && levels.back().height > 4) {
+        const EquirectLevel& src = levels.back();
+        EquirectLevel dst;
+        dst.width = std::max(1, src.width / 2);
+        dst.height = std::max(1, src.height / 2);
+        dst.storage.resize(static_cast<size_t>(dst.width) * dst.height * 3);
+        
+        const float* srcPixels = src.pixels;
+        float* dstPixels = dst.storage.data();
+        int srcWidth = src.width;
+        int srcHeight = src.height;
+        int dstWidth = dst.width;
+        
+        JobSystem::ParallelFor(static_cast<size_t>(dst.height), 16, [&](size_t begin, size_t end) {
+            for (size_t y = begin; y < end; ++y) {
+                int y0 = std::min(static_cast<int>(y) * 2, srcHeight - 1);
+                int y1 = std::min(y0 + 1, srcHeight - 1);
+                for (int x = 0; x < dstWidth; ++x) {
+                    int x0 = std::min(x * 2, srcWidth - 1);
+                    int x1 = std::min(x0 + 1, srcWidth - 1);
+                    for (int c = 0; c < 3; ++c) {
+                        float sum = srcPixels[(static_cast<size_t>(y0) * srcWidth + x0) * 3 + c]
+                                  + srcPixels[(static_cast<size_t>(y0) * srcWidth + x1) * 3 + c]
+                                  + srcPixels[(static_cast<size_t>(y1) * srcWidth + x0) * 3 + c]
+                                  + srcPixels[(static_cast<size_t>(y1) * srcWidth + x1) * 3 + c];
+                        dstPixels[(y * dstWidth + x) * 3 + c] = sum * 0.25f;
+                    }
+                }
+            }
+        });
+        
+        levels.push_back(std::move(dst));
+        levels.back().pixels = levels.back().storage.data();
+    }
+    
+    return levels;
+}
+
+// Bilinear fetch, wrapping horizontally and clamping at the poles
+inline Vec3 SampleLevel(const EquirectLevel& level, float u, float v) {
+    float fx = u * level.width - 0.5f;
+    float fy = v * level.height - 0.5f;
+    int x0 = static_cast<int>(std::floor(fx));
+    int y0 = static_cast<int>(std::floor(fy));
+    float tx = fx - x0;
+    float ty = fy - y0;
+    
+    int x1 = x0 + 1;
+    x0 = ((x0 % level.width) + level.width) % level.width;
+    x1 = ((x1 % level.width) + level.width) % level.width;
+    int y1 = std::min(std::max(y0 + 1, 0), level.height - 1);
+    y0 = std::min(std::max(y0, 0), level.height - 1);
+    
+    const float* p00 = level.pixels + (static_cast<size_t>(y0) * level.width + x0) * 3;
+    const float* p10 = level.pixels + (static_cast<size_t>(y0) * level.width + x1) * 3;
+    const float* p01 = level.pixels + (static_cast<size_t>(y1) * level.width + x0) * 3;
+    const float* p11 = level.pixels + (static_cast<size_t>(y1) * level.width + x1) * 3;
+    
+    float w00 = (1.0f - tx) * (1.0f - ty);
+    float w10 = tx * (1.0f - ty);
+    float w01 = (1.0f - tx) * ty;
+    float w11 = tx * ty;
+    
+    return {
+        p00[0] * w00 + p10[0] * w10 + p01[0] * w01 + p11[0] * w11,
+        p00[1] * w00 + p10[1] * w10 + p01[1] * w01 + p11[1] * w11,
+        p00[2] * w00 + p10[2] * w10 + p01[2] * w01 + p11[2] * w11
+    };
+}
+
+inline Vec3 SamplePyramid(const std::vector<EquirectLevel>& levels, const Vec3& dir, float lod) {
+    float u, v;
+    DirectionToUV(dir, u, v);
+    
+    lod = std::max(0.0f, std::min(lod, static_cast<float>(levels.size() - 1)));
+    size_t lo = static_cast<size_t>(lod);
+    size_t hi = std::min(lo + 1, levels.size() - 1);
+    float t = lod - static_cast<float>(lo);
+    
+    Vec3 a = SampleLevel(levels[lo], u, v);
+    if (t <= 0.0f || hi == lo) {
+        return a;
+    }
+    Vec3 b = SampleLevel(levels[hi], u, v);
+    return {a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t};
+}
+
+inline float RadicalInverse(uint32_t bits) {
+    bits = (bits << 16u) | (bits >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+    return static_cast<float>(bits) * 2.3283064365386963e-10f;
+}
+
+// Light direction in tangent space (N = +Z) with its cosine weight and source LOD
+struct PrefilterSample {
+    Vec3 direction;
+    float weight;
+    float lod;
+};
+
+// Under the N = V = R assumption the sample set is identical for every texel
+// of a mip, so directions, weights and LODs are computed once per mip.
+std::vector<PrefilterSample> BuildPrefilterSamples(float roughness, uint32_t sampleCount, float sourceTexelSolidAngle) {
+    std::vector<PrefilterSample> samples;
+    samples.reserve(sampleCount);
+    
+    float a = roughness * roughness;
+    float a2 = a * a;
+    
+    for (uint32_t i = 0; i < sampleCount; ++i) {
+        float xi1 = (static_cast<float>(i) + 0.5f) / static_cast<float>(sampleCount);
+        float xi2 = RadicalInverse(i);
+        
+        float phi = 2.0f * kPi * xi1;
+        float cosTheta = std::sqrt((1.0f - xi2) / (1.0f + (a2 - 1.0f) * xi2));
+        float sinTheta = std::sqrt(std::max(0.0f, 1.0f - cosTheta * cosTheta));
+        Vec3 h = {sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta};
+        
+        // Reflect V = N = (0, 0, 1) about H
+        Vec3 l = {2.0f * h.z * h.x, 2.0f * h.z * h.y, 2.0f * h.z * h.z - 1.0f};
+        if (l.z <= 0.0f) {
+            continue;
+        }
+        
+        float nDotH = h.z;
+        float d = nDotH * nDotH * (a2 - 1.0f) + 1.0f;
+        float ggx = a2 / (kPi * d * d);
+        float pdf = ggx * 0.25f; // D * NdotH / (4 * VdotH) with VdotH = NdotH
+        float sampleSolidAngle = 1.0f / (static_cast<float>(sampleCount) * pdf + 1e-6f);
+        float lod = 0.5f * std::log2(sampleSolidAngle / sourceTexelSolidAngle) + 1.0f;
+        
+        samples.push_back({l, l.z, lod});
+    }
+    
+    return samples;
+}
+
+} // namespace
+
+uint32_t IBLBakeResult::GetMipResolution(uint32_t mip) const {
+    return std::max(1u, settings.specularResolution >> mip);
+}
+
+void IBLBaker::ProjectIrradianceSH(const HDRImage& equirect, std::array<Math::Vector3, 9>& outSH) {
+    for (auto& coefficient : outSH) {
+        coefficient = Math::Vector3(0.0f);
+    }
+    if (!equirect.IsValid()) {
+        return;
+    }
+    
+    const int width = equirect.width;
+    const int height = equirect.height;
+    const float* pixels = equirect.pixels.data();
+    const size_t lastPixel = equirect.GetPixelCount() - 1;
+    
+    // Per-column azimuth terms are shared by every row
+    std::vector<float> cosPhi(width);
+    std::vector<float> sinPhi(width);
+    for (int x = 0; x < width; ++x) {
+        float phi = ((x + 0.5f) / width - 0.5f) * 2.0f * kPi;
+        cosPhi[x] = std::cos(phi);
+        sinPhi[x] = std::sin(phi);
+    }
+    
+    // One partial sum (9 coefficients x RGBW) per chunk, summed in order for determinism
+    size_t chunkCount = (static_cast<size_t>(height) + kSHRowsPerJob - 1) / kSHRowsPerJob;
+    std::vector<float> partials(chunkCount * 9 * 4, 0.0f);
+    
+    JobSystem::ParallelFor(static_cast<size_t>(height), kSHRowsPerJob, [&](size_t begin, size_t end) {
+        float* partial = partials.data() + (begin / kSHRowsPerJob) * 9 * 4;
+        const float dPhiDTheta = (2.0f * kPi / width) * (kPi / height);
+        
+#if LGE_IBL_SSE2
+        // Lanes hold R, G, B and the solid-angle weight of one pixel
+        __m128 acc[9];
+        for (int k = 0; k < 9; ++k) {
+            acc[k] = _mm_setzero_ps();
+        }
+#endif
+        
+        for (size_t y = begin; y < end; ++y) {
+            float theta = (y + 0.5f) / height * kPi;
+            float sinTheta = std::sin(theta);
+            float cosTheta = std::cos(theta);
+            float rowWeight = dPhiDTheta * sinTheta;
+            
+            for (int x = 0; x < width; ++x) {
+                size_t index = y * width + x;
+                float basis[9];
+                EvaluateSHBasis(sinTheta * cosPhi[x], cosTheta, sinTheta * sinPhi[x], basis);
+                const float* p = pixels + index * 3;
+                
+#if LGE_IBL_SSE2
+                // The 4th float belongs to the next pixel and is replaced by the weight;
+                // the final pixel has no successor so it is loaded lane by lane
+                __m128 color = index < lastPixel ? _mm_loadu_ps(p) : _mm_set_ps(0.0f, p[2], p[1], p[0]);
+                const __m128 rgbMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+                color = _mm_or_ps(_mm_and_ps(color, rgbMask), _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+                color = _mm_mul_ps(color, _mm_set1_ps(rowWeight));
+                for (int k = 0; k < 9; ++k) {
+                    acc[k] = _mm_add_ps(acc[k], _mm_mul_ps(color, _mm_set1_ps(basis[k])));
+                }
+#else
+                for (int k = 0; k < 9; ++k) {
+                    float w = basis[k] * rowWeight;
+                    partial[k * 4 + 0] += p[0] * w;
+                    partial[k * 4 + 1] += p[1] * w;
+                    partial[k * 4 + 2] += p[2] * w;
+                    partial[k * 4 + 3] += w;
+                }
+#endif
+            }
+        }
+        
+#if LGE_IBL_SSE2
+        for (int k = 0; k < 9; ++k) {
+            _mm_storeu_ps(partial + k * 4, acc[k]);
+        }
+#endif
+    });
+    (void)lastPixel;
+    
+    double sums[9][4] = {};
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        for (int k = 0; k < 9; ++k) {
+            for (int c = 0; c < 4; ++c) {
+                sums[k][c] += partials[(chunk * 9 + k) * 4 + c];
+            }
+        }
+    }
+    
+    // sums[0][3] integrates Y00 over the sphere; rescale so discretization
+    // error in the total solid angle does not bias the result
+    double expected = 0.282095 * 4.0 * kPi;
+    double normalization = sums[0][3] > 0.0 ? expected / sums[0][3] : 1.0;
+    
+    for (int k = 0; k < 9; ++k) {
+        float scale = static_cast<float>(normalization) * kCosineLobe[k];
+        outSH[k] = Math::Vector3(static_cast<float>(sums[k][0]) * scale,
+                                 static_cast<float>(sums[k][1]) * scale,
+                                 static_cast<float>(sums[k][2]) * scale);
+    }
+}
+
+Math::Vector3 IBLBaker::EvaluateIrradianceSH(const std::array<Math::Vector3, 9>& sh, const Math::Vector3& normal) {
+    float basis[9];
+    EvaluateSHBasis(normal.x, normal.y, normal.z, basis);
+    
+    Math::Vector3 result(0.0f);
+    for (int k = 0; k < 9; ++k) {
+        result = result + sh[k] * basis[k];
+    }
+    return Math::Vector3(std::max(result.x, 0.0f), std::max(result.y, 0.0f), std::max(result.z, 0.0f));
+}
+
+void IBLBaker::PrefilterSpecular(const HDRImage& equirect, const IBLBakeSettings& settings, std::vector<std::vector<float>>& outMips) {
+    outMips.clear();
+    if (!equirect.IsValid() || settings.specularResolution == 0) {
+        return;
+    }
+    
+    std::vector<EquirectLevel> pyramid = BuildPyramid(equirect);
+    const float sourceTexelSolidAngle = 4.0f * kPi / (static_cast<float>(equirect.width) * equirect.height);
+    
+    uint32_t maxMips = static_cast<uint32_t>(std::floor(std::log2(static_cast<float>(settings.specularResolution)))) + 1;
+    uint32_t mipCount = std::max(1u, std::min(settings.specularMipCount, maxMips));
+    outMips.resize(mipCount);
+    
+    for (uint32_t mip = 0; mip < mipCount; ++mip) {
+        const uint32_t resolution = std::max(1u, settings.specularResolution >> mip);
+        const float roughness = mipCount > 1 ? static_cast<float>(mip) / (mipCount - 1) : 0.0f;
+        
+        std::vector<float>& faces = outMips[mip];
+        faces.resize(static_cast<size_t>(resolution) * resolution * 3 * 6);
+        
+        // Mirror mip: a single fetch whose footprint matches the cube texel
+        const float cubeTexelSolidAngle = 4.0f * kPi / (6.0f * resolution * resolution);
+        const float mirrorLod = std::max(0.0f, 0.5f * std::log2(cubeTexelSolidAngle / sourceTexelSolidAngle));
+        const std::vector<PrefilterSample> samples = mip == 0
+            ? std::vector<PrefilterSample>()
+            : BuildPrefilterSamples(roughness, std::max(1u, settings.sampleCount), sourceTexelSolidAngle);
+        
+        JobSystem::ParallelFor(static_cast<size_t>(resolution) * 6, kCubeRowsPerJob, [&](size_t begin, size_t end) {
+            for (size_t row = begin; row < end; ++row) {
+                uint32_t face = static_cast<uint32_t>(row / resolution);
+                uint32_t y = static_cast<uint32_t>(row % resolution);
+                float t = 2.0f * (y + 0.5f) / resolution - 1.0f;
+                float* out = faces.data() + row * resolution * 3;
+                
+                for (uint32_t x = 0; x < resolution; ++x) {
+                    float s = 2.0f * (x + 0.5f) / resolution - 1.0f;
+                    Vec3 n = CubeTexelDirection(face, s, t);
+                    
+                    Vec3 color = {0.0f, 0.0f, 0.0f};
+                    if (samples.empty()) {
+                        color = SamplePyramid(pyramid, n, mirrorLod);
+                    } else {
+                        Vec3 up = std::fabs(n.y) < 0.999f ? Vec3{0.0f, 1.0f, 0.0f} : Vec3{1.0f, 0.0f, 0.0f};
+                        Vec3 tangent = Normalize(Cross(up, n));
+                        Vec3 bitangent = Cross(n, tangent);
+                        
+                        float totalWeight = 0.0f;
+                        for (const PrefilterSample& sample : samples) {
+                            const Vec3& l = sample.direction;
+                            Vec3 dir = {
+                                tangent.x * l.x + bitangent.x * l.y + n.x * l.z,
+                                tangent.y * l.x + bitangent.y * l.y + n.y * l.z,
+                                tangent.z * l.x + bitangent.z * l.y + n.z * l.z
+                            };
+                            Vec3 c = SamplePyramid(pyramid, dir, sample.lod);
+                            color.x += c.x * sample.weight;
+                            color.y += c.y * sample.weight;
+                            color.z += c.z * sample.weight;
+                            totalWeight += sample.weight;
+                        }
+                        
+                        if (totalWeight > 0.0f) {
+                            color = {color.x / totalWeight, color.y / totalWeight, color.z / totalWeight};
+                        }
+                    }
+                    
+                    out[x * 3 + 0] = color.x;
+                    out[x * 3 + 1] = color.y;
+                    out[x * 3 + 2] = color.z;
+                }
+            }
+        });
+    }
+}
+
+bool IBLBaker::Bake(const HDRImage& equirect, const IBLBakeSettings& settings, IBLBakeResult& outResult) {
+    if (!equirect.IsValid()) {
+        Log::Error("IBLBaker: cannot bake an empty HDR image");
+        return false;
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    outResult.settings = settings;
+    ProjectIrradianceSH(equirect, outResult.irradianceSH);
+    PrefilterSpecular(equirect, settings, outResult.specularMips);
+    outResult.settings.specularMipCount = static_cast<uint32_t>(outResult.specularMips.size());
+    
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    Log::Info("IBLBaker: baked " + std::to_string(equirect.width) + "x" + std::to_string(equirect.height) +
+              " HDRI in " + std::to_string(static_cast<int>(elapsed)) + " ms");
+    return outResult.IsValid();
+}
+
+std::string IBLBaker::GetCacheFilePath(const std::string& cacheDirectory, uint64_t sourceHash, const IBLBakeSettings& settings) {
+    std::string fileName = Hash::ToHex(sourceHash) + "_" +
+                           std::to_string(settings.specularResolution) + "_" +
+                           std::to_string(settings.specularMipCount) + "_" +
+                           std::to_string(settings.sampleCount) + ".libl";
+    return (std::filesystem::path(cacheDirectory) / fileName).string();
+}
+
+bool IBLBaker::SaveToCache(const std::string& cacheFile, const IBLBakeResult& result) {
+    if (!result.IsValid()) {
+        return false;
+    }
+    
+    try {
+        std::filesystem::path path(cacheFile);
+        if (path.has_parent_path()) {
+            std::filesystem::create_directories(path.parent_path());
+        }
+        
+        // Write to a temporary file first so a crash never leaves a truncated cache entry
+        std::filesystem::path tempPath = path;
+        tempPath += ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                Log::Error("IBLBaker: failed to write cache file: " + cacheFile);
+                return false;
+            }
+            
+            uint32_t mipCount = static_cast<uint32_t>(result.specularMips.size());
+            file.write(reinterpret_cast<const char*>(&kCacheMagic), sizeof(kCacheMagic));
+            file.write(reinterpret_cast<const char*>(&kCacheVersion), sizeof(kCacheVersion));
+            file.write(reinterpret_cast<const char*>(&result.sourceHash), sizeof(result.sourceHash));
+            file.write(reinterpret_cast<const char*>(&result.settings.specularResolution), sizeof(uint32_t));
+            file.write(reinterpret_cast<const char*>(&mipCount), sizeof(uint32_t));
+            file.write(reinterpret_cast<const char*>(&result.settings.sampleCount), sizeof(uint32_t));
+            
+            for (const auto& coefficient : result.irradianceSH) {
+                float rgb[3] = {coefficient.x, coefficient.y, coefficient.z};
+                file.write(reinterpret_cast<const char*>(rgb), sizeof(rgb));
+            }
+            
+            for (const auto& mip : result.specularMips) {
+                file.write(reinterpret_cast<const char*>(mip.data()), static_cast<std::streamsize>(mip.size() * sizeof(float)));
+            }
+            
+            if (!file.good()) {
+                Log::Error("IBLBaker: failed to write cache file: " + cacheFile);
+                return false;
+            }
+        }
+        
+        std::filesystem::rename(tempPath, path);
+        return true;
+    } catch (const std::exception& e) {
+        Log::Error("IBLBaker: failed to save cache: " + std::string(e.what()));
+        return false;
+    }
+}
+
+bool IBLBaker::LoadFromCache(const std::string& cacheFile, IBLBakeResult& outResult) {
+    std::ifstream file(cacheFile, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint32_t mipCount = 0;
+    IBLBakeResult result;
+    
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&result.sourceHash), sizeof(result.sourceHash));
+    file.read(reinterpret_cast<char*>(&result.settings.specularResolution), sizeof(uint32_t));
+    file.read(reinterpret_cast<char*>(&mipCount), sizeof(uint32_t));
+    file.read(reinterpret_cast<char*>(&result.settings.sampleCount), sizeof(uint32_t));
+    
+    if (!file || magic != kCacheMagic || version != kCacheVersion ||
+        result.settings.specularResolution == 0 || mipCount == 0 || mipCount > 16) {
+        Log::Warn("IBLBaker: ignoring invalid cache file: " + cacheFile);
+        return false;
+    }
+    result.settings.specularMipCount = mipCount;
+    
+    for (auto& coefficient : result.irradianceSH) {
+        float rgb[3] = {};
+        file.read(reinterpret_cast<char*>(rgb), sizeof(rgb));
+        coefficient = Math::Vector3(rgb[0], rgb[1], rgb[2]);
+    }
+    
+    result.specularMips.resize(mipCount);
+    for (uint32_t mip = 0; mip < mipCount; ++mip) {
+        uint32_t resolution = result.GetMipResolution(mip);
+        auto& data = result.specularMips[mip];
+        data.resize(static_cast<size_t>(resolution) * resolution * 3 * 6);
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(float)));
+    }
+    
+    if (!file) {
+        Log::Warn("IBLBaker: truncated cache file: " + cacheFile);
+        return false;
+    }
+    
+    outResult = std::move(result);
+    return true;
+}
+
+bool IBLBaker::LoadOrBake(const std::string& hdriPath, const std::string& cacheDirectory,
+                          const IBLBakeSettings& settings, IBLBakeResult& outResult) {
+    LGE_PROFILE_SCOPE("IBLBaker::LoadOrBake");
+    uint64_t sourceHash = 0;
+    if (!Hash::File(hdriPath, sourceHash)) {
+        Log::Error("IBLBaker: cannot read HDRI: " + hdriPath);
+        return false;
+    }
+    
+    std::string cacheFile;
+    if (!cacheDirectory.empty()) {
+        cacheFile = GetCacheFilePath(cacheDirectory, sourceHash, settings);
+        if (LoadFromCache(cacheFile, outResult) && outResult.sourceHash == sourceHash) {
+            Log::Info("IBLBaker: loaded cached IBL for " + hdriPath);
+            return true;
+        }
+    }
+    
+    HDRImage image;
+    if (!HDRDecoder::Load(hdriPath, image)) {
+        return false;
+    }
+    
+    if (!Bake(image, settings, outResult)) {
+        return false;
+    }
+    outResult.sourceHash = sourceHash;
+    
+    if (!cacheFile.empty()) {
+        SaveToCache(cacheFile, outResult);
+    }
+    return true;
+}
+
+} // namespace LGE
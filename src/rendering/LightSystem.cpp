@@ -33,6 +33,8 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/rendering/IndexBuffer.h"
 #include "LGE/core/filesystem/FileSystem.h"
 #include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
+#include "LGE/rendering/GPUProfiler.h"
 #include <glad/glad.h>
 #include <algorithm>
 #include <cmath>
@@ -130,6 +132,7 @@ void LightSystem::Shutdown() {
 }
 
 void LightSystem::BeginFrame(World& world) {
+    LGE_PROFILE_SCOPE("LightSystem::BeginFrame");
     // Clear lights for new frame - this ensures we always have fresh data
     m_Lights.clear();
     m_Lights.reserve(MAX_LIGHTS); // Reserve space to avoid reallocations
@@ -223,6 +226,7 @@ void LightSystem::CollectLights(World& world) {
 }
 
 void LightSystem::UploadToGPU() {
+    LGE_PROFILE_SCOPE("LightSystem::UploadToGPU");
     // Update Light SSBO with latest light data
     // This is called every frame to ensure changes are reflected immediately
     
@@ -471,17 +475,18 @@ void LightSystem::RenderSceneToShadowMap(World& world, const Math::Matrix4& ligh
     }
 }
 
-void LightSystem::RenderShadowMaps(World& world, Camera* camera) {
+bool LightSystem::PrepareDirectionalShadow(Camera* camera) {
+    LGE_PROFILE_SCOPE("LightSystem::PrepareDirectionalShadow");
     if (!camera || !m_ShadowCasterShader) {
         m_DirectionalShadow.IsValid = false;
-        return;
+        return false;
     }
     
     // Create shadow map on first use (lazy initialization)
     if (m_DirectionalShadow.ShadowMapTextureID == 0) {
         CreateShadowMap();
         if (!m_DirectionalShadow.IsValid) {
-            return; // Shadow map creation failed
+            return false; // Shadow map creation failed
         }
     }
     
@@ -506,26 +511,47 @@ void LightSystem::RenderShadowMaps(World& world, Camera* camera) {
     
     if (!foundLight || !m_DirectionalShadow.IsValid) {
         m_DirectionalShadow.IsValid = false;
-        return;
+        return false;
     }
     
     try {
         // Calculate light view-projection matrix
         CalculateLightViewProj(lightDir, camera, m_DirectionalShadow.LightViewProj);
-        
-        // Render scene to shadow map
-        RenderSceneToShadowMap(world, m_DirectionalShadow.LightViewProj);
-        
         m_DirectionalShadow.IsValid = true;
     } catch (const std::exception& e) {
-        Log::Error("RenderShadowMaps exception: " + std::string(e.what()));
+        Log::Error("PrepareDirectionalShadow exception: " + std::string(e.what()));
+        m_DirectionalShadow.IsValid = false;
+    } catch (...) {
+        Log::Error("PrepareDirectionalShadow unknown exception!");
+        m_DirectionalShadow.IsValid = false;
+    }
+    return m_DirectionalShadow.IsValid;
+}
+
+void LightSystem::RenderDirectionalShadow(World& world) {
+    LGE_PROFILE_SCOPE("LightSystem::RenderDirectionalShadow");
+    LGE_GPU_SCOPE("ShadowMap");
+    if (!m_DirectionalShadow.IsValid) {
+        return;
+    }
+    
+    try {
+        RenderSceneToShadowMap(world, m_DirectionalShadow.LightViewProj);
+    } catch (const std::exception& e) {
+        Log::Error("RenderDirectionalShadow exception: " + std::string(e.what()));
         m_DirectionalShadow.IsValid = false;
     } catch (...) {
-        Log::Error("RenderShadowMaps unknown exception!");
+        Log::Error("RenderDirectionalShadow unknown exception!");
         m_DirectionalShadow.IsValid = false;
     }
 }
 
+void LightSystem::RenderShadowMaps(World& world, Camera* camera) {
+    if (PrepareDirectionalShadow(camera)) {
+        RenderDirectionalShadow(world);
+    }
+}
+
 // Cascaded Shadow Maps (CSM) - future implementation
 void LightSystem::RenderCascadedShadowMaps(World& world, Camera* camera) {
     // TODO: Implement CSM rendering
@@ -0,0 +1,96 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/LuminanceHistogram.h"
+#include <algorithm>
+#include <cmath>
+
+namespace LGE {
+
+uint32_t LuminanceHistogram::BinForLuminance(float luminance, const LuminanceHistogramSettings& settings) {
+    // Written so NaN lands in bin 0
+    if (!(luminance >= std::exp2(settings.minLog2Luminance))) {
+        return 0;
+    }
+    
+    float inverseRange = 1.0f / (settings.maxLog2Luminance - settings.minLog2Luminance);
+    float t = (std::log2(luminance) - settings.minLog2Luminance) * inverseRange;
+    t = std::max(0.0f, std::min(1.0f, t));
+    return 1 + static_cast<uint32_t>(t * static_cast<float>(BinCount - 2));
+}
+
+float LuminanceHistogram::BinCenterLog2(uint32_t bin, const LuminanceHistogramSettings& settings) {
+    float range = settings.maxLog2Luminance - settings.minLog2Luminance;
+    float t = (static_cast<float>(bin - 1) + 0.5f) / static_cast<float>(BinCount - 2);
+    return settings.minLog2Luminance + std::min(t, 1.0f) * range;
+}
+
+void LuminanceHistogram::Accumulate(const float* pixels, size_t pixelCount, uint32_t channels,
+                                    const LuminanceHistogramSettings& settings, Bins& bins) {
+    for (size_t i = 0; i < pixelCount; ++i) {
+        const float* p = pixels + i * channels;
+        bins[BinForLuminance(Luminance(p[0], p[1], p[2]), settings)]++;
+    }
+}
+
+float LuminanceHistogram::ComputeAverageLuminance(const Bins& bins, const LuminanceHistogramSettings& settings) {
+    uint64_t total = 0;
+    for (uint32_t bin = 1; bin < BinCount; ++bin) {
+        total += bins[bin];
+    }
+    if (total == 0) {
+        return std::exp2(settings.minLog2Luminance);
+    }
+    
+    // Only the part of each bin that falls inside [low, high] of the sorted pixels counts
+    double low = static_cast<double>(total) * settings.lowPercentile;
+    double high = static_cast<double>(total) * settings.highPercentile;
+    double cumulative = 0.0;
+    double weightedLog2 = 0.0;
+    double weight = 0.0;
+    
+    for (uint32_t bin = 1; bin < BinCount; ++bin) {
+        double begin = cumulative;
+        double end = cumulative + bins[bin];
+        cumulative = end;
+        
+        double contribution = std::min(end, high) - std::max(begin, low);
+        if (contribution > 0.0) {
+            weightedLog2 += contribution * BinCenterLog2(bin, settings);
+            weight += contribution;
+        }
+    }
+    
+    if (weight <= 0.0) {
+        return std::exp2(settings.minLog2Luminance);
+    }
+    return static_cast<float>(std::exp2(weightedLog2 / weight));
+}
+
+float LuminanceHistogram::ComputeTargetExposure(float averageLuminance, float targetLuminance, float minExposure, float maxExposure) {
+    // Clamp luminance to avoid extreme values
+    float luminance = std::max(0.01f, std::min(averageLuminance, 10.0f));
+    return std::max(minExposure, std::min(maxExposure, targetLuminance / luminance));
+}
+
+} // namespace LGE
@@ -27,6 +27,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/rendering/IndexBuffer.h"
 #include "LGE/core/filesystem/FileSystem.h"
 #include "LGE/core/Log.h"
+#include "LGE/rendering/GPUProfiler.h"
 #include <glad/glad.h>
 
 namespace LGE {
@@ -120,6 +121,7 @@ void PostProcessor::CreateFullscreenQuad() {
 }
 
 void PostProcessor::Render(uint32_t hdrTextureID, uint32_t width, uint32_t height, float exposure, EToneMapperType toneMapper) {
+    LGE_GPU_SCOPE("ToneMap");
     if (!m_Initialized || !m_ToneMappingShader) {
         return;
     }
@@ -150,6 +152,7 @@ void PostProcessor::Render(uint32_t hdrTextureID, uint32_t width, uint32_t heigh
 }
 
 void PostProcessor::RenderToFramebuffer(uint32_t hdrTextureID, uint32_t targetFramebufferID, uint32_t width, uint32_t height, float exposure, EToneMapperType toneMapper) {
+    LGE_GPU_SCOPE("ToneMap");
     if (!m_Initialized || !m_ToneMappingShader) {
         return;
     }
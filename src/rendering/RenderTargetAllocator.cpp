@@ -0,0 +1,302 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/RenderTargetAllocator.h"
+#include <algorithm>
+#include <numeric>
+
+namespace LGE {
+
+RenderTargetAllocator::RenderTargetAllocator()
+    : m_FrameIndex(0)
+    , m_MaxIdleFrames(120)
+    , m_FreeBudget(128ull * 1024 * 1024)
+    , m_CreatedThisFrame(0)
+    , m_CompiledFrame(~0ull)
+{
+}
+
+uint32_t RenderTargetAllocator::GetBytesPerPixel(RenderTargetFormat format) {
+    switch (format) {
+        case RenderTargetFormat::RGBA8:           return 4;
+        case RenderTargetFormat::RGBA16F:         return 8;
+        case RenderTargetFormat::RGBA32F:         return 16;
+        case RenderTargetFormat::RG16F:           return 4;
+        case RenderTargetFormat::R32F:            return 4;
+        case RenderTargetFormat::Depth24Stencil8: return 4;
+        case RenderTargetFormat::Depth32F:        return 4;
+    }
+    return 4;
+}
+
+uint64_t RenderTargetAllocator::GetBytes(const RenderTargetDesc& desc) {
+    return static_cast<uint64_t>(desc.width) * desc.height * GetBytesPerPixel(desc.format) *
+           std::max(desc.samples, 1u);
+}
+
+bool RenderTargetAllocator::IsDepthFormat(RenderTargetFormat format) {
+    return format == RenderTargetFormat::Depth24Stencil8 || format == RenderTargetFormat::Depth32F;
+}
+
+uint32_t RenderTargetAllocator::Acquire(const RenderTargetDesc& desc) {
+    if (desc.width == 0 || desc.height == 0) {
+        return InvalidHandle;
+    }
+    
+    uint32_t handle = FindFree(desc);
+    if (handle == InvalidHandle) {
+        handle = Create(desc);
+    }
+    
+    Target& target = m_Targets[handle];
+    target.persistent = true;
+    target.lastUsedFrame = m_FrameIndex;
+    UpdateTotals();
+    return handle;
+}
+
+void RenderTargetAllocator::Release(uint32_t handle) {
+    if (!IsValid(handle)) {
+        return;
+    }
+    
+    Target& target = m_Targets[handle];
+    target.persistent = false;
+    target.lastUsedFrame = m_FrameIndex;
+    UpdateTotals();
+}
+
+uint32_t RenderTargetAllocator::DeclareTransient(const RenderTargetDesc& desc, uint32_t firstPass, uint32_t lastPass) {
+    TransientRequest request;
+    request.desc = desc;
+    request.firstPass = std::min(firstPass, lastPass);
+    request.lastPass = std::max(firstPass, lastPass);
+    m_Transients.push_back(request);
+    return static_cast<uint32_t>(m_Transients.size() - 1);
+}
+
+void RenderTargetAllocator::CompileTransients() {
+    if (m_CompiledFrame != m_FrameIndex) {
+        m_CompiledFrame = m_FrameIndex;
+        m_Stats.transientRequests = 0;
+        m_Stats.aliasedRequests = 0;
+        m_Stats.transientBytesRequested = 0;
+        m_Stats.transientBytesAllocated = 0;
+    }
+    
+    std::vector<uint32_t> order(m_Transients.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+        return m_Transients[a].firstPass < m_Transients[b].firstPass;
+    });
+    
+    for (uint32_t index : order) {
+        TransientRequest& request = m_Transients[index];
+        if (request.target != InvalidHandle || request.desc.width == 0 || request.desc.height == 0) {
+            continue;
+        }
+        
+        // Prefer a target whose previous owner this frame is already done,
+        // taking the one freed most recently so longer gaps stay available
+        uint32_t chosen = InvalidHandle;
+        auto it = m_ByDesc.find(request.desc);
+        if (it != m_ByDesc.end()) {
+            uint32_t bestPass = 0;
+            for (uint32_t handle : it->second) {
+                const Target& target = m_Targets[handle];
+                if (target.persistent || !target.transient || target.busyUntilPass >= request.firstPass) {
+                    continue;
+                }
+                if (chosen == InvalidHandle || target.busyUntilPass > bestPass) {
+                    chosen = handle;
+                    bestPass = target.busyUntilPass;
+                }
+            }
+        }
+        
+        if (chosen != InvalidHandle) {
+            m_Stats.aliasedRequests++;
+        } else {
+            chosen = FindFree(request.desc);
+            if (chosen == InvalidHandle) {
+                chosen = Create(request.desc);
+            }
+            m_Stats.transientBytesAllocated += m_Targets[chosen].bytes;
+        }
+        
+        Target& target = m_Targets[chosen];
+        target.transient = true;
+        target.busyUntilPass = request.lastPass;
+        target.lastUsedFrame = m_FrameIndex;
+        
+        request.target = chosen;
+        m_Stats.transientRequests++;
+        m_Stats.transientBytesRequested += target.bytes;
+    }
+    
+    UpdateTotals();
+}
+
+uint32_t RenderTargetAllocator::GetTransientTarget(uint32_t transient) const {
+    return transient < m_Transients.size() ? m_Transients[transient].target : InvalidHandle;
+}
+
+void RenderTargetAllocator::EndFrame(std::vector<uint32_t>& outDestroyed) {
+    size_t destroyedBefore = outDestroyed.size();
+    
+    for (Target& target : m_Targets) {
+        target.transient = false;
+        target.busyUntilPass = 0;
+    }
+    m_Transients.clear();
+    
+    // Idle targets go first, then the oldest free ones until under budget
+    std::vector<uint32_t> freeTargets;
+    uint64_t freeBytes = 0;
+    for (uint32_t handle = 0; handle < m_Targets.size(); ++handle) {
+        const Target& target = m_Targets[handle];
+        if (!target.alive || target.persistent) {
+            continue;
+        }
+        if (m_FrameIndex - target.lastUsedFrame > m_MaxIdleFrames) {
+            Destroy(handle, outDestroyed);
+        } else {
+            freeTargets.push_back(handle);
+            freeBytes += target.bytes;
+        }
+    }
+    
+    if (freeBytes > m_FreeBudget) {
+        std::sort(freeTargets.begin(), freeTargets.end(), [this](uint32_t a, uint32_t b) {
+            return m_Targets[a].lastUsedFrame < m_Targets[b].lastUsedFrame;
+        });
+        for (uint32_t handle : freeTargets) {
+            if (freeBytes <= m_FreeBudget) {
+                break;
+            }
+            freeBytes -= m_Targets[handle].bytes;
+            Destroy(handle, outDestroyed);
+        }
+    }
+    
+    UpdateTotals();
+    m_Stats.createdThisFrame = m_CreatedThisFrame;
+    m_Stats.destroyedThisFrame = static_cast<uint32_t>(outDestroyed.size() - destroyedBefore);
+    m_CreatedThisFrame = 0;
+    m_FrameIndex++;
+}
+
+void RenderTargetAllocator::Trim(std::vector<uint32_t>& outDestroyed) {
+    for (uint32_t handle = 0; handle < m_Targets.size(); ++handle) {
+        const Target& target = m_Targets[handle];
+        if (target.alive && !target.persistent && !target.transient) {
+            Destroy(handle, outDestroyed);
+        }
+    }
+    UpdateTotals();
+}
+
+bool RenderTargetAllocator::IsValid(uint32_t handle) const {
+    return handle < m_Targets.size() && m_Targets[handle].alive;
+}
+
+uint32_t RenderTargetAllocator::FindFree(const RenderTargetDesc& desc) const {
+    auto it = m_ByDesc.find(desc);
+    if (it == m_ByDesc.end()) {
+        return InvalidHandle;
+    }
+    
+    // Most recently used first; the others are the ones that should age out
+    uint32_t best = InvalidHandle;
+    for (uint32_t handle : it->second) {
+        const Target& target = m_Targets[handle];
+        if (target.persistent || target.transient) {
+            continue;
+        }
+        if (best == InvalidHandle || target.lastUsedFrame > m_Targets[best].lastUsedFrame) {
+            best = handle;
+        }
+    }
+    return best;
+}
+
+uint32_t RenderTargetAllocator::Create(const RenderTargetDesc& desc) {
+    uint32_t handle;
+    if (!m_FreeSlots.empty()) {
+        handle = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    } else {
+        handle = static_cast<uint32_t>(m_Targets.size());
+        m_Targets.emplace_back();
+    }
+    
+    Target& target = m_Targets[handle];
+    target = Target();
+    target.desc = desc;
+    target.bytes = GetBytes(desc);
+    target.lastUsedFrame = m_FrameIndex;
+    target.alive = true;
+    
+    m_ByDesc[desc].push_back(handle);
+    m_CreatedThisFrame++;
+    return handle;
+}
+
+void RenderTargetAllocator::Destroy(uint32_t handle, std::vector<uint32_t>& outDestroyed) {
+    Target& target = m_Targets[handle];
+    auto it = m_ByDesc.find(target.desc);
+    if (it != m_ByDesc.end()) {
+        auto& handles = it->second;
+        handles.erase(std::remove(handles.begin(), handles.end(), handle), handles.end());
+        if (handles.empty()) {
+            m_ByDesc.erase(it);
+        }
+    }
+    
+    target.alive = false;
+    target.persistent = false;
+    target.transient = false;
+    m_FreeSlots.push_back(handle);
+    outDestroyed.push_back(handle);
+}
+
+void RenderTargetAllocator::UpdateTotals() {
+    m_Stats.targetCount = 0;
+    m_Stats.inUseCount = 0;
+    m_Stats.totalBytes = 0;
+    m_Stats.inUseBytes = 0;
+    for (const Target& target : m_Targets) {
+        if (!target.alive) {
+            continue;
+        }
+        m_Stats.targetCount++;
+        m_Stats.totalBytes += target.bytes;
+        if (target.persistent || target.transient) {
+            m_Stats.inUseCount++;
+            m_Stats.inUseBytes += target.bytes;
+        }
+    }
+    m_Stats.peakBytes = std::max(m_Stats.peakBytes, m_Stats.totalBytes);
+}
+
+} // namespace LGE
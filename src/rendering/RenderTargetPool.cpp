@@ -0,0 +1,183 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/RenderTargetPool.h"
+#include "LGE/core/Log.h"
+#include <glad/glad.h>
+
+namespace LGE {
+
+namespace {
+
+GLenum ToGLInternalFormat(RenderTargetFormat format) {
+    switch (format) {
+        case RenderTargetFormat::RGBA8:           return GL_RGBA8;
+        case RenderTargetFormat::RGBA16F:         return GL_RGBA16F;
+        case RenderTargetFormat::RGBA32F:         return GL_RGBA32F;
+        case RenderTargetFormat::RG16F:           return GL_RG16F;
+        case RenderTargetFormat::R32F:            return GL_R32F;
+        case RenderTargetFormat::Depth24Stencil8: return GL_DEPTH24_STENCIL8;
+        case RenderTargetFormat::Depth32F:        return GL_DEPTH_COMPONENT32F;
+    }
+    return GL_RGBA8;
+}
+
+uint64_t FramebufferKey(uint32_t colorHandle, uint32_t depthHandle) {
+    return (static_cast<uint64_t>(colorHandle) << 32) | depthHandle;
+}
+
+} // namespace
+
+RenderTargetPool::RenderTargetPool() {
+}
+
+RenderTargetPool::~RenderTargetPool() {
+    Shutdown();
+}
+
+void RenderTargetPool::Shutdown() {
+    for (const auto& pair : m_Framebuffers) {
+        glDeleteFramebuffers(1, &pair.second);
+    }
+    m_Framebuffers.clear();
+    
+    for (uint32_t& texture : m_Textures) {
+        if (texture != 0) {
+            glDeleteTextures(1, &texture);
+            texture = 0;
+        }
+    }
+    m_Textures.clear();
+    m_Allocator = RenderTargetAllocator();
+}
+
+uint32_t RenderTargetPool::GetTexture(uint32_t handle) {
+    if (!m_Allocator.IsValid(handle)) {
+        return 0;
+    }
+    if (handle >= m_Textures.size()) {
+        m_Textures.resize(handle + 1, 0);
+    }
+    if (m_Textures[handle] != 0) {
+        return m_Textures[handle];
+    }
+    
+    const RenderTargetDesc& desc = m_Allocator.GetDesc(handle);
+    GLenum internalFormat = ToGLInternalFormat(desc.format);
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    
+    if (desc.samples > 1) {
+        glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, texture);
+        glTexStorage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, static_cast<GLsizei>(desc.samples), internalFormat,
+                                  static_cast<GLsizei>(desc.width), static_cast<GLsizei>(desc.height), GL_TRUE);
+        glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, 0);
+    } else {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexStorage2D(GL_TEXTURE_2D, 1, internalFormat, static_cast<GLsizei>(desc.width), static_cast<GLsizei>(desc.height));
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+    
+    m_Textures[handle] = texture;
+    return texture;
+}
+
+uint32_t RenderTargetPool::GetFramebuffer(uint32_t colorHandle, uint32_t depthHandle) {
+    bool hasColor = m_Allocator.IsValid(colorHandle);
+    bool hasDepth = m_Allocator.IsValid(depthHandle);
+    if (!hasColor && !hasDepth) {
+        return 0;
+    }
+    
+    uint64_t key = FramebufferKey(hasColor ? colorHandle : InvalidHandle, hasDepth ? depthHandle : InvalidHandle);
+    auto it = m_Framebuffers.find(key);
+    if (it != m_Framebuffers.end()) {
+        return it->second;
+    }
+    
+    GLuint framebuffer = 0;
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    
+    if (hasColor) {
+        GLenum target = m_Allocator.GetDesc(colorHandle).samples > 1 ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, target, GetTexture(colorHandle), 0);
+    } else {
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+    }
+    
+    if (hasDepth) {
+        const RenderTargetDesc& desc = m_Allocator.GetDesc(depthHandle);
+        GLenum target = desc.samples > 1 ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+        GLenum attachment = desc.format == RenderTargetFormat::Depth24Stencil8 ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+        glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, target, GetTexture(depthHandle), 0);
+    }
+    
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        Log::Error("Pooled framebuffer is incomplete");
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    
+    m_Framebuffers[key] = framebuffer;
+    return framebuffer;
+}
+
+void RenderTargetPool::EndFrame() {
+    m_Destroyed.clear();
+    m_Allocator.EndFrame(m_Destroyed);
+    DestroyResources(m_Destroyed);
+}
+
+void RenderTargetPool::Trim() {
+    m_Destroyed.clear();
+    m_Allocator.Trim(m_Destroyed);
+    DestroyResources(m_Destroyed);
+}
+
+void RenderTargetPool::DestroyResources(const std::vector<uint32_t>& handles) {
+    for (uint32_t handle : handles) {
+        // Drop every cached framebuffer that references the retired target
+        for (auto it = m_Framebuffers.begin(); it != m_Framebuffers.end();) {
+            uint32_t color = static_cast<uint32_t>(it->first >> 32);
+            uint32_t depth = static_cast<uint32_t>(it->first & 0xFFFFFFFFu);
+            if (color == handle || depth == handle) {
+                glDeleteFramebuffers(1, &it->second);
+                it = m_Framebuffers.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        
+        if (handle < m_Textures.size() && m_Textures[handle] != 0) {
+            glDeleteTextures(1, &m_Textures[handle]);
+            m_Textures[handle] = 0;
+        }
+    }
+}
+
+} // namespace LGE
@@ -0,0 +1,498 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/SkyAtmosphere.h"
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/Hash.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace LGE {
+
+namespace {
+
+constexpr float kPi = 3.14159265358979f;
+constexpr size_t kRowsPerJob = 4;
+
+struct Vec3 {
+    float x, y, z;
+};
+
+inline Vec3 operator+(const Vec3& a, const Vec3& b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+inline Vec3 operator-(const Vec3& a, const Vec3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+inline Vec3 operator*(const Vec3& a, const Vec3& b) { return {a.x * b.x, a.y * b.y, a.z * b.z}; }
+inline Vec3 operator*(const Vec3& a, float s) { return {a.x * s, a.y * s, a.z * s}; }
+
+inline Vec3 ToVec3(const Math::Vector3& v) { return {v.x, v.y, v.z}; }
+inline Math::Vector3 ToVector(const Vec3& v) { return Math::Vector3(v.x, v.y, v.z); }
+inline float Dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline float Length(const Vec3& v) { return std::sqrt(Dot(v, v)); }
+inline Vec3 Exp(const Vec3& v) { return {std::exp(v.x), std::exp(v.y), std::exp(v.z)}; }
+
+inline Vec3 Normalize(const Vec3& v) {
+    float len = Length(v);
+    return len > 0.0f ? v * (1.0f / len) : Vec3{0.0f, 1.0f, 0.0f};
+}
+
+// Energy-conserving integration of constant in-scattering over one step
+// (Hillaire 2015): (S - S * exp(-extinction * dt)) / extinction
+inline Vec3 IntegrateStep(const Vec3& s, const Vec3& extinction, const Vec3& stepTransmittance) {
+    auto channel = [](float sc, float ext, float t) {
+        return ext > 1e-9f ? (sc - sc * t) / ext : 0.0f;
+    };
+    return {channel(s.x, extinction.x, stepTransmittance.x),
+            channel(s.y, extinction.y, stepTransmittance.y),
+            channel(s.z, extinction.z, stepTransmittance.z)};
+}
+
+struct Medium {
+    Vec3 rayleigh;
+    float mie;
+    Vec3 scattering;
+    Vec3 extinction;
+};
+
+Medium SampleMedium(const AtmosphereParameters& p, float height) {
+    height = std::max(height, 0.0f);
+    float rayleighDensity = std::exp(-height / p.rayleighScaleHeight);
+    float mieDensity = std::exp(-height / p.mieScaleHeight);
+    float ozoneDensity = std::max(0.0f, 1.0f - std::abs(height - p.ozoneCenter) / p.ozoneHalfWidth);
+    
+    Medium medium;
+    medium.rayleigh = ToVec3(p.rayleighScattering) * rayleighDensity;
+    medium.mie = p.mieScattering * mieDensity;
+    medium.scattering = medium.rayleigh + Vec3{medium.mie, medium.mie, medium.mie};
+    float mieExtinction = p.mieExtinction * mieDensity;
+    medium.extinction = medium.rayleigh + Vec3{mieExtinction, mieExtinction, mieExtinction} +
+                        ToVec3(p.ozoneAbsorption) * ozoneDensity;
+    return medium;
+}
+
+inline float RayleighPhase(float cosTheta) {
+    return 3.0f / (16.0f * kPi) * (1.0f + cosTheta * cosTheta);
+}
+
+// Cornette-Shanks
+inline float MiePhase(float g, float cosTheta) {
+    float g2 = g * g;
+    float denom = std::pow(std::max(1.0f + g2 - 2.0f * g * cosTheta, 1e-6f), 1.5f);
+    return 3.0f / (8.0f * kPi) * (1.0f - g2) * (1.0f + cosTheta * cosTheta) / ((2.0f + g2) * denom);
+}
+
+// Ray from radius r with cosine mu against the view zenith
+inline float DistanceToTop(const AtmosphereParameters& p, float r, float mu) {
+    float discriminant = r * r * (mu * mu - 1.0f) + p.topRadius * p.topRadius;
+    return std::max(0.0f, -r * mu + std::sqrt(std::max(discriminant, 0.0f)));
+}
+
+inline bool HitsGround(const AtmosphereParameters& p, float r, float mu) {
+    return mu < 0.0f && r * r * (mu * mu - 1.0f) + p.groundRadius * p.groundRadius >= 0.0f;
+}
+
+inline float DistanceToGround(const AtmosphereParameters& p, float r, float mu) {
+    float discriminant = r * r * (mu * mu - 1.0f) + p.groundRadius * p.groundRadius;
+    return std::max(0.0f, -r * mu - std::sqrt(std::max(discriminant, 0.0f)));
+}
+
+// Bruneton's transmittance parameterization: more resolution near the horizon
+void TransmittanceRMuToUV(const AtmosphereParameters& p, float r, float mu, float& u, float& v) {
+    float H = std::sqrt(p.topRadius * p.topRadius - p.groundRadius * p.groundRadius);
+    float rho = std::sqrt(std::max(r * r - p.groundRadius * p.groundRadius, 0.0f));
+    float d = DistanceToTop(p, r, mu);
+    float dMin = p.topRadius - r;
+    float dMax = rho + H;
+    u = dMax > dMin ? (d - dMin) / (dMax - dMin) : 0.0f;
+    v = rho / H;
+}
+
+void TransmittanceUVToRMu(const AtmosphereParameters& p, float u, float v, float& r, float& mu) {
+    float H = std::sqrt(p.topRadius * p.topRadius - p.groundRadius * p.groundRadius);
+    float rho = H * v;
+    r = std::sqrt(rho * rho + p.groundRadius * p.groundRadius);
+    float dMin = p.topRadius - r;
+    float dMax = rho + H;
+    float d = dMin + u * (dMax - dMin);
+    mu = d <= 0.0f ? 1.0f : (H * H - rho * rho - d * d) / (2.0f * r * d);
+    mu = std::max(-1.0f, std::min(1.0f, mu));
+}
+
+// Bilinear lookup with texel centers at (i + 0.5) / size
+Vec3 SampleImage(const HDRImage& image, float u, float v) {
+    float x = std::max(0.0f, std::min(u * image.width - 0.5f, static_cast<float>(image.width - 1)));
+    float y = std::max(0.0f, std::min(v * image.height - 0.5f, static_cast<float>(image.height - 1)));
+    
+    float fx = std::floor(x);
+    float fy = std::floor(y);
+    float tx = x - fx;
+    float ty = y - fy;
+    int x0 = static_cast<int>(fx);
+    int y0 = static_cast<int>(fy);
+    int x1 = std::min(x0 + 1, image.width - 1);
+    int y1 = std::min(y0 + 1, image.height - 1);
+    
+    auto texel = [&](int tx0, int ty0) {
+        const float* px = image.pixels.data() + (static_cast<size_t>(ty0) * image.width + tx0) * 3;
+        return Vec3{px[0], px[1], px[2]};
+    };
+    Vec3 top = texel(x0, y0) * (1.0f - tx) + texel(x1, y0) * tx;
+    Vec3 bottom = texel(x0, y1) * (1.0f - tx) + texel(x1, y1) * tx;
+    return top * (1.0f - ty) + bottom * ty;
+}
+
+Vec3 LookupTransmittance(const AtmosphereParameters& p, const HDRImage& lut, float r, float mu) {
+    r = std::max(p.groundRadius, std::min(r, p.topRadius));
+    if (HitsGround(p, r, mu)) {
+        return {0.0f, 0.0f, 0.0f};
+    }
+    float u, v;
+    TransmittanceRMuToUV(p, r, mu, u, v);
+    return SampleImage(lut, u, v);
+}
+
+Vec3 LookupMultiScattering(const AtmosphereParameters& p, const HDRImage& lut, float r, float cosSunZenith) {
+    float u = cosSunZenith * 0.5f + 0.5f;
+    float v = (r - p.groundRadius) / (p.topRadius - p.groundRadius);
+    return SampleImage(lut, u, v);
+}
+
+// Sky-view latitude mapping, see SkyAtmosphere.h
+inline float LatitudeToV(float latitude) {
+    float t = std::sqrt(std::abs(latitude) / (0.5f * kPi));
+    return latitude >= 0.0f ? 0.5f - 0.5f * t : 0.5f + 0.5f * t;
+}
+
+inline float VToLatitude(float v) {
+    float t = (v < 0.5f ? 0.5f - v : v - 0.5f) * 2.0f;
+    float latitude = 0.5f * kPi * t * t;
+    return v < 0.5f ? latitude : -latitude;
+}
+
+// Transmittance along a sun ray by numeric integration (reference path only)
+Vec3 IntegrateTransmittance(const AtmosphereParameters& p, float r, float mu, uint32_t steps) {
+    if (HitsGround(p, r, mu)) {
+        return {0.0f, 0.0f, 0.0f};
+    }
+    float distance = DistanceToTop(p, r, mu);
+    float dt = distance / steps;
+    Vec3 opticalDepth{0.0f, 0.0f, 0.0f};
+    for (uint32_t i = 0; i < steps; ++i) {
+        float t = (i + 0.5f) * dt;
+        float height = std::sqrt(r * r + t * t + 2.0f * r * mu * t) - p.groundRadius;
+        opticalDepth = opticalDepth + SampleMedium(p, height).extinction * dt;
+    }
+    return Exp(opticalDepth * -1.0f);
+}
+
+// Single scattering of the sun plus the multiple-scattering LUT term along one
+// view ray. sunTransmittance(r, mu) supplies the sun ray; samples follow a
+// quadratic distribution so most of them land in the dense lower layers.
+template <typename SunTransmittanceFn>
+Vec3 IntegrateSkyRay(const AtmosphereParameters& p, const HDRImage& multiScattering, const Vec3& direction,
+                     uint32_t steps, const SunTransmittanceFn& sunTransmittance) {
+    const float viewRadius = p.groundRadius + std::max(p.viewHeight, 0.001f);
+    const Vec3 origin{0.0f, viewRadius, 0.0f};
+    const Vec3 sun = Normalize(ToVec3(p.sunDirection));
+    const Vec3 illuminance = ToVec3(p.sunIlluminance);
+    
+    float mu = direction.y;
+    bool ground = HitsGround(p, viewRadius, mu);
+    float tMax = ground ? DistanceToGround(p, viewRadius, mu) : DistanceToTop(p, viewRadius, mu);
+    
+    float cosTheta = Dot(direction, sun);
+    float phaseRayleigh = RayleighPhase(cosTheta);
+    float phaseMie = MiePhase(p.mieAnisotropy, cosTheta);
+    
+    Vec3 radiance{0.0f, 0.0f, 0.0f};
+    Vec3 throughput{1.0f, 1.0f, 1.0f};
+    float t0 = 0.0f;
+    for (uint32_t i = 0; i < steps; ++i) {
+        float f = static_cast<float>(i + 1) / steps;
+        float t1 = tMax * f * f;
+        float dt = t1 - t0;
+        float t = t0 + 0.3f * dt;
+        t0 = t1;
+        
+        Vec3 position = origin + direction * t;
+        float r = Length(position);
+        Vec3 up = position * (1.0f / r);
+        float cosSun = Dot(up, sun);
+        Medium medium = SampleMedium(p, r - p.groundRadius);
+        
+        Vec3 sunT = sunTransmittance(r, cosSun);
+        Vec3 psi = LookupMultiScattering(p, multiScattering, r, cosSun);
+        Vec3 scattered = (medium.rayleigh * phaseRayleigh + Vec3{medium.mie, medium.mie, medium.mie} * phaseMie) * sunT +
+                         medium.scattering * psi;
+        scattered = scattered * illuminance;
+        
+        Vec3 stepTransmittance = Exp(medium.extinction * -dt);
+        radiance = radiance + throughput * IntegrateStep(scattered, medium.extinction, stepTransmittance);
+        throughput = throughput * stepTransmittance;
+    }
+    
+    // Lambertian ground lit by the sun
+    if (ground) {
+        Vec3 up = Normalize(origin + direction * tMax);
+        float cosSun = Dot(up, sun);
+        Vec3 sunT = sunTransmittance(p.groundRadius, cosSun);
+        radiance = radiance + throughput * sunT * ToVec3(p.groundAlbedo) * illuminance * (std::max(cosSun, 0.0f) / kPi);
+    }
+    return radiance;
+}
+
+// Direction in the sun's frame; u is the azimuth relative to the sun over [0, PI]
+Vec3 SkyViewTexelDirection(float u, float v) {
+    float azimuth = u * kPi;
+    float latitude = VToLatitude(v);
+    float cosLatitude = std::cos(latitude);
+    return {cosLatitude * std::cos(azimuth), std::sin(latitude), cosLatitude * std::sin(azimuth)};
+}
+
+void AllocateImage(HDRImage& image, uint32_t width, uint32_t height) {
+    image.width = static_cast<int>(width);
+    image.height = static_cast<int>(height);
+    image.pixels.assign(static_cast<size_t>(width) * height * 3, 0.0f);
+}
+
+inline void StorePixel(HDRImage& image, size_t x, size_t y, const Vec3& value) {
+    float* px = image.pixels.data() + (y * image.width + x) * 3;
+    px[0] = value.x;
+    px[1] = value.y;
+    px[2] = value.z;
+}
+
+} // namespace
+
+uint64_t SkyAtmosphere::ComputeHash(const AtmosphereParameters& parameters, const SkyAtmosphereSettings& settings) {
+    // Both structs are plain floats / uint32s without padding
+    uint64_t hash = Hash::Bytes(&parameters, sizeof(parameters));
+    return Hash::Bytes(&settings, sizeof(settings), hash);
+}
+
+void SkyAtmosphere::BakeTransmittance(const AtmosphereParameters& parameters, const SkyAtmosphereSettings& settings,
+                                      HDRImage& outLUT) {
+    AllocateImage(outLUT, settings.transmittanceWidth, settings.transmittanceHeight);
+    const uint32_t steps = std::max(1u, settings.transmittanceSteps);
+    
+    JobSystem::ParallelFor(settings.transmittanceHeight, kRowsPerJob, [&](size_t begin, size_t end) {
+        for (size_t y = begin; y < end; ++y) {
+            for (size_t x = 0; x < settings.transmittanceWidth; ++x) {
+                float r, mu;
+                TransmittanceUVToRMu(parameters,
+                                     (x + 0.5f) / settings.transmittanceWidth,
+                                     (y + 0.5f) / settings.transmittanceHeight, r, mu);
+                
+                float distance = DistanceToTop(parameters, r, mu);
+                float dt = distance / steps;
+                Vec3 opticalDepth{0.0f, 0.0f, 0.0f};
+                for (uint32_t i = 0; i < steps; ++i) {
+                    float t = (i + 0.5f) * dt;
+                    float height = std::sqrt(r * r + t * t + 2.0f * r * mu * t) - parameters.groundRadius;
+                    opticalDepth = opticalDepth + SampleMedium(parameters, height).extinction * dt;
+                }
+                StorePixel(outLUT, x, y, Exp(opticalDepth * -1.0f));
+            }
+        }
+    });
+}
+
+void SkyAtmosphere::BakeMultiScattering(const AtmosphereParameters& parameters, const SkyAtmosphereSettings& settings,
+                                        const HDRImage& transmittance, HDRImage& outLUT) {
+    const uint32_t size = settings.multiScatteringSize;
+    AllocateImage(outLUT, size, size);
+    
+    // Stratified uniform sphere directions, shared by every texel
+    uint32_t side = std::max(1u, static_cast<uint32_t>(std::sqrt(static_cast<float>(settings.multiScatteringDirections))));
+    std::vector<Vec3> directions;
+    directions.reserve(side * side);
+    for (uint32_t a = 0; a < side; ++a) {
+        for (uint32_t b = 0; b < side; ++b) {
+            float cosTheta = 1.0f - 2.0f * (a + 0.5f) / side;
+            float sinTheta = std::sqrt(std::max(0.0f, 1.0f - cosTheta * cosTheta));
+            float phi = 2.0f * kPi * (b + 0.5f) / side;
+            directions.push_back({sinTheta * std::cos(phi), cosTheta, sinTheta * std::sin(phi)});
+        }
+    }
+    const float invDirections = 1.0f / directions.size();
+    const float isotropicPhase = 1.0f / (4.0f * kPi);
+    const uint32_t steps = std::max(1u, settings.multiScatteringSteps);
+    const Vec3 albedo = ToVec3(parameters.groundAlbedo);
+    
+    JobSystem::ParallelFor(size, kRowsPerJob, [&](size_t begin, size_t end) {
+        for (size_t y = begin; y < end; ++y) {
+            float height = (y + 0.5f) / size * (parameters.topRadius - parameters.groundRadius);
+            float viewRadius = parameters.groundRadius + height;
+            Vec3 origin{0.0f, viewRadius, 0.0f};
+            
+            for (size_t x = 0; x < size; ++x) {
+                float cosSunZenith = (x + 0.5f) / size * 2.0f - 1.0f;
+                Vec3 sun{std::sqrt(std::max(0.0f, 1.0f - cosSunZenith * cosSunZenith)), cosSunZenith, 0.0f};
+                
+                // Second-order scattering (L) and the transfer of isotropic
+                // unit radiance (fms), both averaged over all directions
+                Vec3 secondOrder{0.0f, 0.0f, 0.0f};
+                Vec3 transfer{0.0f, 0.0f, 0.0f};
+                for (const Vec3& direction : directions) {
+                    float mu = direction.y;
+                    bool ground = HitsGround(parameters, viewRadius, mu);
+                    float tMax = ground ? DistanceToGround(parameters, viewRadius, mu)
+                                        : DistanceToTop(parameters, viewRadius, mu);
+                    float dt = tMax / steps;
+                    
+                    Vec3 throughput{1.0f, 1.0f, 1.0f};
+                    for (uint32_t i = 0; i < steps; ++i) {
+                        Vec3 position = origin + direction * ((i + 0.5f) * dt);
+                        float r = Length(position);
+                        float cosSun = Dot(position * (1.0f / r), sun);
+                        Medium medium = SampleMedium(parameters, r - parameters.groundRadius);
+                        
+                        Vec3 stepTransmittance = Exp(medium.extinction * -dt);
+                        Vec3 sunT = LookupTransmittance(parameters, transmittance, r, cosSun);
+                        secondOrder = secondOrder + throughput * IntegrateStep(medium.scattering * sunT * isotropicPhase,
+                                                                               medium.extinction, stepTransmittance);
+                        transfer = transfer + throughput * IntegrateStep(medium.scattering, medium.extinction, stepTransmittance);
+                        throughput = throughput * stepTransmittance;
+                    }
+                    
+                    if (ground) {
+                        Vec3 up = Normalize(origin + direction * tMax);
+                        float cosSun = Dot(up, sun);
+                        Vec3 sunT = LookupTransmittance(parameters, transmittance, parameters.groundRadius, cosSun);
+                        secondOrder = secondOrder + throughput * sunT * albedo * (std::max(cosSun, 0.0f) / kPi);
+                    }
+                }
+                
+                secondOrder = secondOrder * invDirections;
+                transfer = transfer * invDirections;
+                // Infinite series of higher orders: L2 * (1 + fms + fms^2 + ...)
+                Vec3 psi{secondOrder.x / std::max(1.0f - transfer.x, 1e-4f),
+                         secondOrder.y / std::max(1.0f - transfer.y, 1e-4f),
+                         secondOrder.z / std::max(1.0f - transfer.z, 1e-4f)};
+                StorePixel(outLUT, x, y, psi);
+            }
+        }
+    });
+}
+
+void SkyAtmosphere::BakeSkyView(const AtmosphereParameters& parameters, const SkyAtmosphereSettings& settings,
+                                const HDRImage& transmittance, const HDRImage& multiScattering, HDRImage& outLUT) {
+    AllocateImage(outLUT, settings.skyViewWidth, settings.skyViewHeight);
+    const uint32_t steps = std::max(1u, settings.skyViewSteps);
+    
+    // Baked in the sun's frame (sun azimuth = 0); the sky is mirror symmetric
+    // about that plane, so u only has to cover half a turn
+    AtmosphereParameters local = parameters;
+    float cosSunZenith = Normalize(ToVec3(parameters.sunDirection)).y;
+    local.sunDirection = Math::Vector3(std::sqrt(std::max(0.0f, 1.0f - cosSunZenith * cosSunZenith)), cosSunZenith, 0.0f);
+    auto sunTransmittance = [&](float r, float mu) {
+        return LookupTransmittance(local, transmittance, r, mu);
+    };
+    
+    JobSystem::ParallelFor(settings.skyViewHeight, kRowsPerJob, [&](size_t begin, size_t end) {
+        for (size_t y = begin; y < end; ++y) {
+            for (size_t x = 0; x < settings.skyViewWidth; ++x) {
+                Vec3 direction = SkyViewTexelDirection((x + 0.5f) / settings.skyViewWidth,
+                                                       (y + 0.5f) / settings.skyViewHeight);
+                StorePixel(outLUT, x, y, IntegrateSkyRay(local, multiScattering, direction, steps, sunTransmittance));
+            }
+        }
+    });
+}
+
+uint64_t SkyAtmosphere::ComputeMediumHash(const AtmosphereParameters& parameters, const SkyAtmosphereSettings& settings) {
+    // Transmittance and multiple scattering do not depend on the sun or the viewer
+    AtmosphereParameters medium = parameters;
+    medium.sunDirection = Math::Vector3(0.0f);
+    medium.sunIlluminance = Math::Vector3(0.0f);
+    medium.viewHeight = 0.0f;
+    return ComputeHash(medium, settings);
+}
+
+bool SkyAtmosphere::Bake(const AtmosphereParameters& parameters, const SkyAtmosphereSettings& settings,
+                         SkyAtmosphereLUTs& outLUTs) {
+    uint64_t mediumHash = ComputeMediumHash(parameters, settings);
+    bool reuseMedium = outLUTs.mediumHash == mediumHash &&
+                       outLUTs.transmittance.IsValid() && outLUTs.multiScattering.IsValid();
+    
+    outLUTs.parameters = parameters;
+    outLUTs.settings = settings;
+    outLUTs.hash = ComputeHash(parameters, settings);
+    outLUTs.mediumHash = mediumHash;
+    
+    if (!reuseMedium) {
+        BakeTransmittance(parameters, settings, outLUTs.transmittance);
+        BakeMultiScattering(parameters, settings, outLUTs.transmittance, outLUTs.multiScattering);
+    }
+    BakeSkyView(parameters, settings, outLUTs.transmittance, outLUTs.multiScattering, outLUTs.skyView);
+    return outLUTs.IsValid();
+}
+
+Math::Vector3 SkyAtmosphere::SampleTransmittance(const SkyAtmosphereLUTs& luts, float height, float cosZenith) {
+    const AtmosphereParameters& p = luts.parameters;
+    return ToVector(LookupTransmittance(p, luts.transmittance, p.groundRadius + height, cosZenith));
+}
+
+Math::Vector3 SkyAtmosphere::SampleMultiScattering(const SkyAtmosphereLUTs& luts, float height, float cosSunZenith) {
+    const AtmosphereParameters& p = luts.parameters;
+    return ToVector(LookupMultiScattering(p, luts.multiScattering, p.groundRadius + height, cosSunZenith));
+}
+
+Math::Vector3 SkyAtmosphere::SampleSkyView(const SkyAtmosphereLUTs& luts, const Math::Vector3& direction) {
+    Vec3 dir = Normalize(ToVec3(direction));
+    Vec3 sun = ToVec3(luts.parameters.sunDirection);
+    
+    // Angle between the view and sun azimuths; any azimuth works for a sun at the zenith
+    float viewLength = std::sqrt(dir.x * dir.x + dir.z * dir.z);
+    float sunLength = std::sqrt(sun.x * sun.x + sun.z * sun.z);
+    float cosAzimuth = 1.0f;
+    if (viewLength > 1e-5f && sunLength > 1e-5f) {
+        cosAzimuth = (dir.x * sun.x + dir.z * sun.z) / (viewLength * sunLength);
+    }
+    float u = std::acos(std::max(-1.0f, std::min(1.0f, cosAzimuth))) / kPi;
+    float v = LatitudeToV(std::asin(std::max(-1.0f, std::min(1.0f, dir.y))));
+    return ToVector(SampleImage(luts.skyView, u, v));
+}
+
+Math::Vector3 SkyAtmosphere::ComputeRadianceReference(const SkyAtmosphereLUTs& luts, const Math::Vector3& direction,
+                                                      uint32_t viewSteps, uint32_t sunSteps) {
+    const AtmosphereParameters& p = luts.parameters;
+    auto sunTransmittance = [&](float r, float mu) {
+        return IntegrateTransmittance(p, r, mu, std::max(1u, sunSteps));
+    };
+    return ToVector(IntegrateSkyRay(p, luts.multiScattering, Normalize(ToVec3(direction)),
+                                    std::max(1u, viewSteps), sunTransmittance));
+}
+
+void SkyAtmosphere::BuildEquirect(const SkyAtmosphereLUTs& luts, int width, int height, HDRImage& outImage) {
+    AllocateImage(outImage, static_cast<uint32_t>(width), static_cast<uint32_t>(height));
+    for (int y = 0; y < height; ++y) {
+        float theta = (y + 0.5f) / height * kPi;
+        for (int x = 0; x < width; ++x) {
+            float phi = ((x + 0.5f) / width - 0.5f) * 2.0f * kPi;
+            Math::Vector3 direction(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+            StorePixel(outImage, x, y, ToVec3(SampleSkyView(luts, direction)));
+        }
+    }
+}
+
+} // namespace LGE
@@ -0,0 +1,247 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/SkyLightEnvironment.h"
+#include "LGE/rendering/Shader.h"
+#include "LGE/rendering/Texture.h"
+#include "LGE/core/scene/World.h"
+#include "LGE/core/scene/GameObject.h"
+#include "LGE/core/scene/components/SkyLightComponent.h"
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/Hash.h"
+#include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <filesystem>
+
+namespace LGE {
+
+SkyLightEnvironment::SkyLightEnvironment()
+    : m_BakeState(std::make_shared<BakeState>())
+    , m_HasSkyLight(false)
+    , m_Intensity(1.0f)
+    , m_UseDiffuse(true)
+    , m_UseSpecular(true)
+    , m_MipCount(0)
+    , m_Ready(false)
+    , m_BakePending(false)
+    , m_SettingsDirty(false)
+{
+    for (auto& coefficient : m_IrradianceSH) {
+        coefficient = Math::Vector3(0.0f);
+    }
+}
+
+SkyLightEnvironment::~SkyLightEnvironment() {
+    // Invalidate any in-flight bake; the job only touches the shared state
+    std::lock_guard<std::mutex> lock(m_BakeState->mutex);
+    m_BakeState->requestId++;
+}
+
+void SkyLightEnvironment::SetBakeSettings(const IBLBakeSettings& settings) {
+    m_Settings = settings;
+    m_SettingsDirty = true;
+}
+
+void SkyLightEnvironment::Update(World& world) {
+    LGE_PROFILE_SCOPE("SkyLightEnvironment::Update");
+    SkyLightComponent* skyLight = nullptr;
+    for (const auto& obj : world.GetAllGameObjects()) {
+        if (!obj || !obj->IsActive()) {
+            continue;
+        }
+        
+        auto* component = obj->GetComponent<SkyLightComponent>();
+        if (component && component->Enabled && (!component->EnvironmentMapPath.empty() || m_ProceduralSky)) {
+            skyLight = component;
+            break;
+        }
+    }
+    
+    m_HasSkyLight = skyLight != nullptr;
+    if (!skyLight) {
+        return;
+    }
+    
+    m_Intensity = skyLight->Intensity;
+    m_UseDiffuse = skyLight->UseDiffuseIBL;
+    m_UseSpecular = skyLight->UseSpecularIBL;
+    
+    // Without an HDRI the sky light captures the procedural sky; its LUTs
+    // change with the sun, and the previous capture stays bound until the
+    // new one lands so the ambient does not drop out
+    if (skyLight->EnvironmentMapPath.empty()) {
+        std::string source = "atmosphere:" + Hash::ToHex(m_ProceduralSky->hash);
+        if (source != m_SourcePath || m_SettingsDirty) {
+            m_SourcePath = source;
+            m_SettingsDirty = false;
+            RequestProceduralBake(m_ProceduralSky);
+        }
+        UploadFinishedBake();
+        return;
+    }
+    
+    // Only the HDRI and bake settings require a rebake
+    std::string sourcePath = ResolvePath(skyLight->EnvironmentMapPath);
+    if (sourcePath != m_SourcePath || m_SettingsDirty) {
+        m_SourcePath = sourcePath;
+        m_SettingsDirty = false;
+        m_Ready = false;
+        RequestBake(sourcePath);
+        return;
+    }
+    
+    UploadFinishedBake();
+}
+
+void SkyLightEnvironment::UploadFinishedBake() {
+    // Upload a finished bake (GL calls must stay on this thread)
+    IBLBakeResult result;
+    bool succeeded = false;
+    {
+        std::lock_guard<std::mutex> lock(m_BakeState->mutex);
+        if (!m_BakeState->completed) {
+            return;
+        }
+        m_BakeState->completed = false;
+        m_BakePending = false;
+        succeeded = m_BakeState->succeeded;
+        result = std::move(m_BakeState->result);
+    }
+    
+    if (succeeded) {
+        UploadResult(result);
+    }
+}
+
+void SkyLightEnvironment::Apply(Shader& shader, uint32_t textureSlot) const {
+    // Always point the cube sampler at its own unit so it never aliases a 2D texture
+    shader.SetUniform1i("u_PrefilteredEnv", static_cast<int>(textureSlot));
+    
+    bool active = m_HasSkyLight && m_Ready && m_PrefilteredEnv;
+    shader.SetUniform1i("u_HasSkyLight", active ? 1 : 0);
+    if (!active) {
+        return;
+    }
+    
+    shader.SetUniform1f("u_SkyLightIntensity", m_Intensity);
+    shader.SetUniform1i("u_UseDiffuseIBL", m_UseDiffuse ? 1 : 0);
+    shader.SetUniform1i("u_UseSpecularIBL", m_UseSpecular ? 1 : 0);
+    shader.SetUniform1f("u_PrefilteredMaxLod", static_cast<float>(m_MipCount > 0 ? m_MipCount - 1 : 0));
+    
+    for (size_t i = 0; i < m_IrradianceSH.size(); ++i) {
+        const auto& c = m_IrradianceSH[i];
+        shader.SetUniform3f("u_IrradianceSH[" + std::to_string(i) + "]", c.x, c.y, c.z);
+    }
+    
+    m_PrefilteredEnv->Bind(textureSlot);
+}
+
+void SkyLightEnvironment::RequestBake(const std::string& hdriPath) {
+    uint64_t requestId = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_BakeState->mutex);
+        requestId = ++m_BakeState->requestId;
+        m_BakeState->completed = false;
+    }
+    m_BakePending = true;
+    
+    std::shared_ptr<BakeState> state = m_BakeState;
+    std::string cacheDirectory = m_CacheDirectory;
+    IBLBakeSettings settings = m_Settings;
+    
+    Log::Info("SkyLightEnvironment: preparing IBL for " + hdriPath);
+    JobSystem::Submit([state, requestId, hdriPath, cacheDirectory, settings]() {
+        LGE_PROFILE_SCOPE("SkyLightEnvironment::BakeHDRI");
+        IBLBakeResult result;
+        bool succeeded = IBLBaker::LoadOrBake(hdriPath, cacheDirectory, settings, result);
+        
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->requestId != requestId) {
+            return; // Superseded by a newer request
+        }
+        state->succeeded = succeeded;
+        state->result = std::move(result);
+        state->completed = true;
+    });
+}
+
+void SkyLightEnvironment::RequestProceduralBake(std::shared_ptr<const SkyAtmosphereLUTs> luts) {
+    uint64_t requestId = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_BakeState->mutex);
+        requestId = ++m_BakeState->requestId;
+        m_BakeState->completed = false;
+    }
+    m_BakePending = true;
+    
+    std::shared_ptr<BakeState> state = m_BakeState;
+    
+    // The sky is smooth, so a small capture is enough and keeps sun changes cheap
+    IBLBakeSettings settings;
+    settings.specularResolution = std::min(m_Settings.specularResolution, 32u);
+    settings.specularMipCount = std::min(m_Settings.specularMipCount, 5u);
+    settings.sampleCount = std::min(m_Settings.sampleCount, 32u);
+    
+    JobSystem::Submit([state, requestId, luts, settings]() {
+        LGE_PROFILE_SCOPE("SkyLightEnvironment::BakeProceduralSky");
+        HDRImage equirect;
+        SkyAtmosphere::BuildEquirect(*luts, 128, 64, equirect);
+        IBLBakeResult result;
+        bool succeeded = IBLBaker::Bake(equirect, settings, result);
+        result.sourceHash = luts->hash;
+        
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->requestId != requestId) {
+            return; // Superseded by a newer request
+        }
+        state->succeeded = succeeded;
+        state->result = std::move(result);
+        state->completed = true;
+    });
+}
+
+void SkyLightEnvironment::UploadResult(const IBLBakeResult& result) {
+    if (!m_PrefilteredEnv) {
+        m_PrefilteredEnv = std::make_unique<Texture>();
+    }
+    
+    m_PrefilteredEnv->CreateCubemapFromMips(result.settings.specularResolution, result.specularMips);
+    m_IrradianceSH = result.irradianceSH;
+    m_MipCount = static_cast<uint32_t>(result.specularMips.size());
+    m_Ready = true;
+    
+    Log::Info("SkyLightEnvironment: IBL ready (" + std::to_string(result.settings.specularResolution) +
+              "px, " + std::to_string(m_MipCount) + " mips)");
+}
+
+std::string SkyLightEnvironment::ResolvePath(const std::string& path) const {
+    std::filesystem::path filePath(path);
+    if (filePath.is_absolute() || m_AssetRoot.empty() || std::filesystem::exists(filePath)) {
+        return path;
+    }
+    return (std::filesystem::path(m_AssetRoot) / filePath).string();
+}
+
+} // namespace LGE
@@ -32,7 +32,10 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/rendering/Camera.h"
 #include "LGE/rendering/Texture.h"
 #include "LGE/core/filesystem/FileSystem.h"
+#include "LGE/core/JobSystem.h"
 #include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
+#include "LGE/rendering/GPUProfiler.h"
 #include <glad/glad.h>
 #include <vector>
 #include <cmath>
@@ -45,11 +48,77 @@ Skybox::Skybox()
     , m_Initialized(false)
     , m_HasTexture(false)
     , m_Scale(50.0f)  // Make skybox much larger (50x the original size)
+    , m_AtmosphereState(std::make_shared<AtmosphereBakeState>())
+    , m_RequestedHash(0)
+    , m_AtmosphereBakePending(false)
 {
 }
 
 Skybox::~Skybox() {
-    // Resources will be cleaned up by unique_ptr
+    // Invalidate any in-flight bake; the job only touches the shared state
+    std::lock_guard<std::mutex> lock(m_AtmosphereState->mutex);
+    m_AtmosphereState->requestId++;
+}
+
+void Skybox::Update() {
+    LGE_PROFILE_SCOPE("Skybox::Update");
+    if (!m_Initialized || m_HasTexture) {
+        return;
+    }
+    
+    // Upload a finished bake (GL calls must stay on this thread)
+    std::shared_ptr<const SkyAtmosphereLUTs> result;
+    {
+        std::lock_guard<std::mutex> lock(m_AtmosphereState->mutex);
+        if (m_AtmosphereState->completed) {
+            m_AtmosphereState->completed = false;
+            m_AtmosphereBakePending = false;
+            result = std::move(m_AtmosphereState->result);
+        }
+    }
+    if (result && result->IsValid()) {
+        if (!m_SkyViewLUT) {
+            m_SkyViewLUT = std::make_unique<Texture>();
+        }
+        m_SkyViewLUT->CreateHDRTexture(result->skyView);
+        m_AtmosphereLUTs = std::move(result);
+    }
+    
+    // One bake in flight at a time; later changes are picked up when it lands
+    uint64_t hash = SkyAtmosphere::ComputeHash(m_Atmosphere, m_AtmosphereSettings);
+    if (hash != m_RequestedHash && !m_AtmosphereBakePending) {
+        m_RequestedHash = hash;
+        RequestAtmosphereBake();
+    }
+}
+
+void Skybox::RequestAtmosphereBake() {
+    uint64_t requestId = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_AtmosphereState->mutex);
+        requestId = ++m_AtmosphereState->requestId;
+        m_AtmosphereState->completed = false;
+    }
+    m_AtmosphereBakePending = true;
+    
+    std::shared_ptr<AtmosphereBakeState> state = m_AtmosphereState;
+    std::shared_ptr<const SkyAtmosphereLUTs> previous = m_AtmosphereLUTs;
+    AtmosphereParameters parameters = m_Atmosphere;
+    SkyAtmosphereSettings settings = m_AtmosphereSettings;
+    
+    JobSystem::Submit([state, requestId, previous, parameters, settings]() {
+        LGE_PROFILE_SCOPE("Skybox::BakeAtmosphere");
+        // Start from the last LUTs so a sun-only change skips transmittance and multiple scattering
+        auto luts = previous ? std::make_shared<SkyAtmosphereLUTs>(*previous) : std::make_shared<SkyAtmosphereLUTs>();
+        SkyAtmosphere::Bake(parameters, settings, *luts);
+        
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->requestId != requestId) {
+            return; // Superseded by a newer request
+        }
+        state->result = std::move(luts);
+        state->completed = true;
+    });
 }
 
 void Skybox::Init() {
@@ -151,6 +220,7 @@ bool Skybox::LoadHDR(const std::string& filepath) {
 }
 
 void Skybox::Render(const Camera& camera, float cloudOffset) {
+    LGE_GPU_SCOPE("Skybox");
     if (!m_Initialized || !m_Shader) {
         return;
     }
@@ -195,6 +265,16 @@ void Skybox::Render(const Camera& camera, float cloudOffset) {
         // They're only used in gradient mode, but shader doesn't have them anymore
     }
     
+    // Procedural sky: one sky-view LUT fetch per pixel
+    bool useAtmosphere = !m_HasTexture && m_SkyViewLUT && m_AtmosphereLUTs;
+    m_Shader->SetUniform1i("u_UseAtmosphere", useAtmosphere ? 1 : 0);
+    if (useAtmosphere) {
+        const Math::Vector3& sun = m_AtmosphereLUTs->parameters.sunDirection;
+        m_SkyViewLUT->Bind(0);
+        m_Shader->SetUniform1i("u_SkyViewLUT", 0);
+        m_Shader->SetUniform3f("u_SunDirection", sun.x, sun.y, sun.z);
+    }
+    
     m_VertexArray->Bind();
     glDrawArrays(GL_TRIANGLES, 0, 36);
     m_VertexArray->Unbind();
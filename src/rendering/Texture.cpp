@@ -29,7 +29,10 @@ For more information, visit: https://nexelgames.com/luma-engine
 */
 
 #include "LGE/rendering/Texture.h"
+#include "LGE/rendering/HDRDecoder.h"
 #include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
+#include "LGE/core/filesystem/MappedFile.h"
 #include <glad/glad.h>
 #include <fstream>
 #include <sstream>
@@ -39,34 +42,6 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include <cstring>
 #include <cctype>
 
-// Provide minimal zlib-compatible stubs for tinyexr when miniz is disabled
-#define TINYEXR_USE_MINIZ 0
-// Stub zlib types and functions
-typedef unsigned long uLong;
-typedef unsigned long uLongf;
-typedef unsigned char Bytef;
-#define Z_OK 0
-#define Z_STREAM_END 1
-#define Z_NEED_DICT 2
-#define Z_ERRNO (-1)
-#define Z_STREAM_ERROR (-2)
-#define Z_DATA_ERROR (-3)
-#define Z_MEM_ERROR (-4)
-#define Z_BUF_ERROR (-5)
-#define Z_VERSION_ERROR (-6)
-
-// Stub functions - these won't work for compressed EXR, but will allow uncompressed EXR to load
-static inline uLong compressBound(uLong sourceLen) { return sourceLen + (sourceLen >> 12) + (sourceLen >> 14) + 11; }
-static inline int compress(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen) { return Z_DATA_ERROR; }
-static inline int uncompress(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen) { return Z_DATA_ERROR; }
-
-#define TINYEXR_IMPLEMENTATION
-#include "../../third_party/tinyexr.h"
-
-// Include stb_image at global scope (before namespace)
-#ifndef STB_IMAGE_IMPLEMENTATION
-#define STB_IMAGE_IMPLEMENTATION
-#endif
 #include "../../third_party/stb_image.h"
 
 namespace LGE {
@@ -91,158 +66,14 @@ Texture::~Texture() {
     }
 }
 
-// Helper function to read RLE scanline (standard RGBE RLE format)
-static bool ReadRLEScanline(std::ifstream& file, unsigned char* scanline, int width) {
-    unsigned char byte1, byte2;
-    if (!file.read(reinterpret_cast<char*>(&byte1), 1) || !file.read(reinterpret_cast<char*>(&byte2), 1)) {
-        return false;
-    }
-    
-    // Check if RLE encoded (first two bytes should be 2, 2)
-    if (byte1 != 2 || byte2 != 2) {
-        // Not RLE encoded, read directly
-        file.seekg(-2, std::ios::cur);
-        if (!file.read(reinterpret_cast<char*>(scanline), width * 4)) {
-            return false;
-        }
-        return file.gcount() == width * 4;
-    }
-    
-    // RLE encoded - read the width bytes (should match our width)
-    unsigned char widthBytes[2];
-    if (!file.read(reinterpret_cast<char*>(widthBytes), 2)) {
-        return false;
-    }
-    
-    int scanlineWidth = (widthBytes[0] << 8) | widthBytes[1];
-    if (scanlineWidth != width) {
-        return false; // Width mismatch
-    }
-    
-    // Read all RLE data for this scanline into a temporary buffer
-    std::vector<unsigned char> rleData;
-    rleData.reserve(width * 4 * 2);
-    
-    // Read RLE data until we have decoded all channels
-    for (int channel = 0; channel < 4; ++channel) {
-        int pixelCount = 0;
-        while (pixelCount < width) {
-            unsigned char byte;
-            if (!file.read(reinterpret_cast<char*>(&byte), 1)) {
-                return false;
-            }
-            
-            if (byte > 128) {
-                // Run: repeat the next byte (byte - 128) times
-                int runLength = byte - 128;
-                unsigned char value;
-                if (!file.read(reinterpret_cast<char*>(&value), 1)) {
-                    return false;
-                }
-                
-                rleData.push_back(byte);
-                rleData.push_back(value);
-                pixelCount += runLength;
-            } else {
-                // Non-run: read (byte) bytes directly
-                int nonRunLength = byte;
-                if (nonRunLength == 0) {
-                    return false;
-                }
-                
-                rleData.push_back(byte);
-                for (int i = 0; i < nonRunLength; ++i) {
-                    unsigned char value;
-                    if (!file.read(reinterpret_cast<char*>(&value), 1)) {
-                        return false;
-                    }
-                    rleData.push_back(value);
-                }
-                pixelCount += nonRunLength;
-            }
-        }
-    }
-    
-    // Now decode the RLE data into the scanline
-    size_t rleIndex = 0;
-    for (int channel = 0; channel < 4; ++channel) {
-        int pos = channel;
-        int pixelCount = 0;
-        
-        while (pixelCount < width && rleIndex < rleData.size()) {
-            unsigned char byte = rleData[rleIndex++];
-            
-            if (byte > 128) {
-                int runLength = byte - 128;
-                unsigned char value = rleData[rleIndex++];
-                for (int i = 0; i < runLength && pixelCount < width; ++i) {
-                    scanline[pos] = value;
-                    pos += 4;
-                    pixelCount++;
-                }
-            } else {
-                int nonRunLength = byte;
-                for (int i = 0; i < nonRunLength && pixelCount < width && rleIndex < rleData.size(); ++i) {
-                    scanline[pos] = rleData[rleIndex++];
-                    pos += 4;
-                    pixelCount++;
-                }
-            }
-        }
-    }
-    
-    return true;
-}
-
-// EXR loader using tinyexr
+// EXR loader (tinyexr, compressed blocks decoded in parallel)
 bool Texture::LoadEXR(const std::string& filepath) {
-    float* out = nullptr; // width * height * RGBA
-    int width, height;
-    const char* err = nullptr;
-    
-    int ret = ::LoadEXR(&out, &width, &height, filepath.c_str(), &err);
-    
-    if (ret != 0) { // 0 means success in tinyexr
-        if (err) {
-            Log::Error("Failed to load EXR file: " + filepath + " - " + std::string(err));
-        } else {
-            Log::Error("Failed to load EXR file: " + filepath);
-        }
+    HDRImage image;
+    if (!HDRDecoder::LoadEXR(filepath, image)) {
         return false;
     }
     
-    if (!out) {
-        Log::Error("LoadEXR returned null data");
-        return false;
-    }
-    
-    m_Width = width;
-    m_Height = height;
-    
-    // Convert RGBA to RGB (drop alpha channel)
-    std::vector<float> rgbData(m_Width * m_Height * 3);
-    for (int i = 0; i < m_Width * m_Height; ++i) {
-        rgbData[i * 3] = out[i * 4];     // R
-        rgbData[i * 3 + 1] = out[i * 4 + 1]; // G
-        rgbData[i * 3 + 2] = out[i * 4 + 2]; // B
-    }
-    
-    free(out); // Free the EXR data
-    
-    // Create OpenGL texture
-    glGenTextures(1, &m_RendererID);
-    glBindTexture(GL_TEXTURE_2D, m_RendererID);
-    
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB32F, m_Width, m_Height, 0, GL_RGB, GL_FLOAT, rgbData.data());
-    
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    
-    glBindTexture(GL_TEXTURE_2D, 0);
-    
-    m_IsHDR = true;
+    CreateHDRTexture(image);
     Log::Info("Loaded EXR texture: " + filepath + " (" + std::to_string(m_Width) + "x" + std::to_string(m_Height) + ")");
     return true;
 }
@@ -263,97 +94,31 @@ bool Texture::LoadHDRImage(const std::string& filepath) {
     }
 }
 
-// HDR loader for RGBE format with RLE support
+// HDR loader for RGBE format (scanlines decoded in parallel)
 bool Texture::LoadHDR(const std::string& filepath) {
-    std::ifstream file(filepath, std::ios::binary);
-    if (!file.is_open()) {
-        Log::Error("Failed to open HDR file: " + filepath);
-        return false;
-    }
-
-    // Read header
-    std::string line;
-    std::getline(file, line);
-    if (line != "#?RADIANCE" && line != "#?RGBE") {
-        Log::Error("Invalid HDR file format: " + filepath);
-        return false;
-    }
-
-    // Skip header lines until we find the resolution
-    while (std::getline(file, line)) {
-        if (line.empty() || line[0] == '#') {
-            continue;
-        }
-        if (line.find("Y ") != std::string::npos || line.find("-Y ") != std::string::npos || 
-            line.find("+Y ") != std::string::npos) {
-            // Parse resolution: "-Y height +X width" or "Y height X width"
-            std::istringstream iss(line);
-            std::string token;
-            int width = 0, height = 0;
-            
-            while (iss >> token) {
-                if (token == "+X" || token == "X") {
-                    iss >> width;
-                } else if (token == "-Y" || token == "+Y" || token == "Y") {
-                    iss >> height;
-                }
-            }
-            
-            if (width > 0 && height > 0) {
-                m_Width = width;
-                m_Height = height;
-                break;
-            }
-        }
-    }
-
-    if (m_Width == 0 || m_Height == 0) {
-        Log::Error("Failed to parse HDR resolution");
+    HDRImage image;
+    if (!HDRDecoder::LoadRadiance(filepath, image)) {
         return false;
     }
-
-    // Skip blank line after resolution
-    std::getline(file, line);
-
-    // Read RGBE data (with RLE support)
-    std::vector<unsigned char> rgbeData(m_Width * m_Height * 4);
-    std::vector<unsigned char> scanline(m_Width * 4);
     
-    for (int y = 0; y < m_Height; ++y) {
-        if (!ReadRLEScanline(file, scanline.data(), m_Width)) {
-            Log::Error("Failed to read HDR scanline " + std::to_string(y) + " of " + std::to_string(m_Height));
-            return false;
-        }
-        
-        // Copy scanline to main buffer
-        std::memcpy(&rgbeData[y * m_Width * 4], scanline.data(), m_Width * 4);
-    }
+    CreateHDRTexture(image);
+    Log::Info("Loaded HDR texture: " + filepath + " (" + std::to_string(m_Width) + "x" + std::to_string(m_Height) + ")");
+    return true;
+}
 
-    // Convert RGBE to float RGB
-    std::vector<float> floatData(m_Width * m_Height * 3);
-    for (size_t i = 0; i < m_Width * m_Height; ++i) {
-        unsigned char r = rgbeData[i * 4];
-        unsigned char g = rgbeData[i * 4 + 1];
-        unsigned char b = rgbeData[i * 4 + 2];
-        unsigned char e = rgbeData[i * 4 + 3];
-
-        if (e == 0) {
-            floatData[i * 3] = 0.0f;
-            floatData[i * 3 + 1] = 0.0f;
-            floatData[i * 3 + 2] = 0.0f;
-        } else {
-            float exp = std::ldexp(1.0f, static_cast<int>(e) - 128);
-            floatData[i * 3] = (r + 0.5f) / 256.0f * exp;
-            floatData[i * 3 + 1] = (g + 0.5f) / 256.0f * exp;
-            floatData[i * 3 + 2] = (b + 0.5f) / 256.0f * exp;
-        }
+// Upload decoded float RGB pixels as a clamped, linearly filtered 2D texture
+void Texture::CreateHDRTexture(const HDRImage& image) {
+    if (m_RendererID != 0) {
+        glDeleteTextures(1, &m_RendererID);
     }
-
-    // Create OpenGL texture
+    
+    m_Width = image.width;
+    m_Height = image.height;
+    
     glGenTextures(1, &m_RendererID);
     glBindTexture(GL_TEXTURE_2D, m_RendererID);
     
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB32F, m_Width, m_Height, 0, GL_RGB, GL_FLOAT, floatData.data());
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB32F, m_Width, m_Height, 0, GL_RGB, GL_FLOAT, image.pixels.data());
     
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
@@ -361,10 +126,8 @@ bool Texture::LoadHDR(const std::string& filepath) {
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     
     glBindTexture(GL_TEXTURE_2D, 0);
-
+    
     m_IsHDR = true;
-    Log::Info("Loaded HDR texture: " + filepath + " (" + std::to_string(m_Width) + "x" + std::to_string(m_Height) + ")");
-    return true;
 }
 
 // Load standard image formats (PNG, JPG, etc.) using stb_image
@@ -374,11 +137,15 @@ bool Texture::LoadImageFile(const std::string& filepath) {
     #undef LoadImage
     #endif
     
+    // Decode straight out of the mapping; no intermediate file buffer
+    FileView file = MappedFile::Open(filepath, FileAccessHint::Sequential);
     int width, height, channels;
-    unsigned char* data = stbi_load(filepath.c_str(), &width, &height, &channels, 4); // Force RGBA
+    unsigned char* data = file.IsValid()
+        ? stbi_load_from_memory(file.GetData(), static_cast<int>(file.GetSize()), &width, &height, &channels, 4) // Force RGBA
+        : nullptr;
     
     if (!data) {
-        Log::Error("Failed to load image: " + filepath + " - " + stbi_failure_reason());
+        Log::Error("Failed to load image: " + filepath + " - " + (file.IsValid() ? stbi_failure_reason() : "can't open file"));
         return false;
     }
     
@@ -477,6 +244,52 @@ void Texture::CreateCubemapFromData(uint32_t resolution, const float* data, bool
     glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 }
 
+void Texture::CreateCubemapFromMips(uint32_t resolution, const std::vector<std::vector<float>>& mips) {
+    if (mips.empty()) {
+        return;
+    }
+    
+    if (m_RendererID != 0) {
+        glDeleteTextures(1, &m_RendererID);
+    }
+    
+    m_Width = resolution;
+    m_Height = resolution;
+    m_IsHDR = true;
+    m_IsCubemap = true;
+    
+    glGenTextures(1, &m_RendererID);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, m_RendererID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    
+    for (uint32_t mip = 0; mip < mips.size(); ++mip) {
+        uint32_t mipResolution = std::max(1u, resolution >> mip);
+        size_t faceFloats = static_cast<size_t>(mipResolution) * mipResolution * 3;
+        if (mips[mip].size() < faceFloats * 6) {
+            Log::Error("Texture: cubemap mip " + std::to_string(mip) + " has too little data");
+            break;
+        }
+        
+        for (uint32_t i = 0; i < 6; ++i) {
+            glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, mip, GL_RGB16F,
+                         mipResolution, mipResolution, 0, GL_RGB, GL_FLOAT,
+                         mips[mip].data() + i * faceFloats);
+        }
+    }
+    
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(mips.size() - 1));
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+    
+    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+}
+
 void Texture::BindAsImage(uint32_t binding, uint32_t mipLevel, bool write) const {
     GLenum access = write ? GL_WRITE_ONLY : GL_READ_ONLY;
     GLenum format = m_IsHDR ? GL_RGBA16F : GL_RGBA8;
@@ -504,6 +317,7 @@ void Texture::GenerateMipmaps() const {
 
 // Load from TextureSpec
 bool Texture::Load(const TextureSpec& spec) {
+    LGE_PROFILE_SCOPE("Texture::Load");
     m_FilePath = spec.filepath;
     m_GammaCorrected = spec.gammaCorrected;
     m_MinFilter = spec.minFilter;
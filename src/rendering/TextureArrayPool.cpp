@@ -0,0 +1,247 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/TextureArrayPool.h"
+#include "LGE/core/Log.h"
+#include <glad/glad.h>
+#include <algorithm>
+
+namespace LGE {
+
+TextureArrayPool::TextureArrayPool()
+    : m_RendererID(0)
+    , m_LayerWidth(0)
+    , m_LayerHeight(0)
+    , m_MipCount(1)
+    , m_Capacity(0)
+    , m_MaxLayers(0)
+    , m_UsedCount(0)
+    , m_InternalFormat(GL_SRGB8_ALPHA8)
+{
+}
+
+TextureArrayPool::~TextureArrayPool() {
+    Shutdown();
+}
+
+bool TextureArrayPool::Initialize(int layerWidth, int layerHeight, uint32_t initialLayers,
+                                  uint32_t maxLayers, uint32_t mipCount, bool gammaCorrected) {
+    Shutdown();
+    if (layerWidth <= 0 || layerHeight <= 0 || maxLayers == 0) {
+        return false;
+    }
+    
+    GLint maxArrayLayers = 0;
+    glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxArrayLayers);
+    
+    uint32_t fullChain = 1;
+    for (int size = std::max(layerWidth, layerHeight); size > 1; size >>= 1) {
+        ++fullChain;
+    }
+    
+    m_LayerWidth = layerWidth;
+    m_LayerHeight = layerHeight;
+    m_MipCount = std::clamp(mipCount, 1u, fullChain);
+    m_MaxLayers = maxArrayLayers > 0 ? std::min(maxLayers, static_cast<uint32_t>(maxArrayLayers)) : maxLayers;
+    m_InternalFormat = gammaCorrected ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+    
+    return Grow(std::clamp(initialLayers, 1u, m_MaxLayers));
+}
+
+void TextureArrayPool::Shutdown() {
+    for (uint32_t view : m_Views) {
+        if (view != 0) {
+            glDeleteTextures(1, &view);
+        }
+    }
+    m_Views.clear();
+    m_Used.clear();
+    m_FreeLayers.clear();
+    
+    if (m_RendererID != 0) {
+        glDeleteTextures(1, &m_RendererID);
+        m_RendererID = 0;
+    }
+    m_Capacity = 0;
+    m_UsedCount = 0;
+}
+
+uint32_t TextureArrayPool::Allocate() {
+    if (m_RendererID == 0) {
+        return InvalidLayer;
+    }
+    if (m_FreeLayers.empty()) {
+        if (m_Capacity >= m_MaxLayers || !Grow(std::min(m_Capacity * 2, m_MaxLayers))) {
+            Log::Warn("Texture array pool is full (" + std::to_string(m_Capacity) + " layers)");
+            return InvalidLayer;
+        }
+    }
+    
+    uint32_t layer = m_FreeLayers.back();
+    m_FreeLayers.pop_back();
+    m_Used[layer] = 1;
+    ++m_UsedCount;
+    CreateView(layer);
+    return layer;
+}
+
+void TextureArrayPool::Free(uint32_t layer) {
+    if (layer >= m_Capacity || !m_Used[layer]) {
+        return;
+    }
+    
+    if (m_Views[layer] != 0) {
+        glDeleteTextures(1, &m_Views[layer]);
+        m_Views[layer] = 0;
+    }
+    m_Used[layer] = 0;
+    --m_UsedCount;
+    m_FreeLayers.push_back(layer);
+}
+
+bool TextureArrayPool::Upload(uint32_t layer, const uint8_t* rgba) {
+    if (!rgba || layer >= m_Capacity || !m_Used[layer]) {
+        return false;
+    }
+    
+    glBindTexture(GL_TEXTURE_2D_ARRAY, m_RendererID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, static_cast<GLint>(layer),
+                    m_LayerWidth, m_LayerHeight, 1, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+    
+    // 2x2 box filter per mip; glGenerateMipmap would touch every layer
+    std::vector<uint8_t> previous;
+    std::vector<uint8_t> current;
+    const uint8_t* source = rgba;
+    int sourceWidth = m_LayerWidth;
+    int sourceHeight = m_LayerHeight;
+    for (uint32_t mip = 1; mip < m_MipCount; ++mip) {
+        int width = std::max(sourceWidth >> 1, 1);
+        int height = std::max(sourceHeight >> 1, 1);
+        current.resize(static_cast<size_t>(width) * static_cast<size_t>(height) * 4);
+        
+        for (int y = 0; y < height; ++y) {
+            int y0 = std::min(y * 2, sourceHeight - 1);
+            int y1 = std::min(y * 2 + 1, sourceHeight - 1);
+            for (int x = 0; x < width; ++x) {
+                int x0 = std::min(x * 2, sourceWidth - 1);
+                int x1 = std::min(x * 2 + 1, sourceWidth - 1);
+                for (int c = 0; c < 4; ++c) {
+                    int sum = source[(static_cast<size_t>(y0) * sourceWidth + x0) * 4 + c] +
+                              source[(static_cast<size_t>(y0) * sourceWidth + x1) * 4 + c] +
+                              source[(static_cast<size_t>(y1) * sourceWidth + x0) * 4 + c] +
+                              source[(static_cast<size_t>(y1) * sourceWidth + x1) * 4 + c];
+                    current[(static_cast<size_t>(y) * width + x) * 4 + c] = static_cast<uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+        
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, static_cast<GLint>(mip), 0, 0, static_cast<GLint>(layer),
+                        width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, current.data());
+        
+        previous.swap(current);
+        source = previous.data();
+        sourceWidth = width;
+        sourceHeight = height;
+    }
+    
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    return true;
+}
+
+uint32_t TextureArrayPool::GetLayerView(uint32_t layer) const {
+    return layer < m_Capacity ? m_Views[layer] : 0;
+}
+
+bool TextureArrayPool::Grow(uint32_t capacity) {
+    if (capacity <= m_Capacity) {
+        return false;
+    }
+    
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+    glTexStorage3D(GL_TEXTURE_2D_ARRAY, static_cast<GLsizei>(m_MipCount), m_InternalFormat,
+                   m_LayerWidth, m_LayerHeight, static_cast<GLsizei>(capacity));
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, m_MipCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    
+    if (m_RendererID != 0) {
+        // Move existing layers across on the GPU, then rebuild the views
+        for (uint32_t mip = 0; mip < m_MipCount; ++mip) {
+            GLsizei width = std::max(m_LayerWidth >> mip, 1);
+            GLsizei height = std::max(m_LayerHeight >> mip, 1);
+            glCopyImageSubData(m_RendererID, GL_TEXTURE_2D_ARRAY, static_cast<GLint>(mip), 0, 0, 0,
+                               texture, GL_TEXTURE_2D_ARRAY, static_cast<GLint>(mip), 0, 0, 0,
+                               width, height, static_cast<GLsizei>(m_Capacity));
+        }
+        for (uint32_t& view : m_Views) {
+            if (view != 0) {
+                glDeleteTextures(1, &view);
+                view = 0;
+            }
+        }
+        glDeleteTextures(1, &m_RendererID);
+    }
+    
+    uint32_t oldCapacity = m_Capacity;
+    m_RendererID = texture;
+    m_Capacity = capacity;
+    m_Views.resize(capacity, 0);
+    m_Used.resize(capacity, 0);
+    
+    // Lowest indices come off the free list first
+    for (uint32_t layer = capacity; layer > oldCapacity; --layer) {
+        m_FreeLayers.push_back(layer - 1);
+    }
+    for (uint32_t layer = 0; layer < oldCapacity; ++layer) {
+        if (m_Used[layer]) {
+            CreateView(layer);
+        }
+    }
+    return true;
+}
+
+void TextureArrayPool::CreateView(uint32_t layer) {
+    if (m_Views[layer] != 0) {
+        return;
+    }
+    
+    GLuint view = 0;
+    glGenTextures(1, &view);
+    glTextureView(view, GL_TEXTURE_2D, m_RendererID, m_InternalFormat,
+                  0, static_cast<GLuint>(m_MipCount), layer, 1);
+    glBindTexture(GL_TEXTURE_2D, view);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_MipCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    m_Views[layer] = view;
+}
+
+} // namespace LGE
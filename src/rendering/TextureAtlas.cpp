@@ -0,0 +1,187 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/TextureAtlas.h"
+#include "LGE/core/Log.h"
+#include "LGE/core/filesystem/MappedFile.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstring>
+
+#include "../../third_party/stb_image.h"
+
+namespace LGE {
+
+TextureAtlas::TextureAtlas()
+    : m_RendererID(0)
+    , m_Width(0)
+    , m_Height(0)
+{
+}
+
+TextureAtlas::~TextureAtlas() {
+    Release();
+}
+
+bool TextureAtlas::AddImage(const std::string& name, const uint8_t* rgba, int width, int height) {
+    if (!rgba || width <= 0 || height <= 0) {
+        return false;
+    }
+    
+    StagedImage& image = m_Staged[name];
+    image.width = width;
+    image.height = height;
+    image.pixels.assign(rgba, rgba + static_cast<size_t>(width) * static_cast<size_t>(height) * 4);
+    return true;
+}
+
+bool TextureAtlas::AddImageFile(const std::string& name, const std::string& filepath) {
+    FileView file = MappedFile::Open(filepath, FileAccessHint::Sequential);
+    int width, height, channels;
+    unsigned char* data = file.IsValid()
+        ? stbi_load_from_memory(file.GetData(), static_cast<int>(file.GetSize()), &width, &height, &channels, 4)
+        : nullptr;
+    if (!data) {
+        Log::Error("Failed to load atlas image: " + filepath + " - " + (file.IsValid() ? stbi_failure_reason() : "can't open file"));
+        return false;
+    }
+    
+    bool added = AddImage(name, data, width, height);
+    stbi_image_free(data);
+    return added;
+}
+
+bool TextureAtlas::HasImage(const std::string& name) const {
+    return m_Staged.find(name) != m_Staged.end();
+}
+
+bool TextureAtlas::Build(int padding, int maxSize, bool gammaCorrected) {
+    if (m_Staged.empty()) {
+        return false;
+    }
+    
+    // Sorted names keep the layout stable between runs
+    std::vector<std::string> names;
+    names.reserve(m_Staged.size());
+    for (const auto& pair : m_Staged) {
+        names.push_back(pair.first);
+    }
+    std::sort(names.begin(), names.end());
+    
+    std::vector<AtlasRect> sizes;
+    sizes.reserve(names.size());
+    for (const auto& name : names) {
+        const StagedImage& image = m_Staged[name];
+        sizes.push_back({ 0, 0, image.width, image.height });
+    }
+    
+    int width = 0;
+    int height = 0;
+    if (!AtlasPacker::ChooseSize(sizes, padding, maxSize, width, height)) {
+        Log::Error("Texture atlas: " + std::to_string(names.size()) + " images do not fit in " +
+                   std::to_string(maxSize) + "x" + std::to_string(maxSize));
+        return false;
+    }
+    
+    AtlasPacker packer(width, height, padding);
+    std::vector<AtlasRect> rects;
+    packer.InsertBatch(sizes, rects);
+    
+    // Compose the page, extruding edge texels into the padding
+    std::vector<uint8_t> page(static_cast<size_t>(width) * static_cast<size_t>(height) * 4, 0);
+    for (size_t i = 0; i < names.size(); ++i) {
+        const StagedImage& image = m_Staged[names[i]];
+        const AtlasRect& rect = rects[i];
+        
+        int x0 = std::max(rect.x - padding, 0);
+        int y0 = std::max(rect.y - padding, 0);
+        int x1 = std::min(rect.x + rect.width + padding, width);
+        int y1 = std::min(rect.y + rect.height + padding, height);
+        for (int y = y0; y < y1; ++y) {
+            int sy = std::clamp(y - rect.y, 0, image.height - 1);
+            const uint8_t* srcRow = image.pixels.data() + static_cast<size_t>(sy) * image.width * 4;
+            uint8_t* dstRow = page.data() + (static_cast<size_t>(y) * width) * 4;
+            
+            std::memcpy(dstRow + static_cast<size_t>(rect.x) * 4, srcRow, static_cast<size_t>(image.width) * 4);
+            for (int x = x0; x < rect.x; ++x) {
+                std::memcpy(dstRow + static_cast<size_t>(x) * 4, srcRow, 4);
+            }
+            for (int x = rect.x + rect.width; x < x1; ++x) {
+                std::memcpy(dstRow + static_cast<size_t>(x) * 4, srcRow + static_cast<size_t>(image.width - 1) * 4, 4);
+            }
+        }
+    }
+    
+    // A mip level only stays clean while the padding still covers a texel
+    int mipCount = 1;
+    for (int p = padding; p > 1 && mipCount < 4; p >>= 1) {
+        ++mipCount;
+    }
+    
+    Release();
+    glGenTextures(1, &m_RendererID);
+    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+    glTexStorage2D(GL_TEXTURE_2D, mipCount, gammaCorrected ? GL_SRGB8_ALPHA8 : GL_RGBA8, width, height);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, page.data());
+    if (mipCount > 1) {
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, mipCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    
+    m_Width = width;
+    m_Height = height;
+    m_Regions.clear();
+    for (size_t i = 0; i < names.size(); ++i) {
+        AtlasRegion region;
+        region.rect = rects[i];
+        region.uv = AtlasPacker::ToUV(rects[i], width, height);
+        m_Regions[names[i]] = region;
+    }
+    
+    Log::Info("Built texture atlas: " + std::to_string(names.size()) + " images in " +
+              std::to_string(width) + "x" + std::to_string(height) + " (" +
+              std::to_string(static_cast<int>(packer.GetOccupancy() * 100.0f)) + "% used)");
+    return true;
+}
+
+void TextureAtlas::Release() {
+    if (m_RendererID != 0) {
+        glDeleteTextures(1, &m_RendererID);
+        m_RendererID = 0;
+    }
+    m_Regions.clear();
+    m_Width = 0;
+    m_Height = 0;
+}
+
+const AtlasRegion* TextureAtlas::GetRegion(const std::string& name) const {
+    auto it = m_Regions.find(name);
+    return it != m_Regions.end() ? &it->second : nullptr;
+}
+
+} // namespace LGE
@@ -21,19 +21,41 @@ For more information, visit: https://nexelgames.com/luma-engine
 */
 
 #include "LGE/rendering/TextureManager.h"
+#include "LGE/rendering/TextureStreamer.h"
 #include "LGE/core/Log.h"
 #include <algorithm>
+#include <cctype>
 #include <filesystem>
 
 namespace LGE {
 
-TextureManager::TextureManager() {
+TextureManager::TextureManager()
+    : m_Streamer(nullptr)
+{
 }
 
 TextureManager::~TextureManager() {
+    SetStreamer(nullptr);
     Clear();
 }
 
+void TextureManager::SetStreamer(TextureStreamer* streamer) {
+    if (m_Streamer) {
+        m_Streamer->SetFailureCallback(nullptr);
+    }
+    m_Streamer = streamer;
+    if (m_Streamer) {
+        m_Streamer->SetFailureCallback([this](const Texture& texture, const std::string& path) {
+            // Only if the cache still holds that texture; it may have been reloaded since
+            auto it = m_TextureCache.find(path);
+            if (it != m_TextureCache.end() && it->second.get() == &texture) {
+                m_TextureCache.erase(it);
+                Log::Warn("Evicted texture that failed to stream: " + path);
+            }
+        });
+    }
+}
+
 std::string TextureManager::NormalizePath(const std::string& filepath) const {
     try {
         // Convert to absolute path and normalize
@@ -91,6 +113,26 @@ std::shared_ptr<Texture> TextureManager::Load(const TextureSpec& spec) {
         return it->second;
     }
     
+    // LDR images stream in the background; HDR/EXR still load synchronously
+    std::string ext = normalized.substr(normalized.find_last_of(".") + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    if (m_Streamer && m_Streamer->IsInitialized() && ext != "hdr" && ext != "exr") {
+        // A missing file fails now, as a synchronous load would; read and decode
+        // errors surface later through the streamer's failure callback
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(normalized, ec)) {
+            Log::Error("Failed to load texture: " + normalized);
+            return nullptr;
+        }
+        
+        TextureSpec streamSpec = spec;
+        streamSpec.filepath = normalized;
+        auto texture = m_Streamer->Stream(streamSpec);
+        m_TextureCache[normalized] = texture;
+        Log::Info("Streaming texture: " + normalized);
+        return texture;
+    }
+    
     // Create new texture
     auto texture = std::make_shared<Texture>();
     if (!texture->Load(spec)) {
@@ -128,6 +170,12 @@ void TextureManager::Unload(const std::string& filepath) {
     }
 }
 
+void TextureManager::ReportScreenSize(const Texture& texture, float screenPixels) {
+    if (m_Streamer) {
+        m_Streamer->ReportScreenSize(texture, screenPixels);
+    }
+}
+
 void TextureManager::Clear() {
     m_TextureCache.clear();
     Log::Info("Cleared texture cache");
@@ -0,0 +1,308 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/TextureResidency.h"
+#include <algorithm>
+#include <cmath>
+
+namespace LGE {
+
+TextureResidency::TextureResidency()
+    : m_NextHandle(1)
+    , m_FrameIndex(0)
+    , m_Budget(512ull * 1024 * 1024)
+    , m_ResidentBytes(0)
+    , m_InFlightBytes(0)
+    , m_PinnedMipSize(64)
+    , m_IdleFrames(300)
+{
+}
+
+uint32_t TextureResidency::Register(const TextureResidencyDesc& desc) {
+    Entry entry;
+    entry.desc = desc;
+    entry.desc.mipCount = std::max(1u, desc.mipCount);
+    entry.residentMip = entry.desc.mipCount;
+    entry.requestedMip = entry.desc.mipCount;
+    entry.frameRequest = entry.desc.mipCount;
+    entry.lastUsedFrame = m_FrameIndex;
+    
+    // Coarsest mip is always pinned, plus any level that fits m_PinnedMipSize
+    entry.pinnedMip = entry.desc.mipCount - 1;
+    for (uint32_t mip = 0; mip < entry.desc.mipCount; ++mip) {
+        if (std::max(desc.width >> mip, desc.height >> mip) <= m_PinnedMipSize) {
+            entry.pinnedMip = mip;
+            break;
+        }
+    }
+    entry.desiredMip = entry.pinnedMip;
+    
+    uint32_t handle = m_NextHandle++;
+    m_Entries.emplace(handle, entry);
+    return handle;
+}
+
+void TextureResidency::Unregister(uint32_t handle) {
+    auto it = m_Entries.find(handle);
+    if (it == m_Entries.end()) {
+        return;
+    }
+    
+    const Entry& entry = it->second;
+    for (uint32_t mip = entry.requestedMip; mip < entry.desc.mipCount; ++mip) {
+        uint64_t bytes = GetMipBytes(entry.desc, mip);
+        if (mip < entry.residentMip && !(entry.arrivedMask & (1u << mip))) {
+            m_InFlightBytes -= bytes;
+        } else {
+            m_ResidentBytes -= bytes;
+        }
+    }
+    m_Entries.erase(it);
+}
+
+void TextureResidency::RequestMip(uint32_t handle, uint32_t mip) {
+    auto it = m_Entries.find(handle);
+    if (it != m_Entries.end()) {
+        it->second.frameRequest = std::min(it->second.frameRequest, std::min(mip, it->second.desc.mipCount - 1));
+    }
+}
+
+void TextureResidency::ReportScreenSize(uint32_t handle, float screenPixels) {
+    auto it = m_Entries.find(handle);
+    if (it != m_Entries.end()) {
+        const TextureResidencyDesc& desc = it->second.desc;
+        RequestMip(handle, ComputeDesiredMip(desc.width, desc.height, desc.mipCount, screenPixels));
+    }
+}
+
+uint32_t TextureResidency::ComputeDesiredMip(uint32_t width, uint32_t height, uint32_t mipCount, float screenPixels) {
+    if (mipCount <= 1 || screenPixels <= 0.0f) {
+        return mipCount > 0 ? mipCount - 1 : 0;
+    }
+    
+    // Texels per screen pixel along the largest axis; round down to keep detail
+    float ratio = static_cast<float>(std::max(width, height)) / screenPixels;
+    if (ratio <= 1.0f) {
+        return 0;
+    }
+    uint32_t mip = static_cast<uint32_t>(std::floor(std::log2(ratio)));
+    return std::min(mip, mipCount - 1);
+}
+
+uint64_t TextureResidency::GetMipBytes(const TextureResidencyDesc& desc, uint32_t mip) {
+    uint64_t width = std::max(1u, desc.width >> mip);
+    uint64_t height = std::max(1u, desc.height >> mip);
+    return width * height * desc.bytesPerPixel;
+}
+
+void TextureResidency::Evict(uint32_t handle, Entry& entry, std::vector<MipTransfer>& outEvictions) {
+    uint64_t bytes = GetMipBytes(entry.desc, entry.residentMip);
+    outEvictions.push_back({handle, entry.residentMip, bytes});
+    m_ResidentBytes -= bytes;
+    entry.residentMip++;
+    entry.requestedMip = entry.residentMip;
+}
+
+bool TextureResidency::MakeRoom(uint64_t bytes, uint32_t requester, std::vector<MipTransfer>& outEvictions) {
+    if (m_ResidentBytes + m_InFlightBytes + bytes <= m_Budget) {
+        return true;
+    }
+    
+    // Victims: textures with droppable (non-pinned, settled) mips that are either
+    // finer than needed or less recently used than the requester
+    const uint64_t requesterLastUsed = m_Entries.at(requester).lastUsedFrame;
+    std::vector<std::pair<uint32_t, Entry*>> victims;
+    uint64_t reclaimable = 0;
+    for (auto& [handle, entry] : m_Entries) {
+        if (handle == requester || entry.requestedMip != entry.residentMip || entry.residentMip >= entry.pinnedMip) {
+            continue;
+        }
+        if (entry.residentMip >= entry.desiredMip && entry.lastUsedFrame >= requesterLastUsed) {
+            continue;
+        }
+        victims.emplace_back(handle, &entry);
+        for (uint32_t mip = entry.residentMip; mip < entry.pinnedMip; ++mip) {
+            reclaimable += GetMipBytes(entry.desc, mip);
+        }
+    }
+    
+    // Do not evict anything unless the request can actually be satisfied
+    if (m_ResidentBytes + m_InFlightBytes - reclaimable + bytes > m_Budget) {
+        return false;
+    }
+    
+    // Over-resident textures first, then least recently used
+    std::sort(victims.begin(), victims.end(), [](const auto& a, const auto& b) {
+        bool aOver = a.second->residentMip < a.second->desiredMip;
+        bool bOver = b.second->residentMip < b.second->desiredMip;
+        if (aOver != bOver) return aOver;
+        if (a.second->lastUsedFrame != b.second->lastUsedFrame) return a.second->lastUsedFrame < b.second->lastUsedFrame;
+        return a.first < b.first;
+    });
+    
+    for (auto& [handle, entry] : victims) {
+        while (entry->residentMip < entry->pinnedMip && m_ResidentBytes + m_InFlightBytes + bytes > m_Budget) {
+            Evict(handle, *entry, outEvictions);
+        }
+        // Keep the victim from immediately streaming the evicted mips back in
+        entry->desiredMip = std::max(entry->desiredMip, entry->residentMip);
+        if (m_ResidentBytes + m_InFlightBytes + bytes <= m_Budget) {
+            break;
+        }
+    }
+    return true;
+}
+
+void TextureResidency::Update(uint32_t maxUploads, uint64_t maxUploadBytes,
+                              std::vector<MipTransfer>& outUploads, std::vector<MipTransfer>& outEvictions) {
+    m_FrameIndex++;
+    
+    // Fold this frame's feedback into the desired mips
+    for (auto& [handle, entry] : m_Entries) {
+        if (entry.frameRequest < entry.desc.mipCount) {
+            entry.desiredMip = std::min(entry.frameRequest, entry.pinnedMip);
+            entry.lastUsedFrame = m_FrameIndex;
+        } else if (m_FrameIndex - entry.lastUsedFrame > m_IdleFrames) {
+            entry.desiredMip = entry.pinnedMip;
+        }
+        entry.frameRequest = entry.desc.mipCount;
+        
+        // Trim textures that are two or more levels finer than needed (one
+        // level of hysteresis avoids thrashing on small zoom changes)
+        while (entry.requestedMip == entry.residentMip && entry.residentMip + 1 < entry.desiredMip) {
+            Evict(handle, entry, outEvictions);
+        }
+    }
+    
+    // Upload candidates: missing pinned mips first, then the largest gap
+    // between resident and desired, then the most recently used
+    struct Candidate {
+        uint32_t handle;
+        bool needsPinned;
+        uint32_t gap;
+        uint64_t lastUsed;
+    };
+    auto higherPriority = [](const Candidate& a, const Candidate& b) {
+        if (a.needsPinned != b.needsPinned) return a.needsPinned;
+        if (a.gap != b.gap) return a.gap > b.gap;
+        if (a.lastUsed != b.lastUsed) return a.lastUsed > b.lastUsed;
+        return a.handle < b.handle;
+    };
+    
+    std::vector<Candidate> candidates;
+    for (const auto& [handle, entry] : m_Entries) {
+        if (entry.requestedMip > entry.desiredMip) {
+            candidates.push_back({handle, entry.requestedMip > entry.pinnedMip,
+                                  entry.requestedMip - entry.desiredMip, entry.lastUsedFrame});
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), higherPriority);
+    
+    // One mip per texture per pass so a single large texture cannot starve the rest
+    uint64_t frameBytes = 0;
+    uint32_t frameUploads = 0;
+    bool progressed = true;
+    while (progressed && frameUploads < maxUploads) {
+        progressed = false;
+        for (const Candidate& candidate : candidates) {
+            if (frameUploads >= maxUploads) {
+                break;
+            }
+            
+            Entry& entry = m_Entries.at(candidate.handle);
+            if (entry.requestedMip <= entry.desiredMip) {
+                continue;
+            }
+            
+            uint32_t mip = entry.requestedMip - 1;
+            uint64_t bytes = GetMipBytes(entry.desc, mip);
+            
+            // A mip larger than the per-frame allowance still goes out when it is
+            // the first of the frame; the streamer splits it across frames
+            if (frameUploads > 0 && frameBytes + bytes > maxUploadBytes) {
+                continue;
+            }
+            
+            bool pinned = mip >= entry.pinnedMip;
+            if (!pinned && !MakeRoom(bytes, candidate.handle, outEvictions)) {
+                continue;
+            }
+            
+            outUploads.push_back({candidate.handle, mip, bytes});
+            entry.requestedMip = mip;
+            m_InFlightBytes += bytes;
+            frameBytes += bytes;
+            frameUploads++;
+            progressed = true;
+        }
+    }
+}
+
+void TextureResidency::MarkResident(uint32_t handle, uint32_t mip) {
+    auto it = m_Entries.find(handle);
+    if (it == m_Entries.end()) {
+        return;
+    }
+    
+    // Levels outside the in-flight range (evicted, unregistered or already
+    // completed) hold no in-flight bytes, so a stale completion is dropped
+    Entry& entry = it->second;
+    const uint32_t bit = 1u << mip;
+    if (mip >= entry.residentMip || mip < entry.requestedMip || (entry.arrivedMask & bit)) {
+        return;
+    }
+    
+    uint64_t bytes = GetMipBytes(entry.desc, mip);
+    m_InFlightBytes -= bytes;
+    m_ResidentBytes += bytes;
+    
+    // A finer level can land before a coarser one; it counts as resident
+    // immediately but residentMip only advances once the tail is contiguous
+    entry.arrivedMask |= bit;
+    while (entry.residentMip > entry.requestedMip && (entry.arrivedMask & (1u << (entry.residentMip - 1)))) {
+        entry.residentMip--;
+        entry.arrivedMask &= ~(1u << entry.residentMip);
+    }
+}
+
+uint32_t TextureResidency::GetResidentMip(uint32_t handle) const {
+    auto it = m_Entries.find(handle);
+    return it != m_Entries.end() ? it->second.residentMip : 0;
+}
+
+uint32_t TextureResidency::GetDesiredMip(uint32_t handle) const {
+    auto it = m_Entries.find(handle);
+    return it != m_Entries.end() ? it->second.desiredMip : 0;
+}
+
+uint32_t TextureResidency::GetPinnedMip(uint32_t handle) const {
+    auto it = m_Entries.find(handle);
+    return it != m_Entries.end() ? it->second.pinnedMip : 0;
+}
+
+bool TextureResidency::HasPendingUploads(uint32_t handle) const {
+    auto it = m_Entries.find(handle);
+    return it != m_Entries.end() && it->second.requestedMip < it->second.residentMip;
+}
+
+} // namespace LGE
@@ -0,0 +1,531 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/rendering/TextureStreamer.h"
+#include "LGE/core/Log.h"
+#include "LGE/core/Profiling.h"
+#include "LGE/core/filesystem/AsyncFileIO.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#include "../../third_party/stb_image.h"
+
+namespace LGE {
+
+namespace {
+
+// sRGB <-> linear so gamma-corrected mips are averaged in linear space
+const std::array<float, 256>& GetSRGBToLinearTable() {
+    static const std::array<float, 256> table = [] {
+        std::array<float, 256> values{};
+        for (int i = 0; i < 256; ++i) {
+            float c = i / 255.0f;
+            values[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+        return values;
+    }();
+    return table;
+}
+
+uint8_t LinearToSRGB(float value) {
+    value = std::max(0.0f, std::min(1.0f, value));
+    float c = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+    return static_cast<uint8_t>(c * 255.0f + 0.5f);
+}
+
+// 2x2 box filter of an RGBA8 level (odd edges clamp)
+void Downsample(const std::vector<uint8_t>& src, uint32_t srcWidth, uint32_t srcHeight,
+                std::vector<uint8_t>& dst, uint32_t dstWidth, uint32_t dstHeight, bool srgb) {
+    const auto& toLinear = GetSRGBToLinearTable();
+    dst.resize(static_cast<size_t>(dstWidth) * dstHeight * 4);
+    
+    for (uint32_t y = 0; y < dstHeight; ++y) {
+        uint32_t y0 = std::min(y * 2, srcHeight - 1);
+        uint32_t y1 = std::min(y0 + 1, srcHeight - 1);
+        for (uint32_t x = 0; x < dstWidth; ++x) {
+            uint32_t x0 = std::min(x * 2, srcWidth - 1);
+            uint32_t x1 = std::min(x0 + 1, srcWidth - 1);
+            const uint8_t* p[4] = {
+                &src[(static_cast<size_t>(y0) * srcWidth + x0) * 4],
+                &src[(static_cast<size_t>(y0) * srcWidth + x1) * 4],
+                &src[(static_cast<size_t>(y1) * srcWidth + x0) * 4],
+                &src[(static_cast<size_t>(y1) * srcWidth + x1) * 4]
+            };
+            uint8_t* out = &dst[(static_cast<size_t>(y) * dstWidth + x) * 4];
+            
+            for (int c = 0; c < 3; ++c) {
+                if (srgb) {
+                    float sum = toLinear[p[0][c]] + toLinear[p[1][c]] + toLinear[p[2][c]] + toLinear[p[3][c]];
+                    out[c] = LinearToSRGB(sum * 0.25f);
+                } else {
+                    out[c] = static_cast<uint8_t>((p[0][c] + p[1][c] + p[2][c] + p[3][c] + 2) / 4);
+                }
+            }
+            out[3] = static_cast<uint8_t>((p[0][3] + p[1][3] + p[2][3] + p[3][3] + 2) / 4);
+        }
+    }
+}
+
+} // namespace
+
+TextureStreamer::TextureStreamer()
+    : m_PixelBuffer(0)
+    , m_MappedRing(nullptr)
+    , m_SegmentBytes(0)
+    , m_CurrentSegment(0)
+{
+}
+
+TextureStreamer::~TextureStreamer() {
+    Shutdown();
+}
+
+bool TextureStreamer::Initialize(uint64_t budgetBytes, uint32_t ringSegments, uint32_t segmentBytes) {
+    if (IsInitialized()) {
+        return true;
+    }
+    
+    m_SegmentBytes = std::max(segmentBytes, 64u * 1024u) & ~3u;
+    ringSegments = std::max(ringSegments, 2u);
+    GLsizeiptr ringBytes = static_cast<GLsizeiptr>(m_SegmentBytes) * ringSegments;
+    
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glGenBuffers(1, &m_PixelBuffer);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_PixelBuffer);
+    glBufferStorage(GL_PIXEL_UNPACK_BUFFER, ringBytes, nullptr, flags);
+    m_MappedRing = static_cast<uint8_t*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, ringBytes, flags));
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    
+    if (!m_MappedRing) {
+        Log::Error("TextureStreamer: failed to map the upload ring");
+        glDeleteBuffers(1, &m_PixelBuffer);
+        m_PixelBuffer = 0;
+        return false;
+    }
+    
+    m_SegmentFences.assign(ringSegments, nullptr);
+    m_CurrentSegment = 0;
+    m_Residency.SetBudget(budgetBytes);
+    
+    Log::Info("TextureStreamer initialized (" + std::to_string(ringBytes / (1024 * 1024)) + " MB upload ring, " +
+              std::to_string(budgetBytes / (1024 * 1024)) + " MB budget)");
+    return true;
+}
+
+void TextureStreamer::Shutdown() {
+    if (!IsInitialized()) {
+        return;
+    }
+    
+    for (void*& fence : m_SegmentFences) {
+        if (fence) {
+            glClientWaitSync(static_cast<GLsync>(fence), GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+            glDeleteSync(static_cast<GLsync>(fence));
+            fence = nullptr;
+        }
+    }
+    
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_PixelBuffer);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glDeleteBuffers(1, &m_PixelBuffer);
+    m_PixelBuffer = 0;
+    m_MappedRing = nullptr;
+    
+    // Textures keep whatever storage they have; they own (and delete) it
+    for (auto& [key, entry] : m_Entries) {
+        if (entry.handle != TextureResidency::InvalidHandle) {
+            m_Residency.Unregister(entry.handle);
+        }
+    }
+    m_Entries.clear();
+    m_HandleToKey.clear();
+    m_UploadQueue.clear();
+}
+
+std::shared_ptr<Texture> TextureStreamer::Stream(const TextureSpec& spec) {
+    auto texture = std::make_shared<Texture>();
+    texture->m_FilePath = spec.filepath;
+    texture->m_GammaCorrected = spec.gammaCorrected;
+    texture->m_MinFilter = spec.minFilter;
+    texture->m_MagFilter = spec.magFilter;
+    texture->m_WrapS = spec.wrapS;
+    texture->m_WrapT = spec.wrapT;
+    texture->m_IsHDR = false;
+    
+    // A previous texture at this address has been destroyed
+    RemoveEntry(texture.get());
+    
+    Entry entry;
+    entry.texture = texture;
+    entry.spec = spec;
+    entry.decode = std::make_shared<DecodeState>();
+    
+    std::shared_ptr<DecodeState> state = entry.decode;
+    bool generateMipmaps = spec.generateMipmaps;
+    bool srgb = spec.gammaCorrected;
+    
+    // The read is queued at high priority so visible textures are not stuck behind
+    // bulk loads; the decode then runs on a JobSystem worker straight from the I/O buffer
+    IOReadRequest request;
+    request.path = spec.filepath;
+    request.priority = IOPriority::High;
+    request.context = IOCompletionContext::JobSystem;
+    request.onComplete = [state, generateMipmaps, srgb](const IOReadResult& result) {
+        LGE_PROFILE_SCOPE("TextureStreamer::Decode");
+        std::string error;
+        std::shared_ptr<DecodedImage> image;
+        if (result.success) {
+            image = DecodeImage(result.data, result.size, generateMipmaps, srgb, error);
+        } else {
+            error = std::string("can't open file (") + std::strerror(result.error) + ")";
+        }
+        
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->image = std::move(image);
+        state->error = std::move(error);
+        state->done = true;
+    };
+    AsyncFileIO::Get().Submit(std::move(request));
+    
+    m_Entries.emplace(texture.get(), std::move(entry));
+    return texture;
+}
+
+std::shared_ptr<TextureStreamer::DecodedImage> TextureStreamer::DecodeImage(const uint8_t* bytes, size_t size, bool generateMipmaps, bool srgb, std::string& error) {
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    unsigned char* data = stbi_load_from_memory(bytes, static_cast<int>(size), &width, &height, &channels, 4); // Force RGBA
+    if (!data) {
+        const char* reason = stbi_failure_reason();
+        error = reason ? reason : "unknown error";
+        return nullptr;
+    }
+    
+    auto image = std::make_shared<DecodedImage>();
+    image->width = static_cast<uint32_t>(width);
+    image->height = static_cast<uint32_t>(height);
+    image->mips.emplace_back(data, data + static_cast<size_t>(width) * height * 4);
+    stbi_image_free(data);
+    
+    if (generateMipmaps) {
+        uint32_t mipWidth = image->width;
+        uint32_t mipHeight = image->height;
+        while (mipWidth > 1 || mipHeight > 1) {
+            uint32_t nextWidth = std::max(1u, mipWidth / 2);
+            uint32_t nextHeight = std::max(1u, mipHeight / 2);
+            std::vector<uint8_t> next;
+            Downsample(image->mips.back(), mipWidth, mipHeight, next, nextWidth, nextHeight, srgb);
+            image->mips.push_back(std::move(next));
+            mipWidth = nextWidth;
+            mipHeight = nextHeight;
+        }
+    }
+    
+    return image;
+}
+
+bool TextureStreamer::IsStreamed(const Texture& texture) const {
+    return m_Entries.find(&texture) != m_Entries.end();
+}
+
+void TextureStreamer::ReportScreenSize(const Texture& texture, float screenPixels) {
+    auto it = m_Entries.find(&texture);
+    if (it != m_Entries.end() && it->second.handle != TextureResidency::InvalidHandle) {
+        m_Residency.ReportScreenSize(it->second.handle, screenPixels);
+    }
+}
+
+void TextureStreamer::RemoveEntry(const Texture* key) {
+    auto it = m_Entries.find(key);
+    if (it == m_Entries.end()) {
+        return;
+    }
+    
+    if (it->second.handle != TextureResidency::InvalidHandle) {
+        m_Residency.Unregister(it->second.handle);
+        m_HandleToKey.erase(it->second.handle);
+    }
+    m_UploadQueue.erase(std::remove_if(m_UploadQueue.begin(), m_UploadQueue.end(),
+                                       [key](const PendingUpload& upload) { return upload.key == key; }),
+                        m_UploadQueue.end());
+    m_Entries.erase(it);
+}
+
+void TextureStreamer::ResizeStorage(Entry& entry, Texture& texture, uint32_t topMip) {
+    const uint32_t mipCount = static_cast<uint32_t>(entry.image->mips.size());
+    const uint32_t levels = mipCount - topMip;
+    const uint32_t residentMip = m_Residency.GetResidentMip(entry.handle);
+    
+    GLuint storage = 0;
+    glGenTextures(1, &storage);
+    glBindTexture(GL_TEXTURE_2D, storage);
+    glTexStorage2D(GL_TEXTURE_2D, levels, entry.spec.gammaCorrected ? GL_SRGB8_ALPHA8 : GL_RGBA8,
+                   std::max(1u, entry.image->width >> topMip), std::max(1u, entry.image->height >> topMip));
+    
+    // Carry resident levels over on the GPU; nothing is re-uploaded
+    if (entry.storageID != 0) {
+        for (uint32_t mip = std::max({residentMip, topMip, entry.storageTopMip}); mip < mipCount; ++mip) {
+            glCopyImageSubData(entry.storageID, GL_TEXTURE_2D, mip - entry.storageTopMip, 0, 0, 0,
+                               storage, GL_TEXTURE_2D, mip - topMip, 0, 0, 0,
+                               std::max(1u, entry.image->width >> mip), std::max(1u, entry.image->height >> mip), 1);
+        }
+        glDeleteTextures(1, &entry.storageID);
+    }
+    
+    entry.storageID = storage;
+    entry.storageTopMip = topMip;
+    texture.m_RendererID = storage;
+    ApplyLevelRange(entry, texture);
+}
+
+void TextureStreamer::ApplyLevelRange(Entry& entry, Texture& texture) {
+    const uint32_t mipCount = static_cast<uint32_t>(entry.image->mips.size());
+    const uint32_t residentMip = std::min(m_Residency.GetResidentMip(entry.handle), mipCount - 1);
+    
+    // Only sample resident levels
+    glBindTexture(GL_TEXTURE_2D, entry.storageID);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(residentMip - std::min(residentMip, entry.storageTopMip)));
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(mipCount - 1 - entry.storageTopMip));
+    texture.ApplyTextureParameters();
+}
+
+void TextureStreamer::Update() {
+    LGE_PROFILE_SCOPE("TextureStreamer::Update");
+    if (!IsInitialized()) {
+        return;
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    m_Stats.uploadsThisFrame = 0;
+    m_Stats.uploadBytesThisFrame = 0;
+    m_Stats.evictionsThisFrame = 0;
+    m_Stats.pendingDecodes = 0;
+    
+    // Drop textures that have been released, adopt finished decodes
+    std::vector<const Texture*> expired;
+    std::vector<std::pair<std::shared_ptr<Texture>, std::string>> failed;
+    for (auto& [key, entry] : m_Entries) {
+        std::shared_ptr<Texture> texture = entry.texture.lock();
+        if (!texture) {
+            expired.push_back(key);
+            continue;
+        }
+        
+        if (!entry.decode) {
+            continue;
+        }
+        
+        std::shared_ptr<DecodedImage> image;
+        std::string error;
+        {
+            std::lock_guard<std::mutex> lock(entry.decode->mutex);
+            if (!entry.decode->done) {
+                m_Stats.pendingDecodes++;
+                continue;
+            }
+            image = std::move(entry.decode->image);
+            error = entry.decode->error;
+        }
+        entry.decode.reset();
+        
+        if (!image) {
+            Log::Error("TextureStreamer: failed to load " + entry.spec.filepath + " - " + error);
+            expired.push_back(key);
+            failed.emplace_back(texture, entry.spec.filepath);
+            continue;
+        }
+        
+        entry.image = std::move(image);
+        texture->m_Width = static_cast<int>(entry.image->width);
+        texture->m_Height = static_cast<int>(entry.image->height);
+        
+        TextureResidencyDesc desc;
+        desc.width = entry.image->width;
+        desc.height = entry.image->height;
+        desc.mipCount = static_cast<uint32_t>(entry.image->mips.size());
+        entry.handle = m_Residency.Register(desc);
+        m_HandleToKey[entry.handle] = key;
+    }
+    for (const Texture* key : expired) {
+        RemoveEntry(key);
+    }
+    // After the entries are gone: the callback may drop the last reference
+    if (m_OnFailure) {
+        for (const auto& [texture, path] : failed) {
+            m_OnFailure(*texture, path);
+        }
+    }
+    
+    // Plan: at most one ring segment of new uploads per frame, and none while
+    // the queue already holds a segment's worth (large mips drain over frames)
+    uint64_t queuedBytes = 0;
+    for (const PendingUpload& upload : m_UploadQueue) {
+        auto it = m_Entries.find(upload.key);
+        if (it != m_Entries.end() && it->second.image) {
+            uint32_t width = std::max(1u, it->second.image->width >> upload.mip);
+            uint32_t height = std::max(1u, it->second.image->height >> upload.mip);
+            queuedBytes += static_cast<uint64_t>(width) * (height - upload.rowsDone) * 4;
+        }
+    }
+    uint32_t maxUploads = queuedBytes < m_SegmentBytes ? 64 : 0;
+    
+    std::vector<MipTransfer> uploads;
+    std::vector<MipTransfer> evictions;
+    m_Residency.Update(maxUploads, m_SegmentBytes - std::min<uint64_t>(queuedBytes, m_SegmentBytes), uploads, evictions);
+    
+    // Evictions release VRAM by shrinking the immutable storage
+    std::vector<const Texture*> shrunk;
+    for (const MipTransfer& eviction : evictions) {
+        auto key = m_HandleToKey.find(eviction.handle);
+        if (key != m_HandleToKey.end() && std::find(shrunk.begin(), shrunk.end(), key->second) == shrunk.end()) {
+            shrunk.push_back(key->second);
+        }
+    }
+    for (const Texture* key : shrunk) {
+        Entry& entry = m_Entries.at(key);
+        std::shared_ptr<Texture> texture = entry.texture.lock();
+        uint32_t residentMip = m_Residency.GetResidentMip(entry.handle);
+        if (texture && entry.storageID != 0 && residentMip > entry.storageTopMip) {
+            ResizeStorage(entry, *texture, residentMip);
+        }
+    }
+    m_Stats.evictionsThisFrame = static_cast<uint32_t>(evictions.size());
+    
+    for (const MipTransfer& upload : uploads) {
+        auto key = m_HandleToKey.find(upload.handle);
+        if (key != m_HandleToKey.end()) {
+            m_UploadQueue.push_back({key->second, upload.mip, 0});
+        }
+    }
+    
+    ProcessUploads();
+    
+    m_Stats.streamedTextures = static_cast<uint32_t>(m_Entries.size());
+    m_Stats.residentBytes = m_Residency.GetResidentBytes();
+    m_Stats.budgetBytes = m_Residency.GetBudget();
+    m_Stats.queuedUploads = static_cast<uint32_t>(m_UploadQueue.size());
+    RecordFrameTime(std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count());
+}
+
+void TextureStreamer::ProcessUploads() {
+    if (m_UploadQueue.empty()) {
+        return;
+    }
+    
+    // Never block on the GPU: if this segment is still being read, try next frame
+    void*& fence = m_SegmentFences[m_CurrentSegment];
+    if (fence) {
+        GLenum status = glClientWaitSync(static_cast<GLsync>(fence), 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED) {
+            m_Stats.ringStalls++;
+            return;
+        }
+        glDeleteSync(static_cast<GLsync>(fence));
+        fence = nullptr;
+    }
+    
+    const size_t segmentOffset = static_cast<size_t>(m_CurrentSegment) * m_SegmentBytes;
+    uint8_t* segment = m_MappedRing + segmentOffset;
+    size_t used = 0;
+    
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_PixelBuffer);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    
+    while (!m_UploadQueue.empty()) {
+        PendingUpload& upload = m_UploadQueue.front();
+        auto it = m_Entries.find(upload.key);
+        std::shared_ptr<Texture> texture = it != m_Entries.end() ? it->second.texture.lock() : nullptr;
+        if (!texture) {
+            m_UploadQueue.pop_front();
+            continue;
+        }
+        Entry& entry = it->second;
+        
+        // Allocate up front for everything the texture currently wants
+        if (upload.rowsDone == 0 && (entry.storageID == 0 || upload.mip < entry.storageTopMip)) {
+            ResizeStorage(entry, *texture, std::min(upload.mip, m_Residency.GetDesiredMip(entry.handle)));
+        }
+        
+        const uint32_t width = std::max(1u, entry.image->width >> upload.mip);
+        const uint32_t height = std::max(1u, entry.image->height >> upload.mip);
+        const size_t rowBytes = static_cast<size_t>(width) * 4;
+        
+        // Large mips are split by rows across frames to keep the per-frame cost flat
+        uint32_t rows = std::min<uint32_t>(height - upload.rowsDone, static_cast<uint32_t>((m_SegmentBytes - used) / rowBytes));
+        if (rows == 0) {
+            break;
+        }
+        
+        const uint8_t* source = entry.image->mips[upload.mip].data() + upload.rowsDone * rowBytes;
+        std::memcpy(segment + used, source, rows * rowBytes);
+        
+        glBindTexture(GL_TEXTURE_2D, entry.storageID);
+        glTexSubImage2D(GL_TEXTURE_2D, upload.mip - entry.storageTopMip, 0, upload.rowsDone, width, rows,
+                        GL_RGBA, GL_UNSIGNED_BYTE, reinterpret_cast<const void*>(segmentOffset + used));
+        
+        used += rows * rowBytes;
+        upload.rowsDone += rows;
+        m_Stats.uploadBytesThisFrame += rows * rowBytes;
+        
+        if (upload.rowsDone == height) {
+            // Commands execute in order, so the level is safe to sample from here on
+            m_Residency.MarkResident(entry.handle, upload.mip);
+            ApplyLevelRange(entry, *texture);
+            m_Stats.uploadsThisFrame++;
+            m_UploadQueue.pop_front();
+        }
+    }
+    
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    
+    if (used > 0) {
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        m_CurrentSegment = (m_CurrentSegment + 1) % static_cast<uint32_t>(m_SegmentFences.size());
+    }
+}
+
+void TextureStreamer::RecordFrameTime(float ms) {
+    m_FrameTimes.push_back(ms);
+    if (m_FrameTimes.size() > TextureStreamingStats::kStatsWindow) {
+        m_FrameTimes.pop_front();
+    }
+    
+    m_Stats.updateMs = ms;
+    m_Stats.peakUpdateMs = 0.0f;
+    m_Stats.spikeFrames = 0;
+    for (float frameMs : m_FrameTimes) {
+        m_Stats.peakUpdateMs = std::max(m_Stats.peakUpdateMs, frameMs);
+        if (frameMs > TextureStreamingStats::kSpikeThresholdMs) {
+            m_Stats.spikeFrames++;
+        }
+    }
+}
+
+} // namespace LGE
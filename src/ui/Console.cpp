@@ -23,24 +23,26 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/ui/Console.h"
 #include "LGE/core/Log.h"
 #include "imgui.h"
-#include <iomanip>
-#include <ctime>
 #include <algorithm>
+#include <cctype>
 #include <cstring>
-#include <sstream>
 
 namespace LGE {
 
 Console::Console()
-    : m_MaxLogs(1000)
+    : m_PendingSecond(-1)
+    , m_FirstSequence(0)
+    , m_NextSequence(0)
     , m_ShowTrace(true)
     , m_ShowInfo(true)
     , m_ShowWarn(true)
     , m_ShowError(true)
     , m_ShowFatal(true)
+    , m_FilterDirty(false)
     , m_AutoScroll(true)
 {
     m_SearchBuffer[0] = '\0';
+    m_PendingTime[0] = '\0';
 }
 
 Console::~Console() {
@@ -49,6 +51,7 @@ Console::~Console() {
 void Console::OnUIRender() {
     ImGui::Begin("Console", nullptr);
     
+    DrainPending();
     RenderToolbar();
     ImGui::Separator();
     RenderLogs();
@@ -74,112 +77,88 @@ void Console::RenderToolbar() {
     ImGui::SameLine();
     
     ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.5f, 0.5f, 0.5f, 1.0f));
-    ImGui::Checkbox("Trace", &m_ShowTrace);
+    m_FilterDirty |= ImGui::Checkbox("Trace", &m_ShowTrace);
     ImGui::PopStyleColor();
     ImGui::SameLine();
     
     ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(0.3f, 0.7f, 1.0f, 1.0f));
-    ImGui::Checkbox("Info", &m_ShowInfo);
+    m_FilterDirty |= ImGui::Checkbox("Info", &m_ShowInfo);
     ImGui::PopStyleColor();
     ImGui::SameLine();
     
     ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.8f, 0.0f, 1.0f));
-    ImGui::Checkbox("Warn", &m_ShowWarn);
+    m_FilterDirty |= ImGui::Checkbox("Warn", &m_ShowWarn);
     ImGui::PopStyleColor();
     ImGui::SameLine();
     
     ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.3f, 0.3f, 1.0f));
-    ImGui::Checkbox("Error", &m_ShowError);
+    m_FilterDirty |= ImGui::Checkbox("Error", &m_ShowError);
     ImGui::PopStyleColor();
     ImGui::SameLine();
     
     ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.0f, 0.0f, 1.0f));
-    ImGui::Checkbox("Fatal", &m_ShowFatal);
+    m_FilterDirty |= ImGui::Checkbox("Fatal", &m_ShowFatal);
     ImGui::PopStyleColor();
     
     // Search box
     ImGui::SameLine();
     ImGui::SetNextItemWidth(200.0f);
-    ImGui::InputText("##Search", m_SearchBuffer, sizeof(m_SearchBuffer), ImGuiInputTextFlags_EnterReturnsTrue);
+    m_FilterDirty |= ImGui::InputText("##Search", m_SearchBuffer, sizeof(m_SearchBuffer));
     if (ImGui::IsItemHovered()) {
         ImGui::SetTooltip("Search logs");
     }
 }
 
 void Console::RenderLogs() {
-    // Get filtered logs
-    std::vector<LogEntry> filteredLogs;
-    {
-        std::lock_guard<std::mutex> lock(m_LogsMutex);
-        
-        for (const auto& log : m_Logs) {
-            // Check level filter
-            bool show = false;
-            switch (log.level) {
-                case LogLevel::Trace: show = m_ShowTrace; break;
-                case LogLevel::Info:  show = m_ShowInfo; break;
-                case LogLevel::Warn:  show = m_ShowWarn; break;
-                case LogLevel::Error: show = m_ShowError; break;
-                case LogLevel::Fatal: show = m_ShowFatal; break;
-            }
-            
-            if (!show) continue;
-            
-            // Check search filter
-            if (m_SearchBuffer[0] != '\0') {
-                std::string searchLower = m_SearchBuffer;
-                std::transform(searchLower.begin(), searchLower.end(), searchLower.begin(), ::tolower);
-                
-                std::string logLower = log.message;
-                std::transform(logLower.begin(), logLower.end(), logLower.begin(), ::tolower);
-                
-                if (logLower.find(searchLower) == std::string::npos) {
-                    continue;
-                }
-            }
-            
-            filteredLogs.push_back(log);
-        }
+    // The filter is only re-evaluated when it changes; new entries are matched as they arrive
+    if (m_FilterDirty) {
+        RebuildVisible();
     }
     
     // Render logs in a child window with scrolling
     ImGui::BeginChild("Logs", ImVec2(0, 0), false, ImGuiWindowFlags_HorizontalScrollbar);
     
-    // Render each log entry with color coding
-    for (size_t i = 0; i < filteredLogs.size(); ++i) {
-        const auto& log = filteredLogs[i];
-        
-        // Get color for this log level
-        ImVec4 color = GetLogColor(log.level);
-        ImGui::PushStyleColor(ImGuiCol_Text, color);
-        
-        // Format: [timestamp] [LEVEL] message
-        std::string formatted = "[" + log.timestamp + "] " + GetLogLevelString(log.level) + " " + log.message;
-        
-        // Use Selectable for each log entry to allow selection and copying
-        // This allows clicking to select and Ctrl+C to copy
-        ImGui::PushID(static_cast<int>(i));
-        ImGui::Selectable(formatted.c_str(), false, ImGuiSelectableFlags_AllowDoubleClick);
-        
-        // Context menu for easy copying
-        if (ImGui::BeginPopupContextItem("LogContextMenu")) {
-            if (ImGui::MenuItem("Copy")) {
-                ImGui::SetClipboardText(formatted.c_str());
-            }
-            if (ImGui::MenuItem("Copy All")) {
-                // Copy all filtered logs
-                std::string allLogs;
-                for (const auto& l : filteredLogs) {
-                    allLogs += "[" + l.timestamp + "] " + GetLogLevelString(l.level) + " " + l.message + "\n";
+    // Only the rows in view are formatted and submitted
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(m_Visible.size()));
+    while (clipper.Step()) {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+            uint64_t sequence = m_Visible[static_cast<size_t>(row)];
+            const LogEntry& log = GetEntry(sequence);
+            
+            // Get color for this log level
+            ImVec4 color = GetLogColor(log.level);
+            ImGui::PushStyleColor(ImGuiCol_Text, color);
+            
+            // Format: [timestamp] [LEVEL] message
+            std::string formatted = FormatEntry(log);
+            
+            // Use Selectable for each log entry to allow selection and copying
+            // This allows clicking to select and Ctrl+C to copy
+            ImGui::PushID(static_cast<int>(sequence));
+            ImGui::Selectable(formatted.c_str(), false, ImGuiSelectableFlags_AllowDoubleClick);
+            
+            // Context menu for easy copying
+            if (ImGui::BeginPopupContextItem("LogContextMenu")) {
+                if (ImGui::MenuItem("Copy")) {
+                    ImGui::SetClipboardText(formatted.c_str());
+                }
+                if (ImGui::MenuItem("Copy All")) {
+                    // Copy all filtered logs
+                    std::string allLogs;
+                    for (uint64_t visible : m_Visible) {
+                        allLogs += FormatEntry(GetEntry(visible)) + "\n";
+                    }
+                    ImGui::SetClipboardText(allLogs.c_str());
                 }
-                ImGui::SetClipboardText(allLogs.c_str());
+                ImGui::EndPopup();
             }
-            ImGui::EndPopup();
+            
+            ImGui::PopID();
+            ImGui::PopStyleColor();
         }
-        
-        ImGui::PopID();
-        ImGui::PopStyleColor();
     }
+    clipper.End();
     
     // Auto-scroll to bottom
     if (m_AutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY() - 1.0f) {
@@ -211,28 +190,138 @@ std::string Console::GetLogLevelString(LogLevel level) const {
     }
 }
 
+std::string Console::FormatEntry(const LogEntry& entry) const {
+    return "[" + std::string(entry.timestamp) + "] " + GetLogLevelString(entry.level) + " " + entry.message;
+}
+
 void Console::AddLog(LogLevel level, const std::string& message) {
-    // Get current time
-    auto now = std::time(nullptr);
-    auto tm = *std::localtime(&now);
-    
-    char timeStr[32];
-    std::strftime(timeStr, sizeof(timeStr), "%H:%M:%S", &tm);
+    std::time_t now = std::time(nullptr);
     
     std::lock_guard<std::mutex> lock(m_LogsMutex);
     
-    m_Logs.emplace_back(level, message, std::string(timeStr));
+    // localtime only once per second
+    if (now != m_PendingSecond) {
+        m_PendingSecond = now;
+        std::strftime(m_PendingTime, sizeof(m_PendingTime), "%H:%M:%S", std::localtime(&now));
+    }
+    
+    // Nobody is drawing the console; keep the newest kCapacity entries
+    if (m_Pending.size() >= kCapacity) {
+        m_Pending.erase(m_Pending.begin(), m_Pending.begin() + m_Pending.size() / 2);
+    }
+    
+    LogEntry entry;
+    entry.level = level;
+    entry.message = message;
+    std::memcpy(entry.timestamp, m_PendingTime, sizeof(entry.timestamp));
+    m_Pending.push_back(std::move(entry));
+}
+
+void Console::DrainPending() {
+    std::vector<LogEntry> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_LogsMutex);
+        pending.swap(m_Pending);
+    }
+    for (LogEntry& entry : pending) {
+        Append(std::move(entry));
+    }
+}
+
+void Console::Append(LogEntry&& entry) {
+    // Evict the oldest entry once the ring is full
+    if (m_NextSequence - m_FirstSequence == kCapacity) {
+        std::deque<uint64_t>& levelIndex = m_LevelIndices[static_cast<int>(GetEntry(m_FirstSequence).level)];
+        if (!levelIndex.empty() && levelIndex.front() == m_FirstSequence) {
+            levelIndex.pop_front();
+        }
+        if (!m_Visible.empty() && m_Visible.front() == m_FirstSequence) {
+            m_Visible.pop_front();
+        }
+        m_FirstSequence++;
+    }
+    
+    uint64_t sequence = m_NextSequence++;
+    size_t slot = static_cast<size_t>(sequence % kCapacity);
+    m_LevelIndices[static_cast<int>(entry.level)].push_back(sequence);
+    bool visible = !m_FilterDirty && IsLevelShown(entry.level) && MatchesSearch(entry);
+    if (slot == m_Logs.size()) {
+        m_Logs.push_back(std::move(entry));
+    } else {
+        m_Logs[slot] = std::move(entry);
+    }
+    if (visible) {
+        m_Visible.push_back(sequence);
+    }
+}
+
+bool Console::IsLevelShown(LogLevel level) const {
+    switch (level) {
+        case LogLevel::Trace: return m_ShowTrace;
+        case LogLevel::Info:  return m_ShowInfo;
+        case LogLevel::Warn:  return m_ShowWarn;
+        case LogLevel::Error: return m_ShowError;
+        case LogLevel::Fatal: return m_ShowFatal;
+    }
+    return false;
+}
+
+bool Console::MatchesSearch(const LogEntry& entry) const {
+    if (m_SearchLower.empty()) {
+        return true;
+    }
+    auto it = std::search(entry.message.begin(), entry.message.end(), m_SearchLower.begin(), m_SearchLower.end(),
+        [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; });
+    return it != entry.message.end();
+}
+
+void Console::RebuildVisible() {
+    m_FilterDirty = false;
+    m_SearchLower = m_SearchBuffer;
+    std::transform(m_SearchLower.begin(), m_SearchLower.end(), m_SearchLower.begin(),
+        [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+    
+    // Merge the index lists of the shown levels in sequence order
+    const std::deque<uint64_t>* lists[5];
+    size_t cursors[5] = {};
+    int listCount = 0;
+    for (int level = 0; level < 5; ++level) {
+        if (IsLevelShown(static_cast<LogLevel>(level)) && !m_LevelIndices[level].empty()) {
+            lists[listCount++] = &m_LevelIndices[level];
+        }
+    }
     
-    // Limit log count
-    if (m_Logs.size() > static_cast<size_t>(m_MaxLogs)) {
-        m_Logs.erase(m_Logs.begin());
+    m_Visible.clear();
+    while (true) {
+        int next = -1;
+        for (int i = 0; i < listCount; ++i) {
+            if (cursors[i] < lists[i]->size() &&
+                (next < 0 || (*lists[i])[cursors[i]] < (*lists[next])[cursors[next]])) {
+                next = i;
+            }
+        }
+        if (next < 0) {
+            break;
+        }
+        uint64_t sequence = (*lists[next])[cursors[next]++];
+        if (MatchesSearch(GetEntry(sequence))) {
+            m_Visible.push_back(sequence);
+        }
     }
 }
 
 void Console::Clear() {
-    std::lock_guard<std::mutex> lock(m_LogsMutex);
-    m_Logs.clear();
+    {
+        std::lock_guard<std::mutex> lock(m_LogsMutex);
+        m_Pending.clear();
+    }
+    
+    // Sequences keep counting so ring slots stay in step with m_Logs
+    m_FirstSequence = m_NextSequence;
+    for (auto& levelIndex : m_LevelIndices) {
+        levelIndex.clear();
+    }
+    m_Visible.clear();
 }
 
 } // namespace LGE
-
@@ -29,9 +29,12 @@ For more information, visit: https://nexelgames.com/luma-engine
 */
 
 #include "LGE/ui/ContentBrowser.h"
+#include "LGE/ui/ContentBrowserModel.h"
+#include "LGE/core/assets/AssetRegistry.h"
 #include "LGE/core/filesystem/FileSystem.h"
 #include "LGE/core/Log.h"
-#include "LGE/rendering/Texture.h"
+#include "LGE/rendering/TextureAtlas.h"
+#include "LGE/ui/EditorIcons.h"
 #include "imgui.h"
 #include <algorithm>
 #include <memory>
@@ -40,6 +43,8 @@ namespace LGE {
 
 ContentBrowser::ContentBrowser()
     : m_HistoryIndex(-1)
+    , m_Registry(nullptr)
+    , m_Model(nullptr)
     , m_FilterType(EFileType::Unknown)
     , m_ShowDirectories(true)
     , m_ShowFiles(true)
@@ -63,9 +68,6 @@ ContentBrowser::ContentBrowser()
     // Build initial directory tree
     RefreshDirectoryTree();
     RefreshAssets();
-    
-    // Load thumbnail images
-    LoadThumbnails();
 }
 
 void ContentBrowser::SetProjectRoot(const std::string& root) {
@@ -78,6 +80,34 @@ void ContentBrowser::SetProjectRoot(const std::string& root) {
 ContentBrowser::~ContentBrowser() {
 }
 
+void ContentBrowser::SetAssetRegistry(AssetRegistry* registry, const std::string& virtualRoot) {
+    m_Registry = registry;
+    m_RegistryRoot = virtualRoot;
+    RefreshDirectoryTree();
+}
+
+void ContentBrowser::SetModel(ContentBrowserModel* model) {
+    m_Model = model;
+    m_SearchQuery.clear();
+}
+
+std::string ContentBrowser::GetDiskPath(const std::string& virtualPath) const {
+    std::string relativePath = virtualPath.substr(std::min(virtualPath.size(), m_RegistryRoot.size()));
+    while (!relativePath.empty() && relativePath.front() == '/') {
+        relativePath.erase(relativePath.begin());
+    }
+    return relativePath.empty() ? m_AssetsRoot : FileSystem::JoinPath(m_AssetsRoot, relativePath);
+}
+
+std::string ContentBrowser::GetVirtualDirectory(const std::string& path) const {
+    std::string relativePath = FileSystem::GetRelativePath(path, m_AssetsRoot);
+    if (relativePath.empty() || relativePath == ".") {
+        return m_RegistryRoot;
+    }
+    std::replace(relativePath.begin(), relativePath.end(), '\\', '/');
+    return m_RegistryRoot + (m_RegistryRoot.empty() || m_RegistryRoot.back() != '/' ? "/" : "") + relativePath;
+}
+
 void ContentBrowser::OnUIRender() {
     ImGui::Begin("Content Browser", nullptr);
     
@@ -143,6 +173,18 @@ void ContentBrowser::OnUIRender() {
     ImGui::SameLine();
     ImGui::SliderFloat("##ThumbSize", &m_ThumbnailSize, 32.0f, 128.0f);
     
+    if (m_Model) {
+        ImGui::SameLine();
+        char searchBuffer[128];
+        size_t length = std::min(m_SearchQuery.size(), sizeof(searchBuffer) - 1);
+        m_SearchQuery.copy(searchBuffer, length);
+        searchBuffer[length] = '\0';
+        if (ImGui::InputTextWithHint("##Search", "Search", searchBuffer, sizeof(searchBuffer))) {
+            m_SearchQuery = searchBuffer;
+            RefreshAssets();
+        }
+    }
+    
     ImGui::Separator();
     
     // Split view: folders on left, content on right
@@ -158,7 +200,11 @@ void ContentBrowser::OnUIRender() {
     
     // Content area
     ImGui::BeginChild("ContentArea", ImVec2(0, 0), true);
-    RenderContentArea();
+    if (m_Model && !m_SearchQuery.empty()) {
+        RenderSearchResults();
+    } else {
+        RenderContentArea();
+    }
     ImGui::EndChild();
     
     ImGui::End();
@@ -175,6 +221,12 @@ void ContentBrowser::RefreshAssets() {
             }
             return a.name < b.name; // Alphabetical
         });
+    
+    // Search results follow the current folder
+    if (m_Model && !m_SearchQuery.empty()) {
+        m_Model->NavigateToDirectory(GetVirtualDirectory(m_CurrentDirectory));
+        m_Model->SetSearchQuery(m_SearchQuery);
+    }
 }
 
 void ContentBrowser::SetCurrentDirectory(const std::string& path) {
@@ -211,6 +263,25 @@ std::shared_ptr<DirectoryNode> ContentBrowser::BuildDirectoryTree(const std::str
 void ContentBrowser::ScanDirectory(std::shared_ptr<DirectoryNode> node) {
     if (node->hasScanned) return;
     
+    // Registry-backed tree: only this folder's direct subfolders, no disk access
+    if (m_Registry) {
+        for (const std::string& name : m_Registry->GetSubdirectories(GetVirtualDirectory(node->path))) {
+            std::string childPath = FileSystem::JoinPath(node->path, name);
+            auto child = std::make_shared<DirectoryNode>(childPath, name);
+            child->isExpanded = m_ExpandedPaths.find(childPath) != m_ExpandedPaths.end();
+            node->children.push_back(child);
+            if (child->isExpanded) {
+                ScanDirectory(child);
+            }
+        }
+        std::sort(node->children.begin(), node->children.end(),
+            [](const std::shared_ptr<DirectoryNode>& a, const std::shared_ptr<DirectoryNode>& b) {
+                return a->name < b->name;
+            });
+        node->hasScanned = true;
+        return;
+    }
+    
     try {
         auto entries = FileSystem::ListDirectory(node->path, false);
         
@@ -261,7 +332,10 @@ void ContentBrowser::RenderDirectoryNode(std::shared_ptr<DirectoryNode> node, in
     if (m_CurrentDirectory == node->path) {
         flags |= ImGuiTreeNodeFlags_Selected;
     }
-    if (node->children.empty()) {
+    // Unscanned registry folders ask the index whether there is anything below
+    bool hasChildren = !node->children.empty() ||
+                       (m_Registry && !node->hasScanned && m_Registry->HasSubdirectories(GetVirtualDirectory(node->path)));
+    if (!hasChildren) {
         flags |= ImGuiTreeNodeFlags_Leaf;
     }
     
@@ -303,6 +377,42 @@ void ContentBrowser::RenderDirectoryNode(std::shared_ptr<DirectoryNode> node, in
     }
 }
 
+void ContentBrowser::RenderSearchResults() {
+    const std::vector<ContentBrowserItem>& items = m_Model->GetCurrentItems();
+    size_t shown = 0;
+    for (const ContentBrowserItem& item : items) {
+        if (item.type != ContentBrowserItem::ItemType::Asset) {
+            continue;
+        }
+        
+        FileEntry entry;
+        entry.path = GetDiskPath(item.path);
+        entry.name = item.name;
+        entry.extension = FileSystem::GetExtension(entry.path);
+        entry.isDirectory = false;
+        entry.fileType = FileSystem::GetFileType(entry.path);
+        entry.fileSize = 0;
+        entry.lastModified = 0;
+        if (m_FilterType != EFileType::Unknown && entry.fileType != m_FilterType) {
+            continue;
+        }
+        
+        ImGui::PushID(entry.path.c_str());
+        if (ImGui::Selectable(item.name.c_str(), m_SelectedFilePath == entry.path, ImGuiSelectableFlags_AllowDoubleClick)) {
+            OnFileSelected(entry);
+            if (ImGui::IsMouseDoubleClicked(0)) {
+                OnFileDoubleClicked(entry);
+            }
+        }
+        ImGui::PopID();
+        shown++;
+    }
+    
+    if (shown == 0) {
+        ImGui::TextDisabled("No matches in this folder");
+    }
+}
+
 void ContentBrowser::RenderContentArea() {
     if (m_ViewMode == ViewMode::List) {
         // List view
@@ -447,13 +557,13 @@ void ContentBrowser::RenderAssetThumbnail(const FileEntry& entry, float iconSize
     ImDrawList* drawList = ImGui::GetWindowDrawList();
     
     // Determine which thumbnail to use
-    std::shared_ptr<Texture> thumbnail = nullptr;
+    const AtlasRegion* thumbnail = nullptr;
     if (entry.isDirectory) {
-        thumbnail = m_FolderThumbnail;
+        thumbnail = EditorIcons::Get(EditorIcon::Folder);
     } else if (entry.fileType == EFileType::Shader) {
-        thumbnail = m_ShaderThumbnail;
+        thumbnail = EditorIcons::Get(EditorIcon::Shader);
     } else if (entry.fileType == EFileType::Script) {
-        thumbnail = m_ScriptThumbnail;
+        thumbnail = EditorIcons::Get(EditorIcon::Script);
     }
     
     // Draw background
@@ -470,26 +580,25 @@ void ContentBrowser::RenderAssetThumbnail(const FileEntry& entry, float iconSize
     drawList->AddRectFilled(cursorPos, ImVec2(cursorPos.x + iconSizeVec.x, cursorPos.y + iconSizeVec.y), bgColor);
     
     // Draw thumbnail image if available
-    if (thumbnail && thumbnail->GetRendererID() != 0) {
+    if (thumbnail) {
+        void* atlasID = reinterpret_cast<void*>(static_cast<intptr_t>(EditorIcons::GetRendererID()));
+        ImVec2 uv0(thumbnail->uv.u0, thumbnail->uv.v0);
+        ImVec2 uv1(thumbnail->uv.u1, thumbnail->uv.v1);
+        
         // For folders, apply light orange tint
         if (entry.isDirectory) {
             ImU32 tintColor = IM_COL32(255, 200, 120, 255); // Light orange
             drawList->AddImage(
-                reinterpret_cast<void*>(static_cast<intptr_t>(thumbnail->GetRendererID())),
+                atlasID,
                 cursorPos,
                 ImVec2(cursorPos.x + iconSizeVec.x, cursorPos.y + iconSizeVec.y),
-                ImVec2(0, 1),
-                ImVec2(1, 0),
+                uv0,
+                uv1,
                 tintColor
             );
         } else {
             ImGui::SetCursorScreenPos(cursorPos);
-            ImGui::Image(
-                reinterpret_cast<void*>(static_cast<intptr_t>(thumbnail->GetRendererID())),
-                iconSizeVec,
-                ImVec2(0, 1),
-                ImVec2(1, 0)
-            );
+            ImGui::Image(atlasID, iconSizeVec, uv0, uv1);
         }
     } else {
         // Fallback: Draw colored rectangle with file type indicator
@@ -730,85 +839,6 @@ std::shared_ptr<DirectoryNode> ContentBrowser::FindNodeByPath(std::shared_ptr<Di
     return nullptr;
 }
 
-void ContentBrowser::LoadThumbnails() {
-    // Try to find thumbnail files in common locations
-    std::vector<std::string> searchPaths = {
-        "build/temp_icons/imgs/Icons/Folders/Folder_Base_256x.png",
-        "build/unreal_icons/imgs/Icons/Folders/Folder_Base_256x.png",
-        "unreal-engine-editor-icons/imgs/Icons/Folders/Folder_Base_256x.png",
-        "assets/icons/Folder_Base_256x.png"
-    };
-    
-    // Load folder thumbnail
-    for (const auto& path : searchPaths) {
-        if (FileSystem::Exists(path)) {
-            m_FolderThumbnail = std::make_shared<Texture>();
-            TextureSpec spec;
-            spec.filepath = path;
-            spec.gammaCorrected = true;
-            spec.minFilter = TextureFilter::Linear;
-            spec.magFilter = TextureFilter::Linear;
-            spec.wrapS = TextureWrap::ClampToEdge;
-            spec.wrapT = TextureWrap::ClampToEdge;
-            if (m_FolderThumbnail->Load(spec)) {
-                Log::Info("Loaded folder thumbnail: " + path);
-                break;
-            }
-            m_FolderThumbnail.reset();
-        }
-    }
-    
-    // Load script thumbnail
-    std::vector<std::string> scriptPaths = {
-        "build/temp_icons/imgs/GameProjectDialog/feature_code.png",
-        "build/unreal_icons/imgs/GameProjectDialog/feature_code.png",
-        "unreal-engine-editor-icons/imgs/GameProjectDialog/feature_code.png",
-        "assets/icons/feature_code.png"
-    };
-    
-    for (const auto& path : scriptPaths) {
-        if (FileSystem::Exists(path)) {
-            m_ScriptThumbnail = std::make_shared<Texture>();
-            TextureSpec spec;
-            spec.filepath = path;
-            spec.gammaCorrected = true;
-            spec.minFilter = TextureFilter::Linear;
-            spec.magFilter = TextureFilter::Linear;
-            spec.wrapS = TextureWrap::ClampToEdge;
-            spec.wrapT = TextureWrap::ClampToEdge;
-            if (m_ScriptThumbnail->Load(spec)) {
-                Log::Info("Loaded script thumbnail: " + path);
-                break;
-            }
-            m_ScriptThumbnail.reset();
-        }
-    }
-    
-    // Load shader thumbnail
-    std::vector<std::string> shaderPaths = {
-        "build/assets/icons/Shader_Thumbnail.png",
-        "assets/icons/Shader_Thumbnail.png"
-    };
-    
-    for (const auto& path : shaderPaths) {
-        if (FileSystem::Exists(path)) {
-            m_ShaderThumbnail = std::make_shared<Texture>();
-            TextureSpec spec;
-            spec.filepath = path;
-            spec.gammaCorrected = true;
-            spec.minFilter = TextureFilter::Linear;
-            spec.magFilter = TextureFilter::Linear;
-            spec.wrapS = TextureWrap::ClampToEdge;
-            spec.wrapT = TextureWrap::ClampToEdge;
-            if (m_ShaderThumbnail->Load(spec)) {
-                Log::Info("Loaded shader thumbnail: " + path);
-                break;
-            }
-            m_ShaderThumbnail.reset();
-        }
-    }
-}
-
 std::string ContentBrowser::GetDisplayName(const FileEntry& entry) const {
     // For scene files, strip the .lscene extension
     if (entry.fileType == EFileType::Scene && entry.extension == ".lscene") {
@@ -22,6 +22,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 */
 
 #include "LGE/ui/ContentBrowserModel.h"
+#include "LGE/core/assets/AssetSearchIndex.h"
 #include "LGE/core/filesystem/FileSystem.h"
 #include "LGE/core/Log.h"
 #include <algorithm>
@@ -31,6 +32,7 @@ namespace LGE {
 
 ContentBrowserModel::ContentBrowserModel(AssetRegistry* reg, VirtualFileSystem* vfs)
     : m_Registry(reg)
+    , m_SearchIndex(nullptr)
     , m_VFS(vfs)
 {
     NavigateToRoot();
@@ -111,57 +113,72 @@ void ContentBrowserModel::RefreshCurrentDirectory() {
         Log::Error("Error reading directory: " + std::string(e.what()));
     }
     
-    // Add assets
+    // Add assets from the registry's directory index
     if (m_Registry) {
-        // Get all assets and filter by current directory
         std::string currentVirtualPath = GetCurrentPath();
+        std::replace(currentVirtualPath.begin(), currentVirtualPath.end(), '\\', '/');
+        while (currentVirtualPath.size() > 1 && currentVirtualPath.back() == '/') {
+            currentVirtualPath.pop_back();
+        }
         
-        // Get all assets by iterating through types
-        std::vector<AssetType> allTypes = {
-            AssetType::Texture, AssetType::Model, AssetType::Material,
-            AssetType::Shader, AssetType::Script, AssetType::Audio,
-            AssetType::Scene, AssetType::Prefab, AssetType::Animation, AssetType::Font
-        };
+        // Folders the registry knows about but which are not on disk (yet)
+        for (const std::string& folder : m_Registry->GetSubdirectories(currentVirtualPath)) {
+            bool listed = std::any_of(m_CurrentItems.begin(), m_CurrentItems.end(),
+                [&folder](const ContentBrowserItem& item) { return item.name == folder; });
+            if (!listed) {
+                ContentBrowserItem item;
+                item.type = ContentBrowserItem::ItemType::Folder;
+                item.name = folder;
+                item.path = (currentVirtualPath == "/" ? "" : currentVirtualPath) + "/" + folder;
+                m_CurrentItems.push_back(item);
+            }
+        }
         
-        for (AssetType type : allTypes) {
-            std::vector<AssetMetadata*> assets = m_Registry->GetAssetsByType(type);
-            for (AssetMetadata* metadataPtr : assets) {
-                const AssetMetadata& metadata = *metadataPtr;
-                std::string assetDir = std::filesystem::path(metadata.virtualPath).parent_path().string();
+        std::vector<AssetMetadata*> assets;
+        if (!m_SearchQuery.empty() && m_SearchIndex) {
+            // Search hits, restricted to the current folder
+            for (const GUID& guid : m_SearchIndex->Search(m_SearchQuery)) {
+                AssetMetadata* metadata = m_Registry->GetAsset(guid);
+                if (!metadata) continue;
+                std::string assetDir = metadata->virtualPath.substr(0, metadata->virtualPath.find_last_of("/\\"));
                 std::replace(assetDir.begin(), assetDir.end(), '\\', '/');
-                
-                std::string currentDir = currentVirtualPath;
-                std::replace(currentDir.begin(), currentDir.end(), '\\', '/');
-                
-                if (assetDir == currentDir || assetDir + "/" == currentDir || assetDir == currentDir + "/") {
-                    // Apply search filter
-                    if (!m_SearchQuery.empty()) {
-                        std::string lowerName = metadata.name;
-                        std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
-                        std::string lowerQuery = m_SearchQuery;
-                        std::transform(lowerQuery.begin(), lowerQuery.end(), lowerQuery.begin(), ::tolower);
-                        
-                        if (lowerName.find(lowerQuery) == std::string::npos) {
-                            continue;
-                        }
-                    }
-                    
-                    // Apply type filter
-                    if (!m_TypeFilters.empty()) {
-                        if (std::find(m_TypeFilters.begin(), m_TypeFilters.end(), metadata.type) == m_TypeFilters.end()) {
-                            continue;
-                        }
-                    }
-                    
-                    ContentBrowserItem item;
-                    item.type = ContentBrowserItem::ItemType::Asset;
-                    item.name = metadata.name;
-                    item.path = metadata.virtualPath;
-                    item.guid = metadata.guid;
-                    item.assetType = metadata.type;
-                    m_CurrentItems.push_back(item);
+                if (assetDir == currentVirtualPath || (assetDir.empty() && currentVirtualPath == "/")) {
+                    assets.push_back(metadata);
+                }
+            }
+        } else {
+            assets = m_Registry->GetAssetsInDirectory(currentVirtualPath);
+        }
+        
+        std::string lowerQuery = m_SearchIndex ? std::string() : m_SearchQuery;
+        std::transform(lowerQuery.begin(), lowerQuery.end(), lowerQuery.begin(), ::tolower);
+        
+        for (AssetMetadata* metadataPtr : assets) {
+            const AssetMetadata& metadata = *metadataPtr;
+            
+            // Apply search filter
+            if (!lowerQuery.empty()) {
+                std::string lowerName = metadata.name;
+                std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
+                if (lowerName.find(lowerQuery) == std::string::npos) {
+                    continue;
+                }
+            }
+            
+            // Apply type filter
+            if (!m_TypeFilters.empty()) {
+                if (std::find(m_TypeFilters.begin(), m_TypeFilters.end(), metadata.type) == m_TypeFilters.end()) {
+                    continue;
                 }
             }
+            
+            ContentBrowserItem item;
+            item.type = ContentBrowserItem::ItemType::Asset;
+            item.name = metadata.name;
+            item.path = metadata.virtualPath;
+            item.guid = metadata.guid;
+            item.assetType = metadata.type;
+            m_CurrentItems.push_back(item);
         }
     }
     
@@ -0,0 +1,145 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/ui/EditorIcons.h"
+#include "LGE/rendering/TextureAtlas.h"
+#include "LGE/core/filesystem/FileSystem.h"
+#include "LGE/core/Log.h"
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace LGE {
+
+namespace {
+
+struct IconSource {
+    const char* name;
+    std::vector<const char*> paths;
+};
+
+// Indexed by EditorIcon; first existing path wins
+const std::array<IconSource, static_cast<size_t>(EditorIcon::Count)>& GetIconSources() {
+    static const std::array<IconSource, static_cast<size_t>(EditorIcon::Count)> sources = {{
+        { "Translate", {
+            "assets/icons/EditorViewport.TranslateMode.png",
+            "assets/icons/EditorViewport.TranslateMode.Small.png",
+            "assets/icons/icon_translate_40x.png",
+            "assets/icons/icon_translate_24x.png",
+            "assets/icons/icon_translate_16x.png",
+            "assets/icons/translate.png" } },
+        { "Rotate", {
+            "assets/icons/EditorViewport.RotateMode.png",
+            "assets/icons/EditorViewport.RotateMode.Small.png",
+            "assets/icons/icon_rotate_40x.png",
+            "assets/icons/icon_rotate_24x.png",
+            "assets/icons/icon_rotate_16x.png",
+            "assets/icons/rotate.png" } },
+        { "Scale", {
+            "assets/icons/EditorViewport.ScaleMode.png",
+            "assets/icons/EditorViewport.ScaleMode.Small.png",
+            "assets/icons/icon_scale_40x.png",
+            "assets/icons/icon_scale_24x.png",
+            "assets/icons/icon_scale_16x.png",
+            "assets/icons/scale.png" } },
+        { "ShowGrid", {
+            "assets/icons/icon_ShowGrid_16x.png",
+            "unreal-engine-editor-icons/imgs/Icons/icon_ShowGrid_16x.png" } },
+        { "Lit", {
+            "unreal-engine-editor-icons/imgs/Icons/icon_ViewMode_Lit_16px.png",
+            "assets/icons/icon_ViewMode_Lit_16px.png" } },
+        { "LightActor", {
+            "unreal-engine-editor-icons/imgs/Icons/ActorIcons/LightActor_16x.png",
+            "assets/icons/LightActor_16x.png" } },
+        { "Plus", {
+            "assets/icons/PlusSymbol_12x.png",
+            "unreal-engine-editor-icons/imgs/Icons/PlusSymbol_12x.png" } },
+        { "Search", {
+            "assets/icons/SearchGlass.png",
+            "unreal-engine-editor-icons/imgs/Common/SearchGlass.png" } },
+        { "Folder", {
+            "build/temp_icons/imgs/Icons/Folders/Folder_Base_256x.png",
+            "build/unreal_icons/imgs/Icons/Folders/Folder_Base_256x.png",
+            "unreal-engine-editor-icons/imgs/Icons/Folders/Folder_Base_256x.png",
+            "assets/icons/Folder_Base_256x.png" } },
+        { "Script", {
+            "build/temp_icons/imgs/GameProjectDialog/feature_code.png",
+            "build/unreal_icons/imgs/GameProjectDialog/feature_code.png",
+            "unreal-engine-editor-icons/imgs/GameProjectDialog/feature_code.png",
+            "assets/icons/feature_code.png" } },
+        { "Shader", {
+            "build/assets/icons/Shader_Thumbnail.png",
+            "assets/icons/Shader_Thumbnail.png" } },
+    }};
+    return sources;
+}
+
+std::unique_ptr<TextureAtlas> s_Atlas;
+std::array<const AtlasRegion*, static_cast<size_t>(EditorIcon::Count)> s_Regions = {};
+bool s_Loaded = false;
+
+} // namespace
+
+void EditorIcons::Load() {
+    if (s_Loaded) return;
+    s_Loaded = true;
+    
+    s_Atlas = std::make_unique<TextureAtlas>();
+    const auto& sources = GetIconSources();
+    for (const auto& source : sources) {
+        for (const char* path : source.paths) {
+            if (FileSystem::Exists(path) && s_Atlas->AddImageFile(source.name, path)) {
+                break;
+            }
+        }
+    }
+    
+    if (!s_Atlas->Build()) {
+        Log::Warn("No editor icons found, using drawn fallbacks");
+        return;
+    }
+    
+    for (size_t i = 0; i < sources.size(); ++i) {
+        s_Regions[i] = s_Atlas->GetRegion(sources[i].name);
+    }
+}
+
+void EditorIcons::Release() {
+    s_Regions.fill(nullptr);
+    s_Atlas.reset();
+    s_Loaded = false;
+}
+
+const AtlasRegion* EditorIcons::Get(EditorIcon icon) {
+    Load();
+    size_t index = static_cast<size_t>(icon);
+    return index < s_Regions.size() ? s_Regions[index] : nullptr;
+}
+
+uint32_t EditorIcons::GetRendererID() {
+    Load();
+    return s_Atlas ? s_Atlas->GetRendererID() : 0;
+}
+
+} // namespace LGE
@@ -30,92 +30,46 @@ For more information, visit: https://nexelgames.com/luma-engine
 
 #include "LGE/ui/Hierarchy.h"
 #include "LGE/core/scene/GameObject.h"
-#include "LGE/rendering/Texture.h"
+#include "LGE/rendering/TextureAtlas.h"
+#include "LGE/ui/EditorIcons.h"
+#include "LGE/core/Profiling.h"
 #include "imgui.h"
 
 namespace LGE {
 
 Hierarchy::Hierarchy()
     : m_SelectedObject(nullptr)
-    , m_IconsLoaded(false)
     , m_OnCreateGameObject(nullptr)
 {
+    m_SearchBuffer[0] = '\0';
 }
 
 Hierarchy::~Hierarchy() {
 }
 
-void Hierarchy::LoadIcons() {
-    if (m_IconsLoaded) return;
+void Hierarchy::SetGameObjects(const std::vector<std::shared_ptr<GameObject>>& objects) {
+    m_GameObjects = objects;
     
-    // Load plus icon
-    m_PlusIcon = std::make_shared<Texture>();
-    std::vector<std::string> plusPaths = {
-        "assets/icons/PlusSymbol_12x.png",
-        "unreal-engine-editor-icons/imgs/Icons/PlusSymbol_12x.png"
-    };
-    bool plusLoaded = false;
-    for (const auto& path : plusPaths) {
-        if (m_PlusIcon->LoadImageFile(path)) {
-            plusLoaded = true;
-            break;
+    // Children are reached through their parents
+    std::vector<std::shared_ptr<GameObject>> roots;
+    for (const auto& obj : objects) {
+        if (obj && !obj->GetParent()) {
+            roots.push_back(obj);
         }
     }
-    if (!plusLoaded) {
-        m_PlusIcon.reset();
-    }
-    
-    // Load search icon
-    m_SearchIcon = std::make_shared<Texture>();
-    std::vector<std::string> searchPaths = {
-        "assets/icons/SearchGlass.png",
-        "unreal-engine-editor-icons/imgs/Common/SearchGlass.png"
-    };
-    bool searchLoaded = false;
-    for (const auto& path : searchPaths) {
-        if (m_SearchIcon->LoadImageFile(path)) {
-            searchLoaded = true;
-            break;
-        }
-    }
-    if (!searchLoaded) {
-        m_SearchIcon.reset();
-    }
-    
-    // Load light actor icon
-    m_LightActorIcon = std::make_shared<Texture>();
-    std::vector<std::string> lightActorPaths = {
-        "unreal-engine-editor-icons/imgs/Icons/ActorIcons/LightActor_16x.png",
-        "assets/icons/LightActor_16x.png"
-    };
-    bool lightActorLoaded = false;
-    for (const auto& path : lightActorPaths) {
-        if (m_LightActorIcon->LoadImageFile(path)) {
-            lightActorLoaded = true;
-            break;
-        }
-    }
-    if (!lightActorLoaded) {
-        m_LightActorIcon.reset();
-    }
-    
-    m_IconsLoaded = true;
+    m_TreeCache.SetRoots(roots);
 }
 
 void Hierarchy::OnUIRender() {
     ImGui::Begin("Outliner", nullptr);
     
-    // Load icons on first render
-    if (!m_IconsLoaded) {
-        LoadIcons();
-    }
-    
     // Plus button and search bar in same line
     ImGui::BeginGroup();
     
     // Plus button on the left
     ImVec2 buttonSize(20.0f, 20.0f);
-    if (m_PlusIcon && m_PlusIcon->GetRendererID() != 0) {
+    const AtlasRegion* plusIcon = EditorIcons::Get(EditorIcon::Plus);
+    if (plusIcon) {
         ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.2f, 0.2f, 0.2f, 1.0f));
         ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(0.3f, 0.3f, 0.3f, 1.0f));
         ImGui::PushStyleColor(ImGuiCol_ButtonActive, ImVec4(0.4f, 0.4f, 0.4f, 1.0f));
@@ -211,9 +165,9 @@ void Hierarchy::OnUIRender() {
             ImVec2 iconMin = ImVec2(center.x - iconSize * 0.5f, center.y - iconSize * 0.5f);
             ImVec2 iconMax = ImVec2(center.x + iconSize * 0.5f, center.y + iconSize * 0.5f);
             ImGui::GetWindowDrawList()->AddImage(
-                reinterpret_cast<void*>(static_cast<intptr_t>(m_PlusIcon->GetRendererID())),
+                reinterpret_cast<void*>(static_cast<intptr_t>(EditorIcons::GetRendererID())),
                 iconMin, iconMax,
-                ImVec2(0, 0), ImVec2(1, 1));
+                ImVec2(plusIcon->uv.u0, plusIcon->uv.v0), ImVec2(plusIcon->uv.u1, plusIcon->uv.v1));
         }
         
         ImGui::PopStyleColor(3);
@@ -306,7 +260,6 @@ void Hierarchy::OnUIRender() {
     
     // Search bar with icon and placeholder
     ImGui::PushItemWidth(-1); // Fill remaining space
-    static char searchBuffer[256] = "";
     
     // Add left padding for search icon
     float iconSize = 14.0f;
@@ -315,22 +268,23 @@ void Hierarchy::OnUIRender() {
     ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(leftPadding, ImGui::GetStyle().FramePadding.y));
     
     // Use InputTextWithHint for placeholder text
-    if (ImGui::InputTextWithHint("##Search", "Search Objects", searchBuffer, sizeof(searchBuffer))) {
-        // Search filter applied
+    if (ImGui::InputTextWithHint("##Search", "Search Objects", m_SearchBuffer, sizeof(m_SearchBuffer))) {
+        m_TreeCache.SetFilter(m_SearchBuffer);
     }
     
     ImGui::PopStyleVar();
     
     // Draw search icon on the left side of the input field
-    if (m_SearchIcon && m_SearchIcon->GetRendererID() != 0 && ImGui::IsItemVisible()) {
+    const AtlasRegion* searchIcon = EditorIcons::Get(EditorIcon::Search);
+    if (searchIcon && ImGui::IsItemVisible()) {
         ImVec2 inputPos = ImGui::GetItemRectMin();
         ImVec2 inputSize = ImGui::GetItemRectSize();
         ImVec2 iconMin = ImVec2(inputPos.x + iconPadding, inputPos.y + (inputSize.y - iconSize) * 0.5f);
         ImVec2 iconMax = ImVec2(iconMin.x + iconSize, iconMin.y + iconSize);
         ImGui::GetWindowDrawList()->AddImage(
-            reinterpret_cast<void*>(static_cast<intptr_t>(m_SearchIcon->GetRendererID())),
+            reinterpret_cast<void*>(static_cast<intptr_t>(EditorIcons::GetRendererID())),
             iconMin, iconMax,
-            ImVec2(0, 0), ImVec2(1, 1));
+            ImVec2(searchIcon->uv.u0, searchIcon->uv.v0), ImVec2(searchIcon->uv.u1, searchIcon->uv.v1));
     }
     
     ImGui::PopItemWidth();
@@ -340,49 +294,90 @@ void Hierarchy::OnUIRender() {
     
     // Scene hierarchy tree
     if (ImGui::TreeNode("Scene")) {
-        // Show all GameObjects
-        for (size_t i = 0; i < m_GameObjects.size(); ++i) {
-            auto& obj = m_GameObjects[i];
-            if (obj) {
-                // Use PushID with pointer address to ensure unique IDs
-                ImGui::PushID(static_cast<int>(reinterpret_cast<intptr_t>(obj.get())));
-                
-                bool isSelected = (m_SelectedObject == obj.get());
-                
-                // Check if this is a light GameObject (Directional Light or Sky Light)
-                bool isLight = (obj->GetName().find("Light") != std::string::npos);
-                
-                // Draw icon if available
-                if (isLight && m_LightActorIcon && m_LightActorIcon->GetRendererID() != 0) {
-                    ImGui::Image(
-                        reinterpret_cast<void*>(static_cast<intptr_t>(m_LightActorIcon->GetRendererID())),
-                        ImVec2(16.0f, 16.0f),
-                        ImVec2(0, 0), ImVec2(1, 1)
-                    );
-                    ImGui::SameLine();
-                }
-                
-                // Use unique label with index to avoid conflicts
-                std::string label = obj->GetName() + "##" + std::to_string(i);
-                if (ImGui::Selectable(label.c_str(), isSelected)) {
-                    m_SelectedObject = obj.get();
-                    obj->SetSelected(true);
-                    // Deselect others
-                    for (auto& other : m_GameObjects) {
-                        if (other.get() != obj.get()) {
-                            other->SetSelected(false);
-                        }
+        RenderTree();
+        ImGui::TreePop();
+    }
+    
+    ImGui::End();
+}
+
+void Hierarchy::RenderTree() {
+    LGE_PROFILE_FUNCTION();
+    
+    const AtlasRegion* lightActorIcon = EditorIcons::Get(EditorIcon::LightActor);
+    const std::vector<HierarchyRow>& rows = m_TreeCache.GetRows();
+    float indent = ImGui::GetStyle().IndentSpacing;
+    
+    // Only rows in view are submitted
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(rows.size()));
+    while (clipper.Step()) {
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+            const HierarchyRow& row = rows[static_cast<size_t>(i)];
+            GameObject* obj = row.object;
+            
+            // Use PushID with pointer address to ensure unique IDs
+            ImGui::PushID(obj);
+            if (row.depth > 0) {
+                ImGui::Indent(indent * row.depth);
+            }
+            
+            // Check if this is a light GameObject (Directional Light or Sky Light)
+            bool isLight = (obj->GetName().find("Light") != std::string::npos);
+            
+            // Draw icon if available
+            if (isLight && lightActorIcon) {
+                ImGui::Image(
+                    reinterpret_cast<void*>(static_cast<intptr_t>(EditorIcons::GetRendererID())),
+                    ImVec2(16.0f, 16.0f),
+                    ImVec2(lightActorIcon->uv.u0, lightActorIcon->uv.v0),
+                    ImVec2(lightActorIcon->uv.u1, lightActorIcon->uv.v1)
+                );
+                ImGui::SameLine();
+            }
+            
+            ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_OpenOnArrow |
+                                       ImGuiTreeNodeFlags_SpanAvailWidth;
+            if (m_SelectedObject == obj) {
+                flags |= ImGuiTreeNodeFlags_Selected;
+            }
+            if (!row.hasChildren) {
+                flags |= ImGuiTreeNodeFlags_Leaf;
+            }
+            
+            // Ancestors kept only for context are dimmed while searching
+            if (!row.matches) {
+                ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled));
+            }
+            ImGui::SetNextItemOpen(row.expanded);
+            bool open = ImGui::TreeNodeEx("##Node", flags, "%s", obj->GetName().c_str());
+            if (!row.matches) {
+                ImGui::PopStyleColor();
+            }
+            
+            if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen()) {
+                m_SelectedObject = obj;
+                obj->SetSelected(true);
+                // Deselect others
+                for (auto& other : m_GameObjects) {
+                    if (other.get() != obj) {
+                        other->SetSelected(false);
                     }
                 }
-                
-                ImGui::PopID();
+            }
+            
+            if (row.depth > 0) {
+                ImGui::Unindent(indent * row.depth);
+            }
+            ImGui::PopID();
+            
+            // The row list is rebuilt on the next frame
+            if (row.hasChildren && open != row.expanded) {
+                m_TreeCache.SetExpanded(obj, open);
             }
         }
-        
-        ImGui::TreePop();
     }
-    
-    ImGui::End();
+    clipper.End();
 }
 
 } // namespace LGE
@@ -0,0 +1,187 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+#include "LGE/ui/HierarchyTreeCache.h"
+#include "LGE/core/scene/GameObject.h"
+#include "LGE/core/Profiling.h"
+#include <algorithm>
+#include <cctype>
+
+namespace LGE {
+
+namespace {
+
+std::string ToLower(const std::string& text) {
+    std::string lower = text;
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+        [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+    return lower;
+}
+
+} // namespace
+
+void HierarchyTreeCache::SetRoots(const std::vector<std::shared_ptr<GameObject>>& roots) {
+    LGE_PROFILE_SCOPE("HierarchyTreeCache::SetRoots");
+    
+    m_Nodes.clear();
+    for (const auto& root : roots) {
+        if (root) {
+            AddSubtree(root, -1, 0);
+        }
+    }
+    
+    // Forget expansion of objects that left the tree (destroyed or unparented)
+    if (!m_Expanded.empty()) {
+        std::unordered_set<GUID> expanded;
+        for (const Node& node : m_Nodes) {
+            if (m_Expanded.count(node.object->GetGUID()) > 0) {
+                expanded.insert(node.object->GetGUID());
+            }
+        }
+        m_Expanded.swap(expanded);
+    }
+    ApplyFilter(false);
+}
+
+void HierarchyTreeCache::Clear() {
+    m_Nodes.clear();
+    m_Expanded.clear();
+    m_Matches.clear();
+    m_Keep.clear();
+    m_Rows.clear();
+    m_RowsDirty = false;
+}
+
+void HierarchyTreeCache::AddSubtree(const std::shared_ptr<GameObject>& object, int parent, int depth) {
+    uint32_t index = static_cast<uint32_t>(m_Nodes.size());
+    Node node;
+    node.object = object;
+    node.lowerName = ToLower(object->GetName());
+    node.parent = parent;
+    node.depth = depth;
+    m_Nodes.push_back(std::move(node));
+    
+    for (const auto& child : object->GetChildren()) {
+        if (child) {
+            AddSubtree(child, static_cast<int>(index), depth + 1);
+        }
+    }
+    m_Nodes[index].subtreeEnd = static_cast<uint32_t>(m_Nodes.size());
+}
+
+bool HierarchyTreeCache::IsExpanded(const GameObject* object) const {
+    return object && m_Expanded.count(object->GetGUID()) > 0;
+}
+
+void HierarchyTreeCache::SetExpanded(const GameObject* object, bool expanded) {
+    if (!object) {
+        return;
+    }
+    if (expanded) {
+        m_Expanded.insert(object->GetGUID());
+    } else {
+        m_Expanded.erase(object->GetGUID());
+    }
+    m_RowsDirty = true;
+}
+
+void HierarchyTreeCache::SetFilter(const std::string& filter) {
+    std::string lower = ToLower(filter);
+    if (lower == m_Filter) {
+        return;
+    }
+    
+    // Every name containing the longer query also contains the shorter one
+    bool narrowing = !m_Filter.empty() && lower.find(m_Filter) != std::string::npos;
+    m_Filter = lower;
+    ApplyFilter(narrowing);
+}
+
+void HierarchyTreeCache::ApplyFilter(bool narrowing) {
+    m_RowsDirty = true;
+    if (m_Filter.empty()) {
+        m_Matches.clear();
+        m_Keep.clear();
+        return;
+    }
+    
+    if (narrowing) {
+        m_Matches.erase(
+            std::remove_if(m_Matches.begin(), m_Matches.end(), [this](uint32_t index) {
+                return m_Nodes[index].lowerName.find(m_Filter) == std::string::npos;
+            }),
+            m_Matches.end()
+        );
+    } else {
+        m_Matches.clear();
+        for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
+            if (m_Nodes[i].lowerName.find(m_Filter) != std::string::npos) {
+                m_Matches.push_back(i);
+            }
+        }
+    }
+    
+    // Keep each match and walk up until an ancestor is already kept
+    m_Keep.assign(m_Nodes.size(), 0);
+    for (uint32_t index : m_Matches) {
+        m_Keep[index] |= 1;
+        for (int parent = m_Nodes[index].parent; parent >= 0 && !(m_Keep[parent] & 2); parent = m_Nodes[parent].parent) {
+            m_Keep[parent] |= 2;
+        }
+    }
+}
+
+const std::vector<HierarchyRow>& HierarchyTreeCache::GetRows() {
+    if (m_RowsDirty) {
+        RebuildRows();
+    }
+    return m_Rows;
+}
+
+void HierarchyTreeCache::RebuildRows() {
+    m_RowsDirty = false;
+    m_Rows.clear();
+    
+    bool filtering = !m_Filter.empty();
+    uint32_t i = 0;
+    while (i < m_Nodes.size()) {
+        const Node& node = m_Nodes[i];
+        if (filtering && m_Keep[i] == 0) {
+            i = node.subtreeEnd;
+            continue;
+        }
+        
+        HierarchyRow row;
+        row.object = node.object.get();
+        row.depth = node.depth;
+        row.hasChildren = node.subtreeEnd > i + 1;
+        // While searching, ancestors of matches are always open
+        row.expanded = row.hasChildren && ((filtering && (m_Keep[i] & 2)) || IsExpanded(row.object));
+        row.matches = !filtering || (m_Keep[i] & 1);
+        m_Rows.push_back(row);
+        
+        i = row.expanded ? i + 1 : node.subtreeEnd;
+    }
+}
+
+} // namespace LGE
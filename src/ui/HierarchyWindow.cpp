@@ -26,13 +26,17 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/scene/components/Transform.h"
 #include "LGE/core/scene/components/MeshRenderer.h"
 #include "LGE/core/scene/components/CameraComponent.h"
+#include "LGE/core/Profiling.h"
 #include "imgui.h"
 
 namespace LGE {
 
 HierarchyWindow::HierarchyWindow(World* world)
     : m_World(world)
+    , m_CachedVersion(0)
+    , m_CacheValid(false)
 {
+    m_SearchBuffer[0] = '\0';
 }
 
 void HierarchyWindow::Render() {
@@ -85,78 +89,115 @@ void HierarchyWindow::Render() {
         ImGui::EndPopup();
     }
     
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(-1.0f);
+    if (ImGui::InputTextWithHint("##Search", "Search", m_SearchBuffer, sizeof(m_SearchBuffer))) {
+        m_TreeCache.SetFilter(m_SearchBuffer);
+    }
+    
     ImGui::Separator();
     
-    // Render all root objects (no parent)
-    auto allObjects = m_World->GetAllGameObjects();
-    for (auto& go : allObjects) {
-        if (!go->GetParent()) {
-            RenderGameObjectNode(go);
+    SyncTreeCache();
+    
+    // Only rows in view are submitted; the rest is a single scroll extent
+    const std::vector<HierarchyRow>& rows = m_TreeCache.GetRows();
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(rows.size()));
+    while (clipper.Step()) {
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+            RenderRow(rows[static_cast<size_t>(i)]);
         }
     }
+    clipper.End();
     
     ImGui::End();
 }
 
-void HierarchyWindow::RenderGameObjectNode(std::shared_ptr<GameObject> gameObject) {
-    if (!gameObject) return;
+void HierarchyWindow::SyncTreeCache() {
+    if (m_CacheValid && m_World->GetHierarchyVersion() == m_CachedVersion) {
+        return;
+    }
+    m_CachedVersion = m_World->GetHierarchyVersion();
+    m_CacheValid = true;
+    
+    // The root list keeps objects that were parented after creation; skip those
+    std::vector<std::shared_ptr<GameObject>> roots;
+    for (const auto& go : m_World->GetRootGameObjects()) {
+        if (go && !go->GetParent()) {
+            roots.push_back(go);
+        }
+    }
+    m_TreeCache.SetRoots(roots);
+}
+
+void HierarchyWindow::RenderRow(const HierarchyRow& row) {
+    GameObject* gameObject = row.object;
+    float indent = ImGui::GetStyle().IndentSpacing * row.depth;
     
-    ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
+    ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick |
+                               ImGuiTreeNodeFlags_NoTreePushOnOpen;
     
     auto selected = m_SelectedGameObject.lock();
-    if (selected == gameObject) {
+    if (selected.get() == gameObject) {
         flags |= ImGuiTreeNodeFlags_Selected;
     }
     
-    if (gameObject->GetChildCount() == 0) {
+    if (!row.hasChildren) {
         flags |= ImGuiTreeNodeFlags_Leaf;
     }
     
-    // Use GUID as unique ID for tree node
     std::string nodeLabel = gameObject->GetName();
     if (!gameObject->IsActive()) {
         nodeLabel += " [Inactive]";
     }
     
-    bool nodeOpen = ImGui::TreeNodeEx(gameObject.get(), flags, "%s", nodeLabel.c_str());
+    if (indent > 0.0f) {
+        ImGui::Indent(indent);
+    }
+    if (!row.matches) {
+        ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled));
+    }
+    ImGui::SetNextItemOpen(row.expanded);
+    bool nodeOpen = ImGui::TreeNodeEx(gameObject, flags, "%s", nodeLabel.c_str());
+    if (!row.matches) {
+        ImGui::PopStyleColor();
+    }
+    
+    // Expansion lives in the cache; the row list is rebuilt next frame
+    if (row.hasChildren && nodeOpen != row.expanded) {
+        m_TreeCache.SetExpanded(gameObject, nodeOpen);
+    }
     
     // Selection
-    if (ImGui::IsItemClicked()) {
-        m_SelectedGameObject = gameObject;
+    if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen()) {
+        m_SelectedGameObject = gameObject->shared_from_this();
     }
     
     // Context menu
     if (ImGui::BeginPopupContextItem()) {
-        ShowContextMenu(gameObject);
+        ShowContextMenu(gameObject->shared_from_this());
         ImGui::EndPopup();
     }
     
     // Drag-drop for reparenting
     if (ImGui::BeginDragDropSource()) {
-        ImGui::SetDragDropPayload("GAME_OBJECT", &gameObject, sizeof(std::shared_ptr<GameObject>));
+        ImGui::SetDragDropPayload("GAME_OBJECT", &gameObject, sizeof(GameObject*));
         ImGui::Text("%s", gameObject->GetName().c_str());
         ImGui::EndDragDropSource();
     }
     
     if (ImGui::BeginDragDropTarget()) {
         if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("GAME_OBJECT")) {
-            auto* droppedGO = static_cast<std::shared_ptr<GameObject>*>(payload->Data);
-            if (*droppedGO && *droppedGO != gameObject) {
-                (*droppedGO)->SetParent(gameObject);
+            GameObject* droppedGO = *static_cast<GameObject* const*>(payload->Data);
+            if (droppedGO && droppedGO != gameObject) {
+                droppedGO->SetParent(gameObject->shared_from_this());
             }
         }
         ImGui::EndDragDropTarget();
     }
     
-    // Render children
-    if (nodeOpen) {
-        for (size_t i = 0; i < gameObject->GetChildCount(); ++i) {
-            auto child = gameObject->GetChild(i);
-            if (child) {
-                RenderGameObjectNode(child);
-            }
-        }
-        ImGui::TreePop();
+    if (indent > 0.0f) {
+        ImGui::Unindent(indent);
     }
 }
 
@@ -28,15 +28,29 @@ For more information, visit: https://nexelgames.com/luma-engine
 */
 
 #include "LGE/ui/Profiler.h"
+#include "LGE/rendering/TextureStreamer.h"
+#include "LGE/rendering/RenderTargetAllocator.h"
+#include "LGE/rendering/GPUProfiler.h"
 #include "imgui.h"
 #include <algorithm>
 #include <cmath>
+#include <functional>
+#include <string>
+#include <unordered_map>
 
 namespace LGE {
 
 Profiler::Profiler()
     : m_CurrentFPS(0.0f)
     , m_CurrentFrameTime(0.0f)
+    , m_StreamingStats(nullptr)
+    , m_RenderTargetStats(nullptr)
+    , m_GPUStats(nullptr)
+    , m_TimelineBegin(0)
+    , m_TimelineEnd(0)
+    , m_TimelineZoom(1.0f)
+    , m_TimelinePaused(false)
+    , m_FreezeOnSpike(false)
 {
     m_FPSHistory.resize(MAX_HISTORY_SIZE, 0.0f);
     m_FrameTimeHistory.resize(MAX_HISTORY_SIZE, 0.0f);
@@ -62,6 +76,40 @@ void Profiler::Update(float deltaTime) {
     if (m_FrameTimeHistory.size() > MAX_HISTORY_SIZE) {
         m_FrameTimeHistory.pop_front();
     }
+    
+    if (m_TimelinePaused) {
+        return;
+    }
+    CaptureTimeline();
+    
+    // Keep the offending frame on screen when it took more than twice the median
+    if (m_FreezeOnSpike && !m_TimelineZones.empty()) {
+        std::vector<float> sorted(m_FrameTimeHistory.begin(), m_FrameTimeHistory.end());
+        std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+        float median = sorted[sorted.size() / 2];
+        float timelineMs = static_cast<float>(Profiling::TicksToMilliseconds(m_TimelineEnd - m_TimelineBegin));
+        if (median > 0.0f && timelineMs > median * 2.0f) {
+            m_TimelinePaused = true;
+        }
+    }
+}
+
+void Profiler::CaptureTimeline() {
+    // Look far enough back that the frame's GPU timings have been read back too
+    uint32_t framesBack = GPUProfiler::kFramesInFlight - 1;
+    if (m_GPUStats) {
+        framesBack = std::max(framesBack, m_GPUStats->latencyFrames);
+    }
+    uint64_t begin = 0;
+    uint64_t end = 0;
+    if (!Profiling::GetFrameRange(framesBack, begin, end)) {
+        return;
+    }
+    
+    m_TimelineBegin = begin;
+    m_TimelineEnd = end;
+    Profiling::CollectZones(begin, end, m_TimelineZones);
+    m_TimelineThreads = Profiling::GetThreads();
 }
 
 void Profiler::DrawPerformanceGraph(const char* label, const std::deque<float>& history, float min, float max, ImVec2 size) {
@@ -155,10 +203,240 @@ void Profiler::OnUIRender() {
         auto minmax = std::minmax_element(m_FrameTimeHistory.begin(), m_FrameTimeHistory.end());
         ImGui::Text("Min Frame Time: %.2f ms", *minmax.first);
         ImGui::Text("Max Frame Time: %.2f ms", *minmax.second);
+        
+        // Spikes: frames taking more than twice the median frame time
+        std::vector<float> sorted(m_FrameTimeHistory.begin(), m_FrameTimeHistory.end());
+        std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+        float median = sorted[sorted.size() / 2];
+        int spikes = 0;
+        for (float ft : m_FrameTimeHistory) {
+            if (median > 0.0f && ft > median * 2.0f) {
+                spikes++;
+            }
+        }
+        ImGui::Text("Frame Spikes (>2x median): %d / %d", spikes, static_cast<int>(m_FrameTimeHistory.size()));
+        ImGui::Text("Worst Spike: %.1fx median", median > 0.0f ? *minmax.second / median : 0.0f);
+    }
+    
+    if (m_GPUStats) {
+        DrawGPUStats();
+    }
+    
+    DrawTimeline();
+    
+    if (m_StreamingStats) {
+        DrawStreamingStats();
+    }
+    
+    if (m_RenderTargetStats) {
+        DrawRenderTargetStats();
     }
     
     ImGui::End();
 }
 
-} // namespace LGE
+void Profiler::DrawGPUStats() {
+    const GPUProfilerStats& stats = *m_GPUStats;
+    
+    ImGui::Spacing();
+    ImGui::Text("GPU");
+    ImGui::Separator();
+    
+    // Every frame is being dropped: the last timings are stale or there are none
+    if (stats.framesSinceResolve > stats.framesInFlight) {
+        ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "GPU Frame: no readback for %u frames (GPU more than %u frames behind)",
+                           stats.framesSinceResolve, stats.framesInFlight);
+    } else {
+        ImGui::Text("GPU Frame: %.2f ms (read back %u frames later)", stats.frameMs, stats.latencyFrames);
+    }
+    ImGui::Text("Dropped Readbacks: %u / %u (%u frames in flight)", stats.droppedFrames,
+                stats.resolvedFrames + stats.droppedFrames, stats.framesInFlight);
+    if (stats.overflowZones > 0) {
+        ImGui::Text("Zones Over Limit: %u", stats.overflowZones);
+    }
+}
 
+void Profiler::DrawTimeline() {
+    ImGui::Spacing();
+    ImGui::Text("CPU Timeline");
+    ImGui::Separator();
+    
+    ImGui::Checkbox("Pause", &m_TimelinePaused);
+    ImGui::SameLine();
+    ImGui::Checkbox("Freeze on Spike", &m_FreezeOnSpike);
+    ImGui::SameLine();
+    if (ImGui::Button("Export Trace")) {
+        Profiling::ExportChromeTrace("LumaProfile.json");
+    }
+    ImGui::SetNextItemWidth(-1);
+    ImGui::SliderFloat("##TimelineZoom", &m_TimelineZoom, 1.0f, 32.0f, "Zoom %.1fx", ImGuiSliderFlags_Logarithmic);
+    
+    if (m_TimelineEnd <= m_TimelineBegin) {
+        ImGui::TextDisabled("No frames recorded yet");
+        return;
+    }
+    
+    const double frameTicks = static_cast<double>(m_TimelineEnd - m_TimelineBegin);
+    ImGui::Text("Frame: %.2f ms, %zu zones", Profiling::TicksToMilliseconds(m_TimelineEnd - m_TimelineBegin), m_TimelineZones.size());
+    
+    // One lane per nesting level, threads stacked in registration order
+    const float laneHeight = ImGui::GetTextLineHeight() + 4.0f;
+    const float labelWidth = 90.0f;
+    float contentHeight = 0.0f;
+    for (size_t i = 0; i < m_TimelineZones.size();) {
+        uint32_t thread = m_TimelineZones[i].threadIndex;
+        uint32_t maxDepth = 0;
+        for (; i < m_TimelineZones.size() && m_TimelineZones[i].threadIndex == thread; ++i) {
+            maxDepth = std::max(maxDepth, m_TimelineZones[i].depth);
+        }
+        contentHeight += (maxDepth + 1) * laneHeight + 4.0f;
+    }
+    
+    ImGui::BeginChild("##Timeline", ImVec2(-1, std::min(contentHeight + 20.0f, 240.0f)), true, ImGuiWindowFlags_HorizontalScrollbar);
+    
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    float timelineWidth = std::max(ImGui::GetContentRegionAvail().x - labelWidth, 100.0f) * m_TimelineZoom;
+    float pixelsPerTick = static_cast<float>(timelineWidth / frameTicks);
+    float y = origin.y;
+    
+    for (size_t i = 0; i < m_TimelineZones.size();) {
+        uint32_t thread = m_TimelineZones[i].threadIndex;
+        size_t first = i;
+        uint32_t maxDepth = 0;
+        for (; i < m_TimelineZones.size() && m_TimelineZones[i].threadIndex == thread; ++i) {
+            maxDepth = std::max(maxDepth, m_TimelineZones[i].depth);
+        }
+        
+        const char* threadName = thread < m_TimelineThreads.size() ? m_TimelineThreads[thread].name.c_str() : "?";
+        drawList->AddText(ImVec2(origin.x, y + 2.0f), IM_COL32(180, 180, 180, 255), threadName);
+        
+        for (size_t z = first; z < i; ++z) {
+            const ProfileZone& zone = m_TimelineZones[z];
+            uint64_t begin = std::max(zone.begin, m_TimelineBegin);
+            uint64_t end = std::min(zone.end, m_TimelineEnd);
+            ImVec2 min(origin.x + labelWidth + (begin - m_TimelineBegin) * pixelsPerTick, y + zone.depth * laneHeight);
+            ImVec2 max(std::max(min.x + 1.0f, origin.x + labelWidth + (end - m_TimelineBegin) * pixelsPerTick), min.y + laneHeight - 1.0f);
+            
+            // Stable colour per zone name
+            uint32_t nameHash = static_cast<uint32_t>(std::hash<std::string>()(zone.name ? zone.name : ""));
+            ImU32 color = ImColor::HSV((nameHash % 360) / 360.0f, 0.45f, 0.70f);
+            drawList->AddRectFilled(min, max, color);
+            
+            if (zone.name && max.x - min.x > 24.0f) {
+                drawList->PushClipRect(min, max, true);
+                drawList->AddText(ImVec2(min.x + 3.0f, min.y + 1.0f), IM_COL32(15, 15, 15, 255), zone.name);
+                drawList->PopClipRect();
+            }
+            
+            if (ImGui::IsMouseHoveringRect(min, max)) {
+                ImGui::SetTooltip("%s\n%.3f ms (%s)", zone.name ? zone.name : "?",
+                                  Profiling::TicksToMilliseconds(zone.end - zone.begin), threadName);
+            }
+        }
+        
+        y += (maxDepth + 1) * laneHeight + 4.0f;
+    }
+    
+    ImGui::Dummy(ImVec2(labelWidth + timelineWidth, contentHeight));
+    ImGui::EndChild();
+    
+    DrawZoneSummary();
+}
+
+void Profiler::DrawZoneSummary() {
+    struct ZoneTotals {
+        double totalMs = 0.0;
+        double selfMs = 0.0;
+        uint32_t calls = 0;
+    };
+    
+    // Self time = zone time minus the time of its direct children
+    std::unordered_map<std::string, ZoneTotals> totals;
+    std::vector<const ProfileZone*> stack;
+    uint32_t stackThread = UINT32_MAX;
+    for (const ProfileZone& zone : m_TimelineZones) {
+        if (zone.threadIndex != stackThread) {
+            stack.clear();
+            stackThread = zone.threadIndex;
+        }
+        while (!stack.empty() && (stack.back()->end <= zone.begin || stack.back()->depth >= zone.depth)) {
+            stack.pop_back();
+        }
+        
+        double ms = Profiling::TicksToMilliseconds(zone.end - zone.begin);
+        ZoneTotals& entry = totals[zone.name ? zone.name : "?"];
+        entry.totalMs += ms;
+        entry.selfMs += ms;
+        entry.calls++;
+        if (!stack.empty() && stack.back()->name) {
+            totals[stack.back()->name].selfMs -= ms;
+        }
+        stack.push_back(&zone);
+    }
+    
+    std::vector<std::pair<std::string, ZoneTotals>> sorted(totals.begin(), totals.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.second.selfMs > b.second.selfMs; });
+    
+    if (ImGui::BeginTable("ZoneSummary", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable)) {
+        ImGui::TableSetupColumn("Zone");
+        ImGui::TableSetupColumn("Self (ms)");
+        ImGui::TableSetupColumn("Total (ms)");
+        ImGui::TableSetupColumn("Calls");
+        ImGui::TableHeadersRow();
+        
+        const size_t maxRows = 12;
+        for (size_t i = 0; i < sorted.size() && i < maxRows; ++i) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(sorted[i].first.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", sorted[i].second.selfMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", sorted[i].second.totalMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%u", sorted[i].second.calls);
+        }
+        ImGui::EndTable();
+    }
+}
+
+void Profiler::DrawStreamingStats() {
+    const TextureStreamingStats& stats = *m_StreamingStats;
+    
+    ImGui::Spacing();
+    ImGui::Text("Texture Streaming");
+    ImGui::Separator();
+    
+    float residentMB = stats.residentBytes / (1024.0f * 1024.0f);
+    float budgetMB = stats.budgetBytes / (1024.0f * 1024.0f);
+    ImGui::Text("Textures: %u (%u decoding)", stats.streamedTextures, stats.pendingDecodes);
+    ImGui::Text("Resident: %.1f / %.1f MB", residentMB, budgetMB);
+    ImGui::ProgressBar(budgetMB > 0.0f ? residentMB / budgetMB : 0.0f, ImVec2(-1, 0));
+    ImGui::Text("Uploads: %u (%.2f MB), queued %u", stats.uploadsThisFrame,
+                stats.uploadBytesThisFrame / (1024.0f * 1024.0f), stats.queuedUploads);
+    ImGui::Text("Evictions: %u", stats.evictionsThisFrame);
+    ImGui::Text("Update: %.2f ms (peak %.2f ms)", stats.updateMs, stats.peakUpdateMs);
+    ImGui::Text("Spikes (>%.1f ms): %u / %zu frames", TextureStreamingStats::kSpikeThresholdMs,
+                stats.spikeFrames, TextureStreamingStats::kStatsWindow);
+    ImGui::Text("Upload Ring Stalls: %u", stats.ringStalls);
+}
+
+void Profiler::DrawRenderTargetStats() {
+    const RenderTargetStats& stats = *m_RenderTargetStats;
+    const float toMB = 1.0f / (1024.0f * 1024.0f);
+    
+    ImGui::Spacing();
+    ImGui::Text("Render Targets");
+    ImGui::Separator();
+    
+    ImGui::Text("Targets: %u (%u in use)", stats.targetCount, stats.inUseCount);
+    ImGui::Text("Memory: %.1f MB (%.1f MB in use, peak %.1f MB)", stats.totalBytes * toMB,
+                stats.inUseBytes * toMB, stats.peakBytes * toMB);
+    ImGui::Text("Transients: %u (%u aliased), %.1f MB requested / %.1f MB allocated",
+                stats.transientRequests, stats.aliasedRequests,
+                stats.transientBytesRequested * toMB, stats.transientBytesAllocated * toMB);
+    ImGui::Text("Created / Destroyed: %u / %u", stats.createdThisFrame, stats.destroyedThisFrame);
+}
+
+} // namespace LGE
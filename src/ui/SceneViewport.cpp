@@ -42,7 +42,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/rendering/Camera.h"
 #include "LGE/rendering/Renderer.h"
 #include "LGE/ui/SceneViewport.h"
-#include "LGE/rendering/Texture.h"
+#include "LGE/rendering/TextureAtlas.h"
 #include "LGE/rendering/Shader.h"
 #include "LGE/rendering/VertexArray.h"
 #include "LGE/rendering/VertexBuffer.h"
@@ -51,6 +51,7 @@ For more information, visit: https://nexelgames.com/luma-engine
 #include "LGE/core/Input.h"
 #include "LGE/core/scene/GameObject.h"
 #include "LGE/ui/UI.h"
+#include "LGE/ui/EditorIcons.h"
 #include "LGE/rendering/PostProcessor.h"
 #include "LGE/rendering/ExposureSystem.h"
 #include "imgui.h"
@@ -60,13 +61,13 @@ namespace LGE {
 
 
 SceneViewport::SceneViewport()
-    : m_Camera(nullptr)
+    : m_RenderTargetPool(nullptr)
+    , m_Camera(nullptr)
     , m_Width(1280)
     , m_Height(720)
     , m_Focused(false)
     , m_Hovered(false)
     , m_ViewportSizeChanged(false)
-    , m_IconsLoaded(false)
     , m_SelectedObject(nullptr)
     , m_SelectedTool(0)
     , m_IsDragging(false)
@@ -76,10 +77,6 @@ SceneViewport::SceneViewport()
 {
     // Don't create framebuffer here - wait until OpenGL is initialized
     // Framebuffer will be created on first render
-    m_StoredViewport[0] = 0;
-    m_StoredViewport[1] = 0;
-    m_StoredViewport[2] = 1280;
-    m_StoredViewport[3] = 720;
     
     // Initialize post-processor and exposure system
     m_PostProcessor = std::make_unique<PostProcessor>();
@@ -93,21 +90,15 @@ void SceneViewport::OnUpdate(float deltaTime) {
     m_ViewportSizeChanged = false;
 }
 
-void SceneViewport::BeginRender() {
+bool SceneViewport::PrepareRender() {
     // Don't render if viewport is too small
     if (m_Width == 0 || m_Height == 0) {
-        return;
-    }
-    
-    // Create HDR framebuffer if it doesn't exist (OpenGL should be initialized by now)
-    // Use HDR format for PBR pipeline
-    if (!m_Framebuffer) {
-        m_Framebuffer = std::make_unique<Framebuffer>(m_Width, m_Height, EFramebufferFormat::HDR);
+        return false;
     }
     
-    // Create LDR framebuffer for tone-mapped result
+    // Create LDR framebuffer for tone-mapped result (OpenGL should be initialized by now)
     if (!m_LDRFramebuffer) {
-        m_LDRFramebuffer = std::make_unique<Framebuffer>(m_Width, m_Height, EFramebufferFormat::LDR);
+        m_LDRFramebuffer = std::make_unique<Framebuffer>(m_Width, m_Height, EFramebufferFormat::LDR, m_RenderTargetPool);
     }
     
     // Initialize post-processor on first render
@@ -115,206 +106,49 @@ void SceneViewport::BeginRender() {
         m_PostProcessor->Initialize();
     }
     
-    if (!m_Framebuffer || !m_LDRFramebuffer) {
-        return;
-    }
-    
-    // Store current viewport to restore later
-    GLint viewport[4];
-    glGetIntegerv(GL_VIEWPORT, viewport);
-    m_StoredViewport[0] = viewport[0];
-    m_StoredViewport[1] = viewport[1];
-    m_StoredViewport[2] = viewport[2];
-    m_StoredViewport[3] = viewport[3];
-    
-    // Render scene to framebuffer
-    m_Framebuffer->Bind();
-    
-    // Set viewport to match framebuffer size
-    glViewport(0, 0, m_Width, m_Height);
-    
-    // Enable depth testing (in case it was disabled)
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LESS);
-    
-    glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    
-    // Scene rendering will happen here (called from application)
+    return m_LDRFramebuffer && m_PostProcessor && m_ExposureSystem;
 }
 
-void SceneViewport::EndRender() {
-    if (!m_Framebuffer || !m_LDRFramebuffer) {
-        return;
-    }
-    
-    // Unbind HDR framebuffer (we need to read from its texture, not render to it)
-    m_Framebuffer->Unbind();
-    
-    // Apply tone mapping from HDR to LDR framebuffer
-    // This will bind the LDR framebuffer and render the HDR texture to it
-    ApplyToneMapping();
-    
-    // Unbind LDR framebuffer (post-processor should have already restored state, but be safe)
-    m_LDRFramebuffer->Unbind();
-    
-    // Restore viewport to what it was before
-    glViewport(m_StoredViewport[0], m_StoredViewport[1], m_StoredViewport[2], m_StoredViewport[3]);
+RenderTargetDesc SceneViewport::GetSceneColorDesc() const {
+    RenderTargetDesc desc;
+    desc.width = m_Width;
+    desc.height = m_Height;
+    desc.format = RenderTargetFormat::RGBA16F;
+    return desc;
 }
 
-void SceneViewport::ApplyToneMapping() {
-    if (!m_PostProcessor || !m_ExposureSystem || !m_Framebuffer || !m_LDRFramebuffer) {
-        return;
-    }
+FrameGraphHandle SceneViewport::AddPostProcessPasses(FrameGraph& graph, FrameGraphHandle sceneColor) {
+    RenderTargetDesc ldrDesc;
+    ldrDesc.width = m_Width;
+    ldrDesc.height = m_Height;
+    ldrDesc.format = RenderTargetFormat::RGBA8;
+    FrameGraphHandle ldr = graph.ImportTexture("ViewportLDR", ldrDesc,
+        m_LDRFramebuffer->GetColorAttachmentRendererID(), m_LDRFramebuffer->GetRendererID());
     
-    // Only update exposure system if auto exposure is enabled
-    // Otherwise, just get the current manual exposure value
+    // Feeds next frame's exposure (readback is a frame or two behind), so it
+    // only has to run, not to finish before tone mapping
     if (m_ExposureSystem->GetAutoExposure()) {
-        // Update exposure system (auto exposure calculation)
-        // Note: This is currently disabled as glReadPixels is too slow
-        // TODO: Implement GPU-based luminance calculation
-        m_ExposureSystem->Update(0.016f, m_Framebuffer->GetColorAttachmentRendererID(), m_Width, m_Height);
-    }
-    
-    // Get current exposure
-    float exposure = m_ExposureSystem->GetExposure();
-    
-    // Render HDR texture through post-processor to LDR framebuffer
-    // The post-processor will handle all framebuffer state management
-    m_PostProcessor->RenderToFramebuffer(
-        m_Framebuffer->GetColorAttachmentRendererID(),
-        m_LDRFramebuffer->GetRendererID(),
-        m_Width,
-        m_Height,
-        exposure,
-        EToneMapperType::ACES
-    );
-}
-
-void SceneViewport::LoadIcons() {
-    if (m_IconsLoaded) return;
-    
-    // Try to load Unreal Engine editor icons (EditorViewport transform tools)
-    std::vector<std::string> translatePaths = {
-        "assets/icons/EditorViewport.TranslateMode.png",
-        "assets/icons/EditorViewport.TranslateMode.Small.png",
-        "assets/icons/icon_translate_40x.png",
-        "assets/icons/icon_translate_24x.png",
-        "assets/icons/icon_translate_16x.png",
-        "assets/icons/translate.png"
-    };
-    
-    std::vector<std::string> rotatePaths = {
-        "assets/icons/EditorViewport.RotateMode.png",
-        "assets/icons/EditorViewport.RotateMode.Small.png",
-        "assets/icons/icon_rotate_40x.png",
-        "assets/icons/icon_rotate_24x.png",
-        "assets/icons/icon_rotate_16x.png",
-        "assets/icons/rotate.png"
-    };
-    
-    std::vector<std::string> scalePaths = {
-        "assets/icons/EditorViewport.ScaleMode.png",
-        "assets/icons/EditorViewport.ScaleMode.Small.png",
-        "assets/icons/icon_scale_40x.png",
-        "assets/icons/icon_scale_24x.png",
-        "assets/icons/icon_scale_16x.png",
-        "assets/icons/scale.png"
-    };
-    
-    std::vector<std::string> showGridPaths = {
-        "assets/icons/icon_ShowGrid_16x.png",
-        "unreal-engine-editor-icons/imgs/Icons/icon_ShowGrid_16x.png"
-    };
-    
-    std::vector<std::string> litIconPaths = {
-        "unreal-engine-editor-icons/imgs/Icons/icon_ViewMode_Lit_16px.png",
-        "assets/icons/icon_ViewMode_Lit_16px.png"
-    };
-    
-    // Load translate icon
-    m_TranslateIcon = std::make_shared<Texture>();
-    bool translateLoaded = false;
-    for (const auto& path : translatePaths) {
-        if (m_TranslateIcon->LoadImageFile(path)) {
-            translateLoaded = true;
-            break;
-        }
-    }
-    if (!translateLoaded) {
-        m_TranslateIcon.reset(); // Failed to load, will use fallback
-    }
-    
-    // Load rotate icon
-    m_RotateIcon = std::make_shared<Texture>();
-    bool rotateLoaded = false;
-    for (const auto& path : rotatePaths) {
-        if (m_RotateIcon->LoadImageFile(path)) {
-            rotateLoaded = true;
-            break;
-        }
-    }
-    if (!rotateLoaded) {
-        m_RotateIcon.reset(); // Failed to load, will use fallback
-    }
-    
-    // Load scale icon
-    m_ScaleIcon = std::make_shared<Texture>();
-    bool scaleLoaded = false;
-    for (const auto& path : scalePaths) {
-        if (m_ScaleIcon->LoadImageFile(path)) {
-            scaleLoaded = true;
-            break;
-        }
-    }
-    if (!scaleLoaded) {
-        m_ScaleIcon.reset(); // Failed to load, will use fallback
-    }
-    
-    // Load show grid icon
-    m_ShowGridIcon = std::make_shared<Texture>();
-    bool showGridLoaded = false;
-    for (const auto& path : showGridPaths) {
-        if (m_ShowGridIcon->LoadImageFile(path)) {
-            showGridLoaded = true;
-            break;
-        }
-    }
-    if (!showGridLoaded) {
-        m_ShowGridIcon.reset(); // Failed to load, will use fallback
-    }
-    
-    // Load lit icon
-    m_LitIcon = std::make_shared<Texture>();
-    bool litIconLoaded = false;
-    for (const auto& path : litIconPaths) {
-        if (m_LitIcon->LoadImageFile(path)) {
-            litIconLoaded = true;
-            break;
-        }
-    }
-    if (!litIconLoaded) {
-        m_LitIcon.reset(); // Failed to load, will use fallback
-    }
-    
-    // Load light actor icon
-    m_LightActorIcon = std::make_shared<Texture>();
-    std::vector<std::string> lightActorPaths = {
-        "unreal-engine-editor-icons/imgs/Icons/ActorIcons/LightActor_16x.png",
-        "assets/icons/LightActor_16x.png"
-    };
-    bool lightActorLoaded = false;
-    for (const auto& path : lightActorPaths) {
-        if (m_LightActorIcon->LoadImageFile(path)) {
-            lightActorLoaded = true;
-            break;
-        }
-    }
-    if (!lightActorLoaded) {
-        m_LightActorIcon.reset();
-    }
-    
-    m_IconsLoaded = true;
+        FrameGraphBuilder exposure = graph.AddPass("Exposure", [this, sceneColor](const FrameGraphResources& resources) {
+            m_ExposureSystem->Update(ImGui::GetIO().DeltaTime, resources.GetTexture(sceneColor), m_Width, m_Height);
+        });
+        exposure.Read(sceneColor, FrameGraphAccess::Sampled);
+        exposure.SetSideEffect();
+    }
+    
+    FrameGraphBuilder toneMap = graph.AddPass("ToneMap", [this, sceneColor](const FrameGraphResources& resources) {
+        m_PostProcessor->RenderToFramebuffer(
+            resources.GetTexture(sceneColor),
+            resources.GetFramebuffer(),
+            m_Width,
+            m_Height,
+            m_ExposureSystem->GetExposure(),
+            EToneMapperType::ACES
+        );
+    });
+    toneMap.Read(sceneColor, FrameGraphAccess::Sampled);
+    ldr = toneMap.Write(ldr, FrameGraphAccess::RenderTarget);
+    graph.MarkOutput(ldr);
+    return ldr;
 }
 
 void SceneViewport::OnUIRender() {
@@ -326,11 +160,6 @@ void SceneViewport::OnUIRender() {
     m_Focused = ImGui::IsWindowFocused();
     m_Hovered = ImGui::IsWindowHovered();
 
-    // Load icons on first render
-    if (!m_IconsLoaded) {
-        LoadIcons();
-    }
-
     // Viewport toolbar above viewport (Unreal Engine style)
     ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(4.0f, 4.0f));
     ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4.0f, 2.0f));
@@ -396,15 +225,15 @@ void SceneViewport::OnUIRender() {
         ImVec2 rectSize = ImGui::GetItemRectSize();
         ImVec2 center = ImVec2(pos.x + rectSize.x * 0.5f, pos.y + rectSize.y * 0.5f);
         
-        if (m_LitIcon && m_LitIcon->GetRendererID() != 0) {
+        if (const AtlasRegion* litIcon = EditorIcons::Get(EditorIcon::Lit)) {
             // Use texture icon
             float iconSize = std::min(rectSize.x, rectSize.y) * 0.7f;
             ImVec2 iconMin = ImVec2(center.x - iconSize * 0.5f, center.y - iconSize * 0.5f);
             ImVec2 iconMax = ImVec2(center.x + iconSize * 0.5f, center.y + iconSize * 0.5f);
             ImGui::GetWindowDrawList()->AddImage(
-                reinterpret_cast<void*>(static_cast<intptr_t>(m_LitIcon->GetRendererID())),
+                reinterpret_cast<void*>(static_cast<intptr_t>(EditorIcons::GetRendererID())),
                 iconMin, iconMax,
-                ImVec2(0, 0), ImVec2(1, 1));
+                ImVec2(litIcon->uv.u0, litIcon->uv.v0), ImVec2(litIcon->uv.u1, litIcon->uv.v1));
         } else {
             // Fallback: draw a simple lightbulb icon
             ImDrawList* drawList = ImGui::GetWindowDrawList();
@@ -429,7 +258,7 @@ void SceneViewport::OnUIRender() {
     ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4.0f, 0.0f));
     
     // Helper function to draw icon button with texture or fallback
-    auto DrawIconButton = [this](const char* label, bool selected, ImVec2 size, std::shared_ptr<Texture> icon, std::function<void(ImVec2, ImVec2)> fallbackDraw) -> bool {
+    auto DrawIconButton = [this](const char* label, bool selected, ImVec2 size, EditorIcon iconId, std::function<void(ImVec2, ImVec2)> fallbackDraw) -> bool {
         ImGui::PushStyleColor(ImGuiCol_Button, selected ? ImVec4(0.3f, 0.5f, 0.8f, 1.0f) : ImVec4(0.2f, 0.2f, 0.2f, 1.0f));
         ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ImVec4(0.4f, 0.6f, 0.9f, 1.0f));
         ImGui::PushStyleColor(ImGuiCol_ButtonActive, ImVec4(0.2f, 0.4f, 0.7f, 1.0f));
@@ -444,15 +273,15 @@ void SceneViewport::OnUIRender() {
             ImVec2 rectSize = ImGui::GetItemRectSize();
             ImVec2 center = ImVec2(pos.x + rectSize.x * 0.5f, pos.y + rectSize.y * 0.5f);
             
-            if (icon && icon->GetRendererID() != 0) {
+            if (const AtlasRegion* icon = EditorIcons::Get(iconId)) {
                 // Use texture icon
                 float iconSize = std::min(rectSize.x, rectSize.y) * 0.7f;
                 ImVec2 iconMin = ImVec2(center.x - iconSize * 0.5f, center.y - iconSize * 0.5f);
                 ImVec2 iconMax = ImVec2(center.x + iconSize * 0.5f, center.y + iconSize * 0.5f);
                 ImGui::GetWindowDrawList()->AddImage(
-                    reinterpret_cast<void*>(static_cast<intptr_t>(icon->GetRendererID())),
+                    reinterpret_cast<void*>(static_cast<intptr_t>(EditorIcons::GetRendererID())),
                     iconMin, iconMax,
-                    ImVec2(0, 0), ImVec2(1, 1)); // Normal texture coordinates
+                    ImVec2(icon->uv.u0, icon->uv.v0), ImVec2(icon->uv.u1, icon->uv.v1)); // Atlas region, top row first
             } else {
                 // Use fallback drawn icon
                 ImDrawList* drawList = ImGui::GetWindowDrawList();
@@ -465,7 +294,7 @@ void SceneViewport::OnUIRender() {
     };
     
     // Translate icon
-    if (DrawIconButton("Translate", m_SelectedTool == 0, ImVec2(36.0f, 32.0f), m_TranslateIcon, [](ImVec2 center, ImVec2 size) {
+    if (DrawIconButton("Translate", m_SelectedTool == 0, ImVec2(36.0f, 32.0f), EditorIcon::Translate, [](ImVec2 center, ImVec2 size) {
         ImDrawList* drawList = ImGui::GetWindowDrawList();
         ImU32 color = IM_COL32(255, 255, 255, 255);
         float radius = 6.0f;
@@ -486,7 +315,7 @@ void SceneViewport::OnUIRender() {
     ImGui::SameLine();
     
     // Rotate icon
-    if (DrawIconButton("Rotate", m_SelectedTool == 1, ImVec2(36.0f, 32.0f), m_RotateIcon, [](ImVec2 center, ImVec2 size) {
+    if (DrawIconButton("Rotate", m_SelectedTool == 1, ImVec2(36.0f, 32.0f), EditorIcon::Rotate, [](ImVec2 center, ImVec2 size) {
         ImDrawList* drawList = ImGui::GetWindowDrawList();
         ImU32 color = IM_COL32(255, 255, 255, 255);
         float radius = 7.0f;
@@ -513,7 +342,7 @@ void SceneViewport::OnUIRender() {
     ImGui::SameLine();
     
     // Scale icon
-    if (DrawIconButton("Scale", m_SelectedTool == 2, ImVec2(36.0f, 32.0f), m_ScaleIcon, [](ImVec2 center, ImVec2 size) {
+    if (DrawIconButton("Scale", m_SelectedTool == 2, ImVec2(36.0f, 32.0f), EditorIcon::Scale, [](ImVec2 center, ImVec2 size) {
         ImDrawList* drawList = ImGui::GetWindowDrawList();
         ImU32 color = IM_COL32(255, 255, 255, 255);
         float boxSize = 8.0f;
@@ -551,15 +380,15 @@ void SceneViewport::OnUIRender() {
         ImVec2 rectSize = ImGui::GetItemRectSize();
         ImVec2 center = ImVec2(pos.x + rectSize.x * 0.5f, pos.y + rectSize.y * 0.5f);
         
-        if (m_ShowGridIcon && m_ShowGridIcon->GetRendererID() != 0) {
+        if (const AtlasRegion* gridIcon = EditorIcons::Get(EditorIcon::ShowGrid)) {
             // Use texture icon
             float iconSize = std::min(rectSize.x, rectSize.y) * 0.7f;
             ImVec2 iconMin = ImVec2(center.x - iconSize * 0.5f, center.y - iconSize * 0.5f);
             ImVec2 iconMax = ImVec2(center.x + iconSize * 0.5f, center.y + iconSize * 0.5f);
             ImGui::GetWindowDrawList()->AddImage(
-                reinterpret_cast<void*>(static_cast<intptr_t>(m_ShowGridIcon->GetRendererID())),
+                reinterpret_cast<void*>(static_cast<intptr_t>(EditorIcons::GetRendererID())),
                 iconMin, iconMax,
-                ImVec2(0, 0), ImVec2(1, 1));
+                ImVec2(gridIcon->uv.u0, gridIcon->uv.v0), ImVec2(gridIcon->uv.u1, gridIcon->uv.v1));
         } else {
             // Fallback: draw grid pattern
             ImDrawList* drawList = ImGui::GetWindowDrawList();
@@ -611,10 +440,6 @@ void SceneViewport::OnUIRender() {
         m_ViewportSizeChanged = true;
         
         if (m_Width > 0 && m_Height > 0) {
-            if (m_Framebuffer) {
-                m_Framebuffer->Resize(m_Width, m_Height);
-            }
-            
             if (m_LDRFramebuffer) {
                 m_LDRFramebuffer->Resize(m_Width, m_Height);
             }
@@ -649,7 +474,8 @@ void SceneViewport::OnUIRender() {
                          ImGui::GetWindowWidth(), ImGui::GetWindowHeight());
         
         // Render GameObject icons (e.g., DirectionalLight icons)
-        if (m_Camera && m_LightActorIcon && m_LightActorIcon->GetRendererID() != 0) {
+        const AtlasRegion* lightActorIcon = EditorIcons::Get(EditorIcon::LightActor);
+        if (m_Camera && lightActorIcon) {
             ImDrawList* drawList = ImGui::GetWindowDrawList();
             const Math::Matrix4& viewProj = m_Camera->GetViewProjectionMatrix();
             float iconSize = 32.0f; // Size of icon in pixels
@@ -688,9 +514,10 @@ void SceneViewport::OnUIRender() {
                         ImVec2 iconMax = ImVec2(screenX + iconSize * 0.5f, screenY + iconSize * 0.5f);
                         
                         drawList->AddImage(
-                            reinterpret_cast<void*>(static_cast<intptr_t>(m_LightActorIcon->GetRendererID())),
+                            reinterpret_cast<void*>(static_cast<intptr_t>(EditorIcons::GetRendererID())),
                             iconMin, iconMax,
-                            ImVec2(0, 0), ImVec2(1, 1)
+                            ImVec2(lightActorIcon->uv.u0, lightActorIcon->uv.v0),
+                            ImVec2(lightActorIcon->uv.u1, lightActorIcon->uv.v1)
                         );
                     }
                 }
@@ -175,6 +175,11 @@ void TextureImporter::RenderTexturePreview() {
         previewWidth = 256.0f * aspectRatio;
     }
     
+    // Streamed textures only need the mips this preview can show
+    if (m_TextureManager) {
+        m_TextureManager->ReportScreenSize(*m_PreviewTexture, std::max(previewWidth, previewHeight));
+    }
+    
     ImGui::Image(
         reinterpret_cast<void*>(static_cast<intptr_t>(m_PreviewTexture->GetRendererID())),
         ImVec2(previewWidth, previewHeight),
@@ -246,6 +246,20 @@ void Toolbar::OnUIRender() {
         ImGui::SetTooltip("Stop");
     }
     
+    // Background status (project open, ...) on the right
+    if (!m_Status.empty()) {
+        float barWidth = 120.0f;
+        float textWidth = ImGui::CalcTextSize(m_Status.c_str()).x;
+        float statusX = contentRegionMax.x - barWidth - textWidth - 8.0f;
+        float buttonsEndX = ImGui::GetItemRectMax().x - ImGui::GetWindowPos().x;
+        if (statusX > buttonsEndX + 8.0f) {
+            ImGui::SameLine(statusX);
+            ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "%s", m_Status.c_str());
+            ImGui::SameLine();
+            ImGui::ProgressBar(m_StatusProgress, ImVec2(barWidth, 0.0f));
+        }
+    }
+    
     ImGui::End();
     
     ImGui::PopStyleColor(2);
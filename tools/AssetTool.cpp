@@ -0,0 +1,548 @@
+/*
+------------------------------------------------------------------------------
+
+Luma Engine - A Next-Generation Game Engine
+
+Copyright (c) 2025 Nexel Games. All Rights Reserved.
+
+This source code is part of the Luma Engine project developed by Nexel Games.
+
+Use of this software is governed by the Luma Engine License Agreement.
+
+Unauthorized copying of this file, via any medium, is strictly prohibited.
+
+Distribution of source or binary forms, with or without modification, is
+
+subject to the terms of the Luma Engine License.
+
+For more information, visit: https://nexelgames.com/luma-engine
+
+------------------------------------------------------------------------------
+
+*/
+
+// Headless asset pipeline driver for build farms and per-commit performance
+// tracking. Links core/assets, core/filesystem and core/project only: no
+// window, GL or ImGui. Results are written as JSON to stdout (or --output),
+// log messages go to stderr.
+// Usage: LGE_AssetTool scan     <project> [--full]
+//        LGE_AssetTool import   <project> <file|directory>...
+//        LGE_AssetTool validate <project>
+//        LGE_AssetTool package  <project> <output.lpak>
+//        LGE_AssetTool bench    [project] [--assets N] [--iterations N] [--keep]
+// <project> is a .luma file or the directory holding one. Common options:
+// --verbose (forward Info logs), --output <file>.
+
+#include "LGE/core/project/Project.h"
+#include "LGE/core/filesystem/FileSystemManager.h"
+#include "LGE/core/filesystem/PackageArchive.h"
+#include "LGE/core/filesystem/AsyncFileIO.h"
+#include "LGE/core/assets/AssetRegistry.h"
+#include "LGE/core/assets/AssetSearchIndex.h"
+#include "LGE/core/assets/AssetValidator.h"
+#include "LGE/core/assets/ImporterFactory.h"
+#include "LGE/core/importers/TextureImporter.h"
+#include "LGE/core/JobSystem.h"
+#include "LGE/core/Log.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace LGE;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Json = nlohmann::json;
+
+struct Options {
+    std::string command;
+    std::vector<std::string> positional;
+    std::string output;
+    int assets = 2000;
+    int iterations = 3;
+    bool full = false;
+    bool keep = false;
+    bool verbose = false;
+};
+
+double MillisecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void PrintUsage() {
+    std::fprintf(stderr,
+        "Usage: LGE_AssetTool <command> [options]\n"
+        "  scan     <project> [--full]                  open the project and reconcile Assets\n"
+        "  import   <project> <file|directory>...       import textures into Assets/Textures\n"
+        "  validate <project>                           validate every registered asset\n"
+        "  package  <project> <output.lpak>             pack Assets into a read-only package\n"
+        "  bench    [project] [--assets N] [--iterations N] [--keep]\n"
+        "Options: --verbose, --output <file>\n");
+}
+
+bool ParseOptions(int argc, char** argv, Options& options) {
+    if (argc < 2) {
+        return false;
+    }
+    options.command = argv[1];
+    for (int i = 2; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--full") == 0) {
+            options.full = true;
+        } else if (std::strcmp(arg, "--keep") == 0) {
+            options.keep = true;
+        } else if (std::strcmp(arg, "--verbose") == 0) {
+            options.verbose = true;
+        } else if (std::strcmp(arg, "--output") == 0 && hasValue) {
+            options.output = argv[++i];
+        } else if (std::strcmp(arg, "--assets") == 0 && hasValue) {
+            options.assets = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(arg, "--iterations") == 0 && hasValue) {
+            options.iterations = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strncmp(arg, "--", 2) == 0) {
+            std::fprintf(stderr, "Unknown or incomplete option: %s\n", arg);
+            return false;
+        } else {
+            options.positional.push_back(arg);
+        }
+    }
+    return true;
+}
+
+// Accepts the .luma file itself or the project directory containing it
+std::shared_ptr<Project> LoadProject(const std::string& path) {
+    std::filesystem::path projectFile = path;
+    std::error_code ec;
+    if (std::filesystem::is_directory(projectFile, ec)) {
+        projectFile.clear();
+        for (const auto& entry : std::filesystem::directory_iterator(path, ec)) {
+            if (entry.is_regular_file(ec) && entry.path().extension() == ".luma") {
+                projectFile = entry.path();
+                break;
+            }
+        }
+        if (projectFile.empty()) {
+            Log::Error("No .luma project file in: " + path);
+            return nullptr;
+        }
+    }
+    
+    std::shared_ptr<Project> project = Project::Load(projectFile.string());
+    if (!project || !project->IsLoaded()) {
+        Log::Error("Failed to load project: " + projectFile.string());
+        return nullptr;
+    }
+    return project;
+}
+
+// Drives the same staged open the editor runs a slice per frame, without a
+// frame budget; returns false when the pipeline fails
+bool OpenProject(FileSystemManager& manager, const std::shared_ptr<Project>& project, Json& out) {
+    Clock::time_point start = Clock::now();
+    if (!manager.BeginOpen(project)) {
+        return false;
+    }
+    while (manager.IsOpening()) {
+        manager.Update(1000.0);
+        // Blocks while a background stage runs instead of spinning on Update
+        manager.WaitForOpenJob(100.0);
+    }
+    
+    const ProjectOpenProgress& progress = manager.GetOpenProgress();
+    out["stage"] = GetProjectOpenStageName(progress.stage);
+    out["interactiveMs"] = progress.interactiveMs;
+    out["readyMs"] = MillisecondsSince(start);
+    out["changedFiles"] = progress.changedFiles;
+    out["removedFiles"] = progress.removedFiles;
+    out["assets"] = manager.IsInitialized() ? manager.GetAssetRegistry()->GetAssetCount() : 0;
+    return progress.stage == ProjectOpenStage::Ready;
+}
+
+// Shutdown persists the registry, GUIDs, dependency graph and search index
+void CloseProject(FileSystemManager& manager, Json& out) {
+    Clock::time_point start = Clock::now();
+    manager.Shutdown();
+    out["saveMs"] = MillisecondsSince(start);
+}
+
+void CollectSources(const std::filesystem::path& path, ImporterFactory& factory, std::vector<std::filesystem::path>& outSources) {
+    std::error_code ec;
+    if (!std::filesystem::is_directory(path, ec)) {
+        outSources.push_back(path);
+        return;
+    }
+    for (auto it = std::filesystem::recursive_directory_iterator(path, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        if (it->is_regular_file(ec) && factory.IsExtensionSupported(it->path().extension().string())) {
+            outSources.push_back(it->path());
+        }
+    }
+    std::sort(outSources.begin(), outSources.end());
+}
+
+bool ImportSources(FileSystemManager& manager, const std::vector<std::string>& inputs, Json& out) {
+    ImporterFactory factory;
+    factory.RegisterImporter(std::make_unique<TextureImporter>(
+        manager.GetAssetRegistry(), manager.GetVFS(), manager.GetGUIDRegistry()));
+    
+    std::vector<std::filesystem::path> sources;
+    for (const std::string& input : inputs) {
+        CollectSources(input, factory, sources);
+    }
+    
+    AssetRegistry* registry = manager.GetAssetRegistry();
+    std::filesystem::path destinationDirectory = manager.GetProject()->GetTexturesPath();
+    size_t imported = 0;
+    Json failures = Json::array();
+    Clock::time_point start = Clock::now();
+    for (const std::filesystem::path& source : sources) {
+        AssetImporter* importer = factory.GetImporterForExtension(source.extension().string());
+        AssetMetadata metadata;
+        if (!importer || !importer->Import(source, destinationDirectory / source.filename(), importer->GetDefaultSettings(), metadata)) {
+            failures.push_back(source.string());
+            continue;
+        }
+        
+        bool registered = registry->GetAsset(metadata.guid)
+            ? registry->UpdateAsset(metadata.guid, metadata)
+            : registry->RegisterAsset(metadata);
+        if (!registered) {
+            failures.push_back(source.string());
+            continue;
+        }
+        manager.GetSearchIndex()->UpdateAsset(metadata.guid, registry);
+        ++imported;
+    }
+    
+    out["sources"] = sources.size();
+    out["imported"] = imported;
+    out["failed"] = failures;
+    out["importMs"] = MillisecondsSince(start);
+    return failures.empty();
+}
+
+const char* GetSeverityName(AssetValidator::ValidationSeverity severity) {
+    switch (severity) {
+        case AssetValidator::ValidationSeverity::Info:    return "info";
+        case AssetValidator::ValidationSeverity::Warning: return "warning";
+        case AssetValidator::ValidationSeverity::Error:   return "error";
+    }
+    return "unknown";
+}
+
+// Returns false when the validator reports errors
+bool ValidateAssets(FileSystemManager& manager, bool includeIssues, Json& out) {
+    AssetValidator* validator = manager.GetAssetValidator();
+    Clock::time_point start = Clock::now();
+    std::vector<AssetValidator::ValidationResult> results = validator->ValidateProject();
+    out["validateMs"] = MillisecondsSince(start);
+    
+    AssetValidator::ValidationSummary summary = validator->GetSummary(results);
+    out["infos"] = summary.infoCount;
+    out["warnings"] = summary.warningCount;
+    out["errors"] = summary.errorCount;
+    out["autoFixable"] = summary.autoFixableCount;
+    if (includeIssues) {
+        Json issues = Json::array();
+        for (const AssetValidator::ValidationResult& result : results) {
+            issues.push_back({
+                { "severity", GetSeverityName(result.severity) },
+                { "asset", result.asset.ToString() },
+                { "message", result.message },
+                { "details", result.details }
+            });
+        }
+        out["issues"] = std::move(issues);
+    }
+    return summary.errorCount == 0;
+}
+
+bool PackageAssets(const Project& project, const std::filesystem::path& outputPath, Json& out) {
+    Clock::time_point start = Clock::now();
+    bool built = PackageArchive::Build(project.GetAssetsPath(), outputPath);
+    out["packageMs"] = MillisecondsSince(start);
+    out["output"] = outputPath.string();
+    
+    std::error_code ec;
+    uint64_t bytes = built ? std::filesystem::file_size(outputPath, ec) : 0;
+    out["bytes"] = ec ? 0 : bytes;
+    return built;
+}
+
+// Minimal uncompressed 32-bit TGA, which every texture importer path decodes
+bool WriteTestTexture(const std::filesystem::path& path, int size, uint32_t seed) {
+    std::vector<uint8_t> bytes(18 + static_cast<size_t>(size) * size * 4);
+    bytes[2] = 2;
+    bytes[12] = static_cast<uint8_t>(size);
+    bytes[13] = static_cast<uint8_t>(size >> 8);
+    bytes[14] = static_cast<uint8_t>(size);
+    bytes[15] = static_cast<uint8_t>(size >> 8);
+    bytes[16] = 32;
+    bytes[17] = 8;
+    for (size_t i = 18; i < bytes.size(); ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        bytes[i] = static_cast<uint8_t>(seed >> 24);
+    }
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(file);
+}
+
+// Synthetic project: mostly textures spread over 50 folders, plus materials,
+// scenes and scripts, and a RawTextures folder of sources for the import stage
+std::shared_ptr<Project> CreateBenchProject(const std::filesystem::path& root, int assetCount) {
+    std::error_code ec;
+    std::filesystem::remove_all(root, ec);
+    std::shared_ptr<Project> project = Project::CreateNew(root.string(), "AssetToolBench");
+    if (!project) {
+        return nullptr;
+    }
+    
+    std::filesystem::path assets = project->GetAssetsPath();
+    for (int i = 0; i < assetCount; ++i) {
+        std::filesystem::path folder = assets / ("Folder" + std::to_string(i % 50));
+        if (i < 50) {
+            std::filesystem::create_directories(folder, ec);
+        }
+        std::string name = "asset_" + std::to_string(i);
+        switch (i % 10) {
+            case 7:
+                std::ofstream(folder / (name + ".lmat")) << "{ \"shader\": \"Standard\", \"textures\": {} }";
+                break;
+            case 8:
+                std::ofstream(folder / (name + ".lscene")) << "{ \"name\": \"" << name << "\", \"gameObjects\": [] }";
+                break;
+            case 9:
+                std::ofstream(folder / (name + ".lua")) << "-- " << name << "\n";
+                break;
+            default:
+                if (!WriteTestTexture(folder / (name + ".tga"), 8, static_cast<uint32_t>(i))) {
+                    return nullptr;
+                }
+                break;
+        }
+    }
+    
+    std::filesystem::path sources = root / "RawTextures";
+    std::filesystem::create_directories(sources, ec);
+    for (int i = 0; i < std::max(1, assetCount / 20); ++i) {
+        if (!WriteTestTexture(sources / ("source_" + std::to_string(i) + ".tga"), 32, 0x9E3779B9u ^ static_cast<uint32_t>(i))) {
+            return nullptr;
+        }
+    }
+    return project;
+}
+
+Json Summarize(std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    double total = 0.0;
+    for (double sample : samples) {
+        total += sample;
+    }
+    return {
+        { "minMs", samples.front() },
+        { "medianMs", samples[samples.size() / 2] },
+        { "maxMs", samples.back() },
+        { "meanMs", total / static_cast<double>(samples.size()) }
+    };
+}
+
+// Each iteration: cold open (persisted state removed), warm open, full
+// rescan, validate, import, incremental revalidation, package. Reports
+// min/median/max per stage.
+bool RunBench(const Options& options, Json& out) {
+    std::shared_ptr<Project> project;
+    std::filesystem::path generatedRoot;
+    if (!options.positional.empty()) {
+        project = LoadProject(options.positional[0]);
+    } else {
+        generatedRoot = std::filesystem::temp_directory_path() / "lge_assettool_bench";
+        Clock::time_point start = Clock::now();
+        project = CreateBenchProject(generatedRoot, options.assets);
+        out["generateMs"] = MillisecondsSince(start);
+    }
+    if (!project) {
+        return false;
+    }
+    
+    std::filesystem::path root = project->GetProjectPath();
+    std::filesystem::path sources = root / "RawTextures";
+    std::filesystem::path package = std::filesystem::path(project->GetSavedPath()) / "AssetToolBench.lpak";
+    const char* stageNames[] = { "coldOpen", "coldInteractive", "warmOpen", "warmInteractive", "fullScan", "validate", "import", "revalidate", "package", "save" };
+    std::vector<std::vector<double>> samples(sizeof(stageNames) / sizeof(stageNames[0]));
+    
+    bool ok = true;
+    for (int iteration = 0; iteration < options.iterations && ok; ++iteration) {
+        Json cold, warm, imported, validated, packaged, closed;
+        
+        std::error_code ec;
+        std::filesystem::remove_all(project->GetIntermediatePath(), ec);
+        project->InitializeDirectoryStructure();
+        
+        FileSystemManager manager;
+        ok = OpenProject(manager, project, cold);
+        CloseProject(manager, closed);
+        ok = ok && OpenProject(manager, project, warm);
+        if (!ok) {
+            break;
+        }
+        
+        Clock::time_point scanStart = Clock::now();
+        manager.ScanAssets();
+        double scanMs = MillisecondsSince(scanStart);
+        
+        std::vector<std::string> importInputs;
+        if (std::filesystem::is_directory(sources, ec)) {
+            importInputs.push_back(sources.string());
+        }
+        ValidateAssets(manager, false, validated);
+        ok = ImportSources(manager, importInputs, imported);
+        Clock::time_point revalidateStart = Clock::now();
+        manager.GetAssetValidator()->RevalidateChanged();
+        double revalidateMs = MillisecondsSince(revalidateStart);
+        ok = PackageAssets(*project, package, packaged) && ok;
+        CloseProject(manager, closed);
+        
+        samples[0].push_back(cold["readyMs"]);
+        samples[1].push_back(cold["interactiveMs"]);
+        samples[2].push_back(warm["readyMs"]);
+        samples[3].push_back(warm["interactiveMs"]);
+        samples[4].push_back(scanMs);
+        samples[5].push_back(validated["validateMs"]);
+        samples[6].push_back(imported["importMs"]);
+        samples[7].push_back(revalidateMs);
+        samples[8].push_back(packaged["packageMs"]);
+        samples[9].push_back(closed["saveMs"]);
+        if (iteration == 0) {
+            out["assets"] = warm["assets"];
+            out["imported"] = imported["imported"];
+            out["validationErrors"] = validated["errors"];
+            out["packageBytes"] = packaged["bytes"];
+        }
+    }
+    
+    if (ok) {
+        Json stages = Json::object();
+        for (size_t stage = 0; stage < samples.size(); ++stage) {
+            stages[stageNames[stage]] = Summarize(samples[stage]);
+        }
+        out["stages"] = std::move(stages);
+    }
+    out["project"] = root.string();
+    out["iterations"] = options.iterations;
+    out["workers"] = JobSystem::GetWorkerCount();
+    
+    if (!generatedRoot.empty() && !options.keep) {
+        std::error_code ec;
+        std::filesystem::remove_all(generatedRoot, ec);
+    }
+    return ok;
+}
+
+bool RunCommand(const Options& options, Json& out) {
+    if (options.command == "bench") {
+        return RunBench(options, out);
+    }
+    
+    size_t required = (options.command == "package" || options.command == "import") ? 2 : 1;
+    if (options.positional.size() < required) {
+        PrintUsage();
+        return false;
+    }
+    
+    std::shared_ptr<Project> project = LoadProject(options.positional[0]);
+    if (!project) {
+        return false;
+    }
+    out["project"] = project->GetProjectPath();
+    
+    if (options.command == "package") {
+        return PackageAssets(*project, options.positional[1], out);
+    }
+    
+    FileSystemManager manager;
+    Json open;
+    if (!OpenProject(manager, project, open)) {
+        out["open"] = std::move(open);
+        return false;
+    }
+    out["open"] = std::move(open);
+    
+    bool ok = true;
+    if (options.command == "scan") {
+        if (options.full) {
+            Clock::time_point start = Clock::now();
+            manager.ScanAssets();
+            out["fullScanMs"] = MillisecondsSince(start);
+            out["assets"] = manager.GetAssetRegistry()->GetAssetCount();
+        }
+    } else if (options.command == "import") {
+        std::vector<std::string> inputs(options.positional.begin() + 1, options.positional.end());
+        ok = ImportSources(manager, inputs, out);
+    } else if (options.command == "validate") {
+        ok = ValidateAssets(manager, true, out);
+    }
+    
+    Json closed;
+    CloseProject(manager, closed);
+    out["saveMs"] = closed["saveMs"];
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 2;
+    }
+    const char* commands[] = { "scan", "import", "validate", "package", "bench" };
+    if (std::find_if(std::begin(commands), std::end(commands), [&](const char* name) { return options.command == name; }) == std::end(commands)) {
+        std::fprintf(stderr, "Unknown command: %s\n", options.command.c_str());
+        PrintUsage();
+        return 2;
+    }
+    
+    // Keep stdout for the JSON report
+    Log::SetConsoleOutput(false);
+    Log::SetLevel(options.verbose ? LogLevel::Info : LogLevel::Warn);
+    Log::RegisterCallback([](LogLevel level, const std::string& message) {
+        const char* prefix = level >= LogLevel::Error ? "error" : level == LogLevel::Warn ? "warning" : "info";
+        std::fprintf(stderr, "[%s] %s\n", prefix, message.c_str());
+    });
+    JobSystem::Initialize();
+    
+    Json report;
+    report["command"] = options.command;
+    Clock::time_point start = Clock::now();
+    bool ok = RunCommand(options, report);
+    report["totalMs"] = MillisecondsSince(start);
+    report["ok"] = ok;
+    
+    AsyncFileIO::Get().Shutdown();
+    JobSystem::Shutdown();
+    Log::Flush();
+    
+    std::string text = report.dump(2) + "\n";
+    if (options.output.empty()) {
+        std::fputs(text.c_str(), stdout);
+    } else {
+        std::ofstream file(options.output, std::ios::binary);
+        file << text;
+        if (!file) {
+            std::fprintf(stderr, "Failed to write report: %s\n", options.output.c_str());
+            return 1;
+        }
+    }
+    Log::Shutdown();
+    return ok ? 0 : 1;
+}